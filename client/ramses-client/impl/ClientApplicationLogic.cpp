@@ -93,6 +93,17 @@ namespace ramses_internal
         return m_resourceComponent->manageResource(*resource);
     }
 
+    ManagedResourceVector ClientApplicationLogic::addResourcesLoadedFromFile(std::vector<std::unique_ptr<IResource>> resources)
+    {
+        ManagedResourceVector result;
+        result.reserve(resources.size());
+        PlatformGuard guard(m_frameworkLock);
+        // same as loaded on demand by resource component: can be dropped when unused and loaded again from file
+        for (auto& resource : resources)
+            result.push_back(m_resourceComponent->manageResource(*resource.release(), true));
+        return result;
+    }
+
     ramses_internal::ManagedResource ClientApplicationLogic::getResource(ResourceContentHash hash) const
     {
         PlatformGuard guard(m_frameworkLock);
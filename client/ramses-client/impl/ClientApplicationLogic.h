@@ -21,6 +21,8 @@
 #include "Collections/Guid.h"
 #include "PlatformAbstraction/PlatformLock.h"
 #include "SceneReferencing/SceneReferenceEvent.h"
+#include <memory>
+#include <vector>
 
 namespace ramses
 {
@@ -59,6 +61,7 @@ namespace ramses_internal
 
         // Resource handling
         ManagedResource         addResource(const IResource* resource);
+        ManagedResourceVector   addResourcesLoadedFromFile(std::vector<std::unique_ptr<IResource>> resources);
         ManagedResource         getResource(ResourceContentHash hash) const;
         ManagedResource         loadResource(const ResourceContentHash& hash) const;
         ResourceHashUsage       getHashUsage(const ResourceContentHash& hash) const;
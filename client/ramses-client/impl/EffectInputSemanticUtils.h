@@ -93,6 +93,8 @@ namespace ramses
                 return ramses_internal::EFixedSemantics::TextPositionsAttribute;
             case EEffectAttributeSemantic::TextTextureCoordinates:
                 return ramses_internal::EFixedSemantics::TextTextureCoordinatesAttribute;
+            case EEffectAttributeSemantic::VertexPositions:
+                return ramses_internal::EFixedSemantics::VertexPositionsAttribute;
             case EEffectAttributeSemantic::Invalid:
                 return ramses_internal::EFixedSemantics::Invalid;
             }
@@ -109,6 +111,8 @@ namespace ramses
                 return EEffectAttributeSemantic::TextPositions;
             case ramses_internal::EFixedSemantics::TextTextureCoordinatesAttribute:
                 return EEffectAttributeSemantic::TextTextureCoordinates;
+            case ramses_internal::EFixedSemantics::VertexPositionsAttribute:
+                return EEffectAttributeSemantic::VertexPositions;
             default:
                 return EEffectAttributeSemantic::Invalid;
             }
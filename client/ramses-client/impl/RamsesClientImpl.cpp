@@ -26,14 +26,16 @@
 
 // framework
 #include "SceneAPI/SceneCreationInformation.h"
+#include "SceneUtils/ResourceUtils.h"
 #include "Scene/ScenePersistation.h"
 #include "Scene/ClientScene.h"
 #include "Components/ResourcePersistation.h"
 #include "Components/ManagedResource.h"
 #include "Components/ResourceTableOfContents.h"
-#include "Components/FileInputStreamContainer.h"
+#include "Components/MemoryMappedFileInputStreamContainer.h"
 #include "Components/MemoryInputStreamContainer.h"
 #include "Components/OffsetFileInputStreamContainer.h"
+#include "Components/ResourceFilePrefetcher.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Resource/IResource.h"
 #include "ClientCommands/PrintSceneList.h"
@@ -59,12 +61,13 @@
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
 #include "Resource/TextureResource.h"
-#include "glslEffectBlock/GlslEffect.h"
+#include "glslEffectBlock/GlslEffectCache.h"
 #include "EffectDescriptionImpl.h"
 #include "TextureUtils.h"
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include <array>
+#include <thread>
 
 namespace ramses
 {
@@ -95,6 +98,7 @@ namespace ramses
         framework.getRamsh().add(m_cmdDumpSceneToFile);
         framework.getRamsh().add(m_cmdLogResourceMemoryUsage);
         m_framework.getPeriodicLogger().registerPeriodicLogSupplier(&m_framework.getScenegraphComponent());
+        m_framework.getPeriodicLogger().registerPeriodicLogSupplier(&ramses_internal::GlslEffectCache::GetInstance());
     }
 
     RamsesClientImpl::~RamsesClientImpl()
@@ -116,6 +120,7 @@ namespace ramses
         }
 
         m_framework.getPeriodicLogger().removePeriodicLogSupplier(&m_framework.getScenegraphComponent());
+        m_framework.getPeriodicLogger().removePeriodicLogSupplier(&ramses_internal::GlslEffectCache::GetInstance());
     }
 
     void RamsesClientImpl::setHLObject(RamsesClient* hlClient)
@@ -302,7 +307,7 @@ namespace ramses
         return new Scene(pimpl);
     }
 
-    Scene* RamsesClientImpl::loadSceneFromCreationConfig(const SceneCreationConfig& cconfig)
+    Scene* RamsesClientImpl::loadSceneFromCreationConfig(const SceneCreationConfig& cconfig, bool prefetchResources)
     {
         // this stream contains scene data AND resource data and will be handed over to and held open by resource component as resource stream
         ramses_internal::IInputStream& inputStream = cconfig.streamContainer->getStream();
@@ -323,6 +328,26 @@ namespace ramses
         inputStream >> sceneObjectStart;
         inputStream >> llResourceStart;
 
+        ramses_internal::ResourceTableOfContents loadedTOC;
+        std::unique_ptr<ramses_internal::ResourceFilePrefetcher> resourcePrefetcher;
+        const auto mappedFile = cconfig.streamContainer->getMappedFile();
+        if (prefetchResources && mappedFile)
+        {
+            // table of contents is stored behind scene, read it first so that workers load resources while scene is loaded
+            size_t scenePos = 0;
+            inputStream.getPos(scenePos);
+            inputStream.seek(static_cast<ramses_internal::Int>(llResourceStart), ramses_internal::IInputStream::Seek::FromBeginning);
+            loadedTOC.readTOCPosAndTOCFromStream(inputStream);
+            inputStream.seek(static_cast<ramses_internal::Int>(scenePos), ramses_internal::IInputStream::Seek::FromBeginning);
+            if (inputStream.getState() != ramses_internal::EStatus::Ok)
+            {
+                LOG_ERROR_P(ramses_internal::CONTEXT_CLIENT, "RamsesClient::{}: Failed reading resource table of contents from file: {} ", cconfig.caller, inputStream.getState());
+                return nullptr;
+            }
+            resourcePrefetcher = startResourcePrefetch(cconfig, mappedFile, loadedTOC);
+        }
+
+        const ramses_internal::UInt64 sceneStart = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
         Scene* scene = nullptr;
         if (cconfig.prefetchData)
         {
@@ -349,18 +374,65 @@ namespace ramses
             return nullptr;
         }
 
+        const ramses_internal::UInt64 sceneEnd = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+        LOG_INFO_P(CONTEXT_CLIENT, "RamsesClient::{}: Loaded scene objects from '{}' in {} ms", cconfig.caller, cconfig.dataSource, sceneEnd - sceneStart);
+
         // calls on m_appLogic are thread safe
         // register stream for on-demand resource loading (LL-Resources)
-        ramses_internal::ResourceTableOfContents loadedTOC;
-        loadedTOC.readTOCPosAndTOCFromStream(inputStream);
+        if (!resourcePrefetcher)
+            loadedTOC.readTOCPosAndTOCFromStream(inputStream);
         const ramses_internal::SceneFileHandle fileHandle = m_appLogic.addResourceFile(cconfig.streamContainer, loadedTOC);
         scene->impl.setSceneFileHandle(fileHandle);
 
+        if (resourcePrefetcher)
+        {
+            // only resources needed by first flush are kept, others stay in file until used
+            ramses_internal::ResourceContentHashVector usedResources;
+            ramses_internal::ResourceUtils::GetAllResourcesFromScene(usedResources, scene->impl.getIScene());
+            resourcePrefetcher->keepOnly(usedResources);
+
+            // scene takes over resources not later than on its first flush, loading does not wait for them
+            scene->impl.setResourcePrefetcher(std::move(resourcePrefetcher));
+        }
+
         LOG_INFO_P(CONTEXT_CLIENT, "RamsesClient::{}: Source '{}' has handle {}", cconfig.caller, cconfig.dataSource, fileHandle);
 
         return scene;
     }
 
+    std::unique_ptr<ramses_internal::ResourceFilePrefetcher> RamsesClientImpl::startResourcePrefetch(const SceneCreationConfig& cconfig,
+        std::shared_ptr<const ramses_internal::MemoryMappedFile> mappedFile, const ramses_internal::ResourceTableOfContents& toc)
+    {
+        // used resources are known only after scene is loaded, all are started and unused ones dropped then
+        std::vector<ramses_internal::ResourceFileEntry> entriesToLoad;
+        entriesToLoad.reserve(toc.getFileContents().size());
+        for (const auto& item : toc.getFileContents())
+        {
+            // resource might be in use already, e.g. by other scene loaded from same resources
+            if (!m_appLogic.getResource(item.key))
+                entriesToLoad.push_back(item.value);
+        }
+        if (entriesToLoad.empty())
+            return {};
+
+        // local only scene resources are never sent over network, where compressed data is used, so they can be decompressed
+        // here already instead of in renderer
+        const size_t entriesToLoadCount = entriesToLoad.size();
+        auto resourcePrefetcher = std::make_unique<ramses_internal::ResourceFilePrefetcher>(std::move(mappedFile), std::move(entriesToLoad), cconfig.localOnly);
+        const ramses_internal::UInt32 workerCount = resourcePrefetcher->start(m_loadFromFileTaskQueue, GetResourcePrefetchWorkerCount());
+        LOG_INFO_P(CONTEXT_CLIENT, "RamsesClient::{}: Loading {} of {} resources from '{}' in {} worker tasks while scene is loaded",
+            cconfig.caller, entriesToLoadCount, toc.getFileContents().size(), cconfig.dataSource, workerCount);
+
+        return resourcePrefetcher;
+    }
+
+    ramses_internal::UInt32 RamsesClientImpl::GetResourcePrefetchWorkerCount()
+    {
+        // application thread keeps one core busy, there is no gain from more workers than remaining cores
+        const ramses_internal::UInt32 coreCount = std::thread::hardware_concurrency();
+        return std::min(MaxResourcePrefetchWorkerCount, coreCount > 1u ? coreCount - 1u : 1u);
+    }
+
     Scene* RamsesClientImpl::loadSceneFromFile(const char* fileName, bool localOnly)
     {
         const std::string stdFilename(fileName ? fileName : "");
@@ -373,7 +445,7 @@ namespace ramses
         return loadSceneSynchonousCommon({
                 "loadSceneFromFile",
                 stdFilename,
-                std::make_shared<ramses_internal::FileInputStreamContainer>(ramses_internal::String(std::move(stdFilename))),
+                ramses_internal::MemoryMappedFileInputStreamContainer::Create(ramses_internal::String(std::move(stdFilename))),
                 true,
                 localOnly,
                 sceneId_t(),
@@ -512,7 +584,7 @@ namespace ramses
             new LoadSceneRunnable(*this, SceneCreationConfig{
                     "loadSceneFromFileAsync",
                     stdFilename,
-                    std::make_shared<ramses_internal::FileInputStreamContainer>(ramses_internal::String(std::move(stdFilename))),
+                    ramses_internal::MemoryMappedFileInputStreamContainer::Create(ramses_internal::String(std::move(stdFilename))),
                     true,
                     localOnly,
                     sceneId_t()
@@ -522,6 +594,37 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesClientImpl::loadEffectCompilationCache(const char* fileName)
+    {
+        if (!fileName || fileName[0] == '\0')
+            return addErrorEntry("RamsesClient::loadEffectCompilationCache: filename may not be empty");
+
+        if (!ramses_internal::GlslEffectCache::GetInstance().loadFromFile(fileName))
+            return addErrorEntry("RamsesClient::loadEffectCompilationCache: failed to load effect compilation cache");
+
+        return StatusOK;
+    }
+
+    status_t RamsesClientImpl::saveEffectCompilationCache(const char* fileName) const
+    {
+        if (!fileName || fileName[0] == '\0')
+            return addErrorEntry("RamsesClient::saveEffectCompilationCache: filename may not be empty");
+
+        const auto& cache = ramses_internal::GlslEffectCache::GetInstance();
+        if (!cache.saveToFile(fileName))
+            return addErrorEntry("RamsesClient::saveEffectCompilationCache: failed to save effect compilation cache");
+
+        LOG_INFO_P(ramses_internal::CONTEXT_CLIENT, "RamsesClient::saveEffectCompilationCache: saved {} effects to {} ({} hits, {} misses)",
+            cache.getNumEntries(), fileName, cache.getNumHits(), cache.getNumMisses());
+        return StatusOK;
+    }
+
+    status_t RamsesClientImpl::setEffectCompilationCacheMaxSize(uint32_t maxSizeInBytes)
+    {
+        ramses_internal::GlslEffectCache::GetInstance().setMaxSize(maxSizeInBytes);
+        return StatusOK;
+    }
+
     SceneReference* RamsesClientImpl::findSceneReference(sceneId_t masterSceneId, sceneId_t referencedSceneId)
     {
         for (auto const& scene : getListOfScenes())
@@ -615,7 +718,7 @@ namespace ramses
     void RamsesClientImpl::LoadSceneRunnable::execute()
     {
         const ramses_internal::UInt64 start = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
-        Scene* scene = m_client.loadSceneFromCreationConfig(m_cconfig);
+        Scene* scene = m_client.loadSceneFromCreationConfig(m_cconfig, true);
         const ramses_internal::UInt64 end = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
 
         if (scene)
@@ -805,14 +908,14 @@ namespace ramses
     {
         //create effect using vertex and fragment shaders
         ramses_internal::String effectName(name);
-        ramses_internal::GlslEffect effectBlock(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.getGeometryShader(), effectDesc.impl.getCompilerDefines(),
-            effectDesc.impl.getSemanticsMap(), effectName);
+        ramses_internal::String effectErrorMessages;
         errorMessages.clear();
-        ramses_internal::EffectResource* effectResource = effectBlock.createEffectResource(ramses_internal::ResourceCacheFlag(cacheFlag.getValue()));
+        ramses_internal::EffectResource* effectResource = ramses_internal::GlslEffectCache::GetInstance().createEffectResource(effectDesc.getVertexShader(), effectDesc.getFragmentShader(),
+            effectDesc.getGeometryShader(), effectDesc.impl.getCompilerDefines(), effectDesc.impl.getSemanticsMap(), effectName, ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), effectErrorMessages);
         if (!effectResource)
         {
-            errorMessages = effectBlock.getEffectErrorMessages().stdRef();
-            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createEffect  Failed to create effect resource (name: '" << effectName << "') :\n    " << effectBlock.getEffectErrorMessages());
+            errorMessages = effectErrorMessages.stdRef();
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createEffect  Failed to create effect resource (name: '" << effectName << "') :\n    " << effectErrorMessages);
             return {};
         }
         return manageResource(effectResource);
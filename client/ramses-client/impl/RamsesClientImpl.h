@@ -51,6 +51,9 @@ namespace ramses_internal
     class BinaryFileOutputStream;
     class BinaryFileInputStream;
     class ClientScene;
+    class MemoryMappedFile;
+    class ResourceTableOfContents;
+    class ResourceFilePrefetcher;
 }
 
 namespace ramses
@@ -106,6 +109,9 @@ namespace ramses
         Scene* loadSceneFromFileDescriptor(sceneId_t sceneId, int fd, size_t offset, size_t length, bool localOnly);
 
         status_t loadSceneFromFileAsync(const char* fileName, bool localOnly);
+        status_t loadEffectCompilationCache(const char* fileName);
+        status_t saveEffectCompilationCache(const char* fileName) const;
+        status_t setEffectCompilationCacheMaxSize(uint32_t maxSizeInBytes);
 
         status_t dispatchEvents(IClientEventHandler& clientEventHandler);
 
@@ -146,6 +152,10 @@ namespace ramses
         friend class ClientFactory;
         RamsesClientImpl(RamsesFrameworkImpl& ramsesFramework, const char* applicationName);
 
+        // leaves one framework task queue thread for other tasks, e.g. loading next scene
+        static constexpr ramses_internal::UInt32 MaxResourcePrefetchWorkerCount = 2u;
+        static ramses_internal::UInt32 GetResourcePrefetchWorkerCount();
+
         struct SceneCreationConfig
         {
             std::string caller;
@@ -189,7 +199,11 @@ namespace ramses
         ramses_internal::ManagedResource manageResource(const ramses_internal::IResource* res);
 
         Scene* loadSceneSynchonousCommon(const SceneCreationConfig& cconf);
-        Scene* loadSceneFromCreationConfig(const SceneCreationConfig& cconf);
+        // Resources are prefetched only if requested (async loading) and file is memory mapped, they are decompressed
+        // only for local only scenes, others keep compressed data for sending it to renderer
+        Scene* loadSceneFromCreationConfig(const SceneCreationConfig& cconf, bool prefetchResources = false);
+        std::unique_ptr<ramses_internal::ResourceFilePrefetcher> startResourcePrefetch(const SceneCreationConfig& cconfig,
+            std::shared_ptr<const ramses_internal::MemoryMappedFile> mappedFile, const ramses_internal::ResourceTableOfContents& toc);
         Scene* loadSceneObjectFromStream(const std::string& caller,
                                          std::string const& filename,
                                          ramses_internal::IInputStream& inputStream,
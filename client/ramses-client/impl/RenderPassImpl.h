@@ -74,6 +74,8 @@ namespace ramses
         status_t setRenderOnce(bool enable);
         bool     isRenderOnce() const;
         status_t retriggerRenderOnce();
+        status_t setFrustumCullingEnabled(bool enable);
+        bool     isFrustumCullingEnabled() const;
 
         ramses_internal::RenderPassHandle getRenderPassHandle() const;
 
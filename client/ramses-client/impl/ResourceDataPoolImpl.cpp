@@ -22,7 +22,8 @@
 #include "RamsesClientImpl.h"
 #include "ResourceImpl.h"
 #include "RamsesClientTypesImpl.h"
-#include "Components/FileInputStreamContainer.h"
+#include "Components/MemoryMappedFileInputStreamContainer.h"
+#include "Utils/MemoryMappedFile.h"
 
 namespace ramses
 {
@@ -117,7 +118,7 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::InputStreamContainerSPtr resourceFileStream = std::make_shared<ramses_internal::FileInputStreamContainer>(ramses_internal::String(filename));
+        ramses_internal::InputStreamContainerSPtr resourceFileStream = ramses_internal::MemoryMappedFileInputStreamContainer::Create(ramses_internal::String(filename));
         ramses_internal::IInputStream& inputStream = resourceFileStream->getStream();
         if (inputStream.getState() != ramses_internal::EStatus::Ok)
         {
@@ -231,7 +232,11 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::File resourceDataFileOut(filename.c_str());
+        // file in use by a loaded scene is replaced instead of truncated, its mapping keeps referring to old contents
+        const bool replaceMappedFile = ramses_internal::MemoryMappedFile::IsFileMapped(filename.c_str());
+        const std::string writeFilename = replaceMappedFile ? filename + ".tmp" : filename;
+
+        ramses_internal::File resourceDataFileOut(writeFilename.c_str());
         ramses_internal::BinaryFileOutputStream resourceDataFileOutStream(resourceDataFileOut);
         if (!resourceDataFileOut.isOpen())
         {
@@ -323,6 +328,12 @@ namespace ramses
             return false;
         }
 
+        if (replaceMappedFile && !resourceDataFileOut.renameTo(filename.c_str()))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "ResourceDataPool::saveResourceDataFile: Could not replace file '" << filename << "' in use by a loaded scene");
+            return false;
+        }
+
         return true;
     }
 
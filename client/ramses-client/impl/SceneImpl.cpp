@@ -113,7 +113,9 @@
 #include "Components/FlushTimeInformation.h"
 #include "Components/EffectUniformTime.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "PlatformAbstraction/PlatformTime.h"
 #include "Utils/TextureMathUtils.h"
+#include "Utils/MemoryMappedFile.h"
 #include "ResourceDataPoolImpl.h"
 #include "Components/FlushTimeInformation.h"
 #include "fmt/format.h"
@@ -1500,6 +1502,9 @@ namespace ramses
         const ramses_internal::FlushTimeInformation flushTimeInfo { m_expirationTimestamp, timestampOfFlushCall, ramses_internal::FlushTime::Clock::getClockType(), m_sendEffectTimeSync };
         m_sendEffectTimeSync          = false;
 
+        // keeps prefetched resources in memory until flush takes its own references
+        const ramses_internal::ManagedResourceVector prefetchedResources = takePrefetchedResources();
+
         if (!getClientImpl().getClientApplication().flush(m_scene.getSceneId(), flushTimeInfo, sceneVersionInternal))
             return addErrorEntry("Scene::flush: Flushing scene failed, consult logs for more details.");
         getStatisticCollection().statFlushesTriggered.incCounter(1);
@@ -2089,23 +2094,31 @@ namespace ramses
         return nullptr;
     }
 
-    status_t SceneImpl::writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream) const
+    status_t SceneImpl::writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream, bool asSnapshot) const
     {
         ramses_internal::ScenePersistation::WriteSceneMetadataToStream(outputStream, getIScene());
-        ramses_internal::ScenePersistation::WriteSceneToStream(outputStream, getIScene());
+        if (asSnapshot)
+            ramses_internal::ScenePersistation::WriteSceneSnapshotToStream(outputStream, getIScene());
+        else
+            ramses_internal::ScenePersistation::WriteSceneToStream(outputStream, getIScene());
 
         SerializationContext serializationContext;
         return serialize(outputStream, serializationContext);
     }
 
-    status_t SceneImpl::saveToFile(const char* fileName, bool compress) const
+    status_t SceneImpl::saveToFile(const char* fileName, bool compress, bool asSnapshot) const
     {
         if (fileName == nullptr)
             return addErrorEntry("Scene::saveToFile failed, filename was null");
 
-        LOG_INFO_P(CONTEXT_CLIENT, "Scene::saveToFile: filename '{}', compress {}", fileName, compress);
+        LOG_INFO_P(CONTEXT_CLIENT, "Scene::saveToFile: filename '{}', compress {}, snapshot {}", fileName, compress, asSnapshot);
+
+        // resources of loaded scenes refer to mapped file contents, truncating file would invalidate them,
+        // mapped file is replaced by a new one instead, existing mapping keeps referring to old contents
+        const bool replaceMappedFile = ramses_internal::MemoryMappedFile::IsFileMapped(fileName);
+        const std::string writeFileName = replaceMappedFile ? std::string(fileName) + ".tmp" : std::string(fileName);
 
-        ramses_internal::File outputFile(fileName);
+        ramses_internal::File outputFile(writeFileName.c_str());
         ramses_internal::BinaryFileOutputStream outputStream(outputFile);
         if (!outputFile.isOpen())
             return addErrorEntry(fmt::format("Scene::saveToFile failed, could not open file for writing: '{}'", fileName));
@@ -2123,7 +2136,7 @@ namespace ramses
         if (!outputFile.seek(static_cast<ramses_internal::Int>(offsetSceneObjectsStart), ramses_internal::File::SeekOrigin::BeginningOfFile))
             return addErrorEntry(fmt::format("Scene::saveToFile failed, error seeking file: '{}'", fileName));
 
-        const status_t status = writeSceneObjectsToStream(outputStream);
+        const status_t status = writeSceneObjectsToStream(outputStream, asSnapshot);
 
         ramses_internal::UInt offsetLLResourcesStart = 0;
         if (!outputFile.getPos(offsetLLResourcesStart))
@@ -2144,6 +2157,9 @@ namespace ramses
         if (!outputFile.close())
             return addErrorEntry(fmt::format("Scene::saveToFile failed, close file failed: '{}'", fileName));
 
+        if (replaceMappedFile && !outputFile.renameTo(fileName))
+            return addErrorEntry(fmt::format("Scene::saveToFile failed, could not replace file in use by a loaded scene: '{}'", fileName));
+
         LOG_INFO_P(ramses_internal::CONTEXT_CLIENT, "Scene::saveToFile: done writing '{}'", fileName);
 
         return status;
@@ -2166,6 +2182,9 @@ namespace ramses
 
     void SceneImpl::closeSceneFile()
     {
+        // workers still running stop after their current resource
+        m_resourcePrefetcher.reset();
+
         if (!m_sceneFileHandle.isValid())
             return;
 
@@ -2179,6 +2198,29 @@ namespace ramses
         return m_sceneFileHandle;
     }
 
+    void SceneImpl::setResourcePrefetcher(std::unique_ptr<ramses_internal::ResourceFilePrefetcher> prefetcher)
+    {
+        m_resourcePrefetcher = std::move(prefetcher);
+    }
+
+    ramses_internal::ManagedResourceVector SceneImpl::takePrefetchedResources()
+    {
+        if (!m_resourcePrefetcher)
+            return {};
+
+        // loads resources not taken by workers yet on this thread
+        const ramses_internal::UInt64 waitStart = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+        auto resources = m_resourcePrefetcher->finish();
+        const auto stats = m_resourcePrefetcher->getStatistics();
+        m_resourcePrefetcher.reset();
+        auto managedResources = getClientImpl().getClientApplication().addResourcesLoadedFromFile(std::move(resources));
+
+        const ramses_internal::UInt64 waitEnd = ramses_internal::PlatformTime::GetMillisecondsMonotonic();
+        LOG_INFO_P(CONTEXT_CLIENT, "Scene({})::flush: Took over resources loaded ahead from scene file after waiting {} ms: {} loaded ({} by workers, {} bytes), {} failed",
+            getSceneId(), waitEnd - waitStart, stats.loadedCount, stats.loadedByWorkersCount, stats.loadedBytes, stats.failedCount);
+        return managedResources;
+    }
+
     bool SceneImpl::removeResourceWithIdFromResources(resourceId_t const& id, Resource& resource)
     {
         auto range = m_resources.equal_range(id);
@@ -34,11 +34,13 @@
 #include "AnimationAPI/IAnimationSystem.h"
 #include "Resource/ResourceTypes.h"
 #include "Components/ManagedResource.h"
+#include "Components/ResourceFilePrefetcher.h"
 
 #include "Collections/Pair.h"
 #include "Utils/StatisticCollection.h"
 #include "RamsesFrameworkTypesImpl.h"
 #include <chrono>
+#include <memory>
 #include <unordered_map>
 
 namespace ramses_internal
@@ -123,7 +125,7 @@ namespace ramses
         sceneId_t           getSceneId() const;
         EScenePublicationMode getPublicationModeSetFromSceneConfig() const;
 
-        status_t saveToFile(const char* fileName, bool compress) const;
+        status_t saveToFile(const char* fileName, bool compress, bool asSnapshot = false) const;
         bool saveResources(std::string const& fileName, bool compress) const;
 
         PerspectiveCamera*  createPerspectiveCamera(const char* name);
@@ -298,6 +300,8 @@ namespace ramses
         void setSceneFileHandle(ramses_internal::SceneFileHandle handle);
         void closeSceneFile();
         ramses_internal::SceneFileHandle getSceneFileHandle() const;
+        // resources being loaded ahead from scene file are taken over by first flush, which would load them anyway
+        void setResourcePrefetcher(std::unique_ptr<ramses_internal::ResourceFilePrefetcher> prefetcher);
 
         void updateResourceId(resourceId_t const& oldId, Resource& resourceWithNewId);
 
@@ -351,8 +355,9 @@ namespace ramses
         void applyVisibilityToSubtree(NodeImpl& initialNode, EVisibilityMode initialVisibility);
         void prepareListOfDirtyNodesForHierarchicalVisibility(NodeVisibilityInfoVector& nodesToProcess);
         void applyHierarchicalVisibility();
+        ramses_internal::ManagedResourceVector takePrefetchedResources();
 
-        status_t writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream) const;
+        status_t writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream, bool asSnapshot = false) const;
 
         bool removeResourceWithIdFromResources(resourceId_t const& id, Resource& resource);
 
@@ -378,6 +383,7 @@ namespace ramses
         std::string m_effectErrorMessages;
 
         ramses_internal::SceneFileHandle m_sceneFileHandle;
+        std::unique_ptr<ramses_internal::ResourceFilePrefetcher> m_resourcePrefetcher;
 
         bool m_sendEffectTimeSync = false;
     };
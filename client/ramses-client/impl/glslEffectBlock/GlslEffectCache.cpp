@@ -0,0 +1,339 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "glslEffectBlock/GlslEffectCache.h"
+#include "glslEffectBlock/GlslEffect.h"
+#include "Resource/EffectResource.h"
+#include "Utils/File.h"
+#include "Utils/LogMacros.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "Utils/BinaryOutputStream.h"
+#include "ramses-sdk-build-config.h"
+#include "city.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // increase when layout of file or entries changes
+        const uint32_t FileFormatVersion = 1u;
+
+        void WriteInputVector(IOutputStream& stream, const EffectInputInformationVector& inputVector)
+        {
+            stream << static_cast<UInt32>(inputVector.size());
+            for (const auto& input : inputVector)
+                stream << input.inputName << input.elementCount << input.dataType << input.semantics;
+        }
+
+        void ReadInputVector(IInputStream& stream, EffectInputInformationVector& inputVector)
+        {
+            UInt32 length = 0u;
+            stream >> length;
+            inputVector.resize(length);
+            for (auto& input : inputVector)
+                stream >> input.inputName >> input.elementCount >> input.dataType >> input.semantics;
+        }
+    }
+
+    GlslEffectCache& GlslEffectCache::GetInstance()
+    {
+        static GlslEffectCache instance;
+        return instance;
+    }
+
+    constexpr UInt64 GlslEffectCache::DefaultMaxSizeInBytes;
+
+    EffectResource* GlslEffectCache::createEffectResource(const String& vertexShader,
+        const String& fragmentShader,
+        const String& geometryShader,
+        const std::vector<String>& compilerDefines,
+        const HashMap<String, EFixedSemantics>& semanticInputs,
+        const String& name,
+        ResourceCacheFlag cacheFlag,
+        String& errorMessages)
+    {
+        const ResourceContentHash key = CreateKey(vertexShader, fragmentShader, geometryShader, compilerDefines, semanticInputs);
+        {
+            std::lock_guard<std::mutex> g(m_lock);
+            const auto it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                ++m_numHits;
+                const Entry& entry = it->value;
+                m_usageOrder.splice(m_usageOrder.begin(), m_usageOrder, entry.usagePosition);
+                return new EffectResource(entry.vertexShader, entry.fragmentShader, entry.geometryShader, entry.geometryShaderInputType,
+                    entry.uniformInputs, entry.attributeInputs, name, cacheFlag);
+            }
+            ++m_numMisses;
+        }
+
+        // compile without holding lock, same effect created concurrently is compiled twice and stored once
+        GlslEffect effectBlock(vertexShader, fragmentShader, geometryShader, compilerDefines, semanticInputs, name);
+        EffectResource* effectResource = effectBlock.createEffectResource(cacheFlag);
+        if (!effectResource)
+        {
+            errorMessages = effectBlock.getEffectErrorMessages();
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> g(m_lock);
+        if (m_maxSize > 0u && !m_entries.contains(key))
+        {
+            Entry entry{ effectResource->getVertexShader(), effectResource->getFragmentShader(), effectResource->getGeometryShader(),
+                effectResource->getGeometryShaderInputType(), effectResource->getUniformInputs(), effectResource->getAttributeInputs() };
+            addEntry(key, std::move(entry));
+            evictEntriesAboveMaxSize();
+        }
+
+        return effectResource;
+    }
+
+    void GlslEffectCache::addEntry(const ResourceContentHash& key, Entry&& entry)
+    {
+        entry.sizeInBytes = GetEntrySize(entry);
+        m_usageOrder.push_front(key);
+        entry.usagePosition = m_usageOrder.begin();
+        m_size += entry.sizeInBytes;
+        m_entries.put(key, std::move(entry));
+    }
+
+    void GlslEffectCache::evictEntriesAboveMaxSize()
+    {
+        while (m_size > m_maxSize)
+        {
+            assert(!m_usageOrder.empty());
+            const auto it = m_entries.find(m_usageOrder.back());
+            assert(it != m_entries.end());
+            m_size -= it->value.sizeInBytes;
+            m_entries.remove(it);
+            m_usageOrder.pop_back();
+        }
+    }
+
+    UInt64 GlslEffectCache::GetEntrySize(const Entry& entry)
+    {
+        UInt64 size = sizeof(Entry) + entry.vertexShader.size() + entry.fragmentShader.size() + entry.geometryShader.size();
+        for (const auto* inputs : { &entry.uniformInputs, &entry.attributeInputs })
+        {
+            for (const auto& input : *inputs)
+                size += sizeof(input) + input.inputName.size();
+        }
+        return size;
+    }
+
+    ResourceContentHash GlslEffectCache::CreateKey(const String& vertexShader,
+        const String& fragmentShader,
+        const String& geometryShader,
+        const std::vector<String>& compilerDefines,
+        const HashMap<String, EFixedSemantics>& semanticInputs)
+    {
+        std::vector<std::pair<String, EFixedSemantics>> sortedSemantics;
+        sortedSemantics.reserve(semanticInputs.size());
+        for (const auto& semantic : semanticInputs)
+            sortedSemantics.emplace_back(semantic.key, semantic.value);
+        std::sort(sortedSemantics.begin(), sortedSemantics.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        BinaryOutputStream keyStream(vertexShader.size() + fragmentShader.size() + geometryShader.size() + 1024u);
+        keyStream << vertexShader << fragmentShader << geometryShader;
+        keyStream << static_cast<UInt32>(compilerDefines.size());
+        for (const auto& define : compilerDefines)
+            keyStream << define;
+        keyStream << static_cast<UInt32>(sortedSemantics.size());
+        for (const auto& semantic : sortedSemantics)
+            keyStream << semantic.first << semantic.second;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        const cityhash::uint128 hash = cityhash::CityHash128(reinterpret_cast<const char*>(keyStream.getData()), keyStream.getSize());
+        return ResourceContentHash(cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash));
+    }
+
+    bool GlslEffectCache::loadFromFile(const String& filePath)
+    {
+        File file(filePath);
+        if (!file.exists())
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: file does not exist: " << filePath);
+            return false;
+        }
+
+        UInt actualSize = 0;
+        if (!file.getSizeInBytes(actualSize) || actualSize < sizeof(FileHeader))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: Invalid file size: " << filePath);
+            return false;
+        }
+
+        BinaryFileInputStream fileInputStream(file);
+        if (EStatus::Ok != fileInputStream.getState())
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: failed to load file: " << filePath << " errorstate: " << fileInputStream.getState());
+            return false;
+        }
+
+        FileHeader fileHeader;
+        fileInputStream >> fileHeader.fileSize >> fileHeader.fileFormatVersion >> fileHeader.checksum;
+        if (actualSize != fileHeader.fileSize || fileHeader.fileFormatVersion != FileFormatVersion)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: File is corrupt or has unsupported format version " << fileHeader.fileFormatVersion << ": " << filePath);
+            return false;
+        }
+
+        const uint32_t contentSize = fileHeader.fileSize - sizeof(FileHeader);
+        std::vector<Byte> content(contentSize);
+        fileInputStream.read(content.data(), contentSize);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        const uint64_t checksum = cityhash::CityHash64(reinterpret_cast<const char*>(content.data()), contentSize);
+        if (EStatus::Ok != fileInputStream.getState() || checksum != fileHeader.checksum)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: Checksum was wrong, file is corrupt: " << filePath);
+            return false;
+        }
+
+        BinaryInputStream inputStream(content.data());
+        String version;
+        String gitHash;
+        inputStream >> version >> gitHash;
+        // cached results depend on glslang and GlslLimits of the build which created them
+        if (version != String(::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING) || gitHash != String(::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH))
+        {
+            LOG_INFO(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: File was created by other ramses build (" << version << " " << gitHash << "), ignoring: " << filePath);
+            return false;
+        }
+
+        UInt32 numEntries = 0u;
+        inputStream >> numEntries;
+
+        std::lock_guard<std::mutex> g(m_lock);
+        // entries are stored least recently used first, so the ones used last end up in front again
+        for (UInt32 i = 0u; i < numEntries; ++i)
+        {
+            ResourceContentHash key;
+            Entry entry;
+            inputStream >> key;
+            DeserializeEntry(inputStream, entry);
+            if (m_maxSize > 0u && !m_entries.contains(key))
+                addEntry(key, std::move(entry));
+        }
+        evictEntriesAboveMaxSize();
+
+        LOG_INFO(CONTEXT_CLIENT, "GlslEffectCache::loadFromFile: loaded " << numEntries << " effects from " << filePath);
+        return true;
+    }
+
+    bool GlslEffectCache::saveToFile(const String& filePath) const
+    {
+        BinaryOutputStream outputStream;
+        outputStream << String(::ramses_sdk::RAMSES_SDK_PROJECT_VERSION_STRING) << String(::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH);
+        {
+            std::lock_guard<std::mutex> g(m_lock);
+            outputStream << static_cast<UInt32>(m_entries.size());
+            for (auto keyIt = m_usageOrder.crbegin(); keyIt != m_usageOrder.crend(); ++keyIt)
+            {
+                const auto it = m_entries.find(*keyIt);
+                assert(it != m_entries.end());
+                outputStream << it->key;
+                SerializeEntry(outputStream, it->value);
+            }
+        }
+
+        const uint32_t contentSize = static_cast<uint32_t>(outputStream.getSize());
+        FileHeader fileHeader = {};
+        fileHeader.fileSize = static_cast<uint32_t>(sizeof(FileHeader)) + contentSize;
+        fileHeader.fileFormatVersion = FileFormatVersion;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        fileHeader.checksum = cityhash::CityHash64(reinterpret_cast<const char*>(outputStream.getData()), contentSize);
+
+        File file(filePath);
+        BinaryFileOutputStream outputFileStream(file);
+        if (outputFileStream.getState() != EStatus::Ok)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "GlslEffectCache::saveToFile: failed to open " << filePath);
+            return false;
+        }
+
+        outputFileStream << fileHeader.fileSize << fileHeader.fileFormatVersion << fileHeader.checksum;
+        outputFileStream.write(outputStream.getData(), contentSize);
+        return outputFileStream.getState() == EStatus::Ok;
+    }
+
+    void GlslEffectCache::SerializeEntry(IOutputStream& stream, const Entry& entry)
+    {
+        stream << entry.vertexShader << entry.fragmentShader << entry.geometryShader;
+        stream << (entry.geometryShaderInputType ? *entry.geometryShaderInputType : EDrawMode::NUMBER_OF_ELEMENTS);
+        WriteInputVector(stream, entry.uniformInputs);
+        WriteInputVector(stream, entry.attributeInputs);
+    }
+
+    void GlslEffectCache::DeserializeEntry(IInputStream& stream, Entry& entry)
+    {
+        stream >> entry.vertexShader >> entry.fragmentShader >> entry.geometryShader;
+        EDrawMode geometryShaderInputType = EDrawMode::NUMBER_OF_ELEMENTS;
+        stream >> geometryShaderInputType;
+        if (geometryShaderInputType != EDrawMode::NUMBER_OF_ELEMENTS)
+            entry.geometryShaderInputType = geometryShaderInputType;
+        ReadInputVector(stream, entry.uniformInputs);
+        ReadInputVector(stream, entry.attributeInputs);
+    }
+
+    void GlslEffectCache::setMaxSize(UInt64 maxSizeInBytes)
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        m_maxSize = maxSizeInBytes;
+        evictEntriesAboveMaxSize();
+    }
+
+    UInt64 GlslEffectCache::getMaxSize() const
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        return m_maxSize;
+    }
+
+    UInt64 GlslEffectCache::getSize() const
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        return m_size;
+    }
+
+    UInt32 GlslEffectCache::getNumEntries() const
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        return static_cast<UInt32>(m_entries.size());
+    }
+
+    UInt32 GlslEffectCache::getNumHits() const
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        return m_numHits;
+    }
+
+    UInt32 GlslEffectCache::getNumMisses() const
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        return m_numMisses;
+    }
+
+    void GlslEffectCache::clear()
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        m_entries.clear();
+        m_usageOrder.clear();
+        m_size = 0u;
+        m_numHits = 0u;
+        m_numMisses = 0u;
+    }
+
+    void GlslEffectCache::triggerLogMessageForPeriodicLog()
+    {
+        std::lock_guard<std::mutex> g(m_lock);
+        LOG_INFO_P(CONTEXT_PERIODIC, "GlslEffectCache: {} effects, {}/{} bytes, {} hits, {} misses", m_entries.size(), m_size, m_maxSize, m_numHits, m_numMisses);
+    }
+}
@@ -0,0 +1,108 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GLSLEFFECTCACHE_H
+#define RAMSES_GLSLEFFECTCACHE_H
+
+#include "Collections/HashMap.h"
+#include "Collections/String.h"
+#include "SceneAPI/EFixedSemantics.h"
+#include "SceneAPI/RenderState.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Resource/EffectInputInformation.h"
+#include "Resource/IResource.h"
+#include "Utils/IPeriodicLogSupplier.h"
+#include "absl/types/optional.h"
+#include <list>
+#include <mutex>
+
+namespace ramses_internal
+{
+    class EffectResource;
+    class IInputStream;
+    class IOutputStream;
+
+    // Process wide cache of GlslEffect results, keyed by shader sources, compiler defines and semantic inputs.
+    // The GLSL limits profile is selected by the version directive of the sources, so it is covered by the key.
+    // Cache hits create the EffectResource from the stored inputs without invoking glslang.
+    // Size of stored entries is limited, least recently used entries are dropped first. Limit of 0 disables caching.
+    class GlslEffectCache : public IPeriodicLogSupplier
+    {
+    public:
+        static constexpr UInt64 DefaultMaxSizeInBytes = 16u * 1024u * 1024u;
+
+        static GlslEffectCache& GetInstance();
+
+        EffectResource* createEffectResource(const String& vertexShader,
+            const String& fragmentShader,
+            const String& geometryShader,
+            const std::vector<String>& compilerDefines,
+            const HashMap<String, EFixedSemantics>& semanticInputs,
+            const String& name,
+            ResourceCacheFlag cacheFlag,
+            String& errorMessages);
+
+        bool loadFromFile(const String& filePath);
+        bool saveToFile(const String& filePath) const;
+
+        // Drops least recently used entries exceeding new limit
+        void setMaxSize(UInt64 maxSizeInBytes);
+        UInt64 getMaxSize() const;
+        UInt64 getSize() const;
+
+        UInt32 getNumEntries() const;
+        UInt32 getNumHits() const;
+        UInt32 getNumMisses() const;
+        void clear();
+
+        virtual void triggerLogMessageForPeriodicLog() override;
+
+        struct FileHeader
+        {
+            uint32_t fileSize;
+            uint32_t fileFormatVersion;
+            uint64_t checksum;
+        };
+
+    private:
+        struct Entry
+        {
+            String vertexShader;
+            String fragmentShader;
+            String geometryShader;
+            absl::optional<EDrawMode> geometryShaderInputType;
+            EffectInputInformationVector uniformInputs;
+            EffectInputInformationVector attributeInputs;
+            UInt64 sizeInBytes = 0u;
+            std::list<ResourceContentHash>::iterator usagePosition;
+        };
+
+        static ResourceContentHash CreateKey(const String& vertexShader,
+            const String& fragmentShader,
+            const String& geometryShader,
+            const std::vector<String>& compilerDefines,
+            const HashMap<String, EFixedSemantics>& semanticInputs);
+        static void SerializeEntry(IOutputStream& stream, const Entry& entry);
+        static void DeserializeEntry(IInputStream& stream, Entry& entry);
+        static UInt64 GetEntrySize(const Entry& entry);
+
+        void addEntry(const ResourceContentHash& key, Entry&& entry);
+        void evictEntriesAboveMaxSize();
+
+        HashMap<ResourceContentHash, Entry> m_entries;
+        // most recently used first
+        std::list<ResourceContentHash> m_usageOrder;
+        UInt64 m_size = 0u;
+        UInt64 m_maxSize = DefaultMaxSizeInBytes;
+        UInt32 m_numHits = 0u;
+        UInt32 m_numMisses = 0u;
+        mutable std::mutex m_lock;
+    };
+}
+
+#endif
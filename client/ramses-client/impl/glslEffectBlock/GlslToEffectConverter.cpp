@@ -134,6 +134,10 @@ namespace ramses_internal
         }
         else if (storageQualifier == glslang::EvqUniform)
         {
+            if (symbol->getType().getBasicType() == glslang::EbtBlock)
+            {
+                return setInputTypeFromUniformBlock(symbol->getType(), String(symbol->getName().c_str()));
+            }
             return setInputTypeFromType(symbol->getType(), String(symbol->getName().c_str()), m_uniformInputs);
         }
 
@@ -223,6 +227,25 @@ namespace ramses_internal
         return true;
     }
 
+    bool GlslToEffectConverter::setInputTypeFromUniformBlock(const glslang::TType& blockType, const String& instanceName)
+    {
+        // GL identifies members of uniform blocks by block name instead of instance name,
+        // members of blocks without instance name (glslang names them 'anon@N') are identified only by their own name
+        const bool isAnonymousBlock = (instanceName.find("anon@") == 0);
+        if (!isAnonymousBlock)
+        {
+            return setInputTypeFromType(blockType, String(blockType.getTypeName().c_str()), m_uniformInputs);
+        }
+
+        for (const auto& blockField : *blockType.getStruct())
+        {
+            const glslang::TType& fieldType = *blockField.type;
+            CHECK_RETURN_ERR(setInputTypeFromType(fieldType, String(fieldType.getFieldName().c_str()), m_uniformInputs));
+        }
+
+        return true;
+    }
+
     const String GlslToEffectConverter::getStructFieldIdentifier(const String& baseName, const String& fieldName, const int32_t arrayIndex) const
     {
         StringOutputStream stream;
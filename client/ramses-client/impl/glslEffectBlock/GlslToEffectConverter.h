@@ -58,6 +58,7 @@ namespace ramses_internal
         bool getElementCountFromType(const glslang::TType& type, const String& inputName, uint32_t& elementCount) const;
         bool setInputTypeFromType(const glslang::TType& type, const String& inputName, EffectInputInformationVector& outputVector) const;
         bool setInputTypeFromType(const glslang::TType& type, EffectInputInformation& input) const;
+        bool setInputTypeFromUniformBlock(const glslang::TType& blockType, const String& instanceName);
         bool replaceVertexAttributeWithBufferVariant();
         bool setSemanticsOnInput(EffectInputInformation& input) const;
         bool makeUniformsUnique();
@@ -79,6 +79,27 @@ namespace ramses
         return status;
     }
 
+    status_t RamsesClient::loadEffectCompilationCache(const char* fileName)
+    {
+        auto status = impl.loadEffectCompilationCache(fileName);
+        LOG_HL_CLIENT_API1(status, fileName);
+        return status;
+    }
+
+    status_t RamsesClient::saveEffectCompilationCache(const char* fileName) const
+    {
+        auto status = impl.saveEffectCompilationCache(fileName);
+        LOG_HL_CLIENT_API1(status, fileName);
+        return status;
+    }
+
+    status_t RamsesClient::setEffectCompilationCacheMaxSize(uint32_t maxSizeInBytes)
+    {
+        auto status = impl.setEffectCompilationCacheMaxSize(maxSizeInBytes);
+        LOG_HL_CLIENT_API1(status, maxSizeInBytes);
+        return status;
+    }
+
     const Scene* RamsesClient::findSceneByName(const char* name) const
     {
         return impl.findSceneByName(name);
@@ -158,4 +158,16 @@ namespace ramses
         LOG_HL_CLIENT_API_NOARG(status);
         return status;
     }
+
+    status_t RenderPass::setFrustumCullingEnabled(bool enable)
+    {
+        const status_t status = impl.setFrustumCullingEnabled(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isFrustumCullingEnabled() const
+    {
+        return impl.isFrustumCullingEnabled();
+    }
 }
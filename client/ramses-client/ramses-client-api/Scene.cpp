@@ -148,6 +148,13 @@ namespace ramses
         return status;
     }
 
+    status_t Scene::saveToFileAsSnapshot(const char* fileName, bool compress) const
+    {
+        const auto status = impl.saveToFile(fileName, compress, true);
+        LOG_HL_CLIENT_API2(status, fileName, compress);
+        return status;
+    }
+
     status_t Scene::destroy(SceneObject& object)
     {
         const status_t status = impl.destroy(object);
@@ -42,7 +42,8 @@ namespace ramses
     {
         Invalid = 0,                 ///< Invalid semantic
         TextPositions,               ///< Text specific - vertex positions input. MUST be of type vec2
-        TextTextureCoordinates       ///< Text specific - texture coordinates input. MUST be of type vec2
+        TextTextureCoordinates,      ///< Text specific - texture coordinates input. MUST be of type vec2
+        VertexPositions              ///< Vertex positions input used for frustum culling (#ramses::RenderPass::setFrustumCullingEnabled). MUST be of type vec3 or vec4
     };
 }
 
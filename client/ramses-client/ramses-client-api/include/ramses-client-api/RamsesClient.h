@@ -153,6 +153,42 @@ namespace ramses
         */
         status_t loadSceneFromFileAsync(const char* fileName, bool localOnly = false);
 
+        /**
+        * @brief Loads previously compiled effects from file into the process wide effect compilation cache.
+        *
+        *        Scene::createEffect and ResourceDataPool::addEffectData look up this cache first. Effects with
+        *        identical shader sources, compiler defines and semantic inputs are created from the cache
+        *        without compiling the shaders again. Files written by another RAMSES build are rejected.
+        *
+        * @param[in] fileName File name to load the effect compilation cache from.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t loadEffectCompilationCache(const char* fileName);
+
+        /**
+        * @brief Saves all effects in the process wide effect compilation cache to file, so they can be loaded
+        *        with loadEffectCompilationCache() on next startup.
+        *
+        * @param[in] fileName File name to save the effect compilation cache to.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t saveEffectCompilationCache(const char* fileName) const;
+
+        /**
+        * @brief Limits the memory used by the process wide effect compilation cache.
+        *
+        *        When the limit is exceeded, the effects used least recently are dropped from the cache.
+        *        A limit of 0 disables the cache, all effects are compiled when created.
+        *        The default limit is 16 MB.
+        *
+        * @param[in] maxSizeInBytes Maximum size of cached effects in bytes, 0 to disable the cache.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setEffectCompilationCacheMaxSize(uint32_t maxSizeInBytes);
+
         /**
         * @brief Destroys the given Scene. The reference of Scene is invalid after this call
         *
@@ -227,6 +227,33 @@ namespace ramses
         */
         status_t retriggerRenderOnce();
 
+        /**
+        * @brief Enable/disable frustum culling of the render pass.
+        * @details When enabled, renderer skips draw calls of meshes which are completely
+        *          outside of the view frustum of the render pass camera. Bounds of a mesh are computed
+        *          on renderer side from its vertex positions, which are taken from the vertex attribute
+        *          with semantic #ramses::EEffectAttributeSemantic::VertexPositions or, if the effect
+        *          has no such attribute, from its only vec3/vec4 float vertex attribute.
+        *
+        *          Only enable culling for render passes where vertex shaders do not move vertices
+        *          outside of these bounds (e.g. skinning or other vertex displacement).
+        *          Meshes whose bounds cannot be determined (several vec3/vec4 attributes and none of them
+        *          marked with the semantic, interleaved or instanced vertex data, positions stored in data buffers)
+        *          are never culled.
+        *
+        * @param enable The flag which indicates if frustum culling is to be used (Default:false)
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setFrustumCullingEnabled(bool enable);
+
+        /**
+        * @brief Get the frustum culling state of the render pass
+        *
+        * @return Indicates if the renderer culls meshes outside of the view frustum of the render pass camera
+        */
+        bool isFrustumCullingEnabled() const;
+
         /**
         * Stores internal data for implementation specifics of RenderPass.
         */
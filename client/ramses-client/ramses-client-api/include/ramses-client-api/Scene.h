@@ -128,6 +128,10 @@ namespace ramses
         /**
         * @brief Saves all scene contents to a file.
         *
+        * @details Resources of scenes loaded from a file are read from that file while the scene exists.
+        *          If the file is still in use by a loaded scene it is replaced by a newly written file
+        *          instead of being overwritten, the loaded scene keeps reading the previous contents.
+        *
         * @param[in] fileName File name to save the scene to.
         * @param[in] compress if set to true, resources might be compressed before saving
         *                     otherwise, uncompressed data will be saved
@@ -136,6 +140,24 @@ namespace ramses
         */
         status_t saveToFile(const char* fileName, bool compress) const;
 
+        /**
+        * @brief Saves all scene contents to a file, same as #saveToFile but stores scene objects as memory snapshot.
+        *
+        * @details Loading a scene stored as snapshot is significantly faster for big scenes, because
+        *          its objects are restored in bulk instead of being recreated one by one.
+        *          The snapshot contains the in-memory representation of scene objects, a file saved this way
+        *          can therefore only be loaded on a platform with the same architecture (e.g. same pointer size),
+        *          loading fails otherwise. Use #saveToFile for files which are to be distributed to different platforms.
+        *          Files saved by either function are loaded using the same API (e.g. RamsesClient::loadSceneFromFile).
+        *
+        * @param[in] fileName File name to save the scene to.
+        * @param[in] compress if set to true, resources might be compressed before saving
+        *                     otherwise, uncompressed data will be saved
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t saveToFileAsSnapshot(const char* fileName, bool compress) const;
+
         /**
         * @brief Creates a Perspective Camera in this Scene
         *
@@ -310,6 +310,60 @@ namespace ramses
         EXPECT_EQ(static_cast<Effect*>(nullptr), sharedTestState->getScene().impl.createEffect(effectDesc, ResourceCacheFlag_DoNotCache, ""));
     }
 
+    TEST_F(AnEffect, canCreateEffectWithVertexPositionsSemanticsOnVec3AndVec4Attributes)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader(
+            "precision highp float;"
+            "attribute vec3 a_position;"
+            "attribute vec4 a_position4;"
+            "void main()"
+            "{"
+            "  gl_Position = vec4(a_position, 1.0) + a_position4;"
+            "}");
+        effectDesc.setFragmentShader(
+            "precision highp float;"
+            "void main(void)\n"
+            "{"
+            "  gl_FragColor = vec4(1.0, 1.0, 1.0, 1.0);"
+            "}");
+
+        effectDesc.setAttributeSemantic("a_position", EEffectAttributeSemantic::VertexPositions);
+        const Effect* effect = sharedTestState->getScene().impl.createEffect(effectDesc, ResourceCacheFlag_DoNotCache, "");
+        ASSERT_NE(nullptr, effect);
+        AttributeInput input;
+        EXPECT_EQ(StatusOK, effect->findAttributeInput(EEffectAttributeSemantic::VertexPositions, input));
+        EXPECT_STREQ("a_position", input.getName());
+        EXPECT_EQ(ramses_internal::EFixedSemantics::VertexPositionsAttribute, input.impl.getSemantics());
+
+        EffectDescription effectDesc4;
+        effectDesc4.setVertexShader(effectDesc.getVertexShader());
+        effectDesc4.setFragmentShader(effectDesc.getFragmentShader());
+        effectDesc4.setAttributeSemantic("a_position4", EEffectAttributeSemantic::VertexPositions);
+        EXPECT_NE(nullptr, sharedTestState->getScene().impl.createEffect(effectDesc4, ResourceCacheFlag_DoNotCache, ""));
+    }
+
+    TEST_F(AnEffect, canNotCreateEffectWhenVertexPositionsSemanticsHasWrongType)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader(
+            "precision highp float;"
+            "attribute vec2 a_position;"
+            "void main()"
+            "{"
+            "  gl_Position = vec4(1.0, 1.0, 1.0, 1.0);"
+            "}");
+        effectDesc.setFragmentShader(
+            "precision highp float;"
+            "void main(void)\n"
+            "{"
+            "  gl_FragColor = vec4(1.0, 1.0, 1.0, 1.0);"
+            "}");
+
+        effectDesc.setAttributeSemantic("a_position", EEffectAttributeSemantic::VertexPositions);
+        EXPECT_EQ(static_cast<Effect*>(nullptr), sharedTestState->getScene().impl.createEffect(effectDesc, ResourceCacheFlag_DoNotCache, ""));
+    }
+
     TEST_F(AnEffect, canRetrieveGLSLErrorMessageFromClient)
     {
 
@@ -0,0 +1,235 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "glslEffectBlock/GlslEffectCache.h"
+#include "Resource/EffectResource.h"
+#include "Utils/File.h"
+#include "gmock/gmock.h"
+#include <memory>
+
+using namespace ramses_internal;
+
+class AGlslEffectCache : public ::testing::Test
+{
+public:
+    ~AGlslEffectCache() override
+    {
+        File(cacheFile).remove();
+    }
+
+protected:
+    std::unique_ptr<EffectResource> createEffect(GlslEffectCache& effectCache, const std::vector<String>& defines = {}, const String& geomShader = "", const String& name = "")
+    {
+        String errors;
+        return std::unique_ptr<EffectResource>(effectCache.createEffectResource(vertexShader, fragmentShader, geomShader, defines, {}, name, ResourceCacheFlag(0u), errors));
+    }
+
+    GlslEffectCache cache;
+    const String cacheFile = "glslEffectCacheTest.cache";
+
+    const String vertexShader = R"SHADER(
+            #version 320 es
+            uniform highp mat4 mvp;
+            in vec3 a_position;
+            void main(void)
+            {
+                gl_Position = mvp * vec4(a_position, 1.0);
+            }
+            )SHADER";
+    const String fragmentShader = R"SHADER(
+            #version 320 es
+            out lowp vec4 colorOut;
+            void main(void)
+            {
+            #ifdef RED
+                colorOut = vec4(1.0, 0.0, 0.0, 1.0);
+            #else
+                colorOut = vec4(0.0);
+            #endif
+            })SHADER";
+    const String geometryShader = R"SHADER(
+            #version 320 es
+            layout(triangles) in;
+            layout(points, max_vertices = 1) out;
+            void main() {
+                gl_Position = vec4(0.0);
+                EmitVertex();
+            }
+            )SHADER";
+};
+
+TEST_F(AGlslEffectCache, isEmptyInitially)
+{
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getNumHits());
+    EXPECT_EQ(0u, cache.getNumMisses());
+}
+
+TEST_F(AGlslEffectCache, createsSameEffectFromCacheOnSecondRequest)
+{
+    const auto compiled = createEffect(cache);
+    ASSERT_TRUE(compiled);
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getNumHits());
+    EXPECT_EQ(1u, cache.getNumMisses());
+
+    const auto cached = createEffect(cache);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(1u, cache.getNumHits());
+    EXPECT_EQ(1u, cache.getNumMisses());
+
+    EXPECT_EQ(compiled->getHash(), cached->getHash());
+    EXPECT_EQ(compiled->getUniformInputs(), cached->getUniformInputs());
+    EXPECT_EQ(compiled->getAttributeInputs(), cached->getAttributeInputs());
+    EXPECT_STREQ(compiled->getVertexShader(), cached->getVertexShader());
+    EXPECT_STREQ(compiled->getFragmentShader(), cached->getFragmentShader());
+}
+
+TEST_F(AGlslEffectCache, appliesNameOfRequestToCachedEffect)
+{
+    createEffect(cache, {}, "", "first");
+    const auto cached = createEffect(cache, {}, "", "second");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(1u, cache.getNumHits());
+    EXPECT_EQ(String("second"), cached->getName());
+}
+
+TEST_F(AGlslEffectCache, compilesAgainForDifferentDefines)
+{
+    const auto withoutDefine = createEffect(cache);
+    const auto withDefine = createEffect(cache, { "RED" });
+    ASSERT_TRUE(withoutDefine);
+    ASSERT_TRUE(withDefine);
+    EXPECT_EQ(2u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getNumHits());
+    EXPECT_EQ(2u, cache.getNumMisses());
+    EXPECT_NE(withoutDefine->getHash(), withDefine->getHash());
+}
+
+TEST_F(AGlslEffectCache, keepsGeometryShaderInputTypeOfCachedEffect)
+{
+    createEffect(cache, {}, geometryShader);
+    const auto cached = createEffect(cache, {}, geometryShader);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(1u, cache.getNumHits());
+    ASSERT_TRUE(cached->getGeometryShaderInputType().has_value());
+    EXPECT_EQ(EDrawMode::Triangles, *cached->getGeometryShaderInputType());
+}
+
+TEST_F(AGlslEffectCache, doesNotCacheFailedCompilation)
+{
+    String errors;
+    EXPECT_EQ(nullptr, cache.createEffectResource("invalid", fragmentShader, "", {}, {}, "", ResourceCacheFlag(0u), errors));
+    EXPECT_FALSE(errors.empty());
+    EXPECT_EQ(nullptr, cache.createEffectResource("invalid", fragmentShader, "", {}, {}, "", ResourceCacheFlag(0u), errors));
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getNumHits());
+    EXPECT_EQ(2u, cache.getNumMisses());
+}
+
+TEST_F(AGlslEffectCache, dropsLeastRecentlyUsedEntriesAboveMaxSize)
+{
+    createEffect(cache);
+    const UInt64 entrySize = cache.getSize();
+    EXPECT_GT(entrySize, 0u);
+    createEffect(cache, { "RED" });
+    EXPECT_EQ(2u, cache.getNumEntries());
+
+    // first entry becomes most recently used
+    createEffect(cache);
+    EXPECT_EQ(1u, cache.getNumHits());
+
+    cache.setMaxSize(cache.getSize() - 1u);
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(entrySize, cache.getSize());
+    createEffect(cache);
+    EXPECT_EQ(2u, cache.getNumHits());
+
+    // next entry makes cache exceed limit again
+    createEffect(cache, { "RED" });
+    EXPECT_EQ(1u, cache.getNumEntries());
+    createEffect(cache, { "RED" });
+    EXPECT_EQ(3u, cache.getNumHits());
+    EXPECT_EQ(3u, cache.getNumMisses());
+}
+
+TEST_F(AGlslEffectCache, doesNotStoreEffectsIfDisabled)
+{
+    createEffect(cache);
+    cache.setMaxSize(0u);
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getSize());
+
+    EXPECT_TRUE(createEffect(cache));
+    EXPECT_TRUE(createEffect(cache));
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getNumHits());
+    EXPECT_EQ(3u, cache.getNumMisses());
+}
+
+TEST_F(AGlslEffectCache, loadsMostRecentlyUsedEntriesFromFileIfLimitedInSize)
+{
+    GlslEffectCache otherCache;
+    createEffect(otherCache, { "RED" });
+    const UInt64 entrySize = otherCache.getSize();
+
+    createEffect(cache, { "RED" });
+    createEffect(cache);
+    createEffect(cache, { "RED" });
+    ASSERT_TRUE(cache.saveToFile(cacheFile));
+
+    GlslEffectCache loadedCache;
+    loadedCache.setMaxSize(entrySize);
+    ASSERT_TRUE(loadedCache.loadFromFile(cacheFile));
+    EXPECT_EQ(1u, loadedCache.getNumEntries());
+    createEffect(loadedCache, { "RED" });
+    EXPECT_EQ(1u, loadedCache.getNumHits());
+}
+
+TEST_F(AGlslEffectCache, canBeSavedToAndLoadedFromFile)
+{
+    const auto compiled = createEffect(cache, {}, geometryShader);
+    ASSERT_TRUE(compiled);
+    ASSERT_TRUE(cache.saveToFile(cacheFile));
+
+    GlslEffectCache loadedCache;
+    ASSERT_TRUE(loadedCache.loadFromFile(cacheFile));
+    EXPECT_EQ(1u, loadedCache.getNumEntries());
+
+    const auto cached = createEffect(loadedCache, {}, geometryShader);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(1u, loadedCache.getNumHits());
+    EXPECT_EQ(0u, loadedCache.getNumMisses());
+    EXPECT_EQ(compiled->getHash(), cached->getHash());
+    EXPECT_EQ(compiled->getGeometryShaderInputType(), cached->getGeometryShaderInputType());
+}
+
+TEST_F(AGlslEffectCache, failsToLoadNonExistingFile)
+{
+    EXPECT_FALSE(cache.loadFromFile("doesNotExist.cache"));
+}
+
+TEST_F(AGlslEffectCache, failsToLoadCorruptFile)
+{
+    createEffect(cache);
+    ASSERT_TRUE(cache.saveToFile(cacheFile));
+
+    {
+        File file(cacheFile);
+        ASSERT_TRUE(file.open(File::Mode::WriteExistingBinary));
+        ASSERT_TRUE(file.seek(sizeof(GlslEffectCache::FileHeader) + 4, File::SeekOrigin::BeginningOfFile));
+        const char garbage[] = "garbage";
+        ASSERT_TRUE(file.write(garbage, sizeof(garbage)));
+        file.close();
+    }
+
+    GlslEffectCache loadedCache;
+    EXPECT_FALSE(loadedCache.loadFromFile(cacheFile));
+    EXPECT_EQ(0u, loadedCache.getNumEntries());
+}
@@ -681,6 +681,44 @@ TEST_F(AGlslEffect, canParseArrayOfStructUniform)
     VerifyUniformInputExists(*res, "s[3].b");
 }
 
+TEST_F(AGlslEffect, canParseUniformBlockMembersWithNamesUsedByGL)
+{
+    const char* vertexShader = R"SHADER(
+        #version 300 es
+        layout(std140) uniform CameraBlock
+        {
+            mat4 viewMatrix;
+            mat4 projectionMatrix;
+        };
+        layout(std140) uniform ModelBlock
+        {
+            mat4 modelMatrix;
+            vec4 colors[2];
+        } model;
+        void main(void)
+        {
+            gl_Position = projectionMatrix * viewMatrix * model.modelMatrix * model.colors[0];
+        })SHADER";
+    const char* fragmentShader = R"SHADER(
+        #version 300 es
+        out lowp vec4 colorOut;
+        void main(void)
+        {
+            colorOut = vec4(0.0);
+        })SHADER";
+    GlslEffect ge(vertexShader, fragmentShader, "", emptyCompilerDefines, emptySemanticInputs, "");
+    std::unique_ptr<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    ASSERT_TRUE(res);
+
+    // members of anonymous blocks have no prefix, members of named blocks are prefixed by block name (not instance name)
+    EXPECT_EQ(4u, res->getUniformInputs().size());
+    VerifyUniformInputExists(*res, "viewMatrix");
+    VerifyUniformInputExists(*res, "projectionMatrix");
+    VerifyUniformInputExists(*res, "ModelBlock.modelMatrix");
+    VerifyUniformInputExists(*res, "ModelBlock.colors");
+    EXPECT_EQ(2u, res->getUniformInputs()[res->getUniformDataFieldHandleByName("ModelBlock.colors").asMemoryHandle()].elementCount);
+}
+
 TEST_F(AGlslEffect, canParseNestedStructUniform)
 {
     const char* vertexShader =
@@ -14,6 +14,7 @@
 #include "RamsesClientImpl.h"
 #include "SceneConfigImpl.h"
 #include "Utils/File.h"
+#include "glslEffectBlock/GlslEffectCache.h"
 #include "RamsesObjectTestTypes.h"
 #include "EffectImpl.h"
 #include "ClientTestUtils.h"
@@ -89,6 +90,34 @@ namespace ramses
         m_client.dispatchEvents(eventHandlerMock);
     }
 
+    TEST_F(ARamsesClient, failsToLoadOrSaveEffectCompilationCacheWithoutFileName)
+    {
+        EXPECT_NE(StatusOK, m_client.loadEffectCompilationCache(nullptr));
+        EXPECT_NE(StatusOK, m_client.loadEffectCompilationCache(""));
+        EXPECT_NE(StatusOK, m_client.saveEffectCompilationCache(nullptr));
+        EXPECT_NE(StatusOK, m_client.saveEffectCompilationCache(""));
+    }
+
+    TEST_F(ARamsesClient, canSaveAndLoadEffectCompilationCache)
+    {
+        EXPECT_EQ(StatusOK, m_client.saveEffectCompilationCache("effectCompilationCache.cache"));
+        EXPECT_EQ(StatusOK, m_client.loadEffectCompilationCache("effectCompilationCache.cache"));
+        EXPECT_NE(StatusOK, m_client.loadEffectCompilationCache("nonExistingEffectCompilationCache.cache"));
+        ramses_internal::File("effectCompilationCache.cache").remove();
+    }
+
+    TEST_F(ARamsesClient, canDisableEffectCompilationCache)
+    {
+        auto& cache = ramses_internal::GlslEffectCache::GetInstance();
+        const auto maxSize = cache.getMaxSize();
+
+        EXPECT_EQ(StatusOK, m_client.setEffectCompilationCacheMaxSize(0u));
+        EXPECT_EQ(0u, cache.getMaxSize());
+        EXPECT_EQ(0u, cache.getNumEntries());
+
+        cache.setMaxSize(maxSize);
+    }
+
     // Not really useful and behavior is not defined, but should not crash at least
     TEST_F(ARamsesClient, canLiveParallelToAnotherClientUsingTheSameFramework)
     {
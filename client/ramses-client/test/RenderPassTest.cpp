@@ -659,6 +659,20 @@ namespace ramses
         EXPECT_FALSE(renderpass.isRenderOnce());
     }
 
+    TEST_F(ARenderPass, hasFrustumCullingDisabledInitially)
+    {
+        EXPECT_FALSE(renderpass.isFrustumCullingEnabled());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableFrustumCulling)
+    {
+        EXPECT_EQ(StatusOK, renderpass.setFrustumCullingEnabled(true));
+        EXPECT_TRUE(renderpass.isFrustumCullingEnabled());
+        EXPECT_TRUE(m_internalScene.getRenderPass(renderpass.impl.getRenderPassHandle()).isFrustumCullingEnabled);
+        EXPECT_EQ(StatusOK, renderpass.setFrustumCullingEnabled(false));
+        EXPECT_FALSE(renderpass.isFrustumCullingEnabled());
+    }
+
     TEST_F(ARenderPass, canRetriggerRenderOnce)
     {
         EXPECT_EQ(StatusOK, renderpass.setRenderOnce(true));
@@ -90,6 +90,7 @@
 #include "Scene/ResourceChanges.h"
 #include "Scene/SceneActionApplier.h"
 #include "ramses-hmi-utils.h"
+#include "Utils/MemoryMappedFile.h"
 
 #include <fstream>
 #include <sys/stat.h>
@@ -1290,6 +1291,27 @@ namespace ramses
         EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTempararyFile.ram"));
     }
 
+    TEST_F(ASceneAndAnimationSystemLoadedFromFile, replacesFileOfLoadedSceneInsteadOfOverwritingIt)
+    {
+        const sceneId_t sceneId = ramses::sceneId_t(1ULL << 63);
+        ramses::Scene* scene = client.createScene(sceneId);
+        const std::vector<uint16_t> data(1000u, 7u);
+        ASSERT_NE(nullptr, scene->createArrayResource(EDataType::UInt16, static_cast<uint32_t>(data.size()), data.data()));
+        EXPECT_EQ(StatusOK, scene->saveToFile("someTempararyFile.ram", false));
+
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTempararyFile.ram");
+        ASSERT_NE(nullptr, m_sceneLoaded);
+
+        // loaded resources might still be read from file, saving replaces it by a new file
+        EXPECT_EQ(StatusOK, scene->saveToFile("someTempararyFile.ram", false));
+        EXPECT_FALSE(ramses_internal::MemoryMappedFile::IsFileMapped("someTempararyFile.ram"));
+        EXPECT_FALSE(ramses_internal::File("someTempararyFile.ram.tmp").exists());
+
+        // loaded scene still reads its resources from contents of replaced file
+        EXPECT_EQ(StatusOK, m_sceneLoaded->saveToFile("someTempararyFile.ram", false));
+        EXPECT_EQ(StatusOK, m_sceneLoaded->saveToFile("someTempararyFile_2.ram", false));
+    }
+
     TEST_F(ASceneAndAnimationSystemLoadedFromFile, cannotLoadScenesWithSameSceneIdTwice)
     {
         const sceneId_t sceneId = ramses::sceneId_t(1ULL << 63);
@@ -25,6 +25,8 @@
 #include "ramses-hmi-utils.h"
 
 #include "ClientEventHandlerMock.h"
+#include "RamsesClientImpl.h"
+#include "ResourceImpl.h"
 #include "TestEffects.h"
 #include "PlatformAbstraction/PlatformThread.h"
 #include "Utils/File.h"
@@ -173,6 +175,31 @@ namespace ramses
         EXPECT_EQ(sceneId_t(123u), loadedScene->getSceneId());
     }
 
+    TEST_F(ARamsesFileLoadedInSeveralThread, asyncLoadedSceneDoesNotLoadResourcesItDoesNotUseAhead)
+    {
+        EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _));
+        EXPECT_EQ(StatusOK, client.loadSceneFromFileAsync(sceneFile));
+        ASSERT_TRUE(waitForNumClientEvents(1));
+        ASSERT_TRUE(loadedScene != nullptr);
+        EXPECT_EQ(StatusOK, loadedScene->flush());
+
+        // index array is not bound to any mesh
+        const RamsesObject* object = loadedScene->findObjectByName("indices");
+        ASSERT_TRUE(object != nullptr);
+        const Resource* resource = RamsesUtils::TryConvert<Resource>(*object);
+        ASSERT_TRUE(resource != nullptr);
+        EXPECT_FALSE(client.impl.getResource_ThreadSafe(resource->impl.getLowlevelResourceHash()));
+    }
+
+    TEST_F(ARamsesFileLoadedInSeveralThread, asyncLoadedSceneCanBeDestroyedBeforeResourcesLoadedAheadAreTakenOver)
+    {
+        EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _));
+        EXPECT_EQ(StatusOK, client.loadSceneFromFileAsync(sceneFile));
+        ASSERT_TRUE(waitForNumClientEvents(1));
+        ASSERT_TRUE(loadedScene != nullptr);
+        EXPECT_EQ(StatusOK, client.destroy(*loadedScene));
+    }
+
     TEST_F(ARamsesFileLoadedInSeveralThread, canAsyncLoadSceneParallelToSynchronousResourceLoad)
     {
         EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _));
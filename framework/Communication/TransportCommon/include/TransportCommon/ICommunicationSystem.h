@@ -15,10 +15,11 @@
 #include "Components/ManagedResource.h"
 #include "Utils/IPeriodicLogSupplier.h"
 #include "Components/DcsmTypes.h"
+#include "Collections/Guid.h"
+#include <vector>
 
 namespace ramses_internal
 {
-    class Guid;
     class IConnectionStatusUpdateNotifier;
     class SceneActionCollection;
     class ISceneUpdateSerializer;
@@ -45,6 +46,14 @@ namespace ramses_internal
 
         virtual bool sendInitializeScene(const Guid& to, const SceneId& sceneId) = 0;
         virtual bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
+        // sends same scene update to several participants, implementations can serialize it only once for all of them
+        virtual bool multicastSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+        {
+            bool result = true;
+            for (const auto& participant : to)
+                result = sendSceneUpdate(participant, sceneId, serializer) && result;
+            return result;
+        }
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<Byte>& data) = 0;
 
@@ -10,7 +10,9 @@
 #define RAMSES_ISCENEUPDATESERIALIZER_H
 
 #include "PlatformAbstraction/PlatformTypes.h"
+#include "TransportCommon/SceneUpdatePacket.h"
 #include "absl/types/span.h"
+#include <functional>
 
 namespace ramses_internal
 {
@@ -19,6 +21,17 @@ namespace ramses_internal
     public:
         virtual ~ISceneUpdateSerializer() = default;
         virtual bool writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const = 0;
+
+        // writes same packets as writeToPackets, implementations can reference data of update in packets instead of copying it
+        virtual bool writeToGatheredPackets(size_t packetSize, const std::function<bool(SceneUpdatePacket&&)>& writeDoneFunc) const
+        {
+            std::vector<Byte> packetMem(packetSize);
+            return writeToPackets({packetMem.data(), packetMem.size()}, [&](size_t size) {
+                SceneUpdatePacket packet;
+                packet.append({packetMem.data(), size});
+                return writeDoneFunc(std::move(packet));
+            });
+        }
     };
 }
 
@@ -0,0 +1,78 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEACTIONDELTAENCODING_H
+#define RAMSES_SCENEACTIONDELTAENCODING_H
+
+#include "Collections/Guid.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "absl/types/span.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class SceneActionCollection;
+
+    /*
+      Encoded scene actions block format
+      - description size : uint32_t
+      - data size : uint32_t
+      - sequence number of this update : uint32_t
+      - sequence number of reference update (0: no reference) : uint32_t
+      - LZ4 compressed (description blob + data blob), XORed with blob of reference update
+
+      Apps typically modify the same objects every frame, so serialized actions of consecutive flushes
+      have same layout and mostly same values: XOR against previous flush yields mostly zero bytes
+      which compress very well.
+     */
+
+    // Sender side of scene action delta encoding, one instance per scene.
+    // Remembers actions sent last and to which participants, these are used as reference only if
+    // update goes to exactly the same participants which all received the previous one.
+    class SceneActionDeltaEncoder
+    {
+    public:
+        // encodes actions for given recipients, returns false if actions are too small to be worth it
+        bool prepare(const SceneActionCollection& actions, const std::vector<Guid>& recipients);
+        // encoded block prepared last, empty if not encoded
+        absl::Span<const Byte> getEncodedBlock() const;
+        // prepared update was sent (or failed), only successfully sent encoded actions can be used as reference
+        void finishUpdate(bool sent);
+        // forget reference, e.g. if a recipient reinitializes scene
+        void reset();
+
+        static constexpr size_t MinimumActionsSize = 512u;
+
+    private:
+        std::vector<Byte> m_actions;
+        std::vector<Byte> m_encodedBlock;
+        std::vector<Guid> m_recipients;
+        uint32_t m_sequenceNumber = 0u;
+        uint32_t m_lastSequenceNumber = 0u;
+
+        std::vector<Byte> m_referenceActions;
+        std::vector<Guid> m_referenceRecipients;
+        uint32_t m_referenceSequenceNumber = 0u;
+
+        std::vector<Byte> m_workingMemory;
+    };
+
+    // Receiver side of scene action delta encoding, one instance per received scene
+    class SceneActionDeltaDecoder
+    {
+    public:
+        bool decode(absl::Span<const Byte> encodedBlock, SceneActionCollection& actions);
+
+    private:
+        std::vector<Byte> m_referenceActions;
+        uint32_t m_referenceSequenceNumber = 0u;
+        std::vector<Byte> m_decodedActions;
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEUPDATEPACKET_H
+#define RAMSES_SCENEUPDATEPACKET_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "absl/types/span.h"
+#include <vector>
+#include <memory>
+
+namespace ramses_internal
+{
+    // Scene update packet as sequence of memory pieces which can be sent with a single gather write.
+    // Appended data is copied into memory owned by the packet, referenced data is not copied but kept
+    // alive by holding a reference to its owner (e.g. resource blob owned by managed resource).
+    class SceneUpdatePacket
+    {
+    public:
+        void append(absl::Span<const Byte> data);
+        void appendReference(absl::Span<const Byte> data, const std::shared_ptr<const void>& owner);
+        // overwrites data previously appended (i.e. copied) at start of packet, used for packet header
+        void overwriteStart(absl::Span<const Byte> data);
+
+        size_t size() const;
+        // pieces in packet order, valid as long as packet is alive and not modified
+        std::vector<absl::Span<const Byte>> getPieces() const;
+
+    private:
+        struct Piece
+        {
+            // nullptr for data in owned memory
+            const Byte* referencedData;
+            size_t offset;
+            size_t size;
+        };
+
+        std::vector<Byte> m_ownedData;
+        std::vector<Piece> m_pieces;
+        std::vector<std::shared_ptr<const void>> m_owners;
+        size_t m_size = 0u;
+    };
+}
+
+#endif
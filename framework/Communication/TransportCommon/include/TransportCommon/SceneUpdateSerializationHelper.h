@@ -10,6 +10,7 @@
 #define RAMSES_SCENEUPDATESERIALIZATIONHELPER_H
 
 #include "PlatformAbstraction/PlatformTypes.h"
+#include "Resource/IResource.h"
 #include "absl/types/span.h"
 #include <vector>
 #include <memory>
@@ -17,7 +18,6 @@
 namespace ramses_internal
 {
     class SceneActionCollection;
-    class IResource;
     struct FlushInformation;
 
     namespace SceneActionSerialization
@@ -26,14 +26,38 @@ namespace ramses_internal
         absl::Span<const Byte> SerializeData(const SceneActionCollection& actions);
 
         SceneActionCollection Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data);
+        // actions of description, data is appended by caller. Data size comes from the wire, so capacity for at most
+        // MaxReservedDataSize bytes is reserved upfront, the rest grows with the data actually appended
+        SceneActionCollection DeserializeDescription(absl::Span<const Byte> description, size_t dataSize);
+        constexpr size_t MaxReservedDataSize = 1024u * 1024u;
+        bool IsValidDescription(absl::Span<const Byte> description);
     };
 
     namespace ResourceSerialization
     {
         absl::Span<const Byte> SerializeDescription(const IResource& resource, std::vector<Byte>& workingMemory);
         absl::Span<const Byte> SerializeData(const IResource& resource);
+        // same as SerializeData, returned data stays valid as long as dataOwner is held
+        absl::Span<const Byte> SerializeSharedData(const IResource& resource, std::shared_ptr<const void>& dataOwner);
 
         std::unique_ptr<IResource> Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data);
+
+        // resource of description, blob data is received separately directly into getDataMemory()
+        struct PartialResource
+        {
+            absl::Span<Byte> getDataMemory();
+
+            std::unique_ptr<IResource> resource;
+            ResourceContentHash hash;
+            uint32_t decompressedSize = 0u;
+            bool isCompressed = false;
+            ResourceBlob data;
+            CompressedResourceBlob compressedData;
+        };
+        // fails for sizes above MaxResourceDataSize, blob memory of data size is allocated before any data is received
+        bool DeserializeDescription(absl::Span<const Byte> description, size_t dataSize, PartialResource& partialResource);
+        constexpr size_t MaxResourceDataSize = 1024u * 1024u * 1024u;
+        std::unique_ptr<IResource> Finalize(PartialResource&& partialResource);
     }
 
     namespace FlushInformationSerialization
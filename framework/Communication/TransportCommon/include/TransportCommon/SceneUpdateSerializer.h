@@ -15,18 +15,27 @@ namespace ramses_internal
 {
     struct SceneUpdate;
     class StatisticCollectionScene;
+    class SceneActionDeltaEncoder;
 
     class SceneUpdateSerializer : public ISceneUpdateSerializer
     {
     public:
-        explicit SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics);
+        // called with index of resource in update right before it gets serialized, e.g. to wait until it is compressed
+        using PrepareResourceFunc = std::function<void(size_t)>;
+
+        // actionEncoder (optional) must be prepared with actions of update
+        explicit SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics, PrepareResourceFunc prepareResource = {},
+                                       const SceneActionDeltaEncoder* actionEncoder = nullptr);
         bool writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override;
+        bool writeToGatheredPackets(size_t packetSize, const std::function<bool(SceneUpdatePacket&&)>& writeDoneFunc) const override;
 
         const SceneUpdate& getUpdate() const;
         const StatisticCollectionScene& getStatisticCollection() const;
     private:
         const SceneUpdate& m_update;
         StatisticCollectionScene& m_sceneStatistics;
+        PrepareResourceFunc m_prepareResource;
+        const SceneActionDeltaEncoder* m_actionEncoder;
     };
 }
 
@@ -11,11 +11,12 @@
 
 #include "Scene/SceneActionCollection.h"
 #include "Components/FlushInformation.h"
+#include "TransportCommon/SceneActionDeltaEncoding.h"
+#include "TransportCommon/SceneUpdateSerializationHelper.h"
 #include "absl/types/span.h"
 
 namespace ramses_internal
 {
-    class IResource;
     class BinaryInputStream;
 
     class SceneUpdateStreamDeserializer
@@ -46,21 +47,35 @@ namespace ramses_internal
         Result processData(absl::Span<const Byte> data);
 
     private:
-        void continueReadingBlock(BinaryInputStream& is, size_t dataSize);
+        bool continueReadingBlock(BinaryInputStream& is, size_t dataSize);
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
         Result fail();
 
+        // scene action and resource data is written directly into final storage while receiving,
+        // only their sizes and description are buffered
+        static bool IsStreamedBlockType(uint32_t blockType);
+        bool handleBufferedBlockStart();
+        void writeStreamedBlockData(absl::Span<const Byte> data);
+        bool startSceneActionCollection(absl::Span<const Byte> description, uint32_t dataSize);
+        bool startResource(absl::Span<const Byte> description, uint32_t dataSize);
+
         bool finalizeBlock();
-        bool handleSceneActionCollection();
-        bool handleResource();
+        bool handleEncodedSceneActionCollection();
+        void finalizeResource();
         bool handleFlushInfos();
 
+        static constexpr uint32_t StreamedBlockHeaderSize = sizeof(uint32_t) * 2;
+
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
         uint32_t m_currentBlockSize = 0;
+        uint32_t m_currentBlockBytesRead = 0;
+        size_t m_currentBlockBufferSize = 0;
         uint32_t m_blockType = 0;
         std::vector<Byte> m_currentBlock;
+        ResourceSerialization::PartialResource m_currentResource;
         Result m_currentResult;
+        SceneActionDeltaDecoder m_actionDecoder;
     };
 }
 
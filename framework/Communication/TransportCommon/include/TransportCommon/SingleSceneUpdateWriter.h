@@ -10,17 +10,22 @@
 #define RAMSES_SINGLESCENEUPDATEWRITER_H
 
 #include "Components/SceneUpdate.h"
-#include "Utils/RawBinaryOutputStream.h"
+#include "TransportCommon/SceneUpdatePacket.h"
 #include "absl/types/span.h"
 
 namespace ramses_internal
 {
     class StatisticCollectionScene;
+    class SceneActionDeltaEncoder;
 
     class SingleSceneUpdateWriter
     {
     public:
-        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics);
+        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics,
+                                const std::function<void(size_t)>& prepareResource = {}, const SceneActionDeltaEncoder* actionEncoder = nullptr);
+        // writes gathered packets, resource blobs are referenced instead of copied into packets
+        SingleSceneUpdateWriter(const SceneUpdate& update, size_t packetSize, const std::function<bool(SceneUpdatePacket&&)>& gatheredWriteDoneFunc, StatisticCollectionScene& sceneStatistics,
+                                const std::function<void(size_t)>& prepareResource = {}, const SceneActionDeltaEncoder* actionEncoder = nullptr);
 
         bool write();
 
@@ -29,26 +34,34 @@ namespace ramses_internal
             SceneActionCollection = 10,
             Resource              = 11,
             FlushInfos            = 12,
+            EncodedSceneActionCollection = 13,
         };
 
         static constexpr const uint32_t hasMorePacketsFlag = 0xCA;
         static constexpr const uint32_t lastPacketFlag = 0xFE;
+        // smaller parts of resource blobs are copied into gathered packets, not worth an own memory piece
+        static constexpr const size_t minReferencedDataSize = 4096u;
 
     private:
         void initializePacket();
         bool finalizePacket(bool more);
 
         bool writeSceneActionCollection();
-        bool writeResource(const IResource& resource);
+        bool writeResource(const ManagedResource& resource);
         bool writeFlushInfos(const FlushInformation& infos);
 
-        bool writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans);
-        bool writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous = false);
+        bool writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans, absl::Span<const Byte> referencedData = {}, const std::shared_ptr<const void>& dataOwner = {});
+        bool writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous = false, const std::shared_ptr<const void>& dataOwner = {});
 
         const SceneUpdate&                 m_update;
         const absl::Span<Byte>             m_packetMem;
-        const std::function<bool(size_t)>& m_writeDoneFunc;
-        RawBinaryOutputStream              m_packetWriter;
+        const size_t                       m_packetSize;
+        const std::function<bool(size_t)>  m_writeDoneFunc;
+        const std::function<bool(SceneUpdatePacket&&)> m_gatheredWriteDoneFunc;
+        const std::function<void(size_t)>  m_prepareResource;
+        const SceneActionDeltaEncoder*     m_actionEncoder;
+        size_t                             m_packetBytesWritten = 0u;
+        SceneUpdatePacket                  m_gatheredPacket;
         uint32_t                           m_packetNum = 1;
         std::vector<Byte>                  m_temporaryMemToSerializeDescription;  // optimization to avoid allocations
         StatisticCollectionScene&          m_sceneStatistics;
@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportCommon/SceneActionDeltaEncoding.h"
+#include "TransportCommon/SceneUpdateSerializationHelper.h"
+#include "Scene/SceneActionCollection.h"
+#include "Utils/RawBinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "Utils/LogMacros.h"
+#include "lz4.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        constexpr size_t EncodedBlockHeaderSize = sizeof(uint32_t) * 4;
+        // LZ4 cannot compress better than 255:1, larger decoded size announced by block header is corrupt
+        constexpr size_t MaxCompressionRatio = 255u;
+
+        void xorWithReference(std::vector<Byte>& data, const std::vector<Byte>& reference)
+        {
+            const size_t commonSize = std::min(data.size(), reference.size());
+            for (size_t i = 0; i < commonSize; ++i)
+                data[i] ^= reference[i];
+        }
+    }
+
+    bool SceneActionDeltaEncoder::prepare(const SceneActionCollection& actions, const std::vector<Guid>& recipients)
+    {
+        m_encodedBlock.clear();
+
+        m_workingMemory.clear();
+        const auto descSpan = SceneActionSerialization::SerializeDescription(actions, m_workingMemory);
+        const auto dataSpan = SceneActionSerialization::SerializeData(actions);
+        if (descSpan.size() + dataSpan.size() < MinimumActionsSize)
+            return false;
+
+        m_actions.assign(descSpan.begin(), descSpan.end());
+        m_actions.insert(m_actions.end(), dataSpan.begin(), dataSpan.end());
+
+        m_recipients = recipients;
+        std::sort(m_recipients.begin(), m_recipients.end(), [](const Guid& a, const Guid& b) { return a.get() < b.get(); });
+        const bool useReference = (m_referenceSequenceNumber != 0u && m_referenceRecipients == m_recipients);
+
+        // never restarts, so reference of a receiver which missed updates cannot accidentally match
+        m_sequenceNumber = ++m_lastSequenceNumber;
+        if (m_sequenceNumber == 0u)
+            m_sequenceNumber = ++m_lastSequenceNumber;
+
+        m_workingMemory = m_actions;
+        if (useReference)
+            xorWithReference(m_workingMemory, m_referenceActions);
+
+        const int maxEncodedSize = LZ4_compressBound(static_cast<int>(m_workingMemory.size()));
+        m_encodedBlock.resize(EncodedBlockHeaderSize + static_cast<size_t>(maxEncodedSize));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        const int encodedSize = LZ4_compress_default(reinterpret_cast<const char*>(m_workingMemory.data()),
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+            reinterpret_cast<char*>(m_encodedBlock.data() + EncodedBlockHeaderSize),
+            static_cast<int>(m_workingMemory.size()),
+            maxEncodedSize);
+        if (encodedSize <= 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaEncoder::prepare: Compression failed (size {})", m_workingMemory.size());
+            m_encodedBlock.clear();
+            return false;
+        }
+        m_encodedBlock.resize(EncodedBlockHeaderSize + static_cast<size_t>(encodedSize));
+
+        RawBinaryOutputStream os(m_encodedBlock.data(), EncodedBlockHeaderSize);
+        os << static_cast<uint32_t>(descSpan.size())
+           << static_cast<uint32_t>(dataSpan.size())
+           << m_sequenceNumber
+           << (useReference ? m_referenceSequenceNumber : 0u);
+
+        return true;
+    }
+
+    absl::Span<const Byte> SceneActionDeltaEncoder::getEncodedBlock() const
+    {
+        return m_encodedBlock;
+    }
+
+    void SceneActionDeltaEncoder::finishUpdate(bool sent)
+    {
+        if (sent && !m_encodedBlock.empty())
+        {
+            m_referenceActions.swap(m_actions);
+            m_referenceRecipients.swap(m_recipients);
+            m_referenceSequenceNumber = m_sequenceNumber;
+        }
+        else
+            reset();
+        m_encodedBlock.clear();
+    }
+
+    void SceneActionDeltaEncoder::reset()
+    {
+        m_referenceActions.clear();
+        m_referenceRecipients.clear();
+        m_referenceSequenceNumber = 0u;
+    }
+
+    bool SceneActionDeltaDecoder::decode(absl::Span<const Byte> encodedBlock, SceneActionCollection& actions)
+    {
+        if (encodedBlock.size() < EncodedBlockHeaderSize)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Block too small ({})", encodedBlock.size());
+            return false;
+        }
+
+        BinaryInputStream is(encodedBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        uint32_t sequenceNumber = 0;
+        uint32_t referenceSequenceNumber = 0;
+        is >> descSize
+           >> dataSize
+           >> sequenceNumber
+           >> referenceSequenceNumber;
+
+        if (referenceSequenceNumber != 0u && referenceSequenceNumber != m_referenceSequenceNumber)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Encoded against update {}, but last received update is {}", referenceSequenceNumber, m_referenceSequenceNumber);
+            return false;
+        }
+
+        const size_t decodedSize = size_t(descSize) + dataSize;
+        const size_t encodedSize = encodedBlock.size() - EncodedBlockHeaderSize;
+        if (decodedSize == 0u)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Empty actions");
+            return false;
+        }
+        // checked before allocating, sizes come from remote
+        if (decodedSize > size_t(LZ4_MAX_INPUT_SIZE) || decodedSize > encodedSize * MaxCompressionRatio || encodedSize > size_t(LZ4_COMPRESSBOUND(LZ4_MAX_INPUT_SIZE)))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Invalid size of actions (description {}, data {}, encoded {})", descSize, dataSize, encodedSize);
+            return false;
+        }
+
+        m_decodedActions.resize(decodedSize);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        const int bytesDecoded = LZ4_decompress_safe(reinterpret_cast<const char*>(encodedBlock.data() + EncodedBlockHeaderSize),
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+            reinterpret_cast<char*>(m_decodedActions.data()),
+            static_cast<int>(encodedSize),
+            static_cast<int>(decodedSize));
+        if (bytesDecoded != static_cast<int>(decodedSize))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Decompression failed (decoded {}, expected {})", bytesDecoded, decodedSize);
+            return false;
+        }
+
+        if (referenceSequenceNumber != 0u)
+            xorWithReference(m_decodedActions, m_referenceActions);
+
+        const absl::Span<const Byte> description(m_decodedActions.data(), descSize);
+        if (!SceneActionSerialization::IsValidDescription(description))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneActionDeltaDecoder::decode: Invalid description (size {})", descSize);
+            return false;
+        }
+        actions = SceneActionSerialization::Deserialize(description, absl::Span<const Byte>(m_decodedActions.data() + descSize, dataSize));
+
+        m_referenceActions.swap(m_decodedActions);
+        m_referenceSequenceNumber = sequenceNumber;
+        return true;
+    }
+}
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportCommon/SceneUpdatePacket.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    void SceneUpdatePacket::append(absl::Span<const Byte> data)
+    {
+        if (data.empty())
+            return;
+
+        // extend last piece if it is in owned memory too
+        if (m_pieces.empty() || m_pieces.back().referencedData != nullptr)
+            m_pieces.push_back({ nullptr, m_ownedData.size(), 0u });
+        m_ownedData.insert(m_ownedData.end(), data.begin(), data.end());
+        m_pieces.back().size += data.size();
+        m_size += data.size();
+    }
+
+    void SceneUpdatePacket::appendReference(absl::Span<const Byte> data, const std::shared_ptr<const void>& owner)
+    {
+        if (data.empty())
+            return;
+
+        assert(owner);
+        m_pieces.push_back({ data.data(), 0u, data.size() });
+        if (m_owners.empty() || m_owners.back() != owner)
+            m_owners.push_back(owner);
+        m_size += data.size();
+    }
+
+    void SceneUpdatePacket::overwriteStart(absl::Span<const Byte> data)
+    {
+        assert(!m_pieces.empty() && m_pieces.front().referencedData == nullptr && m_pieces.front().size >= data.size());
+        std::copy(data.begin(), data.end(), m_ownedData.begin());
+    }
+
+    size_t SceneUpdatePacket::size() const
+    {
+        return m_size;
+    }
+
+    std::vector<absl::Span<const Byte>> SceneUpdatePacket::getPieces() const
+    {
+        std::vector<absl::Span<const Byte>> pieces;
+        pieces.reserve(m_pieces.size());
+        for (const auto& piece : m_pieces)
+        {
+            if (piece.referencedData)
+                pieces.emplace_back(piece.referencedData, piece.size);
+            else
+                pieces.emplace_back(m_ownedData.data() + piece.offset, piece.size);
+        }
+        return pieces;
+    }
+}
@@ -11,8 +11,10 @@
 #include "Scene/SceneActionCollection.h"
 #include "Utils/LogMacros.h"
 #include "Utils/BinaryInputStream.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 #include "Components/ResourceSerializationHelper.h"
 #include "Components/FlushInformation.h"
+#include <algorithm>
 
 
 namespace
@@ -68,13 +70,19 @@ namespace ramses_internal
 
         SceneActionCollection Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data)
         {
+            SceneActionCollection actions = DeserializeDescription(description, data.size());
+            actions.appendRawData(data.data(), data.size());
+            return actions;
+        }
+
+        SceneActionCollection DeserializeDescription(absl::Span<const Byte> description, size_t dataSize)
+        {
+            assert(IsValidDescription(description));
             BinaryInputStream is(description.data());
             uint32_t numActions = 0;
             is >> numActions;
-            assert(description.size() == numActions*2*sizeof(uint32_t) + sizeof(uint32_t));
 
-            SceneActionCollection actions(data.size(), numActions);
-            actions.appendRawData(data.data(), data.size());
+            SceneActionCollection actions(std::min(dataSize, MaxReservedDataSize), numActions);
             for (uint32_t i = 0; i < numActions; ++i)
             {
                 uint32_t type = 0;
@@ -85,6 +93,16 @@ namespace ramses_internal
             }
             return actions;
         }
+
+        bool IsValidDescription(absl::Span<const Byte> description)
+        {
+            if (description.size() < sizeof(uint32_t))
+                return false;
+            BinaryInputStream is(description.data());
+            uint32_t numActions = 0;
+            is >> numActions;
+            return description.size() == size_t(numActions)*2*sizeof(uint32_t) + sizeof(uint32_t);
+        }
     }
 
     namespace FlushInformationSerialization
@@ -255,35 +273,89 @@ namespace ramses_internal
                 return {};
         }
 
+        absl::Span<const Byte> SerializeSharedData(const IResource& resource, std::shared_ptr<const void>& dataOwner)
+        {
+            // blob is checked and taken in one step, resource might get compressed meanwhile
+            if (auto compressedData = resource.getSharedCompressedResourceData())
+            {
+                const auto data = compressedData->span();
+                dataOwner = std::move(compressedData);
+                return data;
+            }
+            if (auto data = resource.getSharedResourceData())
+            {
+                const auto span = data->span();
+                dataOwner = std::move(data);
+                return span;
+            }
+            return {};
+        }
+
         std::unique_ptr<IResource> Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data)
+        {
+            PartialResource partialResource;
+            if (!DeserializeDescription(description, data.size(), partialResource))
+                return nullptr;
+            if (!data.empty())
+                PlatformMemory::Copy(partialResource.getDataMemory().data(), data.data(), data.size());
+            return Finalize(std::move(partialResource));
+        }
+
+        absl::Span<Byte> PartialResource::getDataMemory()
+        {
+            if (isCompressed)
+                return { compressedData.data(), compressedData.size() };
+            return { data.data(), data.size() };
+        }
+
+        bool DeserializeDescription(absl::Span<const Byte> description, size_t dataSize, PartialResource& partialResource)
         {
             BinaryInputStream is(description.data());
-            ResourceContentHash hash;
-            is >> hash;
+            is >> partialResource.hash;
             ResourceSerializationHelper::DeserializedResourceHeader header =
                 ResourceSerializationHelper::ResourceFromMetadataStream(is);
+            if (!header.resource)
+                return false;
 
             const size_t expectedDataSize = header.compressionStatus == EResourceCompressionStatus_Compressed ?
                 header.compressedSize : header.decompressedSize;
 
-            if (data.size() != expectedDataSize)
+            if (dataSize > MaxResourceDataSize || header.decompressedSize > MaxResourceDataSize)
             {
-                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceSerialization::Deserialize: Expected resource size {} but got {}, compression state {}",
-                            expectedDataSize, data.size(), header.compressionStatus);
-                return nullptr;
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceSerialization::DeserializeDescription: Resource size {} (decompressed {}) exceeds maximum {}",
+                            dataSize, header.decompressedSize, MaxResourceDataSize);
+                return false;
             }
-            if (data.size() > 0)
+
+            if (dataSize != expectedDataSize)
             {
-                // TODO(Carsten): We need to set a compression level here, but we simply don't know which one it is.
-                // We just set offline for now to avoid any potential recompressing, but there shouldn't be
-                // any compressing on renderer side anyway.To implement correctly, we need to break network/file
-                // compatibility by serializing the IResource::CompressionLevel instead of EResourceCompressionStatus
-                if (header.compressionStatus == EResourceCompressionStatus_Compressed)
-                    header.resource->setCompressedResourceData(CompressedResourceBlob(data.size(), data.data()), IResource::CompressionLevel::Offline, header.decompressedSize, hash);
-                else
-                    header.resource->setResourceData(ResourceBlob(data.size(), data.data()), hash);
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceSerialization::DeserializeDescription: Expected resource size {} but got {}, compression state {}",
+                            expectedDataSize, dataSize, header.compressionStatus);
+                return false;
             }
-            return std::move(header.resource);
+
+            partialResource.resource = std::move(header.resource);
+            partialResource.decompressedSize = header.decompressedSize;
+            partialResource.isCompressed = (header.compressionStatus == EResourceCompressionStatus_Compressed);
+            // blob memory is left uninitialized, gets completely overwritten with received data
+            if (partialResource.isCompressed)
+                partialResource.compressedData = CompressedResourceBlob(dataSize);
+            else
+                partialResource.data = ResourceBlob(dataSize);
+            return true;
+        }
+
+        std::unique_ptr<IResource> Finalize(PartialResource&& partialResource)
+        {
+            // TODO(Carsten): We need to set a compression level here, but we simply don't know which one it is.
+            // We just set offline for now to avoid any potential recompressing, but there shouldn't be
+            // any compressing on renderer side anyway.To implement correctly, we need to break network/file
+            // compatibility by serializing the IResource::CompressionLevel instead of EResourceCompressionStatus
+            if (partialResource.isCompressed && partialResource.compressedData.size() > 0)
+                partialResource.resource->setCompressedResourceData(std::move(partialResource.compressedData), IResource::CompressionLevel::Offline, partialResource.decompressedSize, partialResource.hash);
+            else if (!partialResource.isCompressed && partialResource.data.size() > 0)
+                partialResource.resource->setResourceData(std::move(partialResource.data), partialResource.hash);
+            return std::move(partialResource.resource);
         }
     }
 }
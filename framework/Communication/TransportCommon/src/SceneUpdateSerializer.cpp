@@ -11,15 +11,24 @@
 
 namespace ramses_internal
 {
-    SceneUpdateSerializer::SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics)
+    SceneUpdateSerializer::SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics, PrepareResourceFunc prepareResource,
+                                                 const SceneActionDeltaEncoder* actionEncoder)
         : m_update(update)
         , m_sceneStatistics(sceneStatistics)
+        , m_prepareResource(std::move(prepareResource))
+        , m_actionEncoder(actionEncoder)
     {
     }
 
     bool SceneUpdateSerializer::writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const
     {
-        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics);
+        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics, m_prepareResource, m_actionEncoder);
+        return writer.write();
+    }
+
+    bool SceneUpdateSerializer::writeToGatheredPackets(size_t packetSize, const std::function<bool(SceneUpdatePacket&&)>& writeDoneFunc) const
+    {
+        SingleSceneUpdateWriter writer(m_update, packetSize, writeDoneFunc, m_sceneStatistics, m_prepareResource, m_actionEncoder);
         return writer.write();
     }
 
@@ -11,6 +11,7 @@
 #include "TransportCommon/SceneUpdateSerializationHelper.h"
 #include "Utils/LogMacros.h"
 #include "Utils/BinaryInputStream.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 namespace ramses_internal
 {
@@ -56,7 +57,10 @@ namespace ramses_internal
         while (is.getCurrentReadBytes() < data.size())
         {
             if (m_currentBlockSize != 0)
-                continueReadingBlock(is, data.size());
+            {
+                if (!continueReadingBlock(is, data.size()))
+                    return fail();
+            }
             else
             {
                 if (!startReadingNewBlock(is, data.size()))
@@ -64,7 +68,7 @@ namespace ramses_internal
             }
 
             // check if read full block
-            if (m_currentBlock.size() == m_currentBlockSize)
+            if (m_currentBlockBytesRead == m_currentBlockSize)
             {
                 if (!finalizeBlock())
                     return fail();
@@ -74,10 +78,10 @@ namespace ramses_internal
         // check if done with update
         if (m_nextExpectedPacketNum == 1)
         {
-            if (!m_currentBlock.empty() || m_currentBlockSize != 0)
+            if (m_currentBlockBytesRead != 0 || m_currentBlockSize != 0)
             {
                 LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::processData: Last packet but data left to read (read {}, needed {}, type {})",
-                            m_currentBlock.size(), m_currentBlockSize, m_blockType);
+                            m_currentBlockBytesRead, m_currentBlockSize, m_blockType);
                 return fail();
             }
 
@@ -90,21 +94,45 @@ namespace ramses_internal
         return Result{ResultType::Empty, SceneActionCollection(), {}, {}};
     }
 
-    void SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
+    bool SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
     {
-        assert(m_currentBlockSize > m_currentBlock.size());
+        assert(m_currentBlockSize > m_currentBlockBytesRead);
 
         const size_t remainingDatInPacket = dataSize - is.getCurrentReadBytes();
-        const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlock.size();
+        const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlockBytesRead;
         const size_t readBytes = std::min(remainingDatInPacket, remainingBytesToReadForBlock);
 
-        m_currentBlock.insert(m_currentBlock.end(), is.readPosition(), is.readPosition() + readBytes);
+        absl::Span<const Byte> blockData(is.readPosition(), readBytes);
         is.skip(readBytes);
+
+        while (!blockData.empty())
+        {
+            if (m_currentBlock.size() < m_currentBlockBufferSize)
+            {
+                const size_t bufferBytes = std::min(blockData.size(), m_currentBlockBufferSize - m_currentBlock.size());
+                m_currentBlock.insert(m_currentBlock.end(), blockData.begin(), blockData.begin() + bufferBytes);
+                m_currentBlockBytesRead += static_cast<uint32_t>(bufferBytes);
+                blockData.remove_prefix(bufferBytes);
+
+                if (m_currentBlock.size() == m_currentBlockBufferSize && IsStreamedBlockType(m_blockType))
+                {
+                    if (!handleBufferedBlockStart())
+                        return false;
+                }
+            }
+            else
+            {
+                writeStreamedBlockData(blockData);
+                m_currentBlockBytesRead += static_cast<uint32_t>(blockData.size());
+                blockData = {};
+            }
+        }
+        return true;
     }
 
     bool SceneUpdateStreamDeserializer::startReadingNewBlock(BinaryInputStream& is, size_t dataSize)
     {
-        assert(m_currentBlock.empty());
+        assert(m_currentBlock.empty() && m_currentBlockBytesRead == 0);
 
         // block header is guaranteed continuous
         if (is.getCurrentReadBytes() + sizeof(uint32_t)*2 > dataSize)
@@ -116,22 +144,90 @@ namespace ramses_internal
         is >> m_blockType
            >> m_currentBlockSize;
 
+        if (IsStreamedBlockType(m_blockType))
+        {
+            if (m_currentBlockSize < StreamedBlockHeaderSize)
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::startReadingNewBlock: Block too small ({}, type {})", m_currentBlockSize, m_blockType);
+                return false;
+            }
+            // only sizes and description are buffered, data is streamed into its final storage
+            m_currentBlockBufferSize = StreamedBlockHeaderSize;
+        }
+        else
+            m_currentBlockBufferSize = m_currentBlockSize;
+
         return true;
     }
 
+    bool SceneUpdateStreamDeserializer::IsStreamedBlockType(uint32_t blockType)
+    {
+        return blockType == static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection) ||
+            blockType == static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::Resource);
+    }
+
+    bool SceneUpdateStreamDeserializer::handleBufferedBlockStart()
+    {
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        is >> descSize
+           >> dataSize;
+
+        if (m_currentBlockBufferSize == StreamedBlockHeaderSize)
+        {
+            if (size_t(StreamedBlockHeaderSize) + descSize + dataSize != m_currentBlockSize)
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleBufferedBlockStart: Sizes do not match block size (desc {}, data {}, block {}, type {})",
+                            descSize, dataSize, m_currentBlockSize, m_blockType);
+                return false;
+            }
+
+            // read description next
+            m_currentBlockBufferSize += descSize;
+            if (descSize != 0)
+                return true;
+        }
+
+        const absl::Span<const Byte> description(m_currentBlock.data() + StreamedBlockHeaderSize, descSize);
+        if (static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+            return startSceneActionCollection(description, dataSize);
+        return startResource(description, dataSize);
+    }
+
+    void SceneUpdateStreamDeserializer::writeStreamedBlockData(absl::Span<const Byte> data)
+    {
+        if (static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+        {
+            // only part of the capacity was reserved upfront, vector grows with received data
+            std::vector<Byte>& actionData = m_currentResult.actions.getRawDataForDirectWriting();
+            actionData.insert(actionData.end(), data.begin(), data.end());
+        }
+        else
+        {
+            const size_t offset = m_currentBlockBytesRead - m_currentBlockBufferSize;
+            const absl::Span<Byte> resourceData = m_currentResource.getDataMemory();
+            assert(offset + data.size() <= resourceData.size());
+            PlatformMemory::Copy(resourceData.data() + offset, data.data(), data.size());
+        }
+    }
+
     bool SceneUpdateStreamDeserializer::finalizeBlock()
     {
         SingleSceneUpdateWriter::BlockType blockType = static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType);
 
         if (blockType == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
         {
-            if (!handleSceneActionCollection())
+            // data was already streamed into actions
+        }
+        else if (blockType == SingleSceneUpdateWriter::BlockType::EncodedSceneActionCollection)
+        {
+            if (!handleEncodedSceneActionCollection())
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::Resource)
         {
-            if (!handleResource())
-                return false;
+            finalizeResource();
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::FlushInfos)
         {
@@ -146,6 +242,8 @@ namespace ramses_internal
 
         m_currentBlock.clear();
         m_currentBlockSize = 0;
+        m_currentBlockBytesRead = 0;
+        m_currentBlockBufferSize = 0;
         return true;
     }
 
@@ -155,48 +253,48 @@ namespace ramses_internal
         return Result{ResultType::Failed, SceneActionCollection(), {}, {}};
     }
 
-    bool SceneUpdateStreamDeserializer::handleSceneActionCollection()
+    bool SceneUpdateStreamDeserializer::startSceneActionCollection(absl::Span<const Byte> description, uint32_t dataSize)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (m_currentResult.actions.numberOfActions() != 0)
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::startSceneActionCollection: More than one SceneActionCollection in packet");
             return false;
         }
-        if (m_currentResult.actions.numberOfActions() != 0)
+        if (!SceneActionSerialization::IsValidDescription(description))
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: More than one SceneActionCollection in packet");
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::startSceneActionCollection: Invalid description (size {})", description.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
-        uint32_t descSize = 0;
-        uint32_t dataSize = 0;
-        is >> descSize
-           >> dataSize;
-
-        m_currentResult.actions = SceneActionSerialization::Deserialize(absl::Span<const Byte>(is.readPosition(), descSize),
-                                                                        absl::Span<const Byte>(is.readPosition() + descSize, dataSize));
+        m_currentResult.actions = SceneActionSerialization::DeserializeDescription(description, dataSize);
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::handleResource()
+    bool SceneUpdateStreamDeserializer::handleEncodedSceneActionCollection()
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (m_currentResult.actions.numberOfActions() != 0)
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleEncodedSceneActionCollection: More than one SceneActionCollection in packet");
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
-        uint32_t descSize = 0;
-        uint32_t dataSize = 0;
-        is >> descSize
-           >> dataSize;
+        return m_actionDecoder.decode(m_currentBlock, m_currentResult.actions);
+    }
 
-        m_currentResult.resources.push_back(ResourceSerialization::Deserialize(absl::Span<const Byte>(is.readPosition(), descSize),
-                                                                               absl::Span<const Byte>(is.readPosition() + descSize, dataSize)));
+    bool SceneUpdateStreamDeserializer::startResource(absl::Span<const Byte> description, uint32_t dataSize)
+    {
+        if (!ResourceSerialization::DeserializeDescription(description, dataSize, m_currentResource))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::startResource: Invalid description (size {})", description.size());
+            return false;
+        }
         return true;
+    }
 
+    void SceneUpdateStreamDeserializer::finalizeResource()
+    {
+        m_currentResult.resources.push_back(ResourceSerialization::Finalize(std::move(m_currentResource)));
+        m_currentResource = ResourceSerialization::PartialResource();
     }
 
     bool SceneUpdateStreamDeserializer::handleFlushInfos()
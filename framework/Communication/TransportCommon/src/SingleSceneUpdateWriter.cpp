@@ -8,18 +8,24 @@
 
 #include "TransportCommon/SingleSceneUpdateWriter.h"
 #include "TransportCommon/SceneUpdateSerializationHelper.h"
+#include "TransportCommon/SceneActionDeltaEncoding.h"
 #include "Utils/StatisticCollection.h"
 #include "Utils/LogMacros.h"
+#include "Utils/RawBinaryOutputStream.h"
 
 #include <functional>
+#include <cstring>
 
 namespace ramses_internal
 {
-    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics)
+    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics,
+                                                     const std::function<void(size_t)>& prepareResource, const SceneActionDeltaEncoder* actionEncoder)
         : m_update(update)
         , m_packetMem(packetMem)
+        , m_packetSize(packetMem.size())
         , m_writeDoneFunc(writeDoneFunc)
-        , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
+        , m_prepareResource(prepareResource)
+        , m_actionEncoder(actionEncoder)
         , m_sceneStatistics(sceneStatistics)
     {
         /*
@@ -41,6 +47,9 @@ namespace ramses_internal
           - type list blob
           - data blob
 
+          Encoded SceneAction data
+          - see SceneActionDeltaEncoding.h
+
           Resource data
           - metadata length : uin32_t
           - blob length : uint32_t
@@ -49,11 +58,22 @@ namespace ramses_internal
          */
     }
 
+    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, size_t packetSize, const std::function<bool(SceneUpdatePacket&&)>& gatheredWriteDoneFunc, StatisticCollectionScene& sceneStatistics,
+                                                     const std::function<void(size_t)>& prepareResource, const SceneActionDeltaEncoder* actionEncoder)
+        : m_update(update)
+        , m_packetSize(packetSize)
+        , m_gatheredWriteDoneFunc(gatheredWriteDoneFunc)
+        , m_prepareResource(prepareResource)
+        , m_actionEncoder(actionEncoder)
+        , m_sceneStatistics(sceneStatistics)
+    {
+    }
+
     bool SingleSceneUpdateWriter::write()
     {
-        if (m_packetMem.size() < 50)
+        if (m_packetSize < 50)
         {
-            LOG_FATAL_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::write: Packet size of {} is too small", m_packetMem.size());
+            LOG_FATAL_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::write: Packet size of {} is too small", m_packetSize);
             return false;
         }
 
@@ -62,9 +82,11 @@ namespace ramses_internal
         if (!writeSceneActionCollection())
             return false;
 
-        for (const auto& res : m_update.resources)
+        for (size_t i = 0; i < m_update.resources.size(); ++i)
         {
-            if (!writeResource(*res))
+            if (m_prepareResource)
+                m_prepareResource(i);
+            if (!writeResource(m_update.resources[i]))
                 return false;
         }
 
@@ -72,7 +94,7 @@ namespace ramses_internal
             if (!writeFlushInfos(m_update.flushInfos))
                 return false;
 
-        if (m_packetWriter.getBytesWritten() > 0)
+        if (m_packetBytesWritten > 0)
         {
             if (!finalizePacket(false))
                 return false;
@@ -85,6 +107,10 @@ namespace ramses_internal
 
     bool SingleSceneUpdateWriter::writeSceneActionCollection()
     {
+        // encoder was prepared with same actions, falls back to plain actions if they were not worth encoding
+        if (m_actionEncoder && !m_actionEncoder->getEncodedBlock().empty())
+            return writeBlock(BlockType::EncodedSceneActionCollection, {m_actionEncoder->getEncodedBlock()});
+
         m_temporaryMemToSerializeDescription.clear();
         const auto descSpan = SceneActionSerialization::SerializeDescription(m_update.actions, m_temporaryMemToSerializeDescription);
         const auto dataSpan = SceneActionSerialization::SerializeData(m_update.actions);
@@ -96,17 +122,19 @@ namespace ramses_internal
         return writeBlock(BlockType::SceneActionCollection, {{os.getData(), os.getSize()}, descSpan, dataSpan});
     }
 
-    bool SingleSceneUpdateWriter::writeResource(const IResource& res)
+    bool SingleSceneUpdateWriter::writeResource(const ManagedResource& res)
     {
         m_temporaryMemToSerializeDescription.clear();
-        const auto descSpan = ResourceSerialization::SerializeDescription(res, m_temporaryMemToSerializeDescription);
-        const auto dataSpan = ResourceSerialization::SerializeData(res);
+        const auto descSpan = ResourceSerialization::SerializeDescription(*res, m_temporaryMemToSerializeDescription);
+        std::shared_ptr<const void> dataOwner;
+        const auto dataSpan = ResourceSerialization::SerializeSharedData(*res, dataOwner);
 
         Byte header[sizeof(uint32_t)*2];
         RawBinaryOutputStream os(header, sizeof(header));
         os << static_cast<uint32_t>(descSpan.size())
            << static_cast<uint32_t>(dataSpan.size());
-        return writeBlock(BlockType::Resource, {{os.getData(), os.getSize()}, descSpan, dataSpan});
+        // blob is kept alive by gathered packets referencing it, independent of later changes to resource
+        return writeBlock(BlockType::Resource, {{os.getData(), os.getSize()}, descSpan}, dataSpan, dataOwner);
     }
 
     bool SingleSceneUpdateWriter::writeFlushInfos(const FlushInformation& infos)
@@ -122,15 +150,22 @@ namespace ramses_internal
 
     void SingleSceneUpdateWriter::initializePacket()
     {
-        m_packetWriter = RawBinaryOutputStream(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()));
         // reserve space for packet header, will be written at end
-        m_packetWriter << static_cast<uint32_t>(0)
-                       << static_cast<uint32_t>(0);  // placeholders
+        const Byte placeholders[sizeof(uint32_t)*2] = {};
+        m_packetBytesWritten = 0u;
+        if (m_gatheredWriteDoneFunc)
+        {
+            m_gatheredPacket = SceneUpdatePacket();
+            m_gatheredPacket.append(placeholders);
+        }
+        else
+            std::memcpy(m_packetMem.data(), placeholders, sizeof(placeholders));
+        m_packetBytesWritten += sizeof(placeholders);
     }
 
-    bool SingleSceneUpdateWriter::writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans)
+    bool SingleSceneUpdateWriter::writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans, absl::Span<const Byte> referencedData, const std::shared_ptr<const void>& dataOwner)
     {
-        size_t blockSize = 0;
+        size_t blockSize = referencedData.size();
         for (const auto s : spans)
             blockSize += s.size();
         Byte header[sizeof(uint32_t)*2];
@@ -144,16 +179,16 @@ namespace ramses_internal
             if (!writeDataToPackets(s))
                 return false;
         }
-        return true;
+        return writeDataToPackets(referencedData, false, dataOwner);
     }
 
-    bool SingleSceneUpdateWriter::writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous)
+    bool SingleSceneUpdateWriter::writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous, const std::shared_ptr<const void>& dataOwner)
     {
         while (data.size() > 0)
         {
             const bool startNewPacket = writeContinuous ?
-                (m_packetMem.size() < m_packetWriter.getBytesWritten() + data.size()) :
-                (m_packetMem.size() == m_packetWriter.getBytesWritten());
+                (m_packetSize < m_packetBytesWritten + data.size()) :
+                (m_packetSize == m_packetBytesWritten);
 
             if (startNewPacket)
             {
@@ -163,10 +198,17 @@ namespace ramses_internal
                 initializePacket();
             }
 
-            const size_t capacityRemaining = m_packetMem.size() - m_packetWriter.getBytesWritten();
+            const size_t capacityRemaining = m_packetSize - m_packetBytesWritten;
             const size_t writeBytes = std::min(capacityRemaining, data.size());
-
-            m_packetWriter.write(data.data(), static_cast<uint32_t>(writeBytes));
+            const auto writeData = data.subspan(0, writeBytes);
+
+            if (!m_gatheredWriteDoneFunc)
+                std::memcpy(m_packetMem.data() + m_packetBytesWritten, writeData.data(), writeBytes);
+            else if (dataOwner && writeBytes >= minReferencedDataSize)
+                m_gatheredPacket.appendReference(writeData, dataOwner);
+            else
+                m_gatheredPacket.append(writeData);
+            m_packetBytesWritten += writeBytes;
             data = data.subspan(writeBytes);
         }
         return true;
@@ -174,16 +216,29 @@ namespace ramses_internal
 
     bool SingleSceneUpdateWriter::finalizePacket(bool more)
     {
-        RawBinaryOutputStream headerWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()));
+        Byte header[sizeof(uint32_t)*2];
+        RawBinaryOutputStream headerWriter(header, sizeof(header));
         headerWriter << m_packetNum
                      << static_cast<uint32_t>(more ? hasMorePacketsFlag : lastPacketFlag);
 
-        if (!m_writeDoneFunc(m_packetWriter.getBytesWritten()))
+        const auto bytesWritten{m_packetBytesWritten};
+        bool writeDone = false;
+        if (m_gatheredWriteDoneFunc)
+        {
+            m_gatheredPacket.overwriteStart(header);
+            writeDone = m_gatheredWriteDoneFunc(std::move(m_gatheredPacket));
+        }
+        else
+        {
+            std::memcpy(m_packetMem.data(), header, sizeof(header));
+            writeDone = m_writeDoneFunc(bytesWritten);
+        }
+
+        if (!writeDone)
         {
-            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::finalizePacket: Packet write failed (size {})", m_packetWriter.getBytesWritten());
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::finalizePacket: Packet write failed (size {})", bytesWritten);
             return false;
         }
-        const auto bytesWritten{m_packetWriter.getBytesWritten()};
         m_sceneStatistics.statSceneUpdatesGeneratedSize.incCounter(static_cast<uint32_t>(bytesWritten));
         m_sceneStatistics.statSceneUpdatesGeneratedPackets.incCounter(1);
 
@@ -276,6 +276,32 @@ namespace ramses_internal
         state->disconnectAll();
     }
 
+    TEST_P(ACommunicationSystemWithDaemon, canMulticastSceneUpdateToTwoOthers)
+    {
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver_1 = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver_1");
+        auto receiver_2 = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver_2");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler_1;
+        receiver_1->commSystem->setSceneRendererServiceHandler(&handler_1);
+
+        StrictMock<SceneRendererServiceHandlerMock> handler_2;
+        receiver_2->commSystem->setSceneRendererServiceHandler(&handler_2);
+
+        const SceneId sceneId(123);
+        StatisticCollectionScene sceneStatistics;
+        EXPECT_CALL(handler_1, handleSceneUpdate(sceneId, _, sender->id)).WillOnce(InvokeWithoutArgs([&](){ state->sendEvent(); }));
+        EXPECT_CALL(handler_2, handleSceneUpdate(sceneId, _, sender->id)).WillOnce(InvokeWithoutArgs([&](){ state->sendEvent(); }));
+        EXPECT_TRUE(sender->commSystem->multicastSceneUpdate({ receiver_1->id, receiver_2->id }, sceneId, SceneUpdateSerializer(SceneUpdate(), sceneStatistics)));
+
+        ASSERT_TRUE(state->event.waitForEvents(2));
+
+        state->disconnectAll();
+    }
+
     TEST_P(ACommunicationSystemWithDaemon, getsParticipantConnectedNotificationsAfterConnectAndDisconnectMultipleTimes)
     {
         auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
@@ -0,0 +1,174 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportCommon/SceneActionDeltaEncoding.h"
+#include "Scene/SceneActionCollection.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <limits>
+
+namespace ramses_internal
+{
+    class ASceneActionDeltaEncoding : public ::testing::Test
+    {
+    public:
+        static SceneActionCollection CreateActions(float value, uint32_t numActions = 100u)
+        {
+            SceneActionCollection actions;
+            for (uint32_t i = 0u; i < numActions; ++i)
+            {
+                actions.beginWriteSceneAction(ESceneActionId::SetTransformComponent);
+                actions.write(i);
+                actions.write(value);
+                actions.write(value + 1.f);
+                actions.write(value + 2.f);
+            }
+            return actions;
+        }
+
+        void encodeAndExpectDecodedToSame(const SceneActionCollection& actions, const std::vector<Guid>& recipients)
+        {
+            ASSERT_TRUE(encoder.prepare(actions, recipients));
+            SceneActionCollection decoded;
+            ASSERT_TRUE(decoder.decode(encoder.getEncodedBlock(), decoded));
+            EXPECT_EQ(actions, decoded);
+            encoder.finishUpdate(true);
+        }
+
+    protected:
+        SceneActionDeltaEncoder encoder;
+        SceneActionDeltaDecoder decoder;
+        const std::vector<Guid> recipients{ Guid(1), Guid(2) };
+    };
+
+    TEST_F(ASceneActionDeltaEncoding, doesNotEncodeSmallActions)
+    {
+        EXPECT_FALSE(encoder.prepare(CreateActions(1.f, 1u), recipients));
+        EXPECT_TRUE(encoder.getEncodedBlock().empty());
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, canEncodeDecodeSequenceOfUpdates)
+    {
+        encodeAndExpectDecodedToSame(CreateActions(1.f), recipients);
+        encodeAndExpectDecodedToSame(CreateActions(2.f), recipients);
+        encodeAndExpectDecodedToSame(CreateActions(2.f, 150u), recipients);
+        encodeAndExpectDecodedToSame(CreateActions(3.f, 50u), recipients);
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, encodesRepeatedUpdateSmallerThanFirst)
+    {
+        ASSERT_TRUE(encoder.prepare(CreateActions(1.f), recipients));
+        const size_t firstSize = encoder.getEncodedBlock().size();
+        encoder.finishUpdate(true);
+
+        ASSERT_TRUE(encoder.prepare(CreateActions(1.f), recipients));
+        EXPECT_LT(encoder.getEncodedBlock().size(), firstSize);
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, usesReferenceRegardlessOfRecipientOrder)
+    {
+        encodeAndExpectDecodedToSame(CreateActions(1.f), { Guid(2), Guid(1) });
+        encodeAndExpectDecodedToSame(CreateActions(2.f), { Guid(1), Guid(2) });
+
+        // decoder without reference cannot decode, i.e. reference was used
+        ASSERT_TRUE(encoder.prepare(CreateActions(3.f), { Guid(2), Guid(1) }));
+        SceneActionDeltaDecoder newDecoder;
+        SceneActionCollection decoded;
+        EXPECT_FALSE(newDecoder.decode(encoder.getEncodedBlock(), decoded));
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, doesNotUseReferenceForDifferentRecipients)
+    {
+        encodeAndExpectDecodedToSame(CreateActions(1.f), recipients);
+
+        ASSERT_TRUE(encoder.prepare(CreateActions(2.f), { Guid(1), Guid(2), Guid(3) }));
+        SceneActionDeltaDecoder newDecoder;
+        SceneActionCollection decoded;
+        ASSERT_TRUE(newDecoder.decode(encoder.getEncodedBlock(), decoded));
+        EXPECT_EQ(CreateActions(2.f), decoded);
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, doesNotUseReferenceAfterResetOrFailedSend)
+    {
+        encodeAndExpectDecodedToSame(CreateActions(1.f), recipients);
+        encoder.reset();
+        ASSERT_TRUE(encoder.prepare(CreateActions(2.f), recipients));
+        SceneActionDeltaDecoder newDecoder;
+        SceneActionCollection decoded;
+        ASSERT_TRUE(newDecoder.decode(encoder.getEncodedBlock(), decoded));
+        encoder.finishUpdate(false);
+
+        ASSERT_TRUE(encoder.prepare(CreateActions(3.f), recipients));
+        SceneActionDeltaDecoder otherNewDecoder;
+        ASSERT_TRUE(otherNewDecoder.decode(encoder.getEncodedBlock(), decoded));
+        EXPECT_EQ(CreateActions(3.f), decoded);
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, failsDecodeWhenReferencedUpdateWasMissed)
+    {
+        encodeAndExpectDecodedToSame(CreateActions(1.f), recipients);
+
+        // update not received by decoder
+        ASSERT_TRUE(encoder.prepare(CreateActions(2.f), recipients));
+        encoder.finishUpdate(true);
+
+        ASSERT_TRUE(encoder.prepare(CreateActions(3.f), recipients));
+        SceneActionCollection decoded;
+        EXPECT_FALSE(decoder.decode(encoder.getEncodedBlock(), decoded));
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, failsDecodeCorruptedBlock)
+    {
+        ASSERT_TRUE(encoder.prepare(CreateActions(1.f), recipients));
+        std::vector<Byte> block(encoder.getEncodedBlock().begin(), encoder.getEncodedBlock().end());
+        block.resize(block.size() / 2);
+        SceneActionCollection decoded;
+        EXPECT_FALSE(decoder.decode(block, decoded));
+        EXPECT_FALSE(decoder.decode(absl::Span<const Byte>(block.data(), 4u), decoded));
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, failsDecodeBlockAnnouncingSizeNotReachableByCompression)
+    {
+        ASSERT_TRUE(encoder.prepare(CreateActions(1.f), recipients));
+        std::vector<Byte> block(encoder.getEncodedBlock().begin(), encoder.getEncodedBlock().end());
+        SceneActionCollection decoded;
+
+        // data size far beyond what compressed payload can hold, would overflow int when passed to LZ4
+        const uint32_t hugeSize = std::numeric_limits<uint32_t>::max();
+        std::memcpy(block.data() + sizeof(uint32_t), &hugeSize, sizeof(hugeSize));
+        EXPECT_FALSE(decoder.decode(block, decoded));
+
+        const uint32_t tooLargeForPayload = static_cast<uint32_t>((block.size() - 4u * sizeof(uint32_t)) * 256u);
+        std::memcpy(block.data() + sizeof(uint32_t), &tooLargeForPayload, sizeof(tooLargeForPayload));
+        EXPECT_FALSE(decoder.decode(block, decoded));
+    }
+
+    TEST_F(ASceneActionDeltaEncoding, failsDecodeBlockWithInvalidDescription)
+    {
+        const SceneActionCollection actions = CreateActions(1.f);
+        ASSERT_TRUE(encoder.prepare(actions, recipients));
+        std::vector<Byte> block(encoder.getEncodedBlock().begin(), encoder.getEncodedBlock().end());
+
+        // shift boundary between description and data, total decoded size stays same
+        uint32_t descSize = 0u;
+        uint32_t dataSize = 0u;
+        std::memcpy(&descSize, block.data(), sizeof(descSize));
+        std::memcpy(&dataSize, block.data() + sizeof(uint32_t), sizeof(dataSize));
+        descSize += 4u;
+        dataSize -= 4u;
+        std::memcpy(block.data(), &descSize, sizeof(descSize));
+        std::memcpy(block.data() + sizeof(uint32_t), &dataSize, sizeof(dataSize));
+
+        SceneActionCollection decoded;
+        EXPECT_FALSE(decoder.decode(block, decoded));
+
+        // decoder state is not affected by failed block
+        encoder.finishUpdate(false);
+        encodeAndExpectDecodedToSame(actions, recipients);
+    }
+}
@@ -10,6 +10,10 @@
 #include "Scene/SceneActionCollection.h"
 #include "ResourceSerializationTestHelper.h"
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 
 namespace ramses_internal
 {
@@ -44,6 +48,42 @@ namespace ramses_internal
         EXPECT_EQ(in, SerializeDeserialize(in));
     }
 
+    TEST_F(ASceneActionSerialization, canDeserializeDescriptionAndAppendDataSeparately)
+    {
+        SceneActionCollection in;
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+        in.write(static_cast<uint32_t>(123));
+        in.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        in.write(String("foobar"));
+
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+        const absl::Span<const Byte> data = SceneActionSerialization::SerializeData(in);
+        ASSERT_TRUE(SceneActionSerialization::IsValidDescription(desc));
+        SceneActionCollection out = SceneActionSerialization::DeserializeDescription(desc, data.size());
+        out.getRawDataForDirectWriting().insert(out.getRawDataForDirectWriting().end(), data.begin(), data.end());
+        EXPECT_EQ(in, out);
+    }
+
+    TEST_F(ASceneActionSerialization, reservesOnlyLimitedDataCapacityForDataSizeFromDescription)
+    {
+        SceneActionCollection in;
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+
+        SceneActionCollection out = SceneActionSerialization::DeserializeDescription(desc, std::numeric_limits<uint32_t>::max());
+        EXPECT_GE(SceneActionSerialization::MaxReservedDataSize, out.getRawDataForDirectWriting().capacity());
+        EXPECT_EQ(1u, out.numberOfActions());
+    }
+
+    TEST_F(ASceneActionSerialization, detectsInvalidDescription)
+    {
+        SceneActionCollection in;
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+        EXPECT_FALSE(SceneActionSerialization::IsValidDescription({}));
+        EXPECT_FALSE(SceneActionSerialization::IsValidDescription(desc.subspan(0, desc.size() - 1)));
+    }
+
 
     class AResourceSerialization : public ::testing::Test
     {
@@ -105,6 +145,23 @@ namespace ramses_internal
         ResourceSerializationTestHelper::CompareTypedResources(static_cast<const ArrayResource&>(*res), static_cast<const ArrayResource&>(*deserRes));
     }
 
+    TEST_F(AResourceSerialization, canDeserializeDescriptionAndWriteDataSeparately)
+    {
+        const std::unique_ptr<IResource> res(ResourceSerializationTestHelper::CreateTestResource<ArrayResource>(1000));
+        const absl::Span<const Byte> desc = ResourceSerialization::SerializeDescription(*res, workingMem);
+        const absl::Span<const Byte> data = ResourceSerialization::SerializeData(*res);
+
+        ResourceSerialization::PartialResource partialResource;
+        ASSERT_TRUE(ResourceSerialization::DeserializeDescription(desc, data.size(), partialResource));
+        ASSERT_EQ(data.size(), partialResource.getDataMemory().size());
+        std::copy(data.begin(), data.end(), partialResource.getDataMemory().begin());
+
+        std::unique_ptr<IResource> deserRes(ResourceSerialization::Finalize(std::move(partialResource)));
+        ASSERT_TRUE(deserRes);
+        ResourceSerializationTestHelper::CompareResourceValues(*res, *deserRes);
+        ResourceSerializationTestHelper::CompareTypedResources(static_cast<const ArrayResource&>(*res), static_cast<const ArrayResource&>(*deserRes));
+    }
+
     TEST_F(AResourceSerialization, deserializeFailsWithDataSizeMatch)
     {
         const std::unique_ptr<IResource> res(ResourceSerializationTestHelper::CreateTestResource<ArrayResource>(1000));
@@ -115,4 +172,26 @@ namespace ramses_internal
         std::unique_ptr<IResource> deserRes(ResourceSerialization::Deserialize(desc, data.subspan(1)));
         ASSERT_FALSE(deserRes);
     }
+
+    TEST_F(AResourceSerialization, deserializeDescriptionFailsForDataSizeAboveMaximum)
+    {
+        const std::unique_ptr<IResource> res(ResourceSerializationTestHelper::CreateTestResource<ArrayResource>(1000));
+        const absl::Span<const Byte> desc = ResourceSerialization::SerializeDescription(*res, workingMem);
+        const uint32_t dataSize = static_cast<uint32_t>(ResourceSerialization::SerializeData(*res).size());
+
+        // description of uncompressed resource claiming data size above maximum, i.e. expected and announced size match
+        std::vector<Byte> corruptedDesc(desc.begin(), desc.end());
+        const std::array<uint32_t, 2> sizes = { 0u, dataSize };
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto sizesBytes = reinterpret_cast<const Byte*>(sizes.data());
+        const auto sizesIt = std::search(corruptedDesc.begin(), corruptedDesc.end(), sizesBytes, sizesBytes + sizeof(sizes));
+        ASSERT_NE(corruptedDesc.end(), sizesIt);
+        const uint32_t tooBigSize = static_cast<uint32_t>(ResourceSerialization::MaxResourceDataSize + 1u);
+        std::memcpy(&*sizesIt + sizeof(uint32_t), &tooBigSize, sizeof(tooBigSize));
+
+        ResourceSerialization::PartialResource partialResource;
+        EXPECT_FALSE(ResourceSerialization::DeserializeDescription(corruptedDesc, tooBigSize, partialResource));
+        EXPECT_TRUE(partialResource.getDataMemory().empty());
+        EXPECT_TRUE(ResourceSerialization::DeserializeDescription(desc, dataSize, partialResource));
+    }
 }
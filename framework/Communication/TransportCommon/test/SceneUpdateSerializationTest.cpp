@@ -8,6 +8,9 @@
 
 #include "TransportCommon/SceneUpdateSerializer.h"
 #include "TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "TransportCommon/SceneActionDeltaEncoding.h"
+#include "TransportCommon/SingleSceneUpdateWriter.h"
+#include "Utils/RawBinaryOutputStream.h"
 #include "Components/SceneUpdate.h"
 #include "Scene/SceneActionCollection.h"
 #include "gtest/gtest.h"
@@ -26,7 +29,7 @@ namespace ramses_internal
     public:
         bool serialize(size_t pktSize)
         {
-            SceneUpdateSerializer sus(update, sceneStatistics);
+            SceneUpdateSerializer sus(update, sceneStatistics, {}, actionEncoder);
             std::vector<Byte> vec(pktSize);
             return sus.writeToPackets({vec.data(), vec.size()}, [&](size_t s) {
                 data.push_back(vec);
@@ -35,6 +38,20 @@ namespace ramses_internal
             });
         }
 
+        bool serializeGathered(size_t pktSize)
+        {
+            SceneUpdateSerializer sus(update, sceneStatistics, {}, actionEncoder);
+            return sus.writeToGatheredPackets(pktSize, [&](SceneUpdatePacket&& packet) {
+                std::vector<Byte> vec;
+                for (const auto& piece : packet.getPieces())
+                    vec.insert(vec.end(), piece.begin(), piece.end());
+                EXPECT_EQ(packet.size(), vec.size());
+                data.push_back(std::move(vec));
+                gatheredPackets.push_back(std::move(packet));
+                return true;
+            });
+        }
+
         void addTestActions()
         {
             update.actions.beginWriteSceneAction(ESceneActionId::TestAction);
@@ -108,6 +125,8 @@ namespace ramses_internal
         SceneUpdate update;
         StatisticCollectionScene sceneStatistics;
         std::vector<std::vector<Byte>> data;
+        std::vector<SceneUpdatePacket> gatheredPackets;
+        const SceneActionDeltaEncoder* actionEncoder = nullptr;
     };
 
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeEmptyUpdate)
@@ -205,7 +224,7 @@ namespace ramses_internal
 
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnFirstPacket)
     {
-        SceneUpdateSerializer sus(update, sceneStatistics);
+        SceneUpdateSerializer sus(update, sceneStatistics, {}, actionEncoder);
         std::vector<Byte> vec(60);
         EXPECT_FALSE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t) {
             return false;
@@ -215,7 +234,7 @@ namespace ramses_internal
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnLaterPacketInResource)
     {
         update.resources.push_back(CreateTestResource(2500));
-        SceneUpdateSerializer sus(update, sceneStatistics);
+        SceneUpdateSerializer sus(update, sceneStatistics, {}, actionEncoder);
         std::vector<Byte> vec(60);
         int cnt = 0;
         EXPECT_FALSE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t) {
@@ -229,7 +248,7 @@ namespace ramses_internal
     {
         for (size_t i = 0; i < 100; ++i)
             addTestActions();
-        SceneUpdateSerializer sus(update, sceneStatistics);
+        SceneUpdateSerializer sus(update, sceneStatistics, {}, actionEncoder);
         std::vector<Byte> vec(60);
         int cnt = 0;
         EXPECT_FALSE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t) {
@@ -287,6 +306,86 @@ namespace ramses_internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, gatheredPacketsHaveSameContentAsPacketsWrittenToMemory)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        update.resources.push_back(CreateTestResource(100000));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        addFlushInformation();
+        EXPECT_TRUE(serialize(10000));
+        const auto packetsInMemory = data;
+
+        data.clear();
+        EXPECT_TRUE(serializeGathered(10000));
+        EXPECT_EQ(packetsInMemory, data);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, gatheredPacketsReferenceLargeResourceBlobsInsteadOfCopying)
+    {
+        update.resources.push_back(CreateTestResource(100000));
+        const auto& blob = update.resources.front()->getResourceData();
+        EXPECT_TRUE(serializeGathered(300000));
+        ASSERT_EQ(1u, gatheredPackets.size());
+
+        const auto pieces = gatheredPackets.front().getPieces();
+        EXPECT_TRUE(std::any_of(pieces.cbegin(), pieces.cend(), [&](const auto& piece) { return piece.data() == blob.data() && piece.size() == blob.size(); }));
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, gatheredPacketsCopySmallResourceBlobs)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        const auto& blob = update.resources.front()->getResourceData();
+        EXPECT_TRUE(serializeGathered(1000));
+        ASSERT_EQ(1u, gatheredPackets.size());
+
+        const auto pieces = gatheredPackets.front().getPieces();
+        EXPECT_EQ(1u, pieces.size());
+        EXPECT_NE(blob.data(), pieces.front().data());
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, gatheredPacketsKeepSentBlobAliveWhenResourceIsRecompressedWhileSendIsPending)
+    {
+        // data must not compress well, otherwise compressed blob is too small to be referenced instead of copied
+        std::mt19937 gen(42u);
+        ResourceBlob noise(100000);
+        std::generate(noise.data(), noise.data() + noise.size(), [&]() { return static_cast<Byte>(gen()); });
+        IResource* res = new ArrayResource(EResourceType_VertexArray, 100000, EDataType::Vector3F, nullptr, ResourceCacheFlag(15u), "resName");
+        res->setResourceData(std::move(noise));
+        update.resources.push_back(ManagedResource{ res, deleterMock });
+        const IResource& resource = *update.resources.front();
+        resource.compress(IResource::CompressionLevel::Realtime);
+        ASSERT_GT(resource.getCompressedResourceData().size(), SingleSceneUpdateWriter::minReferencedDataSize);
+        const std::weak_ptr<const CompressedResourceBlob> sentBlob = resource.getSharedCompressedResourceData();
+        ASSERT_FALSE(sentBlob.expired());
+        const std::vector<Byte> sentContent(sentBlob.lock()->data(), sentBlob.lock()->data() + sentBlob.lock()->size());
+
+        EXPECT_TRUE(serializeGathered(300000));
+        ASSERT_EQ(1u, gatheredPackets.size());
+
+        // e.g. resource stored to file with offline compression while packet is still being sent
+        resource.compress(IResource::CompressionLevel::Offline);
+        EXPECT_NE(sentBlob.lock(), resource.getSharedCompressedResourceData());
+        update.resources.clear();
+        ASSERT_FALSE(sentBlob.expired());
+
+        // packet is written only now, as asio does after send was triggered
+        std::vector<Byte> sentPacket;
+        for (const auto& piece : gatheredPackets.front().getPieces())
+            sentPacket.insert(sentPacket.end(), piece.begin(), piece.end());
+        const auto result = deser.processData(sentPacket);
+        ASSERT_EQ(SceneUpdateStreamDeserializer::ResultType::HasData, result.result);
+        ASSERT_EQ(1u, result.resources.size());
+        const auto& receivedBlob = result.resources.front()->getCompressedResourceData();
+        EXPECT_EQ(sentContent, std::vector<Byte>(receivedBlob.data(), receivedBlob.data() + receivedBlob.size()));
+
+        gatheredPackets.clear();
+        EXPECT_TRUE(sentBlob.expired());
+    }
+
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeSameUpdateMultipleTimesWithSameDeserializer)
     {
         update.resources.push_back(CreateTestResource(100));
@@ -329,6 +428,91 @@ namespace ramses_internal
         }
     }
 
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeDeltaEncodedSceneActions)
+    {
+        SceneActionDeltaEncoder encoder;
+        actionEncoder = &encoder;
+        const std::vector<Guid> recipients{ Guid(5) };
+
+        update.resources.push_back(CreateTestResource(100));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        addFlushInformation();
+        ASSERT_TRUE(encoder.prepare(update.actions, recipients));
+        EXPECT_TRUE(serialize(1000));
+        encoder.finishUpdate(true);
+        const size_t firstUpdateSize = data.size();
+        expectDeserializeToSame();
+
+        data.clear();
+        ASSERT_TRUE(encoder.prepare(update.actions, recipients));
+        EXPECT_TRUE(serializeGathered(1000));
+        encoder.finishUpdate(true);
+        EXPECT_LE(data.size(), firstUpdateSize);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsDeserializeDeltaEncodedSceneActionsWhenReferenceWasMissed)
+    {
+        SceneActionDeltaEncoder encoder;
+        actionEncoder = &encoder;
+        const std::vector<Guid> recipients{ Guid(5) };
+
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        ASSERT_TRUE(encoder.prepare(update.actions, recipients));
+        EXPECT_TRUE(serialize(1000));
+        encoder.finishUpdate(true);
+
+        data.clear();
+        ASSERT_TRUE(encoder.prepare(update.actions, recipients));
+        EXPECT_TRUE(serialize(1000));
+        encoder.finishUpdate(true);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deserialize().result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, canDeserializeWhenPacketsSplitBlockSizesAndDescriptions)
+    {
+        update.resources.push_back(CreateTestResource(1000));
+        update.resources.push_back(CreateTestResource(3));
+        for (size_t i = 0; i < 10; ++i)
+            addTestActions();
+        addFlushInformation();
+        EXPECT_TRUE(serialize(50));
+        EXPECT_GT(data.size(), 20u);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsDeserializeWhenBlockSizesDoNotMatchBlock)
+    {
+        std::vector<Byte> vec(8 * sizeof(uint32_t));
+        RawBinaryOutputStream os(vec.data(), vec.size());
+        os << uint32_t(1u)
+           << SingleSceneUpdateWriter::lastPacketFlag
+           << static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+           << uint32_t(16u)
+           << uint32_t(4u)    // desc size
+           << uint32_t(100u)  // data size, too large for block
+           << uint32_t(0u)
+           << uint32_t(0u);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(vec).result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsDeserializeSceneActionsWithInvalidDescription)
+    {
+        std::vector<Byte> vec(8 * sizeof(uint32_t));
+        RawBinaryOutputStream os(vec.data(), vec.size());
+        os << uint32_t(1u)
+           << SingleSceneUpdateWriter::lastPacketFlag
+           << static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection)
+           << uint32_t(16u)
+           << uint32_t(4u)    // desc size
+           << uint32_t(4u)    // data size
+           << uint32_t(5u)    // number of actions, do not fit in description
+           << uint32_t(0u);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(vec).result);
+    }
+
     TEST_F(ASceneUpdateSerialization, failsDeserializeEmptyPacket)
     {
         const auto res = deser.processData({});
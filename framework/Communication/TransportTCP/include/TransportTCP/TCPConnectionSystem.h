@@ -14,11 +14,13 @@
 #include "PlatformAbstraction/PlatformThread.h"
 #include "TransportTCP/NetworkParticipantAddress.h"
 #include "TransportTCP/EMessageId.h"
+#include "TransportCommon/SceneUpdatePacket.h"
 #include "Utils/BinaryOutputStream.h"
 #include "Collections/HashSet.h"
 #include "Collections/HashMap.h"
 #include "TransportTCP/AsioWrapper.h"
 #include <deque>
+#include <memory>
 
 
 namespace ramses_internal
@@ -52,6 +54,7 @@ namespace ramses_internal
 
         virtual bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
         virtual bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+        virtual bool multicastSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<Byte>& data) override;
 
@@ -124,6 +127,15 @@ namespace ramses_internal
             BinaryOutputStream stream;
         };
 
+        // message with header filled in, data is shared by all participants it is queued for.
+        // Optional payload follows data on the wire, it is sent from the memory it references (gather write).
+        struct OutPacket
+        {
+            EMessageId messageType{};
+            std::shared_ptr<const std::vector<Byte>> data;
+            std::shared_ptr<const SceneUpdatePacket> payload;
+        };
+
         struct Participant
         {
             Participant(const NetworkParticipantAddress& address_, asio::io_service& io_,
@@ -134,8 +146,8 @@ namespace ramses_internal
             asio::ip::tcp::socket socket;
             asio::steady_timer connectTimer;
 
-            std::deque<OutMessage> outQueue;
-            std::vector<Byte> currentOutBuffer;
+            std::deque<OutPacket> outQueue;
+            OutPacket currentOutPacket;
 
             uint32_t lengthReceiveBuffer;
             std::vector<Byte> receiveBuffer;
@@ -171,12 +183,13 @@ namespace ramses_internal
         bool openAcceptor();
         void doAcceptIncomingConnections();
 
-        void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        OutPacket finalizeMessage(OutMessage msg, std::shared_ptr<const SceneUpdatePacket> payload = {}) const;
+        void sendMessageToParticipant(const ParticipantPtr& pp, OutPacket packet);
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
         void handleReceivedMessage(const ParticipantPtr& pp);
-        bool postMessageForSending(OutMessage msg);
+        bool postMessageForSending(OutMessage msg, std::shared_ptr<const SceneUpdatePacket> payload = {});
         void updateLastReceivedTime(const ParticipantPtr& pp);
         void sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp);
         void triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status);
@@ -314,22 +314,37 @@ namespace ramses_internal
         sendConnectionDescriptionOnNewConnection(pp);
     }
 
-    void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
+    TCPConnectionSystem::OutPacket TCPConnectionSystem::finalizeMessage(OutMessage msg, std::shared_ptr<const SceneUpdatePacket> payload) const
     {
-        assert(pp->currentOutBuffer.empty());
+        auto data = std::make_shared<std::vector<Byte>>(msg.stream.release());
+        const uint32_t fullSize = static_cast<uint32_t>(data->size() + (payload ? payload->size() : 0u));
 
-        pp->currentOutBuffer = msg.stream.release();
-        const uint32_t fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
-
-        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
-                  ", MsgType " << msg.messageType << ", Size " << fullSize);
-
-        RawBinaryOutputStream s(pp->currentOutBuffer.data(), pp->currentOutBuffer.size());
-        const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
+        RawBinaryOutputStream s(data->data(), data->size());
+        const uint32_t remainingSize = fullSize - sizeof(Participant::lengthReceiveBuffer);
         s << remainingSize
           << m_protocolVersion;
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
+        return { msg.messageType, std::move(data), std::move(payload) };
+    }
+
+    void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutPacket packet)
+    {
+        assert(!pp->currentOutPacket.data);
+
+        // keeps data alive until written, even if participant got removed meanwhile
+        pp->currentOutPacket = std::move(packet);
+        const std::vector<Byte>& data = *pp->currentOutPacket.data;
+        std::vector<asio::const_buffer> buffers{ asio::const_buffer(data.data(), data.size()) };
+        if (pp->currentOutPacket.payload)
+        {
+            for (const auto& piece : pp->currentOutPacket.payload->getPieces())
+                buffers.emplace_back(piece.data(), piece.size());
+        }
+
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
+                  ", MsgType " << pp->currentOutPacket.messageType << ", Size " << asio::buffer_size(buffers) << ", Buffers " << buffers.size());
+
+        asio::async_write(pp->socket, buffers,
                           [this, pp](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
@@ -342,9 +357,9 @@ namespace ramses_internal
                               else
                               {
                                   LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
-                                            ", MsgBytes " << pp->currentOutBuffer.size() << ", SentBytes " << sentBytes);
+                                            ", SentBytes " << sentBytes);
 
-                                  pp->currentOutBuffer.clear();
+                                  pp->currentOutPacket = OutPacket();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -363,22 +378,22 @@ namespace ramses_internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
+        if (!pp->currentOutPacket.data && !pp->outQueue.empty())
         {
-            OutMessage msg = std::move(pp->outQueue.front());
+            OutPacket packet = std::move(pp->outQueue.front());
             pp->outQueue.pop_front();
 
-            sendMessageToParticipant(pp, std::move(msg));
+            sendMessageToParticipant(pp, std::move(packet));
         }
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (!pp->currentOutPacket.data)
         {
             assert(pp->outQueue.empty());
 
-            sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
+            sendMessageToParticipant(pp, finalizeMessage(OutMessage(std::vector<Guid>(), EMessageId::Alive)));
         }
     }
 
@@ -547,7 +562,7 @@ namespace ramses_internal
         }
     }
 
-    bool TCPConnectionSystem::postMessageForSending(OutMessage msg)
+    bool TCPConnectionSystem::postMessageForSending(OutMessage msg, std::shared_ptr<const SceneUpdatePacket> payload)
     {
         // expect framework lock to be held
         if (!m_runState)
@@ -562,18 +577,21 @@ namespace ramses_internal
         if (msg.to.empty())
             return true;
 
-        asio::post(m_runState->m_io, [this, msg = std::move(msg)]() mutable {
-                            if (msg.to.size() > 1)
+        // header is filled in once here, all participants queue a reference to the same data
+        std::vector<Guid> to = std::move(msg.to);
+        OutPacket packet = finalizeMessage(std::move(msg), std::move(payload));
+
+        asio::post(m_runState->m_io, [this, to = std::move(to), packet = std::move(packet)]() mutable {
+                            if (to.size() > 1)
                             {
-                                for (auto& p : msg.to)
+                                for (auto& p : to)
                                 {
                                     ParticipantPtr pp;
                                     if (m_establishedParticipants.get(p, pp) != EStatus::Ok)
                                         continue; // skip invalid participant in broadcast. might happen due to disconnect race
                                     assert(pp);
 
-                                    // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
+                                    pp->outQueue.push_back(packet);
 
                                     doSendQueuedMessage(pp);
                                 }
@@ -581,15 +599,15 @@ namespace ramses_internal
                             else
                             {
                                 ParticipantPtr pp;
-                                if (m_establishedParticipants.get(msg.to.front(), pp) != EStatus::Ok)
+                                if (m_establishedParticipants.get(to.front(), pp) != EStatus::Ok)
                                 {
-                                    LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::postMessageForSending: post message " << msg.messageType <<
-                                             " to not (fully) connected participant " << msg.to.front());
+                                    LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::postMessageForSending: post message " << packet.messageType <<
+                                             " to not (fully) connected participant " << to.front());
                                     return;
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
+                                pp->outQueue.push_back(std::move(packet));
 
                                 doSendQueuedMessage(pp);
                             }
@@ -699,7 +717,7 @@ namespace ramses_internal
                    << m_participantAddress.getIp()
                    << static_cast<uint16_t>(m_runState->m_acceptor.local_endpoint().port())
                    << m_participantType;
-        sendMessageToParticipant(pp, std::move(msg));
+        sendMessageToParticipant(pp, finalizeMessage(std::move(msg)));
     }
 
     void TCPConnectionSystem::handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream)
@@ -944,20 +962,30 @@ namespace ramses_internal
     // --
     bool TCPConnectionSystem::sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
     {
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendSceneActionList: to " << to);
+        assert(to.isValid());
+        return multicastSceneUpdate({ to }, sceneId, serializer);
+    }
+
+    bool TCPConnectionSystem::multicastSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    {
+        LOG_TRACE_F(CONTEXT_COMMUNICATION, ([&](ramses_internal::StringOutputStream& sos) {
+                                                sos << "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendSceneActionList: to";
+                                                for (const auto& participant : to)
+                                                    sos << " " << participant;
+                                            }));
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
-        std::vector<Byte> buffer(SceneActionDataSize);
-        return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
+        // scene update is serialized once, packets are shared by all participants and
+        // sent directly from memory they reference (e.g. resource blobs) without copying it into message
+        return serializer.writeToGatheredPackets(SceneActionDataSize, [&](SceneUpdatePacket&& packet) {
 
-            const uint32_t usedSize = static_cast<uint32_t>(size);
+            const uint32_t usedSize = static_cast<uint32_t>(packet.size());
             OutMessage msg(to, EMessageId::SendSceneUpdate);
             msg.stream << sceneId.getValue()
                        << usedSize;
-            msg.stream.write(buffer.data(), usedSize);
 
-            return postMessageForSending(std::move(msg));
+            return postMessageForSending(std::move(msg), std::make_shared<const SceneUpdatePacket>(std::move(packet)));
         });
     }
 
@@ -970,14 +998,17 @@ namespace ramses_internal
             stream >> sceneId.getReference();
             uint32_t dataSize = 0;
             stream >> dataSize;
-
-            std::vector<Byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            if (stream.getCurrentReadBytes() + dataSize > pp->receiveBuffer.size())
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneUpdate: Invalid data size " << dataSize << " from " << pp->address.getParticipantId());
+                return;
+            }
 
             LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneActionList: from " << pp->address.getParticipantId());
 
+            // deserialized directly from participant receive buffer, it is reused for next message after handling
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(data), pp->address.getParticipantId());
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, absl::Span<const Byte>(stream.readPosition(), dataSize), pp->address.getParticipantId());
         }
     }
 
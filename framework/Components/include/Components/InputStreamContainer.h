@@ -10,9 +10,12 @@
 #define RAMSES_FRAMEWORK_INPUTSTREAMCONTAINER_H
 
 #include "Collections/IInputStream.h"
+#include <memory>
 
 namespace ramses_internal
 {
+    class MemoryMappedFile;
+
     class IInputStreamContainer
     {
     public:
@@ -24,6 +27,18 @@ namespace ramses_internal
 
 
         virtual IInputStream& getStream() = 0;
+
+        // Returns file whose mapped memory holds whole stream content (stream offsets are offsets into mapped memory),
+        // data can then be referenced in place instead of being read from stream. Returns nullptr if stream is not mapped.
+        virtual std::shared_ptr<const MemoryMappedFile> getMappedFile() const
+        {
+            return {};
+        }
+
+        // Hints that given range of stream is going to be read soon
+        virtual void readAhead(size_t /*offset*/, size_t /*length*/)
+        {
+        }
     };
 
     using InputStreamContainerSPtr = std::shared_ptr<IInputStreamContainer>;
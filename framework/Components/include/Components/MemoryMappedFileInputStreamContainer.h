@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEWORK_MEMORYMAPPEDFILEINPUTSTREAMCONTAINER_H
+#define RAMSES_FRAMEWORK_MEMORYMAPPEDFILEINPUTSTREAMCONTAINER_H
+
+#include "Components/InputStreamContainer.h"
+#include "Components/FileInputStreamContainer.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/BinarySpanInputStream.h"
+
+namespace ramses_internal
+{
+    class MemoryMappedFileInputStreamContainer : public IInputStreamContainer
+    {
+    public:
+        explicit MemoryMappedFileInputStreamContainer(std::shared_ptr<const MemoryMappedFile> file)
+            : m_file(std::move(file))
+            , m_stream(absl::Span<const Byte>(m_file->data(), m_file->size()))
+        {
+            assert(m_file->isMapped());
+        }
+
+        // Maps file if supported on platform, falls back to reading file otherwise
+        static InputStreamContainerSPtr Create(const String& filename)
+        {
+            auto file = std::make_shared<const MemoryMappedFile>(filename);
+            if (file->isMapped())
+                return std::make_shared<MemoryMappedFileInputStreamContainer>(std::move(file));
+            return std::make_shared<FileInputStreamContainer>(filename);
+        }
+
+        IInputStream& getStream() override
+        {
+            return m_stream;
+        }
+
+        std::shared_ptr<const MemoryMappedFile> getMappedFile() const override
+        {
+            return m_file;
+        }
+
+        void readAhead(size_t offset, size_t length) override
+        {
+            m_file->readAhead(offset, length);
+        }
+
+    private:
+        std::shared_ptr<const MemoryMappedFile> m_file;
+        BinarySpanInputStream m_stream;
+    };
+}
+
+#endif
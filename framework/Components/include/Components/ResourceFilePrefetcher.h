@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEFILEPREFETCHER_H
+#define RAMSES_RESOURCEFILEPREFETCHER_H
+
+#include "Components/ResourceTableOfContents.h"
+#include "Resource/IResource.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include <memory>
+#include <vector>
+
+namespace ramses_internal
+{
+    class MemoryMappedFile;
+    class ITaskQueue;
+
+    // Loads resources from memory mapped file in worker threads while owner does other work, e.g. applies
+    // scene actions stored in same file. Each resource is taken by exactly one thread, the thread calling finish()
+    // takes the ones workers did not get to, so progress never depends on free workers in task queue.
+    class ResourceFilePrefetcher
+    {
+    public:
+        struct Statistics
+        {
+            UInt32 loadedCount = 0u;
+            UInt32 failedCount = 0u;
+            UInt32 loadedByWorkersCount = 0u;
+            UInt32 droppedCount = 0u;
+            UInt64 loadedBytes = 0u;
+        };
+
+        // Resources with compressed data get decompressed too if decompress is set
+        ResourceFilePrefetcher(std::shared_ptr<const MemoryMappedFile> file, std::vector<ResourceFileEntry> entries, bool decompress);
+        // Workers still running stop after their current resource
+        ~ResourceFilePrefetcher();
+
+        ResourceFilePrefetcher(const ResourceFilePrefetcher&) = delete;
+        ResourceFilePrefetcher& operator=(const ResourceFilePrefetcher&) = delete;
+
+        // Enqueues given number of worker tasks, returns number of tasks accepted by queue
+        UInt32 start(ITaskQueue& taskQueue, UInt32 workerCount);
+
+        // Drops entries of resources not in given list, also while workers are running: entries not taken yet are skipped,
+        // resources loaded already are released. Allows starting with all resources of a file before it is known which are needed.
+        void keepOnly(const ResourceContentHashVector& resourcesToKeep);
+
+        // Loads resources not taken by workers yet on calling thread and waits for workers to finish the others.
+        // Returns successfully loaded resources in file order.
+        std::vector<std::unique_ptr<IResource>> finish();
+
+        Statistics getStatistics() const;
+
+        // state shared with worker tasks, defined in implementation
+        struct SharedState;
+
+    private:
+        std::shared_ptr<SharedState> m_state;
+    };
+}
+
+#endif
@@ -40,6 +40,12 @@ namespace ramses_internal
     {
         InputStreamContainerSPtr stream;
         FileContentsMap resources;
+
+        // offset and size of resources sorted by offset, i.e. in order they are stored in file
+        std::vector<std::pair<UInt32, UInt32>> resourceRangesInFileOrder;
+        // range of file already requested to be read ahead
+        size_t readAheadBegin = 0u;
+        size_t readAheadEnd = 0u;
     };
 
     class ResourceFilesRegistry
@@ -49,6 +55,14 @@ namespace ramses_internal
         void unregisterResourceFile(SceneFileHandle handle);
         const FileContentsMap* getContentsOfResourceFile(SceneFileHandle handle) const;
         EStatus getEntry(const ResourceContentHash& hash, IInputStream*& resourceStream, ResourceFileEntry& fileEntry, SceneFileHandle& fileHandle) const;
+        InputStreamContainerSPtr getStreamContainer(SceneFileHandle handle) const;
+
+        // Requests stream of file to read ahead resources stored after given one (up to ReadAheadSize bytes),
+        // resources of a scene are stored next to each other and typically requested in that order
+        void readAheadFollowingResources(SceneFileHandle handle, const ResourceFileEntry& fileEntry);
+
+        static constexpr size_t ReadAheadSize = 4u * 1024u * 1024u;
+
     private:
         std::unordered_map<SceneFileHandle, ResourceRegistryFileEntry> m_resourceFiles;
         SceneFileHandle m_nextHandle{1};
@@ -64,8 +78,18 @@ namespace ramses_internal
         for (const auto& p : tocContent)
             fileContentsMap.put(p.key, ResourceRegistryEntry{p.value, resourceStorage.getResourceHashUsage(p.key)});
 
+        std::vector<std::pair<UInt32, UInt32>> resourceRanges;
+        resourceRanges.reserve(tocContent.size());
+        for (const auto& p : tocContent)
+            resourceRanges.push_back({ p.value.offsetInBytes, p.value.sizeInBytes });
+        std::sort(resourceRanges.begin(), resourceRanges.end());
+
         SceneFileHandle handle = m_nextHandle;
-        m_resourceFiles.insert({ handle, ResourceRegistryFileEntry{resourceFileInputStream, std::move(fileContentsMap)} });
+        ResourceRegistryFileEntry fileEntry;
+        fileEntry.stream = resourceFileInputStream;
+        fileEntry.resources = std::move(fileContentsMap);
+        fileEntry.resourceRangesInFileOrder = std::move(resourceRanges);
+        m_resourceFiles.insert({ handle, std::move(fileEntry) });
         ++m_nextHandle.getReference();
         return handle;
     }
@@ -102,6 +126,47 @@ namespace ramses_internal
         }
         return EStatus::NotExist;
     }
+
+    inline
+    InputStreamContainerSPtr ResourceFilesRegistry::getStreamContainer(SceneFileHandle handle) const
+    {
+        const auto it = m_resourceFiles.find(handle);
+        if (it == m_resourceFiles.end())
+            return {};
+        return it->second.stream;
+    }
+
+    inline
+    void ResourceFilesRegistry::readAheadFollowingResources(SceneFileHandle handle, const ResourceFileEntry& fileEntry)
+    {
+        const auto it = m_resourceFiles.find(handle);
+        if (it == m_resourceFiles.end())
+            return;
+        ResourceRegistryFileEntry& file = it->second;
+
+        // extend window by whole resources only, requested resource is always included
+        const auto& ranges = file.resourceRangesInFileOrder;
+        auto rangeIt = std::lower_bound(ranges.cbegin(), ranges.cend(), std::make_pair(fileEntry.offsetInBytes, UInt32(0u)));
+        size_t windowEnd = static_cast<size_t>(fileEntry.offsetInBytes) + fileEntry.sizeInBytes;
+        for (; rangeIt != ranges.cend() && rangeIt->first < fileEntry.offsetInBytes + ReadAheadSize; ++rangeIt)
+            windowEnd = std::max(windowEnd, static_cast<size_t>(rangeIt->first) + rangeIt->second);
+
+        size_t windowBegin = fileEntry.offsetInBytes;
+        if (windowBegin >= file.readAheadBegin && windowBegin <= file.readAheadEnd)
+        {
+            // continues sequence of previous requests, only new part is requested
+            if (windowEnd <= file.readAheadEnd)
+                return;
+            windowBegin = file.readAheadEnd;
+        }
+        else
+        {
+            file.readAheadBegin = windowBegin;
+        }
+        file.readAheadEnd = windowEnd;
+
+        file.stream->readAhead(windowBegin, windowEnd - windowBegin);
+    }
 }
 
 #endif
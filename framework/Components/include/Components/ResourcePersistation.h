@@ -19,6 +19,7 @@ namespace ramses_internal
     class IOutputStream;
     class IInputStream;
     class BinaryFileOutputStream;
+    class MemoryMappedFile;
     struct ResourceFileEntry;
 
     class ResourcePersistation
@@ -29,6 +30,8 @@ namespace ramses_internal
 
         static std::unique_ptr<IResource> ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static std::unique_ptr<IResource> RetrieveResourceFromStream(IInputStream& inStream, const ResourceFileEntry& entry);
+        // resource data references mapped file where possible, file stays mapped as long as resource exists
+        static std::unique_ptr<IResource> RetrieveResourceFromMappedFile(const std::shared_ptr<const MemoryMappedFile>& file, const ResourceFileEntry& entry);
     };
 }
 
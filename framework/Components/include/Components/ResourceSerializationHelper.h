@@ -31,7 +31,8 @@ namespace ramses_internal
             UInt32 compressedSize;
         };
 
-        void SerializeResourceMetadata(IOutputStream& output, const IResource& resource);
+        // writes metadata of compressed data if available and preferred, of decompressed data otherwise
+        void SerializeResourceMetadata(IOutputStream& output, const IResource& resource, bool preferCompressed = true);
         UInt32 ResourceMetadataSize(const IResource& resource);
 
         DeserializedResourceHeader ResourceFromMetadataStream(IInputStream& input);
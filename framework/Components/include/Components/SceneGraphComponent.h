@@ -23,6 +23,7 @@
 #include "Utils/IPeriodicLogSupplier.h"
 #include "ISceneProviderEventConsumer.h"
 #include "TransportCommon/ServiceHandlerInterfaces.h"
+#include "TransportCommon/SceneActionDeltaEncoding.h"
 #include <unordered_map>
 #include "ERendererToClientEventType.h"
 
@@ -36,6 +37,7 @@ namespace ramses_internal
     class ISceneRendererHandler;
     class SceneUpdateStreamDeserializer;
     class IResourceProviderComponent;
+    class ITaskQueue;
 
     class SceneGraphComponent final : public ISceneGraphProviderComponent,
                                       public ISceneGraphSender,
@@ -46,7 +48,8 @@ namespace ramses_internal
                                       public IPeriodicLogSupplier
     {
     public:
-        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock);
+        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock,
+                            ITaskQueue* resourceCompressionTaskQueue = nullptr, bool sceneActionDeltaEncodingEnabled = false);
         virtual ~SceneGraphComponent() override;
 
         virtual void setSceneRendererHandler(ISceneRendererHandler* sceneRendererHandler) override;
@@ -96,6 +99,9 @@ namespace ramses_internal
         const ClientSceneLogicBase* getClientSceneLogicForScene(SceneId sceneId) const;
 
     private:
+        // smaller resources are compressed on flushing thread, not worth a task
+        static constexpr UInt32 ParallelCompressionMinimumResourceSize = 64u * 1024u;
+
         void forwardToSceneProviderEventConsumer(SceneReferenceEvent const& event);
         void forwardToSceneProviderEventConsumer(ResourceAvailabilityEvent const& event);
 
@@ -115,6 +121,12 @@ namespace ramses_internal
         SceneEventConsumerMap m_sceneEventConsumers;
 
         IResourceProviderComponent& m_resourceComponent;
+        // if set, large resources are compressed in parallel on it while scene update is being sent
+        ITaskQueue* m_resourceCompressionTaskQueue;
+
+        // if enabled, scene actions sent to remote participants are delta encoded against previously sent ones
+        const bool m_sceneActionDeltaEncodingEnabled;
+        std::unordered_map<SceneId, SceneActionDeltaEncoder> m_sceneActionEncoders;
 
         struct ReceivedScene
         {
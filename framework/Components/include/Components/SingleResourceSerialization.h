@@ -11,6 +11,7 @@
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "SceneAPI/ResourceContentHash.h"
+#include "absl/types/span.h"
 #include <memory>
 
 namespace ramses_internal
@@ -22,10 +23,15 @@ namespace ramses_internal
     class SingleResourceSerialization
     {
     public:
-        static UInt32 SizeOfSerializedResource(const IResource& resource);
-        static void SerializeResource(IOutputStream& output, const IResource& resource);
+        // compressed data is written if available unless preferCompressed is unset, decompressed data must be available then
+        static UInt32 SizeOfSerializedResource(const IResource& resource, bool preferCompressed = true);
+        static void SerializeResource(IOutputStream& output, const IResource& resource, bool preferCompressed = true);
 
         static std::unique_ptr<IResource> DeserializeResource(IInputStream& input, ResourceContentHash hash);
+        // Deserializes resource from memory holding exactly one serialized resource. Data blob of resource references
+        // the memory directly instead of copying it (if its alignment is sufficient), dataOwner keeps memory alive
+        // as long as resource exists. Returns nullptr if data is malformed.
+        static std::unique_ptr<IResource> DeserializeResourceInPlace(absl::Span<Byte> data, const std::shared_ptr<const void>& dataOwner, ResourceContentHash hash);
     };
 }
 
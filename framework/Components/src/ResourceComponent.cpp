@@ -105,9 +105,15 @@ namespace ramses_internal
         if (EStatus::Ok != m_resourceFiles.getEntry(hash, resourceStream, entry, fileHandle))
             return {};
 
+        m_resourceFiles.readAheadFollowingResources(fileHandle, entry);
+        const auto mappedFile = m_resourceFiles.getStreamContainer(fileHandle)->getMappedFile();
+
         try
         {
-            lowLevelResource = ResourcePersistation::RetrieveResourceFromStream(*resourceStream, entry);
+            if (mappedFile)
+                lowLevelResource = ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, entry);
+            else
+                lowLevelResource = ResourcePersistation::RetrieveResourceFromStream(*resourceStream, entry);
         }
         catch(std::exception const& e)
         {
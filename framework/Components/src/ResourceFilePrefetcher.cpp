@@ -0,0 +1,213 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Components/ResourceFilePrefetcher.h"
+#include "Components/ResourcePersistation.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/LogMacros.h"
+#include "TaskFramework/ITask.h"
+#include "TaskFramework/ITaskQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses_internal
+{
+    struct ResourceFilePrefetcher::SharedState
+    {
+        SharedState(std::shared_ptr<const MemoryMappedFile> file_, std::vector<ResourceFileEntry> entries_, bool decompress_)
+            : file(std::move(file_))
+            , entries(std::move(entries_))
+            , decompress(decompress_)
+            , resources(entries.size())
+            , dropped(entries.size(), false)
+        {
+        }
+
+        void loadRemaining(bool isWorker)
+        {
+            for (size_t idx = nextEntry.fetch_add(1u); idx < entries.size(); idx = nextEntry.fetch_add(1u))
+            {
+                std::unique_ptr<IResource> resource;
+                if (!isDropped(idx))
+                    resource = load(entries[idx]);
+
+                std::lock_guard<std::mutex> guard(lock);
+                if (resource)
+                {
+                    ++statistics.loadedCount;
+                    statistics.loadedBytes += entries[idx].sizeInBytes;
+                    if (isWorker)
+                        ++statistics.loadedByWorkersCount;
+                }
+                else if (!dropped[idx])
+                    ++statistics.failedCount;
+                // entry might have been dropped while loading, resource is released after lock then
+                if (!dropped[idx])
+                    resources[idx] = std::move(resource);
+
+                if (++finishedCount == entries.size())
+                    allFinished.notify_all();
+            }
+        }
+
+        bool isDropped(size_t idx)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            return dropped[idx];
+        }
+
+        std::unique_ptr<IResource> load(const ResourceFileEntry& entry) const
+        {
+            std::unique_ptr<IResource> resource;
+            try
+            {
+                resource = ResourcePersistation::RetrieveResourceFromMappedFile(file, entry);
+            }
+            catch (std::exception const& e)
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceFilePrefetcher: loading resource {} (type {}, offset {}, size {}) failed with exception '{}'",
+                    entry.resourceInfo.hash, entry.resourceInfo.type, entry.offsetInBytes, entry.sizeInBytes, e.what());
+                return {};
+            }
+
+            if (!resource)
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceFilePrefetcher: loading resource {} (type {}, offset {}, size {}) failed",
+                    entry.resourceInfo.hash, entry.resourceInfo.type, entry.offsetInBytes, entry.sizeInBytes);
+                return {};
+            }
+
+            if (decompress && resource->isCompressedAvailable())
+                resource->decompress();
+            return resource;
+        }
+
+        const std::shared_ptr<const MemoryMappedFile> file;
+        const std::vector<ResourceFileEntry> entries;
+        const bool decompress;
+
+        std::atomic<size_t> nextEntry{ 0u };
+
+        std::mutex lock;
+        std::condition_variable allFinished;
+        size_t finishedCount = 0u;
+        std::vector<std::unique_ptr<IResource>> resources;
+        std::vector<bool> dropped;
+        Statistics statistics;
+    };
+
+    namespace
+    {
+        class PrefetchTask final : public ITask
+        {
+        public:
+            explicit PrefetchTask(std::shared_ptr<ResourceFilePrefetcher::SharedState> state)
+                : m_state(std::move(state))
+            {
+            }
+
+            virtual void execute() override
+            {
+                m_state->loadRemaining(true);
+            }
+
+        private:
+            std::shared_ptr<ResourceFilePrefetcher::SharedState> m_state;
+        };
+
+        std::vector<ResourceFileEntry> SortedByOffset(std::vector<ResourceFileEntry> entries)
+        {
+            std::sort(entries.begin(), entries.end(), [](const ResourceFileEntry& a, const ResourceFileEntry& b) { return a.offsetInBytes < b.offsetInBytes; });
+            return entries;
+        }
+    }
+
+    ResourceFilePrefetcher::ResourceFilePrefetcher(std::shared_ptr<const MemoryMappedFile> file, std::vector<ResourceFileEntry> entries, bool decompress)
+        : m_state(std::make_shared<SharedState>(std::move(file), SortedByOffset(std::move(entries)), decompress))
+    {
+        assert(m_state->file && m_state->file->isMapped());
+    }
+
+    ResourceFilePrefetcher::~ResourceFilePrefetcher()
+    {
+        // workers find nothing left to take
+        m_state->nextEntry = m_state->entries.size();
+    }
+
+    UInt32 ResourceFilePrefetcher::start(ITaskQueue& taskQueue, UInt32 workerCount)
+    {
+        const auto& entries = m_state->entries;
+        if (entries.empty())
+            return 0u;
+
+        // resources are read in file order, let system load whole range while first ones are processed
+        const size_t rangeBegin = entries.front().offsetInBytes;
+        const size_t rangeEnd = entries.back().offsetInBytes + entries.back().sizeInBytes;
+        m_state->file->readAhead(rangeBegin, rangeEnd - rangeBegin);
+
+        UInt32 acceptedCount = 0u;
+        for (UInt32 i = 0u; i < std::min<UInt32>(workerCount, static_cast<UInt32>(entries.size())); ++i)
+        {
+            auto task = new PrefetchTask(m_state);
+            if (taskQueue.enqueue(*task))
+                ++acceptedCount;
+            // queue holds its own reference
+            task->release();
+        }
+
+        return acceptedCount;
+    }
+
+    void ResourceFilePrefetcher::keepOnly(const ResourceContentHashVector& resourcesToKeep)
+    {
+        ResourceContentHashVector sortedResourcesToKeep = resourcesToKeep;
+        std::sort(sortedResourcesToKeep.begin(), sortedResourcesToKeep.end());
+
+        std::vector<std::unique_ptr<IResource>> droppedResources;
+        {
+            std::lock_guard<std::mutex> guard(m_state->lock);
+            for (size_t idx = 0u; idx < m_state->entries.size(); ++idx)
+            {
+                if (m_state->dropped[idx] || std::binary_search(sortedResourcesToKeep.cbegin(), sortedResourcesToKeep.cend(), m_state->entries[idx].resourceInfo.hash))
+                    continue;
+
+                m_state->dropped[idx] = true;
+                ++m_state->statistics.droppedCount;
+                if (m_state->resources[idx])
+                    droppedResources.push_back(std::move(m_state->resources[idx]));
+            }
+        }
+        // resources are released outside of lock, workers are not blocked by it
+    }
+
+    std::vector<std::unique_ptr<IResource>> ResourceFilePrefetcher::finish()
+    {
+        m_state->loadRemaining(false);
+
+        std::vector<std::unique_ptr<IResource>> result;
+        std::unique_lock<std::mutex> guard(m_state->lock);
+        m_state->allFinished.wait(guard, [&]() { return m_state->finishedCount == m_state->entries.size(); });
+
+        result.reserve(m_state->statistics.loadedCount);
+        for (auto& resource : m_state->resources)
+        {
+            if (resource)
+                result.push_back(std::move(resource));
+        }
+
+        return result;
+    }
+
+    ResourceFilePrefetcher::Statistics ResourceFilePrefetcher::getStatistics() const
+    {
+        std::lock_guard<std::mutex> guard(m_state->lock);
+        return m_state->statistics;
+    }
+}
@@ -14,6 +14,7 @@
 #include "Utils/VoidOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Components/ManagedResource.h"
 #include "Components/ResourceTableOfContents.h"
 #include "Resource/ResourceInfo.h"
@@ -123,4 +124,27 @@ namespace ramses_internal
 
         return resource;
     }
+
+    std::unique_ptr<IResource> ResourcePersistation::RetrieveResourceFromMappedFile(const std::shared_ptr<const MemoryMappedFile>& file, const ResourceFileEntry& fileEntry)
+    {
+        LOG_DEBUG_P(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourceFromMappedFile: Hash {}, Size {}, Offset {}",
+                    fileEntry.resourceInfo.hash, fileEntry.sizeInBytes, fileEntry.offsetInBytes);
+
+        if (static_cast<size_t>(fileEntry.offsetInBytes) + fileEntry.sizeInBytes > file->size())
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourceFromMappedFile: resource {} exceeds file (resOffset {}, resSize {}, fileSize {})",
+                        fileEntry.resourceInfo.hash, fileEntry.offsetInBytes, fileEntry.sizeInBytes, file->size());
+            return {};
+        }
+
+        const absl::Span<Byte> resourceData(file->data() + fileEntry.offsetInBytes, fileEntry.sizeInBytes);
+        std::unique_ptr<IResource> resource = SingleResourceSerialization::DeserializeResourceInPlace(resourceData, file, fileEntry.resourceInfo.hash);
+        if (!resource)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourceFromMappedFile: resource deserialization failed for {}", fileEntry.resourceInfo.hash);
+            return {};
+        }
+
+        return resource;
+    }
 }
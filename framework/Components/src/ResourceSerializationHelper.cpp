@@ -17,14 +17,14 @@ namespace ramses_internal
 {
     namespace ResourceSerializationHelper
     {
-        void SerializeResourceMetadata(IOutputStream& output, const IResource& resource)
+        void SerializeResourceMetadata(IOutputStream& output, const IResource& resource, bool preferCompressed)
         {
             output << static_cast<UInt32>(resource.getTypeID());
             output << resource.getName();
 
-            // prefer compressed if available
-            output << static_cast<UInt32>(resource.isCompressedAvailable() ? EResourceCompressionStatus_Compressed : EResourceCompressionStatus_Uncompressed);
-            output << resource.getCompressedDataSize();
+            const bool writeCompressed = preferCompressed && resource.isCompressedAvailable();
+            output << static_cast<UInt32>(writeCompressed ? EResourceCompressionStatus_Compressed : EResourceCompressionStatus_Uncompressed);
+            output << (writeCompressed ? resource.getCompressedDataSize() : 0u);
             output << resource.getDecompressedDataSize();
             output << resource.getCacheFlag().getValue();
 
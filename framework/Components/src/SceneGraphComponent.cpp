@@ -19,19 +19,23 @@
 #include "TransportCommon/SceneUpdateStreamDeserializer.h"
 #include "Components/SceneUpdate.h"
 #include "TransportCommon/SceneUpdateSerializer.h"
+#include "TaskFramework/ParallelTaskGroup.h"
 #include "Components/ResourceAvailabilityEvent.h"
 #include "Components/IResourceProviderComponent.h"
 #include "Components/SceneUpdate.h"
 
 namespace ramses_internal
 {
-    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock)
+    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock,
+                                             ITaskQueue* resourceCompressionTaskQueue, bool sceneActionDeltaEncodingEnabled)
         : m_sceneRendererHandler(nullptr)
         , m_myID(myID)
         , m_communicationSystem(communicationSystem)
         , m_connectionStatusUpdateNotifier(connectionStatusUpdateNotifier)
         , m_frameworkLock(frameworkLock)
         , m_resourceComponent(res)
+        , m_resourceCompressionTaskQueue(resourceCompressionTaskQueue)
+        , m_sceneActionDeltaEncodingEnabled(sceneActionDeltaEncodingEnabled)
     {
         m_connectionStatusUpdateNotifier.registerForConnectionUpdates(this);
         m_communicationSystem.setSceneProviderServiceHandler(this);
@@ -94,6 +98,14 @@ namespace ramses_internal
             // return;   // TODO: lots of tests must be fixed for this check
         }
 
+        // remote participant (re)initializes scene, cannot reference actions it got before
+        if (m_myID != to)
+        {
+            auto encoderIt = m_sceneActionEncoders.find(sceneId);
+            if (encoderIt != m_sceneActionEncoders.end())
+                encoderIt->second.reset();
+        }
+
         if (m_myID == to)
         {
             if (m_sceneRendererHandler)
@@ -116,25 +128,52 @@ namespace ramses_internal
     {
         // send to network (no ownership transfer)
         bool sendToSelf = false;
-        bool alreadyCompressed = false;
+        std::vector<Guid> remoteParticipants;
+        remoteParticipants.reserve(toVec.size());
         for (const auto& to : toVec)
         {
             if (m_myID == to)
-            {
                 sendToSelf = true;
-            }
             else
+                remoteParticipants.push_back(to);
+        }
+
+        if (!remoteParticipants.empty())
+        {
+            // large resources are compressed in parallel, serializer waits for each of them only right before writing it,
+            // so first packets are sent while later resources are still being compressed
+            std::vector<std::unique_ptr<ParallelTaskGroup>> compressionTasks(sceneUpdate.resources.size());
+            if (m_resourceCompressionTaskQueue)
             {
-                if (!alreadyCompressed)
+                for (size_t i = 0; i < sceneUpdate.resources.size(); ++i)
                 {
-                    for (auto& resource : sceneUpdate.resources)
+                    const ManagedResource& resource = sceneUpdate.resources[i];
+                    if (resource->getDecompressedDataSize() >= ParallelCompressionMinimumResourceSize)
                     {
-                        resource->compress(IResource::CompressionLevel::Realtime);
+                        compressionTasks[i] = std::make_unique<ParallelTaskGroup>(*m_resourceCompressionTaskQueue);
+                        compressionTasks[i]->run([resource]() { resource->compress(IResource::CompressionLevel::Realtime); });
                     }
-                    alreadyCompressed = true;
                 }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics));
             }
+            const auto prepareResource = [&](size_t resourceIndex) {
+                if (compressionTasks[resourceIndex])
+                    compressionTasks[resourceIndex]->wait();
+                else
+                    sceneUpdate.resources[resourceIndex]->compress(IResource::CompressionLevel::Realtime);
+            };
+
+            SceneActionDeltaEncoder* actionEncoder = nullptr;
+            if (m_sceneActionDeltaEncodingEnabled)
+            {
+                actionEncoder = &m_sceneActionEncoders[sceneId];
+                actionEncoder->prepare(sceneUpdate.actions, remoteParticipants);
+            }
+
+            // serialized once for all remote participants where communication system supports it
+            const bool sent = m_communicationSystem.multicastSceneUpdate(remoteParticipants, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics, prepareResource, actionEncoder));
+            if (actionEncoder)
+                actionEncoder->finishUpdate(sent);
+            // compressionTasks wait for pending compressions on destruction (if sending failed early), before update is passed on
         }
 
         // send to self last to move sceneUpdate to local renderer
@@ -330,6 +369,7 @@ namespace ramses_internal
         assert(sceneLogic != nullptr);
         m_clientSceneLogicMap.remove(sceneId);
         m_sceneEventConsumers.remove(sceneId);
+        m_sceneActionEncoders.erase(sceneId);
         delete sceneLogic;
     }
 
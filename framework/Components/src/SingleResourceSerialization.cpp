@@ -13,24 +13,25 @@
 #include "Resource/EResourceCompressionStatus.h"
 #include "Utils/VoidOutputStream.h"
 #include "Collections/IInputStream.h"
+#include "Utils/BinarySpanInputStream.h"
+#include <cstddef>
 
 namespace ramses_internal
 {
-    UInt32 SingleResourceSerialization::SizeOfSerializedResource(const IResource& resource)
+    UInt32 SingleResourceSerialization::SizeOfSerializedResource(const IResource& resource, bool preferCompressed)
     {
         VoidOutputStream stream;
-        SerializeResource(stream, resource);
+        SerializeResource(stream, resource, preferCompressed);
         return static_cast<uint32_t>(stream.getSize());
     }
 
-    void SingleResourceSerialization::SerializeResource(IOutputStream& output, const IResource& resource)
+    void SingleResourceSerialization::SerializeResource(IOutputStream& output, const IResource& resource, bool preferCompressed)
     {
         // header
-        ResourceSerializationHelper::SerializeResourceMetadata(output, resource);
+        ResourceSerializationHelper::SerializeResourceMetadata(output, resource, preferCompressed);
 
         // data blob
-        // prefer compressed if available
-        if (resource.isCompressedAvailable())
+        if (preferCompressed && resource.isCompressedAvailable())
         {
             // write compressed data to stream
             const CompressedResourceBlob& compressedData = resource.getCompressedResourceData();
@@ -69,4 +70,41 @@ namespace ramses_internal
 
         return std::move(header.resource);
     }
+
+    std::unique_ptr<IResource> SingleResourceSerialization::DeserializeResourceInPlace(absl::Span<Byte> data, const std::shared_ptr<const void>& dataOwner, ResourceContentHash hash)
+    {
+        // header
+        BinarySpanInputStream input(data);
+        ResourceSerializationHelper::DeserializedResourceHeader header = ResourceSerializationHelper::ResourceFromMetadataStream(input);
+        size_t headerSize = 0u;
+        if (!header.resource || input.getPos(headerSize) != EStatus::Ok)
+            return {};
+
+        // data blob, must span rest of memory
+        Byte* blobData = data.data() + headerSize;
+        const size_t blobSize = data.size() - headerSize;
+        if (header.compressionStatus == EResourceCompressionStatus_Compressed)
+        {
+            if (header.compressedSize != blobSize)
+                return {};
+            // compressed data is only input of decompression, no alignment needed
+            header.resource->setCompressedResourceData(CompressedResourceBlob(blobSize, blobData, dataOwner), IResource::CompressionLevel::Offline, header.decompressedSize, hash);
+        }
+        else
+        {
+            if (header.decompressedSize != blobSize)
+                return {};
+
+            // texels are uploaded as bytes, other resource data may be accessed as elements of bigger types
+            const EResourceType type = header.resource->getTypeID();
+            const bool isTexture = (type == EResourceType_Texture2D || type == EResourceType_Texture3D || type == EResourceType_TextureCube);
+            const bool isAligned = reinterpret_cast<uintptr_t>(blobData) % alignof(std::max_align_t) == 0u;
+            if (isTexture || isAligned)
+                header.resource->setResourceData(ResourceBlob(blobSize, blobData, dataOwner), hash);
+            else
+                header.resource->setResourceData(ResourceBlob(blobSize, blobData), hash);
+        }
+
+        return std::move(header.resource);
+    }
 }
@@ -10,6 +10,7 @@
 #include "Components/FileInputStreamContainer.h"
 #include "Components/MemoryInputStreamContainer.h"
 #include "Components/OffsetFileInputStreamContainer.h"
+#include "Components/MemoryMappedFileInputStreamContainer.h"
 #include "FileDescriptorHelper.h"
 #include "gtest/gtest.h"
 #include <memory>
@@ -76,4 +77,40 @@ namespace ramses_internal
         std::array<Byte, 3> dataWsub{4, 3, 2};
         EXPECT_EQ(dataWsub, dataR);
     }
+
+    TEST(AInputStreamContainer, canCreateAndUseWithMemoryMappedFile)
+    {
+        const std::array<Byte, 5> dataW = {5, 4, 3, 2, 10};
+        {
+            File f("test.bin");
+            EXPECT_TRUE(f.open(File::Mode::WriteNewBinary));
+            EXPECT_TRUE(f.write(dataW.data(), dataW.size()));
+        }
+
+        InputStreamContainerSPtr is = MemoryMappedFileInputStreamContainer::Create("test.bin");
+        ASSERT_TRUE(is->getMappedFile());
+        is->readAhead(1u, 3u);
+
+        std::array<Byte, 5> dataR = {0};
+        is->getStream().read(dataR.data(), dataR.size());
+        EXPECT_EQ(dataW, dataR);
+        EXPECT_EQ(0, std::memcmp(dataW.data(), is->getMappedFile()->data(), dataW.size()));
+
+        // never reads beyond end of file
+        is->getStream().read(dataR.data(), 1u);
+        EXPECT_EQ(EStatus::Eof, is->getStream().getState());
+    }
+
+    TEST(AInputStreamContainer, memoryMappedFileFallsBackToReadingFileIfItCannotBeMapped)
+    {
+        {
+            File f("empty.bin");
+            EXPECT_TRUE(f.open(File::Mode::WriteNewBinary));
+        }
+
+        // empty file cannot be mapped
+        InputStreamContainerSPtr is = MemoryMappedFileInputStreamContainer::Create("empty.bin");
+        EXPECT_FALSE(is->getMappedFile());
+        EXPECT_EQ(EStatus::Ok, is->getStream().getState());
+    }
 }
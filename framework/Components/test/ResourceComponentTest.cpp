@@ -615,6 +615,7 @@ namespace ramses_internal
 
         localResourceComponent.addResourceFile(streamContainer, toc);
 
+        EXPECT_CALL(*streamContainer, readAhead(0u, 5u));
         EXPECT_CALL(stream, seek(_, _)).WillOnce(Return(EStatus::Error));
         EXPECT_CALL(stream, getState()).WillRepeatedly(Return(EStatus::Ok));
         EXPECT_CALL(stream, getPos(_)).WillOnce(Return(EStatus::Ok));
@@ -634,6 +635,7 @@ namespace ramses_internal
 
         localResourceComponent.addResourceFile(streamContainer, toc);
 
+        EXPECT_CALL(*streamContainer, readAhead(0u, 5u));
         EXPECT_CALL(stream, seek(_, _)).WillOnce(Return(EStatus::Ok));
         EXPECT_CALL(stream, getState()).WillRepeatedly(Return(EStatus::Ok));
         EXPECT_CALL(stream, getPos(_)).WillOnce(Return(EStatus::Ok));
@@ -0,0 +1,190 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Components/ResourceFilePrefetcher.h"
+#include "Components/ResourcePersistation.h"
+#include "Components/ResourceTableOfContents.h"
+#include "Components/ManagedResource.h"
+#include "Components/ResourceDeleterCallingCallback.h"
+#include "Resource/ArrayResource.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include "MockTaskQueue.h"
+#include "ResourceMock.h"
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class AResourceFilePrefetcher : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestCase()
+        {
+            NiceMock<ManagedResourceDeleterCallbackMock> deleterMock;
+            ResourceDeleterCallingCallback deleter(deleterMock);
+
+            ManagedResourceVector resources;
+            std::vector<std::unique_ptr<ArrayResource>> arrays;
+            for (UInt32 i = 0u; i < ResourceCount; ++i)
+            {
+                // big enough to be compressed
+                std::vector<float> data(1000u, static_cast<float>(i));
+                arrays.push_back(std::make_unique<ArrayResource>(EResourceType_VertexArray, 1000u, EDataType::Float, data.data(), ResourceCacheFlag(0u), ""));
+                resources.push_back(ManagedResource{ arrays.back().get(), deleter });
+            }
+
+            File tempFile(Filename);
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, true);
+        }
+
+        static void TearDownTestCase()
+        {
+            File(Filename).remove();
+        }
+
+        AResourceFilePrefetcher()
+            : m_file(std::make_shared<const MemoryMappedFile>(Filename))
+        {
+            File tempFile(Filename);
+            BinaryFileInputStream instream(tempFile);
+            m_toc.readTOCPosAndTOCFromStream(instream);
+            for (const auto& item : m_toc.getFileContents())
+                m_entries.push_back(item.value);
+        }
+
+        static constexpr UInt32 ResourceCount = 20u;
+        static constexpr const char* Filename = "resourceFilePrefetcherTest.ramres";
+
+        std::shared_ptr<const MemoryMappedFile> m_file;
+        ResourceTableOfContents m_toc;
+        std::vector<ResourceFileEntry> m_entries;
+    };
+
+    constexpr UInt32 AResourceFilePrefetcher::ResourceCount;
+    constexpr const char* AResourceFilePrefetcher::Filename;
+
+    TEST_F(AResourceFilePrefetcher, loadsAllResourcesInWorkersAndCallingThread)
+    {
+        ASSERT_TRUE(m_file->isMapped());
+        ASSERT_EQ(ResourceCount, m_entries.size());
+
+        ThreadedTaskExecutor executor(2u);
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, false);
+        EXPECT_EQ(2u, prefetcher.start(executor, 2u));
+
+        const auto resources = prefetcher.finish();
+        ASSERT_EQ(ResourceCount, resources.size());
+        for (const auto& resource : resources)
+        {
+            EXPECT_TRUE(m_toc.containsResource(resource->getHash()));
+            EXPECT_TRUE(resource->isCompressedAvailable());
+            EXPECT_FALSE(resource->isDeCompressedAvailable());
+        }
+
+        const auto stats = prefetcher.getStatistics();
+        EXPECT_EQ(ResourceCount, stats.loadedCount);
+        EXPECT_EQ(0u, stats.failedCount);
+        EXPECT_LE(stats.loadedByWorkersCount, ResourceCount);
+    }
+
+    TEST_F(AResourceFilePrefetcher, decompressesResourcesIfRequested)
+    {
+        ThreadedTaskExecutor executor(2u);
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, true);
+        prefetcher.start(executor, 2u);
+
+        const auto resources = prefetcher.finish();
+        ASSERT_EQ(ResourceCount, resources.size());
+        for (const auto& resource : resources)
+        {
+            EXPECT_TRUE(resource->isDeCompressedAvailable());
+            EXPECT_EQ(1000u * sizeof(float), resource->getResourceData().size());
+        }
+    }
+
+    TEST_F(AResourceFilePrefetcher, loadsAllResourcesInCallingThreadIfQueueRejectsTasks)
+    {
+        StrictMock<MockTaskQueue> queue;
+        EXPECT_CALL(queue, enqueue(_)).Times(3).WillRepeatedly(Return(false));
+
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, false);
+        EXPECT_EQ(0u, prefetcher.start(queue, 3u));
+
+        EXPECT_EQ(ResourceCount, prefetcher.finish().size());
+        EXPECT_EQ(0u, prefetcher.getStatistics().loadedByWorkersCount);
+    }
+
+    TEST_F(AResourceFilePrefetcher, reportsResourcesFailingToLoad)
+    {
+        m_entries[3].sizeInBytes += 1u;
+
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, false);
+        const auto resources = prefetcher.finish();
+        EXPECT_EQ(ResourceCount - 1u, resources.size());
+
+        const auto stats = prefetcher.getStatistics();
+        EXPECT_EQ(ResourceCount - 1u, stats.loadedCount);
+        EXPECT_EQ(1u, stats.failedCount);
+    }
+
+    TEST_F(AResourceFilePrefetcher, skipsDroppedResources)
+    {
+        StrictMock<MockTaskQueue> queue;
+        EXPECT_CALL(queue, enqueue(_)).WillOnce(Return(false));
+
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, false);
+        prefetcher.start(queue, 1u);
+
+        ResourceContentHashVector resourcesToKeep;
+        for (size_t i = 0u; i < m_entries.size(); i += 2u)
+            resourcesToKeep.push_back(m_entries[i].resourceInfo.hash);
+        prefetcher.keepOnly(resourcesToKeep);
+
+        const auto resources = prefetcher.finish();
+        ASSERT_EQ(ResourceCount / 2u, resources.size());
+        for (const auto& resource : resources)
+            EXPECT_NE(resourcesToKeep.cend(), std::find(resourcesToKeep.cbegin(), resourcesToKeep.cend(), resource->getHash()));
+
+        const auto stats = prefetcher.getStatistics();
+        EXPECT_EQ(ResourceCount / 2u, stats.loadedCount);
+        EXPECT_EQ(ResourceCount / 2u, stats.droppedCount);
+        EXPECT_EQ(0u, stats.failedCount);
+    }
+
+    TEST_F(AResourceFilePrefetcher, releasesDroppedResourcesLoadedByWorkersAlready)
+    {
+        ThreadedTaskExecutor executor(2u);
+        ResourceFilePrefetcher prefetcher(m_file, m_entries, false);
+        prefetcher.start(executor, 2u);
+
+        // workers may have loaded any number of resources at this point
+        const ResourceContentHash resourceToKeep = m_entries.back().resourceInfo.hash;
+        prefetcher.keepOnly({ resourceToKeep });
+
+        const auto resources = prefetcher.finish();
+        ASSERT_EQ(1u, resources.size());
+        EXPECT_EQ(resourceToKeep, resources.front()->getHash());
+        EXPECT_EQ(ResourceCount - 1u, prefetcher.getStatistics().droppedCount);
+    }
+
+    TEST_F(AResourceFilePrefetcher, canBeDestroyedWhileWorkersAreQueued)
+    {
+        ThreadedTaskExecutor executor(1u);
+        {
+            ResourceFilePrefetcher prefetcher(m_file, m_entries, true);
+            prefetcher.start(executor, 4u);
+        }
+        // workers keep their state alive and finish without touching prefetcher
+    }
+}
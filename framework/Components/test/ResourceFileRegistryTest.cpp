@@ -12,6 +12,7 @@
 #include "Components/ResourceTableOfContents.h"
 #include "Components/ResourceFilesRegistry.h"
 #include "Components/FileInputStreamContainer.h"
+#include "InputStreamContainerMock.h"
 
 namespace ramses_internal
 {
@@ -152,4 +153,37 @@ namespace ramses_internal
         for (auto const& entry : { ResourceContentHash{ 2, 2 }, ResourceContentHash{ 5, 5 }, ResourceContentHash{ 1, 1 } })
             EXPECT_NE(content->find(entry), content->end());
     }
+
+    TEST_F(AResourceFileRegistry, readsAheadResourcesFollowingRequestedOneInFileOrder)
+    {
+        const ResourceInfo resInfo1(EResourceType_VertexArray, ResourceContentHash(1, 0), 10, 10);
+        const ResourceInfo resInfo2(EResourceType_VertexArray, ResourceContentHash(2, 0), 10, 10);
+        const ResourceInfo resInfo3(EResourceType_VertexArray, ResourceContentHash(3, 0), 10, 10);
+        const ResourceInfo resInfo4(EResourceType_VertexArray, ResourceContentHash(4, 0), 10, 10);
+        constexpr UInt32 bigSize = static_cast<UInt32>(ResourceFilesRegistry::ReadAheadSize);
+
+        ResourceTableOfContents toc;
+        toc.registerContents(resInfo3, 100 + 2 * bigSize, 10);
+        toc.registerContents(resInfo1, 100, 10);
+        toc.registerContents(resInfo4, 100 + 2 * bigSize + 10, 10);
+        toc.registerContents(resInfo2, 110, 2 * bigSize);
+
+        auto streamContainer = std::make_shared<::testing::StrictMock<InputStreamContainerMock>>();
+        const SceneFileHandle handle = registry.registerResourceFile(streamContainer, toc, storage);
+
+        // window of first resource includes the whole big resource starting within window
+        EXPECT_CALL(*streamContainer, readAhead(100u, 10u + 2 * bigSize));
+        registry.readAheadFollowingResources(handle, toc.getEntryForHash(resInfo1.hash));
+        // already requested
+        registry.readAheadFollowingResources(handle, toc.getEntryForHash(resInfo2.hash));
+        ::testing::Mock::VerifyAndClearExpectations(streamContainer.get());
+
+        // only not yet requested part
+        EXPECT_CALL(*streamContainer, readAhead(110u + 2 * bigSize, 10u));
+        registry.readAheadFollowingResources(handle, toc.getEntryForHash(resInfo3.hash));
+        ::testing::Mock::VerifyAndClearExpectations(streamContainer.get());
+
+        // going back within requested range does not request again
+        registry.readAheadFollowingResources(handle, toc.getEntryForHash(resInfo1.hash));
+    }
 }
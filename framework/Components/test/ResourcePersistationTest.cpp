@@ -19,6 +19,7 @@
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryOutputStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "ResourceMock.h"
 #include "InputStreamMock.h"
 #include "UnsafeTestMemoryHelpers.h"
@@ -398,4 +399,82 @@ namespace ramses_internal
         });
         EXPECT_FALSE(ResourcePersistation::RetrieveResourceFromStream(stream, dummyResource.second));
     }
+
+    TEST(ResourcePersistation, retrieveResourceFromMappedFileReferencesTextureDataInFile)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat::RGBA8, false, DefaultTextureSwizzleArray, { 64u });
+        TextureResource texture(EResourceType_Texture2D, texDesc, ResourceCacheFlag(0u), "texture");
+        ResourceBlob pixels(64u);
+        for (size_t i = 0; i < pixels.size(); ++i)
+            pixels.data()[i] = static_cast<uint8_t>(i);
+        texture.setResourceData(std::move(pixels));
+        ManagedResource managedTexture{ &texture, dummyManagedResourceCallback };
+
+        float vertexData[9] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+        ArrayResource vertices(EResourceType_VertexArray, 3, EDataType::Vector3F, vertexData, ResourceCacheFlag(0u), "vertices");
+        ManagedResource managedVertices{ &vertices, dummyManagedResourceCallback };
+
+        const String filename("mappedResourceFile");
+        {
+            File tempFile(filename);
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, { managedTexture, managedVertices }, false);
+        }
+
+        ResourceTableOfContents loadedTOC;
+        {
+            File tempFile(filename);
+            BinaryFileInputStream instream(tempFile);
+            ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        }
+
+        auto mappedFile = std::make_shared<const MemoryMappedFile>(filename);
+        ASSERT_TRUE(mappedFile->isMapped());
+        const Byte* mappedBegin = mappedFile->data();
+        const Byte* mappedEnd = mappedFile->data() + mappedFile->size();
+
+        auto loadedTexture = ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, loadedTOC.getEntryForHash(texture.getHash()));
+        auto loadedVertices = ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, loadedTOC.getEntryForHash(vertices.getHash()));
+        ASSERT_TRUE(loadedTexture);
+        ASSERT_TRUE(loadedVertices);
+
+        // resources keep file mapped
+        mappedFile.reset();
+
+        EXPECT_TRUE(loadedTexture->getResourceData().referencesExternalMemory());
+        EXPECT_GE(loadedTexture->getResourceData().data(), mappedBegin);
+        EXPECT_LT(loadedTexture->getResourceData().data(), mappedEnd);
+        EXPECT_EQ(texture.getResourceData().span(), loadedTexture->getResourceData().span());
+        EXPECT_EQ(texture.getHash(), loadedTexture->getHash());
+        EXPECT_EQ(String("texture"), loadedTexture->getName());
+
+        // may or may not be referenced depending on alignment in file, but content must match
+        EXPECT_TRUE(UnsafeTestMemoryHelpers::CompareMemoryBlobToSpan(vertexData, sizeof(vertexData), loadedVertices->getResourceData().span()));
+    }
+
+    TEST(ResourcePersistation, retrieveResourceFromMappedFileFailsForEntryNotMatchingData)
+    {
+        const auto dummyResource = getDummyResourceData();
+        const String filename("mappedDummyResourceFile");
+        {
+            File tempFile(filename);
+            ASSERT_TRUE(tempFile.open(File::Mode::WriteNewBinary));
+            ASSERT_TRUE(tempFile.write(dummyResource.first.data(), dummyResource.first.size()));
+        }
+        auto mappedFile = std::make_shared<const MemoryMappedFile>(filename);
+        ASSERT_TRUE(mappedFile->isMapped());
+
+        EXPECT_TRUE(ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, dummyResource.second));
+
+        ResourceFileEntry beyondFile = dummyResource.second;
+        ++beyondFile.sizeInBytes;
+        EXPECT_FALSE(ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, beyondFile));
+
+        ResourceFileEntry truncated = dummyResource.second;
+        --truncated.sizeInBytes;
+        EXPECT_FALSE(ResourcePersistation::RetrieveResourceFromMappedFile(mappedFile, truncated));
+    }
 }
@@ -19,6 +19,9 @@
 #include "Resource/ArrayResource.h"
 #include "Resource/TextureResource.h"
 #include "Components/ClientSceneLogicBase.h"
+#include "MockTaskQueue.h"
+#include <thread>
+#include <chrono>
 
 using namespace ramses_internal;
 
@@ -62,6 +65,35 @@ public:
         });
     }
 
+    // actions of same layout as in every flush of an app modifying same objects
+    static SceneActionCollection CreateRepeatedTransformActions()
+    {
+        SceneActionCollection actions;
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            actions.beginWriteSceneAction(ESceneActionId::SetTransformComponent);
+            actions.write(i);
+            actions.write(1.f);
+            actions.write(2.f);
+            actions.write(3.f);
+        }
+        return actions;
+    }
+
+    size_t sendRepeatedTransformActionsAndGetSerializedSize(SceneGraphComponent& sender, SceneId sceneId)
+    {
+        size_t serializedSize = 0u;
+        EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto, auto, auto& serializer) {
+            for (const auto& packet : TestSerializeSceneUpdateToVectorChunked(serializer))
+                serializedSize += packet.size();
+            return true;
+        });
+        SceneUpdate update;
+        update.actions = CreateRepeatedTransformActions();
+        sender.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, sceneStatistics);
+        return serializedSize;
+    }
+
     void publishScene(UInt32 sceneId, const String& name, EScenePublicationMode pubMode)
     {
         SceneInfo info(SceneId(sceneId), name, pubMode);
@@ -357,6 +389,8 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
         // grab resources directly out of serializer
         const auto resources = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().resources;
         EXPECT_EQ(resourcesToSend, resources);
+        // compressed when serialized
+        TestSerializeSceneUpdateToVectorChunked(serializer);
         EXPECT_TRUE(resources[0]->isCompressedAvailable());
         return true;
         });
@@ -365,6 +399,70 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, sceneStatistics);
 }
 
+TEST_F(ASceneGraphComponent, compressesLargeResourcesInParallelWhenSendingToRemoteProvider)
+{
+    StrictMock<MockTaskQueue> taskQueue;
+    SceneGraphComponent sceneGraphComponentWithTaskQueue(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, frameworkLock, &taskQueue);
+    sceneGraphComponentWithTaskQueue.connectToNetwork();
+
+    SceneId sceneId;
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
+    sceneGraphComponentWithTaskQueue.sendCreateScene(remoteParticipantID, sceneId, EScenePublicationMode_LocalAndRemote);
+
+    const UInt32 largeElementCount = 256u * 1024u;
+    ResourceBlob largeBlob(largeElementCount * EnumToSize(EDataType::Float));
+    std::iota(largeBlob.data(), largeBlob.data() + largeBlob.size(), static_cast<uint8_t>(10));
+    ResourceBlob smallBlob(1024 * EnumToSize(EDataType::Float));
+    std::iota(smallBlob.data(), smallBlob.data() + smallBlob.size(), static_cast<uint8_t>(10));
+    ManagedResourceVector resourcesToSend{
+        std::make_shared<const ArrayResource>(EResourceType_VertexArray, largeElementCount, EDataType::Float, largeBlob.data(), ResourceCacheFlag_DoNotCache, "large1"),
+        std::make_shared<const ArrayResource>(EResourceType_VertexArray, 1024u, EDataType::Float, smallBlob.data(), ResourceCacheFlag_DoNotCache, "small"),
+        std::make_shared<const ArrayResource>(EResourceType_VertexArray, largeElementCount, EDataType::Float, largeBlob.data(), ResourceCacheFlag_DoNotCache, "large2")
+    };
+
+    // only large resources are compressed as tasks, small one is compressed inline
+    std::vector<ITask*> compressionTasks;
+    EXPECT_CALL(taskQueue, enqueue(_)).Times(2).WillRepeatedly([&](ITask& task) {
+        task.addRef();
+        compressionTasks.push_back(&task);
+        return true;
+        });
+    const auto executeCompressionTask = [&](size_t taskIdx) {
+        compressionTasks[taskIdx]->execute();
+        compressionTasks[taskIdx]->release();
+    };
+
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto, auto, auto& serializer) {
+        EXPECT_EQ(2u, compressionTasks.size());
+        for (const auto& res : resourcesToSend)
+            EXPECT_FALSE(res->isCompressedAvailable());
+
+        // serializer has to wait for each large resource right before writing it, compression of second large resource
+        // is therefore executed only after small resource following the first one was compressed (i.e. reached by serializer)
+        std::thread worker([&]() {
+            EXPECT_FALSE(resourcesToSend[1]->isCompressedAvailable());
+            executeCompressionTask(0u);
+            EXPECT_TRUE(resourcesToSend[0]->isCompressedAvailable());
+
+            const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!resourcesToSend[1]->isCompressedAvailable() && std::chrono::steady_clock::now() < timeout)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            EXPECT_TRUE(resourcesToSend[1]->isCompressedAvailable());
+            EXPECT_FALSE(resourcesToSend[2]->isCompressedAvailable());
+            executeCompressionTask(1u);
+        });
+        TestSerializeSceneUpdateToVectorChunked(serializer);
+        worker.join();
+
+        for (const auto& res : resourcesToSend)
+            EXPECT_TRUE(res->isCompressedAvailable());
+        return true;
+        });
+    SceneUpdate update;
+    update.resources = resourcesToSend;
+    sceneGraphComponentWithTaskQueue.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, sceneStatistics);
+}
+
 
 TEST_F(ASceneGraphComponent, doesntSendSceneActionIfLocalConsumerIsntSet)
 {
@@ -401,6 +499,31 @@ TEST_F(ASceneGraphComponent, sendsAllSceneActionsAtOnceToRemoteProvider)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, sceneStatistics);
 }
 
+TEST_F(ASceneGraphComponent, doesNotDeltaEncodeSceneActionsByDefault)
+{
+    const SceneId sceneId(1);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, sceneId, EScenePublicationMode_LocalAndRemote);
+
+    const size_t actionsSize = CreateRepeatedTransformActions().collectionData().size();
+    EXPECT_GT(sendRepeatedTransformActionsAndGetSerializedSize(sceneGraphComponent, sceneId), actionsSize);
+    EXPECT_GT(sendRepeatedTransformActionsAndGetSerializedSize(sceneGraphComponent, sceneId), actionsSize);
+}
+
+TEST_F(ASceneGraphComponent, deltaEncodesSceneActionsSentToRemoteIfEnabled)
+{
+    SceneGraphComponent encodingSceneGraphComponent(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, frameworkLock, nullptr, true);
+    encodingSceneGraphComponent.connectToNetwork();
+
+    const SceneId sceneId(1);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
+    encodingSceneGraphComponent.sendCreateScene(remoteParticipantID, sceneId, EScenePublicationMode_LocalAndRemote);
+
+    const size_t actionsSize = CreateRepeatedTransformActions().collectionData().size();
+    EXPECT_LT(sendRepeatedTransformActionsAndGetSerializedSize(encodingSceneGraphComponent, sceneId), actionsSize);
+    EXPECT_LT(sendRepeatedTransformActionsAndGetSerializedSize(encodingSceneGraphComponent, sceneId), actionsSize / 10u);
+}
+
 TEST_F(ASceneGraphComponent, doesNotsendSceneUpdateToRemoteIfSceneWasPublishedLocalOnly)
 {
     const SceneId sceneId(111);
@@ -56,6 +56,13 @@ namespace ramses_internal
         static constexpr Matrix44f Scaling(const Vector3& scaling);
         static constexpr Matrix44f Scaling(const Float uniScale);
 
+        // Composes Translation * RotationEuler * Scaling directly without full matrix multiplications (same result)
+        static Matrix44f Transformation(const Vector3& translation, const Vector3& rotation, ERotationConvention rotationConvention, const Vector3& scaling);
+        // Composes inverse of Transformation(...), i.e. Scaling^-1 * RotationEuler^T * Translation^-1 (same result)
+        static Matrix44f InverseTransformation(const Vector3& translation, const Vector3& rotation, ERotationConvention rotationConvention, const Vector3& scaling);
+        // Same result as left * right, uses SSE or NEON if available at compile time
+        static Matrix44f Multiply(const Matrix44f& left, const Matrix44f& right);
+
         constexpr Matrix44f();
         constexpr Matrix44f(  const Float _m11, const Float _m12, const Float _m13, const Float _m14,
                     const Float _m21, const Float _m22, const Float _m23, const Float _m24,
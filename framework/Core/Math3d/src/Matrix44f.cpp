@@ -8,6 +8,14 @@
 
 #include <Math3d/Matrix44f.h>
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAMSES_MATRIX44F_USE_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RAMSES_MATRIX44F_USE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace ramses_internal
 {
     const Matrix44f Matrix44f::Identity(  1.f, 0.f, 0.f, 0.f,
@@ -19,4 +27,83 @@ namespace ramses_internal
                                     0.f, 0.f, 0.f, 0.f,
                                     0.f, 0.f, 0.f, 0.f,
                                     0.f, 0.f, 0.f, 0.f);
+
+    Matrix44f Matrix44f::Transformation(const Vector3& translation, const Vector3& rotation, ERotationConvention rotationConvention, const Vector3& scaling)
+    {
+        // T * R * S only scales the columns of R and puts translation into last column,
+        // all the other terms of the full multiplication are zeros
+        const Matrix33f rot = Matrix33f::RotationEuler(rotation, rotationConvention);
+        return Matrix44f(
+            rot.m11 * scaling.x, rot.m12 * scaling.y, rot.m13 * scaling.z, translation.x,
+            rot.m21 * scaling.x, rot.m22 * scaling.y, rot.m23 * scaling.z, translation.y,
+            rot.m31 * scaling.x, rot.m32 * scaling.y, rot.m33 * scaling.z, translation.z,
+            0.f,                 0.f,                 0.f,                 1.f);
+    }
+
+    Matrix44f Matrix44f::InverseTransformation(const Vector3& translation, const Vector3& rotation, ERotationConvention rotationConvention, const Vector3& scaling)
+    {
+        // S^-1 * R^T scales the rows of transposed R, multiplication with T^-1 then only adds translation column
+        const Matrix33f rot = Matrix33f::RotationEuler(rotation, rotationConvention);
+        const Vector3 invScaling = scaling.inverse();
+        const Vector3 invTranslation = -translation;
+
+        const Float r11 = invScaling.x * rot.m11;
+        const Float r12 = invScaling.x * rot.m21;
+        const Float r13 = invScaling.x * rot.m31;
+        const Float r21 = invScaling.y * rot.m12;
+        const Float r22 = invScaling.y * rot.m22;
+        const Float r23 = invScaling.y * rot.m32;
+        const Float r31 = invScaling.z * rot.m13;
+        const Float r32 = invScaling.z * rot.m23;
+        const Float r33 = invScaling.z * rot.m33;
+
+        return Matrix44f(
+            r11, r12, r13, r11 * invTranslation.x + r12 * invTranslation.y + r13 * invTranslation.z,
+            r21, r22, r23, r21 * invTranslation.x + r22 * invTranslation.y + r23 * invTranslation.z,
+            r31, r32, r33, r31 * invTranslation.x + r32 * invTranslation.y + r33 * invTranslation.z,
+            0.f, 0.f, 0.f, 1.f);
+    }
+
+    Matrix44f Matrix44f::Multiply(const Matrix44f& left, const Matrix44f& right)
+    {
+        // Each result column is a linear combination of left columns weighted by elements of corresponding right column.
+        // Terms are added in same order as in operator* and without fused multiply-add, so result is identical
+#if defined(RAMSES_MATRIX44F_USE_SSE)
+        const __m128 col0 = _mm_loadu_ps(&left.data[0]);
+        const __m128 col1 = _mm_loadu_ps(&left.data[4]);
+        const __m128 col2 = _mm_loadu_ps(&left.data[8]);
+        const __m128 col3 = _mm_loadu_ps(&left.data[12]);
+
+        Matrix44f result;
+        for (UInt32 i = 0u; i < 4u; ++i)
+        {
+            const Float* rightCol = &right.data[4u * i];
+            __m128 resultCol = _mm_mul_ps(col0, _mm_set1_ps(rightCol[0]));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col1, _mm_set1_ps(rightCol[1])));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col2, _mm_set1_ps(rightCol[2])));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col3, _mm_set1_ps(rightCol[3])));
+            _mm_storeu_ps(&result.data[4u * i], resultCol);
+        }
+        return result;
+#elif defined(RAMSES_MATRIX44F_USE_NEON)
+        const float32x4_t col0 = vld1q_f32(&left.data[0]);
+        const float32x4_t col1 = vld1q_f32(&left.data[4]);
+        const float32x4_t col2 = vld1q_f32(&left.data[8]);
+        const float32x4_t col3 = vld1q_f32(&left.data[12]);
+
+        Matrix44f result;
+        for (UInt32 i = 0u; i < 4u; ++i)
+        {
+            const Float* rightCol = &right.data[4u * i];
+            float32x4_t resultCol = vmulq_n_f32(col0, rightCol[0]);
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col1, rightCol[1]));
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col2, rightCol[2]));
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col3, rightCol[3]));
+            vst1q_f32(&result.data[4u * i], resultCol);
+        }
+        return result;
+#else
+        return left * right;
+#endif
+    }
 }
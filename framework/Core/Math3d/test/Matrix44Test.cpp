@@ -10,6 +10,8 @@
 #include "framework_common_gmock_header.h"
 #include "IOStreamTester.h"
 #include "gtest/gtest.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <iostream>
 
 namespace ramses_internal
 {
@@ -669,4 +671,109 @@ namespace ramses_internal
         IOStreamTesterBase::expectSame(Matrix44f::Identity);
         IOStreamTesterBase::expectSame(mat1);
     }
+
+    TEST_F(Matrix44Test, MultiplyGivesSameResultAsMultiplicationOperator)
+    {
+        const Matrix44f mat2(  0.5f, -2.0f,  3.5f,  1.0f
+                            ,  1.5f,  6.0f, -7.0f,  0.1f
+                            , -9.0f,  0.3f, 11.0f,  2.0f
+                            ,  0.0f,  4.0f,  1.0f,  1.0f);
+
+        EXPECT_EQ(mat1 * mat2, Matrix44f::Multiply(mat1, mat2));
+        EXPECT_EQ(mat2 * mat1, Matrix44f::Multiply(mat2, mat1));
+        EXPECT_EQ(mat1, Matrix44f::Multiply(mat1, Matrix44f::Identity));
+        EXPECT_EQ(Matrix44f::Empty, Matrix44f::Multiply(Matrix44f::Empty, mat1));
+    }
+
+    TEST_F(Matrix44Test, TransformationGivesSameResultAsComposingTranslationRotationAndScaling)
+    {
+        const Vector3 translation(1.f, -2.5f, 300.f);
+        const Vector3 rotation(10.f, -45.f, 123.f);
+        const Vector3 scaling(0.5f, 2.f, -3.f);
+
+        for (uint8_t i = 0u; i <= static_cast<uint8_t>(ERotationConvention::ZYZ); ++i)
+        {
+            const auto convention = static_cast<ERotationConvention>(i);
+            const Matrix44f expected = Matrix44f::Translation(translation) * Matrix44f::RotationEuler(rotation, convention) * Matrix44f::Scaling(scaling);
+            EXPECT_EQ(expected, Matrix44f::Transformation(translation, rotation, convention, scaling));
+        }
+    }
+
+    TEST_F(Matrix44Test, InverseTransformationGivesSameResultAsComposingInverseScalingRotationAndTranslation)
+    {
+        const Vector3 translation(1.f, -2.5f, 300.f);
+        const Vector3 rotation(10.f, -45.f, 123.f);
+        const Vector3 scaling(0.5f, 2.f, -3.f);
+
+        for (uint8_t i = 0u; i <= static_cast<uint8_t>(ERotationConvention::ZYZ); ++i)
+        {
+            const auto convention = static_cast<ERotationConvention>(i);
+            const Matrix44f expected = Matrix44f::Scaling(scaling.inverse()) * Matrix44f::RotationEuler(rotation, convention).transpose() * Matrix44f::Translation(-translation);
+            EXPECT_EQ(expected, Matrix44f::InverseTransformation(translation, rotation, convention, scaling));
+        }
+    }
+
+    TEST_F(Matrix44Test, ComposingTransformationChainWithMultiplyGivesSameResultAsOperator)
+    {
+        // chain of nodes, i.e. world matrix of every node is parent world matrix multiplied by local transformation
+        Matrix44f referenceMatrix = Matrix44f::Identity;
+        Matrix44f matrix = Matrix44f::Identity;
+        for (UInt32 i = 0u; i < 10u; ++i)
+        {
+            const Float f = static_cast<Float>(i * 37u % 100u);
+            const Vector3 translation(f * 0.1f, -f, 1.f);
+            const Vector3 rotation(f, 2.f * f, -f);
+            const Vector3 scaling(1.f + f * 0.01f, 1.f, 1.f - f * 0.001f);
+
+            referenceMatrix *= Matrix44f::Translation(translation) * Matrix44f::RotationEuler(rotation, ERotationConvention::XYZ) * Matrix44f::Scaling(scaling);
+            matrix = Matrix44f::Multiply(matrix, Matrix44f::Transformation(translation, rotation, ERotationConvention::XYZ, scaling));
+            EXPECT_EQ(referenceMatrix, matrix);
+        }
+    }
+
+    TEST_F(Matrix44Test, DISABLED_BenchmarkTransformationChainComposition)
+    {
+        constexpr UInt32 NodeCount = 1000000u;
+        std::vector<Vector3> translations(NodeCount);
+        std::vector<Vector3> rotations(NodeCount);
+        std::vector<Vector3> scalings(NodeCount);
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            const Float f = static_cast<Float>(i % 1000u);
+            translations[i] = Vector3(f * 0.1f, -f, 1.f);
+            rotations[i] = Vector3(f, 2.f * f, -f);
+            scalings[i] = Vector3(1.f + f * 0.001f, 1.f, 1.f - f * 0.0001f);
+        }
+
+        // chains of 10 nodes, i.e. world matrix of every node is parent world matrix multiplied by local transformation
+        std::vector<Matrix44f> referenceMatrices(NodeCount);
+        UInt64 start = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            Matrix44f chainMatrix = (i % 10u == 0u ? Matrix44f::Identity : referenceMatrices[i - 1]);
+            chainMatrix *= Matrix44f::Translation(translations[i]) * Matrix44f::RotationEuler(rotations[i], ERotationConvention::XYZ) * Matrix44f::Scaling(scalings[i]);
+            referenceMatrices[i] = chainMatrix;
+        }
+        const UInt64 referenceTime = PlatformTime::GetMicrosecondsMonotonic() - start;
+
+        std::vector<Matrix44f> matrices(NodeCount);
+        start = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            const Matrix44f& parentMatrix = (i % 10u == 0u ? Matrix44f::Identity : matrices[i - 1]);
+            matrices[i] = Matrix44f::Multiply(parentMatrix, Matrix44f::Transformation(translations[i], rotations[i], ERotationConvention::XYZ, scalings[i]));
+        }
+        const UInt64 time = PlatformTime::GetMicrosecondsMonotonic() - start;
+
+        // sin/cos of euler angles is shared by both variants and bounds the achievable speedup
+        std::vector<Matrix33f> rotationMatrices(NodeCount);
+        start = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+            rotationMatrices[i] = Matrix33f::RotationEuler(rotations[i], ERotationConvention::XYZ);
+        const UInt64 rotationTime = PlatformTime::GetMicrosecondsMonotonic() - start;
+
+        std::cout << "Composition of " << NodeCount << " world matrices: T*R*S with operator* " << referenceTime << "us, Transformation/Multiply " << time
+                  << "us, thereof euler rotation " << rotationTime << "us" << std::endl;
+        EXPECT_EQ(referenceMatrices, matrices);
+    }
 }
@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PARALLELTASKGROUP_H
+#define RAMSES_PARALLELTASKGROUP_H
+
+#include <functional>
+#include <memory>
+
+namespace ramses_internal
+{
+    class ITaskQueue;
+
+    /**
+     * Fork/join helper on top of an ITaskQueue (typically ThreadedTaskExecutor).
+     * Work items are enqueued as tasks into the queue, wait() blocks until all of them were executed.
+     * Tasks are ref counted and own the shared completion state, so it is safe to destroy the group
+     * right after wait() returned even though the worker thread still holds a reference to the task.
+     */
+    class ParallelTaskGroup
+    {
+    public:
+        explicit ParallelTaskGroup(ITaskQueue& taskQueue);
+        ~ParallelTaskGroup();
+
+        ParallelTaskGroup(const ParallelTaskGroup&) = delete;
+        ParallelTaskGroup& operator=(const ParallelTaskGroup&) = delete;
+
+        void run(std::function<void()> work);
+        void wait();
+
+    private:
+        struct State;
+        class GroupTask;
+
+        ITaskQueue& m_taskQueue;
+        std::shared_ptr<State> m_state;
+    };
+}
+
+#endif
@@ -0,0 +1,82 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TaskFramework/ParallelTaskGroup.h"
+#include "TaskFramework/ITaskQueue.h"
+#include "TaskFramework/ITask.h"
+#include <mutex>
+#include <condition_variable>
+#include <cassert>
+
+namespace ramses_internal
+{
+    struct ParallelTaskGroup::State
+    {
+        std::mutex lock;
+        std::condition_variable allDone;
+        size_t pendingTasks = 0u;
+    };
+
+    class ParallelTaskGroup::GroupTask final : public ITask
+    {
+    public:
+        GroupTask(std::shared_ptr<State> state, std::function<void()> work)
+            : m_state(std::move(state))
+            , m_work(std::move(work))
+        {
+        }
+
+        virtual void execute() override
+        {
+            m_work();
+
+            std::lock_guard<std::mutex> guard(m_state->lock);
+            assert(m_state->pendingTasks > 0u);
+            if (--m_state->pendingTasks == 0u)
+                m_state->allDone.notify_all();
+        }
+
+    private:
+        std::shared_ptr<State> m_state;
+        std::function<void()> m_work;
+    };
+
+    ParallelTaskGroup::ParallelTaskGroup(ITaskQueue& taskQueue)
+        : m_taskQueue(taskQueue)
+        , m_state(std::make_shared<State>())
+    {
+    }
+
+    ParallelTaskGroup::~ParallelTaskGroup()
+    {
+        wait();
+    }
+
+    void ParallelTaskGroup::run(std::function<void()> work)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_state->lock);
+            ++m_state->pendingTasks;
+        }
+
+        auto task = new GroupTask(m_state, std::move(work));
+        if (!m_taskQueue.enqueue(*task))
+        {
+            // queue refused the task, execute in calling thread instead so that wait() cannot block forever
+            task->execute();
+        }
+        // queue holds its own reference, task deletes itself when worker releases it
+        task->release();
+    }
+
+    void ParallelTaskGroup::wait()
+    {
+        std::unique_lock<std::mutex> l(m_state->lock);
+        m_state->allDone.wait(l, [&]() { return m_state->pendingTasks == 0u; });
+    }
+}
@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TaskFramework/ParallelTaskGroup.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "framework_common_gmock_header.h"
+#include "MockTaskQueue.h"
+#include <atomic>
+#include <thread>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    TEST(AParallelTaskGroup, executesAllWorkItemsBeforeWaitReturns)
+    {
+        ThreadedTaskExecutor executor(4);
+        std::atomic<uint32_t> counter{ 0u };
+
+        ParallelTaskGroup group(executor);
+        for (int i = 0; i < 100; ++i)
+        {
+            group.run([&counter]()
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                ++counter;
+            });
+        }
+        group.wait();
+
+        EXPECT_EQ(100u, counter);
+    }
+
+    TEST(AParallelTaskGroup, canBeReusedAfterWait)
+    {
+        ThreadedTaskExecutor executor(2);
+        std::atomic<uint32_t> counter{ 0u };
+
+        ParallelTaskGroup group(executor);
+        group.run([&counter]() { ++counter; });
+        group.wait();
+        EXPECT_EQ(1u, counter);
+
+        group.run([&counter]() { ++counter; });
+        group.run([&counter]() { ++counter; });
+        group.wait();
+        EXPECT_EQ(3u, counter);
+    }
+
+    TEST(AParallelTaskGroup, waitReturnsImmediatelyIfNothingWasRun)
+    {
+        StrictMock<MockTaskQueue> queue;
+        ParallelTaskGroup group(queue);
+        group.wait();
+    }
+
+    TEST(AParallelTaskGroup, executesWorkInCallingThreadIfQueueRejectsTask)
+    {
+        StrictMock<MockTaskQueue> queue;
+        EXPECT_CALL(queue, enqueue(_)).WillOnce(Return(false));
+
+        bool executed = false;
+        ParallelTaskGroup group(queue);
+        group.run([&executed]() { executed = true; });
+        EXPECT_TRUE(executed);
+        group.wait();
+    }
+
+    TEST(AParallelTaskGroup, destructorWaitsForPendingWork)
+    {
+        ThreadedTaskExecutor executor(2);
+        std::atomic<bool> finished{ false };
+        {
+            ParallelTaskGroup group(executor);
+            group.run([&finished]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                finished = true;
+            });
+        }
+        EXPECT_TRUE(finished);
+    }
+}
@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BINARYSPANINPUTSTREAM_H
+#define RAMSES_BINARYSPANINPUTSTREAM_H
+
+#include "Collections/IInputStream.h"
+#include "absl/types/span.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    /*
+     * Input stream on memory of known size (e.g. memory mapped file). Unlike BinaryInputStream
+     * it never reads beyond its end but sets state to Eof instead.
+     */
+    class BinarySpanInputStream : public IInputStream
+    {
+    public:
+        explicit BinarySpanInputStream(absl::Span<const Byte> data);
+
+        IInputStream& read(void* buffer, size_t size) override;
+
+        EStatus seek(Int numberOfBytesToSeek, Seek origin) override;
+        EStatus getPos(size_t& position) const override;
+
+        EStatus getState() const override;
+
+    private:
+        absl::Span<const Byte> m_data;
+        size_t m_pos = 0u;
+        EStatus m_state = EStatus::Ok;
+    };
+
+    inline BinarySpanInputStream::BinarySpanInputStream(absl::Span<const Byte> data)
+        : m_data(data)
+    {
+    }
+
+    inline IInputStream& BinarySpanInputStream::read(void* buffer, size_t size)
+    {
+        if (m_state != EStatus::Ok)
+            return *this;
+        if (size > m_data.size() - m_pos)
+        {
+            m_state = EStatus::Eof;
+            return *this;
+        }
+
+        if (size)
+            std::memcpy(buffer, m_data.data() + m_pos, size);
+        m_pos += size;
+        return *this;
+    }
+
+    inline EStatus BinarySpanInputStream::seek(Int numberOfBytesToSeek, Seek origin)
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+
+        const Int newPos = (origin == Seek::FromBeginning ? 0 : static_cast<Int>(m_pos)) + numberOfBytesToSeek;
+        if (newPos < 0 || newPos > static_cast<Int>(m_data.size()))
+            return EStatus::Error;
+
+        m_pos = static_cast<size_t>(newPos);
+        return EStatus::Ok;
+    }
+
+    inline EStatus BinarySpanInputStream::getPos(size_t& position) const
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+        position = m_pos;
+        return EStatus::Ok;
+    }
+
+    inline EStatus BinarySpanInputStream::getState() const
+    {
+        return m_state;
+    }
+}
+
+#endif
@@ -49,6 +49,8 @@ namespace ramses_internal
         bool createFile();
         bool createDirectory();
         bool remove();
+        // replaces file at newPath if it exists, file must not be open
+        RNODISCARD bool renameTo(const String& newPath);
 
         RNODISCARD bool open(const Mode& mode);
         bool close();
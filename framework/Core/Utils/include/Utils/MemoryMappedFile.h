@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MEMORYMAPPEDFILE_H
+#define RAMSES_MEMORYMAPPEDFILE_H
+
+#include "Collections/String.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/Macros.h"
+
+namespace ramses_internal
+{
+    /*
+     * Maps whole file into memory for reading. Pages are loaded on first access and can be dropped by
+     * system again under memory pressure, so mapped data does not count as private memory of the process.
+     * Mapping is private (copy-on-write), writes to mapped memory are never stored to file.
+     *
+     * The file must not be truncated while mapped, accessing pages beyond its new end terminates the process.
+     * Writers of files which might be mapped by the process itself are expected to check IsFileMapped before writing in place,
+     * a mapped file can be replaced by writing a new file and renaming it over the mapped one.
+     * Mapping fails on platforms without memory mapped files support, users are expected to fall back to reading the file.
+     */
+    class MemoryMappedFile final
+    {
+    public:
+        explicit MemoryMappedFile(const String& filename);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        RNODISCARD bool isMapped() const;
+        RNODISCARD Byte* data() const;
+        RNODISCARD size_t size() const;
+
+        // Hints system to load given range of file into memory ahead of access, does not block
+        void readAhead(size_t offset, size_t length) const;
+
+        // Returns true if file is currently mapped by any instance in this process, also if it is referred to by a different path.
+        // Always false on platforms which refuse to modify mapped files anyway (Windows)
+        static bool IsFileMapped(const String& filename);
+
+    private:
+        Byte* m_data = nullptr;
+        size_t m_size = 0u;
+        // identifies mapped file independent of path it was opened by
+        UInt64 m_device = 0u;
+        UInt64 m_inode = 0u;
+    };
+
+    inline bool MemoryMappedFile::isMapped() const
+    {
+        return m_data != nullptr;
+    }
+
+    inline Byte* MemoryMappedFile::data() const
+    {
+        return m_data;
+    }
+
+    inline size_t MemoryMappedFile::size() const
+    {
+        return m_size;
+    }
+}
+
+#endif
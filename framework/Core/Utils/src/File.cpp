@@ -294,6 +294,20 @@ namespace ramses_internal
         return false;
     }
 
+    bool File::renameTo(const String& newPath)
+    {
+        if (m_handle != nullptr)
+            return false;
+        // std::rename fails on windows if target exists
+        if (MoveFileExA(m_path.c_str(), newPath.c_str(), MOVEFILE_REPLACE_EXISTING) != TRUE)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "File::renameTo: renaming {} to {} failed, error is {}", m_path, newPath, GetLastError());
+            return false;
+        }
+        m_path = RemoveTrailingBackslash(newPath);
+        return true;
+    }
+
     bool File::isDirectory() const
     {
         DWORD dwAttributes = GetFileAttributesA(m_path.c_str());
@@ -385,6 +399,19 @@ namespace ramses_internal
         return false;
     }
 
+    bool File::renameTo(const String& newPath)
+    {
+        if (m_handle != nullptr)
+            return false;
+        if (::rename(m_path.c_str(), newPath.c_str()) != 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "File::renameTo: renaming {} to {} failed, errno is {}", m_path, newPath, errno);
+            return false;
+        }
+        m_path = RemoveTrailingBackslash(newPath);
+        return true;
+    }
+
     bool File::exists() const
     {
         struct stat fileStats;
@@ -0,0 +1,189 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/LogMacros.h"
+#include <algorithm>
+
+#if defined(_WIN32)
+#include "PlatformAbstraction/MinimalWindowsH.h"
+#elif !defined(__ghs__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cassert>
+#include <mutex>
+#include <vector>
+#endif
+
+namespace ramses_internal
+{
+#if defined(_WIN32)
+
+    MemoryMappedFile::MemoryMappedFile(const String& filename)
+    {
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            // view keeps mapping alive, handles are not needed anymore once it is created
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                if (view != nullptr)
+                {
+                    m_data = static_cast<Byte*>(view);
+                    m_size = static_cast<size_t>(fileSize.QuadPart);
+                }
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+
+        if (!m_data)
+            LOG_WARN_P(CONTEXT_FRAMEWORK, "MemoryMappedFile: failed to map file '{}', error {}", filename, GetLastError());
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+    }
+
+    void MemoryMappedFile::readAhead(size_t /*offset*/, size_t /*length*/) const
+    {
+        // pages are loaded on access only
+    }
+
+    bool MemoryMappedFile::IsFileMapped(const String& /*filename*/)
+    {
+        // mapped files can't be truncated or replaced on Windows, writing them fails instead
+        return false;
+    }
+
+#elif defined(__ghs__)
+
+    MemoryMappedFile::MemoryMappedFile(const String& /*filename*/)
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile() = default;
+
+    void MemoryMappedFile::readAhead(size_t /*offset*/, size_t /*length*/) const
+    {
+    }
+
+    bool MemoryMappedFile::IsFileMapped(const String& /*filename*/)
+    {
+        return false;
+    }
+
+#else
+
+    namespace
+    {
+        // device and inode of files mapped in process, one entry per mapping
+        class MappedFilesRegistry
+        {
+        public:
+            static MappedFilesRegistry& GetInstance()
+            {
+                static MappedFilesRegistry registry;
+                return registry;
+            }
+
+            void add(UInt64 device, UInt64 inode)
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                m_files.emplace_back(device, inode);
+            }
+
+            void remove(UInt64 device, UInt64 inode)
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                const auto it = std::find(m_files.cbegin(), m_files.cend(), std::make_pair(device, inode));
+                assert(it != m_files.cend());
+                m_files.erase(it);
+            }
+
+            bool contains(UInt64 device, UInt64 inode) const
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                return std::find(m_files.cbegin(), m_files.cend(), std::make_pair(device, inode)) != m_files.cend();
+            }
+
+        private:
+            mutable std::mutex m_lock;
+            std::vector<std::pair<UInt64, UInt64>> m_files;
+        };
+    }
+
+    MemoryMappedFile::MemoryMappedFile(const String& filename)
+    {
+        const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return;
+
+        struct stat fileStat = {};
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            // mapping stays valid after file descriptor is closed
+            void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED)
+            {
+                m_data = static_cast<Byte*>(mapping);
+                m_size = static_cast<size_t>(fileStat.st_size);
+                m_device = static_cast<UInt64>(fileStat.st_dev);
+                m_inode = static_cast<UInt64>(fileStat.st_ino);
+                MappedFilesRegistry::GetInstance().add(m_device, m_inode);
+                // access order is not sequential, read ahead is requested explicitly by users who know what is read next
+                madvise(m_data, m_size, MADV_RANDOM);
+            }
+        }
+        close(fd);
+
+        if (!m_data)
+            LOG_WARN_P(CONTEXT_FRAMEWORK, "MemoryMappedFile: failed to map file '{}', errno {}", filename, errno);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+        {
+            munmap(m_data, m_size);
+            MappedFilesRegistry::GetInstance().remove(m_device, m_inode);
+        }
+    }
+
+    void MemoryMappedFile::readAhead(size_t offset, size_t length) const
+    {
+        if (!m_data || offset >= m_size)
+            return;
+
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t alignedOffset = offset / pageSize * pageSize;
+        const size_t end = std::min(offset + length, m_size);
+        madvise(m_data + alignedOffset, end - alignedOffset, MADV_WILLNEED);
+    }
+
+    bool MemoryMappedFile::IsFileMapped(const String& filename)
+    {
+        struct stat fileStat = {};
+        if (stat(filename.c_str(), &fileStat) != 0)
+            return false;
+        return MappedFilesRegistry::GetInstance().contains(static_cast<UInt64>(fileStat.st_dev), static_cast<UInt64>(fileStat.st_ino));
+    }
+
+#endif
+}
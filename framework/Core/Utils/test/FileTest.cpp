@@ -319,6 +319,39 @@ namespace ramses_internal
         EXPECT_FALSE(file.exists());
     }
 
+    TEST_F(AFile, RenameReplacesExistingFile)
+    {
+        addForCleanup({"renameSource", "renameTarget"});
+
+        File target("renameTarget");
+        ASSERT_TRUE(target.open(File::Mode::WriteNewBinary));
+        const char oldContent[] = "old content";
+        EXPECT_TRUE(target.write(oldContent, sizeof(oldContent)));
+        EXPECT_TRUE(target.close());
+
+        File source("renameSource");
+        ASSERT_TRUE(source.open(File::Mode::WriteNewBinary));
+        const char newContent[] = "new";
+        EXPECT_TRUE(source.write(newContent, sizeof(newContent)));
+        EXPECT_FALSE(source.renameTo("renameTarget"));
+        EXPECT_TRUE(source.close());
+
+        EXPECT_TRUE(source.renameTo("renameTarget"));
+        EXPECT_FALSE(File("renameSource").exists());
+        EXPECT_EQ("renameTarget", source.getPath());
+
+        size_t size = 0u;
+        EXPECT_TRUE(File("renameTarget").getSizeInBytes(size));
+        EXPECT_EQ(sizeof(newContent), size);
+    }
+
+    TEST_F(AFile, RenameFailsIfFileDoesNotExist)
+    {
+        File file("this_file_should_really_not_exist");
+        EXPECT_FALSE(file.renameTo("renameTarget"));
+        EXPECT_FALSE(File("renameTarget").exists());
+    }
+
     TEST_F(AFile, TestExists)
     {
         File file(".");
@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace ramses_internal
+{
+    class AMemoryMappedFile : public ::testing::Test
+    {
+    public:
+        AMemoryMappedFile()
+        {
+            File file(Filename);
+            EXPECT_TRUE(file.open(File::Mode::WriteOverWriteOld));
+            const Byte data[4] = { 1u, 2u, 3u, 4u };
+            EXPECT_TRUE(file.write(data, sizeof(data)));
+            EXPECT_TRUE(file.close());
+        }
+
+        virtual ~AMemoryMappedFile() override
+        {
+            File(Filename).remove();
+        }
+
+    protected:
+        static constexpr const char* Filename = "memoryMappedFileTest.bin";
+    };
+
+    constexpr const char* AMemoryMappedFile::Filename;
+
+    TEST_F(AMemoryMappedFile, mapsFileContents)
+    {
+        MemoryMappedFile file(Filename);
+        if (!file.isMapped())
+            GTEST_SKIP() << "memory mapped files not supported on this platform";
+
+        ASSERT_EQ(4u, file.size());
+        EXPECT_EQ(1u, file.data()[0]);
+        EXPECT_EQ(4u, file.data()[3]);
+    }
+
+    TEST_F(AMemoryMappedFile, failsToMapNonexistingFile)
+    {
+        MemoryMappedFile file("this_file_should_really_not_exist.bin");
+        EXPECT_FALSE(file.isMapped());
+        EXPECT_FALSE(MemoryMappedFile::IsFileMapped("this_file_should_really_not_exist.bin"));
+    }
+
+#if !defined(_WIN32)
+    TEST_F(AMemoryMappedFile, reportsFileAsMappedWhileAnyInstanceMapsIt)
+    {
+        EXPECT_FALSE(MemoryMappedFile::IsFileMapped(Filename));
+
+        auto file1 = std::make_unique<MemoryMappedFile>(Filename);
+        if (!file1->isMapped())
+            GTEST_SKIP() << "memory mapped files not supported on this platform";
+        auto file2 = std::make_unique<MemoryMappedFile>(Filename);
+        EXPECT_TRUE(MemoryMappedFile::IsFileMapped(Filename));
+
+        file1.reset();
+        EXPECT_TRUE(MemoryMappedFile::IsFileMapped(Filename));
+        file2.reset();
+        EXPECT_FALSE(MemoryMappedFile::IsFileMapped(Filename));
+    }
+
+    TEST_F(AMemoryMappedFile, reportsFileAsMappedIfReferredToByDifferentPath)
+    {
+        MemoryMappedFile file(Filename);
+        if (!file.isMapped())
+            GTEST_SKIP() << "memory mapped files not supported on this platform";
+
+        EXPECT_TRUE(MemoryMappedFile::IsFileMapped(String("./") + Filename));
+    }
+#endif
+}
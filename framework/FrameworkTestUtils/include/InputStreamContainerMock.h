@@ -21,6 +21,7 @@ namespace ramses_internal
         ~InputStreamContainerMock() override;
 
         MOCK_METHOD(IInputStream&, getStream, (), (override));
+        MOCK_METHOD(void, readAhead, (size_t offset, size_t length), (override));
     };
 }
 
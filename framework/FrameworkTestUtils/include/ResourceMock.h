@@ -25,6 +25,8 @@ namespace ramses_internal
 
         MOCK_METHOD(const ResourceBlob&, getResourceData, (), (const, override));
         MOCK_METHOD(const CompressedResourceBlob&, getCompressedResourceData, (), (const, override));
+        MOCK_METHOD(std::shared_ptr<const ResourceBlob>, getSharedResourceData, (), (const, override));
+        MOCK_METHOD(std::shared_ptr<const CompressedResourceBlob>, getSharedCompressedResourceData, (), (const, override));
         MOCK_METHOD(UInt32, getDecompressedDataSize, (), (const, override));
         MOCK_METHOD(UInt32, getCompressedDataSize, (), (const, override));
         MOCK_METHOD(bool, isCompressedAvailable, (), (const, override));
@@ -15,6 +15,7 @@
 #include "Utils/AssertMovable.h"
 #include "absl/types/span.h"
 #include <memory>
+#include <cassert>
 
 namespace ramses_internal
 {
@@ -26,6 +27,8 @@ namespace ramses_internal
     public:
         explicit HeapArray(UInt size = 0, const T* data = nullptr);
         HeapArray(UInt size, HeapArray&& other);
+        // references memory not owned by array, which is kept alive by externalOwner as long as array exists
+        HeapArray(UInt size, T* externalData, std::shared_ptr<const void> externalOwner);
 
         HeapArray(const HeapArray&) = delete;
         HeapArray& operator=(const HeapArray&) = delete;
@@ -39,21 +42,25 @@ namespace ramses_internal
         RNODISCARD absl::Span<const T> span() const;
 
         void setZero();
+        RNODISCARD bool referencesExternalMemory() const;
 
     private:
         UInt m_size;
-        std::unique_ptr<T[]> m_data;
+        std::unique_ptr<T[]> m_ownedData;
+        std::shared_ptr<const void> m_externalOwner;
+        T* m_data;
     };
 
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(UInt size, const T* data)
         : m_size(size)
-        , m_data(m_size > 0 ? new T[m_size] : nullptr)
+        , m_ownedData(m_size > 0 ? new T[m_size] : nullptr)
+        , m_data(m_ownedData.get())
     {
         if (m_data && data)
         {
-            PlatformMemory::Copy(m_data.get(), data, size * sizeof(T));
+            PlatformMemory::Copy(m_data, data, size * sizeof(T));
         }
     }
 
@@ -61,20 +68,36 @@ namespace ramses_internal
     inline
     HeapArray<T, UniqueIdT>::HeapArray(UInt size, HeapArray&& other)
         : m_size(size)
-        , m_data(std::move(other.m_data))
+        , m_ownedData(std::move(other.m_ownedData))
+        , m_externalOwner(std::move(other.m_externalOwner))
+        , m_data(other.m_data)
     {
         ASSERT_MOVABLE(HeapArray)
 
         other.m_size = 0;
+        other.m_data = nullptr;
+    }
+
+    template <typename T, typename UniqueIdT>
+    inline
+    HeapArray<T, UniqueIdT>::HeapArray(UInt size, T* externalData, std::shared_ptr<const void> externalOwner)
+        : m_size(size)
+        , m_externalOwner(std::move(externalOwner))
+        , m_data(externalData)
+    {
+        assert(m_externalOwner);
     }
 
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(HeapArray&& o) noexcept
         : m_size(o.m_size)
-        , m_data(std::move(o.m_data))
+        , m_ownedData(std::move(o.m_ownedData))
+        , m_externalOwner(std::move(o.m_externalOwner))
+        , m_data(o.m_data)
     {
         o.m_size = 0;
+        o.m_data = nullptr;
     }
 
     template <typename T, typename UniqueIdT>
@@ -84,8 +107,11 @@ namespace ramses_internal
         if (&o != this)
         {
             m_size = o.m_size;
-            m_data = std::move(o.m_data);
+            m_ownedData = std::move(o.m_ownedData);
+            m_externalOwner = std::move(o.m_externalOwner);
+            m_data = o.m_data;
             o.m_size = 0;
+            o.m_data = nullptr;
         }
         return *this;
     }
@@ -101,21 +127,21 @@ namespace ramses_internal
     inline
     T* HeapArray<T, UniqueIdT>::data()
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename UniqueIdT>
     inline
     const T* HeapArray<T, UniqueIdT>::data() const
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename UniqueIdT>
     inline
     absl::Span<const T> HeapArray<T, UniqueIdT>::span() const
     {
-        return {m_data.get(), m_size};
+        return {m_data, m_size};
     }
 
     template <typename T, typename UniqueIdT>
@@ -124,9 +150,16 @@ namespace ramses_internal
     {
         if (m_data)
         {
-            PlatformMemory::Set(m_data.get(), 0, m_size * sizeof(T));
+            PlatformMemory::Set(m_data, 0, m_size * sizeof(T));
         }
     }
+
+    template <typename T, typename UniqueIdT>
+    inline
+    bool HeapArray<T, UniqueIdT>::referencesExternalMemory() const
+    {
+        return m_externalOwner != nullptr;
+    }
 }
 
 #endif
@@ -8,6 +8,7 @@
 
 #include "Collections/HeapArray.h"
 #include "gtest/gtest.h"
+#include <vector>
 
 
 namespace ramses_internal
@@ -112,4 +113,25 @@ namespace ramses_internal
         HeapArray<TypeParam> a;
         EXPECT_EQ(absl::Span<const TypeParam>(), a.span());
     }
+
+    TYPED_TEST(AHeapArray, canReferenceExternalMemoryKeepingItsOwnerAlive)
+    {
+        auto owner = std::make_shared<std::vector<TypeParam>>(std::vector<TypeParam>{ 1, 2, 3, 4 });
+        std::weak_ptr<std::vector<TypeParam>> weakOwner = owner;
+        TypeParam* externalData = owner->data();
+
+        HeapArray<TypeParam> a(3, externalData + 1, std::move(owner));
+        EXPECT_TRUE(a.referencesExternalMemory());
+        EXPECT_EQ(externalData + 1, a.data());
+        EXPECT_EQ(3u, a.size());
+
+        HeapArray<TypeParam> b;
+        b = std::move(a);
+        EXPECT_EQ(externalData + 1, b.data());
+        EXPECT_FALSE(weakOwner.expired());
+
+        b = HeapArray<TypeParam>(2);
+        EXPECT_FALSE(b.referencesExternalMemory());
+        EXPECT_TRUE(weakOwner.expired());
+    }
 }
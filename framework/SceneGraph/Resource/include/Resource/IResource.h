@@ -12,6 +12,7 @@
 #include "SceneAPI/ResourceContentHash.h"
 #include "Collections/String.h"
 #include "Resource/ResourceTypes.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -39,6 +40,10 @@ namespace ramses_internal
         virtual ~IResource(){};
         virtual const ResourceBlob& getResourceData() const = 0;
         virtual const CompressedResourceBlob& getCompressedResourceData() const = 0;
+        // blobs stay valid as long as returned pointer is held, also if resource is recompressed or its data
+        // replaced meanwhile (e.g. while blob is being sent), nullptr if not available
+        virtual std::shared_ptr<const ResourceBlob> getSharedResourceData() const = 0;
+        virtual std::shared_ptr<const CompressedResourceBlob> getSharedCompressedResourceData() const = 0;
         virtual UInt32 getDecompressedDataSize() const = 0;
         virtual UInt32 getCompressedDataSize() const = 0;
         virtual void setResourceData(ResourceBlob data) = 0;
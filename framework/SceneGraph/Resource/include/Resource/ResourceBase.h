@@ -13,6 +13,7 @@
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "SceneAPI/IScene.h"
 #include <mutex>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -33,22 +34,34 @@ namespace ramses_internal
 
         virtual const ResourceBlob& getResourceData() const final override
         {
-            assert(m_data.data());
-            return m_data;
+            assert(m_data);
+            return m_data ? *m_data : EmptyResourceBlob;
         }
 
         virtual const CompressedResourceBlob& getCompressedResourceData() const final override
         {
-            assert(m_compressedData.data());
+            assert(m_compressedData);
+            return m_compressedData ? *m_compressedData : EmptyCompressedResourceBlob;
+        }
+
+        virtual std::shared_ptr<const ResourceBlob> getSharedResourceData() const final override
+        {
+            std::unique_lock<std::mutex> l(m_compressionLock);
+            return m_data;
+        }
+
+        virtual std::shared_ptr<const CompressedResourceBlob> getSharedCompressedResourceData() const final override
+        {
+            std::unique_lock<std::mutex> l(m_compressionLock);
             return m_compressedData;
         }
 
         virtual void setResourceData(ResourceBlob data) final override
         {
             assert(data.size() > 0);
-            m_data = std::move(data);
-            m_uncompressedSize = static_cast<uint32_t>(m_data.size());
-            m_compressedData = CompressedResourceBlob();
+            m_uncompressedSize = static_cast<uint32_t>(data.size());
+            m_data = MakeShared(std::move(data));
+            m_compressedData.reset();
             m_currentCompression = CompressionLevel::None;
             m_hash = ResourceContentHash::Invalid();
         }
@@ -56,9 +69,9 @@ namespace ramses_internal
         virtual void setResourceData(ResourceBlob data, const ResourceContentHash& hash) final override
         {
             assert(data.size() > 0);
-            m_data = std::move(data);
-            m_uncompressedSize = static_cast<uint32_t>(m_data.size());
-            m_compressedData = CompressedResourceBlob();
+            m_uncompressedSize = static_cast<uint32_t>(data.size());
+            m_data = MakeShared(std::move(data));
+            m_compressedData.reset();
             m_currentCompression = CompressionLevel::None;
             m_hash = hash;
         }
@@ -67,8 +80,8 @@ namespace ramses_internal
         {
             assert(compressedData.size() > 0);
             assert(uncompressedSize > 0);
-            m_data = ResourceBlob();
-            m_compressedData = std::move(compressedData);
+            m_data.reset();
+            m_compressedData = MakeShared(std::move(compressedData));
             m_currentCompression = compressionLevel;
             m_uncompressedSize = uncompressedSize;
             m_hash = hash;
@@ -82,8 +95,8 @@ namespace ramses_internal
         virtual UInt32 getCompressedDataSize() const override
         {
             std::unique_lock<std::mutex> l(m_compressionLock);
-            if (m_compressedData.data())
-                return static_cast<uint32_t>(m_compressedData.size());
+            if (m_compressedData)
+                return static_cast<uint32_t>(m_compressedData->size());
             // 0 == not compressed
             return 0;
         }
@@ -102,13 +115,13 @@ namespace ramses_internal
         bool isCompressedAvailable() const final override
         {
             std::unique_lock<std::mutex> l(m_compressionLock);
-            return m_compressedData.data() != nullptr;
+            return m_compressedData != nullptr;
         }
 
         bool isDeCompressedAvailable() const final override
         {
             std::unique_lock<std::mutex> l(m_compressionLock);
-            return m_data.data() != nullptr;
+            return m_data != nullptr;
         }
 
         ResourceCacheFlag getCacheFlag() const final override
@@ -129,10 +142,21 @@ namespace ramses_internal
 
         void updateHash() const;
 
+        template <typename BLOB>
+        static std::shared_ptr<const BLOB> MakeShared(BLOB blob)
+        {
+            return blob.data() ? std::make_shared<const BLOB>(std::move(blob)) : nullptr;
+        }
+
+        static const ResourceBlob EmptyResourceBlob;
+        static const CompressedResourceBlob EmptyCompressedResourceBlob;
+
     private:
         const EResourceType m_typeID;
-        mutable ResourceBlob m_data;
-        mutable CompressedResourceBlob m_compressedData;
+        // blobs are shared with users which need them beyond the next change of resource data,
+        // they are replaced but never modified in place
+        mutable std::shared_ptr<const ResourceBlob> m_data;
+        mutable std::shared_ptr<const CompressedResourceBlob> m_compressedData;
         mutable CompressionLevel m_currentCompression = CompressionLevel::None;
         mutable ResourceContentHash m_hash;
         uint32_t m_uncompressedSize = 0;
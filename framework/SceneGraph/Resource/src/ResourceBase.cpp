@@ -13,11 +13,14 @@
 
 namespace ramses_internal
 {
+    const ResourceBlob ResourceBase::EmptyResourceBlob;
+    const CompressedResourceBlob ResourceBase::EmptyCompressedResourceBlob;
+
     void ResourceBase::updateHash() const
     {
-        if (!m_data.data() || m_data.size() == 0)
+        if (!m_data || m_data->size() == 0)
         {
-            if (!m_compressedData.data())
+            if (!m_compressedData)
             {
                 m_hash = ResourceContentHash::Invalid();
             }
@@ -26,7 +29,7 @@ namespace ramses_internal
         {
             // hash blob
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(reinterpret_cast<const char*>(m_data.data()), m_data.size());
+            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(reinterpret_cast<const char*>(m_data->data()), m_data->size());
 
             // hash metadata
             BinaryOutputStream metaDataStream(1024);
@@ -49,14 +52,14 @@ namespace ramses_internal
     {
         std::unique_lock<std::mutex> l(m_compressionLock);
         if (level > m_currentCompression &&
-            m_data.size() > 1000) // only compress if it pays off
+            m_data && m_data->size() > 1000) // only compress if it pays off
         {
-            assert(m_data.data());
             getHash(); // try calculate before uncompressed data is lost
             const auto lz4Level = (level == CompressionLevel::Realtime) ?
                 LZ4CompressionUtils::CompressionLevel::Fast :
                 LZ4CompressionUtils::CompressionLevel::High;
-            m_compressedData = LZ4CompressionUtils::compress(m_data, lz4Level);
+            // previous blob is swapped, not overwritten, it may still be referenced by data being sent
+            m_compressedData = MakeShared(LZ4CompressionUtils::compress(*m_data, lz4Level));
             m_currentCompression = level;
         }
     }
@@ -64,12 +67,12 @@ namespace ramses_internal
     void ResourceBase::decompress() const
     {
         std::unique_lock<std::mutex> l(m_compressionLock);
-        if (!m_data.data())
+        if (!m_data)
         {
-            assert(m_compressedData.data());
-            assert(m_compressedData.size());
+            assert(m_compressedData);
+            assert(m_compressedData->size());
 
-            m_data = LZ4CompressionUtils::decompress(m_compressedData, m_uncompressedSize);
+            m_data = MakeShared(LZ4CompressionUtils::decompress(*m_compressedData, m_uncompressedSize));
         }
     }
 }
@@ -21,6 +21,7 @@ namespace ramses_internal
         explicit ActionCollectingScene(const SceneInfo& sceneInfo = SceneInfo());
 
         virtual void                        preallocateSceneSize            (const SceneSizeInformation& sizeInfo) override;
+        virtual void                        restoreFromSnapshot             (const SceneSnapshot& snapshot) override;
 
         // Renderable allocation
         virtual RenderableHandle            allocateRenderable              (NodeHandle nodeHandle, RenderableHandle handle = RenderableHandle::Invalid()) override;
@@ -118,6 +119,7 @@ namespace ramses_internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        virtual void                        setRenderPassFrustumCulling     (RenderPassHandle passHandle, bool enable) override;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order) override;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
 
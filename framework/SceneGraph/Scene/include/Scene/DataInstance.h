@@ -21,9 +21,11 @@ namespace ramses_internal
         {
         }
 
-        DataInstance(DataLayoutHandle dataLayoutHandle, UInt32 size)
+        // payload memory is owned by the scene's DataInstanceArena
+        DataInstance(DataLayoutHandle dataLayoutHandle, Byte* data, UInt32 size)
             : m_dataLayoutHandle(dataLayoutHandle)
-            , m_data(size)
+            , m_data(data)
+            , m_size(size)
         {
         }
 
@@ -43,7 +45,7 @@ namespace ramses_internal
         void setTypedData(UInt32 fieldOffset, UInt32 elementCount, const DATATYPE* value)
         {
             const UInt32 fieldSizeInByte = sizeof(DATATYPE) * elementCount;
-            assert(fieldOffset + fieldSizeInByte <= m_data.size());
+            assert(fieldOffset + fieldSizeInByte <= m_size);
             void* dest = &m_data[fieldOffset];
             if (dest != value)
             {
@@ -56,9 +58,20 @@ namespace ramses_internal
             return m_dataLayoutHandle;
         }
 
+        Byte* getData() const
+        {
+            return m_data;
+        }
+
+        UInt32 getSize() const
+        {
+            return m_size;
+        }
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
-        std::vector<Byte> m_data;
+        Byte* m_data = nullptr;
+        UInt32 m_size = 0u;
     };
 
     ASSERT_MOVABLE(DataInstance)
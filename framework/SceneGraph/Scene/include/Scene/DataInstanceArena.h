@@ -0,0 +1,85 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DATAINSTANCEARENA_H
+#define RAMSES_DATAINSTANCEARENA_H
+
+#include "SceneAPI/Handles.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <vector>
+#include <memory>
+
+namespace ramses_internal
+{
+    /**
+     * Slab storage for data instance payloads.
+     * Payloads of instances sharing the same data layout are placed next to each other in chunks,
+     * so that iterating over instances of one layout touches contiguous memory and allocating an instance
+     * does not require a heap allocation of its own. First chunk of a layout is small, following chunks grow
+     * geometrically up to ChunkSizeInBytes, so layouts with few instances do not waste memory.
+     * Chunks are never moved or shrunk while they hold instances, therefore payload pointers stay valid
+     * for the whole lifetime of an instance, even if the layout handle is reused for a different layout meanwhile.
+     */
+    class DataInstanceArena
+    {
+    public:
+        DataInstanceArena() = default;
+        DataInstanceArena(const DataInstanceArena&) = delete;
+        DataInstanceArena& operator=(const DataInstanceArena&) = delete;
+        DataInstanceArena(DataInstanceArena&&) noexcept = default;
+        DataInstanceArena& operator=(DataInstanceArena&&) noexcept = default;
+
+        // returns zero initialized payload of given size, nullptr for empty payloads
+        Byte* allocate(DataLayoutHandle layout, UInt32 payloadSize);
+        void release(DataLayoutHandle layout, Byte* payload);
+        // frees all chunks of given layout, all its instances must have been released before
+        void releaseLayout(DataLayoutHandle layout);
+
+        // counts only instances allocated since layout handle was last used with different payload size
+        UInt32 getInstanceCount(DataLayoutHandle layout) const;
+        UInt32 getChunkCount(DataLayoutHandle layout) const;
+        UInt32 getSlotStride(DataLayoutHandle layout) const;
+
+        static constexpr UInt32 ChunkSizeInBytes = 16u * 1024u;
+        static constexpr UInt32 InitialSlotsPerChunk = 4u;
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<Byte[]> memory;
+            UInt32 slotCount = 0u;
+        };
+
+        struct LayoutSlabs
+        {
+            bool contains(const Byte* payload) const;
+
+            UInt32 payloadSize = 0u;
+            UInt32 slotStride = 0u;
+            UInt32 maxSlotsPerChunk = 0u;
+            UInt32 usedSlotsInLastChunk = 0u;
+            UInt32 instanceCount = 0u;
+            std::vector<Chunk> chunks;
+            std::vector<Byte*> freeSlots;
+        };
+
+        // slabs of instances still alive when their layout handle got reused for different payload size
+        struct RetiredSlabs
+        {
+            DataLayoutHandle layout;
+            LayoutSlabs slabs;
+        };
+
+        bool releaseRetired(DataLayoutHandle layout, Byte* payload);
+
+        std::vector<LayoutSlabs> m_layouts;
+        std::vector<RetiredSlabs> m_retiredSlabs;
+    };
+}
+
+#endif
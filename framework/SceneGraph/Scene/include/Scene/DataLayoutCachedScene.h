@@ -23,6 +23,8 @@ namespace ramses_internal
         virtual DataLayoutHandle            allocateDataLayout(const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle = DataLayoutHandle::Invalid()) override;
         virtual void                        releaseDataLayout(DataLayoutHandle handle) override;
 
+        virtual void                        restoreFromSnapshot(const SceneSnapshot& snapshot) override;
+
         UInt32                              getNumDataLayoutReferences(DataLayoutHandle handle) const;
 
     private:
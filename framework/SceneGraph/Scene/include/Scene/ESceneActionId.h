@@ -111,6 +111,7 @@ namespace ramses_internal
         SetRenderPassEnabled,
         SetRenderPassRenderOnce,
         RetriggerRenderPassRenderOnce,
+        SetRenderPassFrustumCulling,
         AddRenderGroupToRenderPass,
         RemoveRenderGroupFromRenderPass,
 
@@ -303,6 +304,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetRenderPassEnabled);
             CreateNameForEnumID(ESceneActionId::SetRenderPassRenderOnce);
             CreateNameForEnumID(ESceneActionId::RetriggerRenderPassRenderOnce);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassFrustumCulling);
             CreateNameForEnumID(ESceneActionId::AddRenderGroupToRenderPass);
             CreateNameForEnumID(ESceneActionId::RemoveRenderGroupFromRenderPass);
 
@@ -23,6 +23,8 @@ namespace ramses_internal
         bool                                haveResourcesChanged() const;
         void                                resetResourceChanges();
 
+        virtual void                        restoreFromSnapshot(const SceneSnapshot& snapshot) override;
+
         // functions which affect client resources
         virtual void                        releaseRenderable(RenderableHandle renderableHandle) override;
         virtual void                        setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
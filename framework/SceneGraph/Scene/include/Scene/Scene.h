@@ -31,12 +31,15 @@
 #include "Scene/TopologyTransform.h"
 #include "Scene/DataLayout.h"
 #include "Scene/DataInstance.h"
+#include "Scene/DataInstanceArena.h"
 
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
 
 namespace ramses_internal
 {
+    struct SceneSnapshot;
+
     template <template<typename, typename> class MEMORYPOOL>
     class SceneT;
 
@@ -72,6 +75,9 @@ namespace ramses_internal
         virtual ~SceneT() override;
 
         virtual void                        preallocateSceneSize            (const SceneSizeInformation& sizeInfo) override;
+        // Fills memory pools of object types stored in snapshot by copying the snapshot records directly,
+        // scene must not contain any objects of those types yet
+        virtual void                        restoreFromSnapshot             (const SceneSnapshot& snapshot);
 
         virtual SceneId                     getSceneId                      () const final override;
         virtual const String&               getName                         () const final override;
@@ -260,6 +266,7 @@ namespace ramses_internal
         virtual void                    setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         virtual void                    setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         virtual void                    retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        virtual void                    setRenderPassFrustumCulling     (RenderPassHandle passHandle, bool enable) override;
         virtual void                    addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order) override;
         virtual void                    removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         virtual const RenderPass&       getRenderPass                   (RenderPassHandle passHandle) const override final;
@@ -372,6 +379,7 @@ namespace ramses_internal
         TransformMemoryPool         m_transforms;
         DataLayoutMemoryPool        m_dataLayoutMemory;
         DataInstanceMemoryPool      m_dataInstanceMemory;
+        DataInstanceArena           m_dataInstanceArena;
         RenderGroupMemoryPool       m_renderGroups;
         RenderPassMemoryPool        m_renderPasses;
         BlitPassMemoryPool          m_blitPasses;
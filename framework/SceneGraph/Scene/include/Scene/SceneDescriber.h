@@ -25,6 +25,12 @@ namespace ramses_internal
         template <typename T>
         static void describeScene(const T& source, SceneActionCollectionCreator& collector);
 
+        // Describes only objects of types stored in a scene snapshot (see SceneSnapshot), respectively all others.
+        // Objects described by describeSnapshotObjects do not depend on objects described by describeNonSnapshotObjects
+        // being created before them.
+        static void describeSnapshotObjects(const IScene& source, SceneActionCollectionCreator& collector);
+        static void describeNonSnapshotObjects(const IScene& source, SceneActionCollectionCreator& collector);
+
     private:
         static void RecreateNodes(const IScene& source, SceneActionCollectionCreator& collector);
         static void RecreateCameras(const IScene& source, SceneActionCollectionCreator& collector);
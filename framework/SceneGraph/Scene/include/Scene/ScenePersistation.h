@@ -20,17 +20,27 @@ namespace ramses_internal
     class IInputStream;
     class AnimationSystemFactory;
     struct SceneCreationInformation;
+    class SceneActionCollection;
 
     class ScenePersistation
     {
     public:
         static void WriteSceneMetadataToStream(IOutputStream& outStream, const IScene& scene);
         static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene);
+        // Stores nodes, transforms, data layouts, data instances, renderables and render groups as memory snapshot
+        // (see SceneSnapshot) which is restored without replaying scene actions, all other objects as scene actions.
+        // Result is read by ReadSceneFromStream same as scene written by WriteSceneToStream.
+        static void WriteSceneSnapshotToStream(IOutputStream& outStream, const ClientScene& scene);
         static void WriteSceneToFile(const String& filename, const ClientScene& scene);
 
         static void ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo);
         static void ReadSceneFromStream(IInputStream& inStream, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
         static void ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory = nullptr);
+
+    private:
+        static void WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& collection);
+        static bool ReadSceneSnapshotFromStream(IInputStream& inStream, IScene& scene);
+        static void ResetRenderStatesMissingInScene(IScene& scene);
     };
 }
 
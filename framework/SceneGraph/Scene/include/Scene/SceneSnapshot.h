@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENESNAPSHOT_H
+#define RAMSES_SCENESNAPSHOT_H
+
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/Renderable.h"
+#include "SceneAPI/RenderGroup.h"
+#include "SceneAPI/DataFieldInfo.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Scene/TopologyTransform.h"
+#include "absl/types/span.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class ClientScene;
+
+    /**
+     * Content of the memory pools of nodes, transforms, data layouts, data instances, renderables and render groups
+     * stored as flat arrays of their in-memory records. A snapshot is restored into a scene by bulk copying
+     * the records into the pools (see SceneT::restoreFromSnapshot) instead of replaying a scene action per object.
+     *
+     * All arrays are views into the serialized data (e.g. a buffer read from file or a memory mapped file),
+     * which must outlive the snapshot. Records are stored in their in-memory representation, therefore
+     * a snapshot can only be parsed on a platform with the same record sizes.
+     * Objects of each type are stored in ascending order of their handles.
+     */
+    struct SceneSnapshot
+    {
+        static constexpr UInt32 FormatVersion = 1u;
+
+        static void Serialize(const ClientScene& scene, std::vector<Byte>& data);
+        // returns false if data is malformed, references objects not contained in it or was written
+        // on a platform with different record sizes, data must be aligned to 8 bytes
+        static bool Parse(absl::Span<const Byte> data, SceneSnapshot& snapshot);
+
+        absl::Span<const NodeHandle>            nodeHandles;
+        absl::Span<const NodeHandle>            nodeParents;
+        absl::Span<const UInt32>                nodeChildCounts;
+        absl::Span<const NodeHandle>            nodeChildren;
+
+        absl::Span<const TransformHandle>       transformHandles;
+        absl::Span<const TopologyTransform>     transforms;
+
+        absl::Span<const DataLayoutHandle>      dataLayoutHandles;
+        absl::Span<const UInt32>                dataLayoutUsageCounts;
+        absl::Span<const ResourceContentHash>   dataLayoutEffectHashes;
+        absl::Span<const UInt32>                dataLayoutFieldCounts;
+        absl::Span<const DataFieldInfo>         dataLayoutFields;
+
+        absl::Span<const DataInstanceHandle>    dataInstanceHandles;
+        absl::Span<const DataLayoutHandle>      dataInstanceLayouts;
+        absl::Span<const UInt32>                dataInstanceSizes;
+        absl::Span<const Byte>                  dataInstancePayloads;
+
+        absl::Span<const RenderableHandle>      renderableHandles;
+        absl::Span<const Renderable>            renderables;
+
+        absl::Span<const RenderGroupHandle>     renderGroupHandles;
+        absl::Span<const UInt32>                renderGroupRenderableCounts;
+        absl::Span<const RenderableOrderEntry>  renderGroupRenderables;
+        absl::Span<const UInt32>                renderGroupNestedGroupCounts;
+        absl::Span<const RenderGroupOrderEntry> renderGroupNestedGroups;
+    };
+}
+
+#endif
@@ -30,6 +30,7 @@ namespace ramses_internal
         explicit TransformationCachedSceneT(const SceneInfo& sceneInfo = SceneInfo());
 
         virtual void                    preallocateSceneSize(const SceneSizeInformation& sizeInfo) override;
+        virtual void                    restoreFromSnapshot(const SceneSnapshot& snapshot) override;
 
         // From IScene
         virtual NodeHandle              allocateNode(UInt32 childrenCount = 0u, NodeHandle node = NodeHandle::Invalid()) override;
@@ -56,6 +57,10 @@ namespace ramses_internal
         void                        computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const;
         void                        setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const Matrix44f& matrix) const;
 
+        // Same as updateMatrixCache but uses given buffer for collecting dirty nodes instead of the member one,
+        // can be called concurrently for nodes whose dirty ancestor chains do not overlap
+        Matrix44f                   updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node, NodeHandleVector& dirtyNodesBuffer) const;
+
         // A (local) member variable used by propagateDirty(...) and propagateDirtyToConsumers(...).,
         // in order to avoid creating a new Vector each time a method is called.
         mutable NodeHandleVector m_dirtyPropagationTraversalBuffer;
@@ -66,12 +71,15 @@ namespace ramses_internal
         void                        computeWorldMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const;
         void                        computeObjectMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
+        const TopologyTransform*    findTransformForNode(NodeHandle node) const;
 
         // Cache
         using MatrixCachePool = MEMORYPOOL<MatrixCacheEntry, NodeHandle>;
         mutable MatrixCachePool m_matrixCachePool;
 
-        HashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
+        // transform handle for each node indexed by node handle (invalid if node has no transform),
+        // dense array instead of hash map as it is looked up for every node during matrix update
+        std::vector<TransformHandle> m_nodeToTransform;
 
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
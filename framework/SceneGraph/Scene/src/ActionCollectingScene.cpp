@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneDescriber.h"
 
 namespace ramses_internal
 {
@@ -23,6 +24,13 @@ namespace ramses_internal
         m_creator.preallocateSceneSize(sizeInfo);
     }
 
+    void ActionCollectingScene::restoreFromSnapshot(const SceneSnapshot& snapshot)
+    {
+        ResourceChangeCollectingScene::restoreFromSnapshot(snapshot);
+        // restored objects are not created by individual calls, describe them as if they were
+        SceneDescriber::describeSnapshotObjects(*this, m_creator);
+    }
+
     void ActionCollectingScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, UInt32 instancingDivisor, UInt16 offsetWithinElementInBytes, UInt16 stride)
     {
         ResourceChangeCollectingScene::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
@@ -478,6 +486,12 @@ namespace ramses_internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassFrustumCulling(RenderPassHandle passHandle, bool enable)
+    {
+        ResourceChangeCollectingScene::setRenderPassFrustumCulling(passHandle, enable);
+        m_creator.setRenderPassFrustumCulling(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         ResourceChangeCollectingScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstanceArena.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+#include <cstddef>
+#include <cassert>
+
+namespace ramses_internal
+{
+    constexpr UInt32 DataInstanceArena::ChunkSizeInBytes;
+    constexpr UInt32 DataInstanceArena::InitialSlotsPerChunk;
+
+    Byte* DataInstanceArena::allocate(DataLayoutHandle layout, UInt32 payloadSize)
+    {
+        if (payloadSize == 0u)
+            return nullptr;
+
+        const UInt32 layoutIdx = layout.asMemoryHandle();
+        if (layoutIdx >= m_layouts.size())
+            m_layouts.resize(layoutIdx + 1u);
+
+        LayoutSlabs& slabs = m_layouts[layoutIdx];
+        if (slabs.payloadSize != payloadSize)
+        {
+            // first instance of layout, or layout handle was reused for a different layout
+            if (slabs.instanceCount != 0u)
+            {
+                // instances of previous layout still point into its chunks, keep them until released
+                m_retiredSlabs.push_back({ layout, std::move(slabs) });
+            }
+            constexpr UInt32 alignment = static_cast<UInt32>(alignof(std::max_align_t));
+            slabs = LayoutSlabs();
+            slabs.payloadSize = payloadSize;
+            slabs.slotStride = (payloadSize + alignment - 1u) / alignment * alignment;
+            slabs.maxSlotsPerChunk = std::max(1u, ChunkSizeInBytes / slabs.slotStride);
+        }
+
+        Byte* payload = nullptr;
+        if (!slabs.freeSlots.empty())
+        {
+            payload = slabs.freeSlots.back();
+            slabs.freeSlots.pop_back();
+        }
+        else
+        {
+            if (slabs.chunks.empty() || slabs.usedSlotsInLastChunk == slabs.chunks.back().slotCount)
+            {
+                const UInt32 slotCount = slabs.chunks.empty() ? InitialSlotsPerChunk : slabs.chunks.back().slotCount * 2u;
+                Chunk chunk;
+                chunk.slotCount = std::min(slotCount, slabs.maxSlotsPerChunk);
+                chunk.memory.reset(new Byte[chunk.slotCount * slabs.slotStride]);
+                slabs.chunks.push_back(std::move(chunk));
+                slabs.usedSlotsInLastChunk = 0u;
+            }
+            payload = slabs.chunks.back().memory.get() + slabs.usedSlotsInLastChunk * slabs.slotStride;
+            ++slabs.usedSlotsInLastChunk;
+        }
+
+        PlatformMemory::Set(payload, 0, payloadSize);
+        ++slabs.instanceCount;
+
+        return payload;
+    }
+
+    void DataInstanceArena::release(DataLayoutHandle layout, Byte* payload)
+    {
+        if (payload == nullptr)
+            return;
+
+        if (!m_retiredSlabs.empty() && releaseRetired(layout, payload))
+            return;
+
+        assert(layout.asMemoryHandle() < m_layouts.size());
+        LayoutSlabs& slabs = m_layouts[layout.asMemoryHandle()];
+        assert(slabs.contains(payload));
+        assert(slabs.instanceCount > 0u);
+        --slabs.instanceCount;
+
+        if (slabs.instanceCount == 0u)
+        {
+            // rewind instead of keeping a free list covering the whole slab, chunks are kept for reuse
+            slabs.freeSlots.clear();
+            slabs.chunks.resize(1u);
+            slabs.usedSlotsInLastChunk = 0u;
+        }
+        else
+        {
+            slabs.freeSlots.push_back(payload);
+        }
+    }
+
+    bool DataInstanceArena::releaseRetired(DataLayoutHandle layout, Byte* payload)
+    {
+        auto it = std::find_if(m_retiredSlabs.begin(), m_retiredSlabs.end(), [&](const RetiredSlabs& retired) {
+            return retired.layout == layout && retired.slabs.contains(payload);
+        });
+        if (it == m_retiredSlabs.end())
+            return false;
+
+        assert(it->slabs.instanceCount > 0u);
+        if (--it->slabs.instanceCount == 0u)
+            m_retiredSlabs.erase(it);
+        return true;
+    }
+
+    bool DataInstanceArena::LayoutSlabs::contains(const Byte* payload) const
+    {
+        return std::any_of(chunks.cbegin(), chunks.cend(), [&](const Chunk& chunk) {
+            return payload >= chunk.memory.get() && payload < chunk.memory.get() + chunk.slotCount * slotStride;
+        });
+    }
+
+    void DataInstanceArena::releaseLayout(DataLayoutHandle layout)
+    {
+        if (layout.asMemoryHandle() >= m_layouts.size())
+            return;
+
+        LayoutSlabs& slabs = m_layouts[layout.asMemoryHandle()];
+        // keep memory of instances still referencing the layout valid, they will be released later
+        if (slabs.instanceCount == 0u)
+            slabs = LayoutSlabs();
+    }
+
+    UInt32 DataInstanceArena::getInstanceCount(DataLayoutHandle layout) const
+    {
+        return layout.asMemoryHandle() < m_layouts.size() ? m_layouts[layout.asMemoryHandle()].instanceCount : 0u;
+    }
+
+    UInt32 DataInstanceArena::getChunkCount(DataLayoutHandle layout) const
+    {
+        return layout.asMemoryHandle() < m_layouts.size() ? static_cast<UInt32>(m_layouts[layout.asMemoryHandle()].chunks.size()) : 0u;
+    }
+
+    UInt32 DataInstanceArena::getSlotStride(DataLayoutHandle layout) const
+    {
+        return layout.asMemoryHandle() < m_layouts.size() ? m_layouts[layout.asMemoryHandle()].slotStride : 0u;
+    }
+}
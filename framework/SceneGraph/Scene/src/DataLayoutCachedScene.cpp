@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/DataLayoutCachedScene.h"
+#include "Scene/SceneSnapshot.h"
 
 namespace ramses_internal
 {
@@ -48,6 +49,29 @@ namespace ramses_internal
         }
     }
 
+    void DataLayoutCachedScene::restoreFromSnapshot(const SceneSnapshot& snapshot)
+    {
+        ActionCollectingScene::restoreFromSnapshot(snapshot);
+
+        for (size_t i = 0u; i < snapshot.dataLayoutHandles.size(); ++i)
+        {
+            const DataLayoutHandle handle = snapshot.dataLayoutHandles[i];
+            const DataLayout& layout = ActionCollectingScene::getDataLayout(handle);
+
+            const UInt fieldCount = layout.getFieldCount();
+            if (m_dataLayoutCache.size() <= fieldCount)
+            {
+                m_dataLayoutCache.resize(fieldCount + 1u);
+            }
+
+            DataLayoutCacheEntry entry;
+            entry.m_dataFields = layout.getDataFields();
+            entry.m_usageCount = snapshot.dataLayoutUsageCounts[i];
+            entry.m_effectHash = layout.getEffectHash();
+            m_dataLayoutCache[fieldCount].put(handle, entry);
+        }
+    }
+
     DataLayoutHandle DataLayoutCachedScene::allocateAndCacheDataLayout(const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle)
     {
         const DataLayoutHandle actualHandle = ActionCollectingScene::allocateDataLayout(dataFields, effectHash, handle);
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/ResourceChangeCollectingScene.h"
+#include "Scene/SceneSnapshot.h"
 #include "Utils/MemoryPoolExplicit.h"
 
 namespace ramses_internal
@@ -32,6 +33,13 @@ namespace ramses_internal
         m_resourcesChanged = false;
     }
 
+    void ResourceChangeCollectingScene::restoreFromSnapshot(const SceneSnapshot& snapshot)
+    {
+        TransformationCachedScene::restoreFromSnapshot(snapshot);
+        if (!snapshot.renderableHandles.empty() || !snapshot.dataInstanceHandles.empty())
+            m_resourcesChanged = true;
+    }
+
 
     void ResourceChangeCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
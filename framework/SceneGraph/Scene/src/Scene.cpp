@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/Scene.h"
+#include "Scene/SceneSnapshot.h"
 
 #include "Math3d/Vector2.h"
 #include "Math3d/Vector3.h"
@@ -129,6 +130,12 @@ namespace ramses_internal
         // implemented on renderer side only in a derived scene
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassFrustumCulling(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isFrustumCullingEnabled = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
@@ -966,9 +973,9 @@ namespace ramses_internal
         const DataLayout& layout = *m_dataLayoutMemory.getMemory(layoutHandle);
         const DataInstanceHandle containerHandle = m_dataInstanceMemory.allocate(instanceHandle);
 
-        UInt32 dataInstanceSize = layout.getTotalSize();
+        const UInt32 dataInstanceSize = layout.getTotalSize();
         DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
-        *instance = DataInstance(layoutHandle, dataInstanceSize);
+        *instance = DataInstance(layoutHandle, m_dataInstanceArena.allocate(layoutHandle, dataInstanceSize), dataInstanceSize);
 
         // initialize data instance fields
         // TODO violin this can be generalized further, e.g. via templated static inplace contructor
@@ -1015,7 +1022,9 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataInstance(DataInstanceHandle containerHandle)
     {
-        assert(isDataLayoutAllocated(m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle()));
+        const DataInstance& instance = *m_dataInstanceMemory.getMemory(containerHandle);
+        assert(isDataLayoutAllocated(instance.getLayoutHandle()));
+        m_dataInstanceArena.release(instance.getLayoutHandle(), instance.getData());
         m_dataInstanceMemory.release(containerHandle);
     }
 
@@ -1023,6 +1032,7 @@ namespace ramses_internal
     void SceneT<MEMORYPOOL>::releaseDataLayout(DataLayoutHandle layoutHandle)
     {
         m_dataLayoutMemory.release(layoutHandle);
+        m_dataInstanceArena.releaseLayout(layoutHandle);
     }
 
 
@@ -1114,6 +1124,72 @@ namespace ramses_internal
         m_sceneReferences.preallocateSize(sizeInfo.sceneReferenceCount);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::restoreFromSnapshot(const SceneSnapshot& snapshot)
+    {
+        // handles in snapshot are ascending, pools are grown once to fit the last one
+        const auto preallocate = [](auto& pool, const auto& handles)
+        {
+            if (!handles.empty())
+                pool.preallocateSize(handles.back().asMemoryHandle() + 1u);
+        };
+        preallocate(m_nodes, snapshot.nodeHandles);
+        preallocate(m_transforms, snapshot.transformHandles);
+        preallocate(m_dataLayoutMemory, snapshot.dataLayoutHandles);
+        preallocate(m_dataInstanceMemory, snapshot.dataInstanceHandles);
+        preallocate(m_renderables, snapshot.renderableHandles);
+        preallocate(m_renderGroups, snapshot.renderGroupHandles);
+
+        const NodeHandle* children = snapshot.nodeChildren.data();
+        for (size_t i = 0u; i < snapshot.nodeHandles.size(); ++i)
+        {
+            TopologyNode& node = *m_nodes.getMemory(m_nodes.allocate(snapshot.nodeHandles[i]));
+            node.parent = snapshot.nodeParents[i];
+            node.children.assign(children, children + snapshot.nodeChildCounts[i]);
+            children += snapshot.nodeChildCounts[i];
+        }
+
+        for (size_t i = 0u; i < snapshot.transformHandles.size(); ++i)
+            *m_transforms.getMemory(m_transforms.allocate(snapshot.transformHandles[i])) = snapshot.transforms[i];
+
+        const DataFieldInfo* fields = snapshot.dataLayoutFields.data();
+        for (size_t i = 0u; i < snapshot.dataLayoutHandles.size(); ++i)
+        {
+            DataLayout& layout = *m_dataLayoutMemory.getMemory(m_dataLayoutMemory.allocate(snapshot.dataLayoutHandles[i]));
+            layout.setDataFields(DataFieldInfoVector(fields, fields + snapshot.dataLayoutFieldCounts[i]));
+            layout.setEffectHash(snapshot.dataLayoutEffectHashes[i]);
+            fields += snapshot.dataLayoutFieldCounts[i];
+        }
+
+        const Byte* payload = snapshot.dataInstancePayloads.data();
+        for (size_t i = 0u; i < snapshot.dataInstanceHandles.size(); ++i)
+        {
+            const DataLayoutHandle layoutHandle = snapshot.dataInstanceLayouts[i];
+            const UInt32 size = snapshot.dataInstanceSizes[i];
+            assert(m_dataLayoutMemory.getMemory(layoutHandle)->getTotalSize() == size);
+
+            Byte* data = m_dataInstanceArena.allocate(layoutHandle, size);
+            if (size > 0u)
+                PlatformMemory::Copy(data, payload, size);
+            *m_dataInstanceMemory.getMemory(m_dataInstanceMemory.allocate(snapshot.dataInstanceHandles[i])) = DataInstance(layoutHandle, data, size);
+            payload += size;
+        }
+
+        for (size_t i = 0u; i < snapshot.renderableHandles.size(); ++i)
+            *m_renderables.getMemory(m_renderables.allocate(snapshot.renderableHandles[i])) = snapshot.renderables[i];
+
+        const RenderableOrderEntry* groupRenderables = snapshot.renderGroupRenderables.data();
+        const RenderGroupOrderEntry* nestedGroups = snapshot.renderGroupNestedGroups.data();
+        for (size_t i = 0u; i < snapshot.renderGroupHandles.size(); ++i)
+        {
+            RenderGroup& group = *m_renderGroups.getMemory(m_renderGroups.allocate(snapshot.renderGroupHandles[i]));
+            group.renderables.assign(groupRenderables, groupRenderables + snapshot.renderGroupRenderableCounts[i]);
+            group.renderGroups.assign(nestedGroups, nestedGroups + snapshot.renderGroupNestedGroupCounts[i]);
+            groupRenderables += snapshot.renderGroupRenderableCounts[i];
+            nestedGroups += snapshot.renderGroupNestedGroupCounts[i];
+        }
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     TransformHandle SceneT<MEMORYPOOL>::allocateTransform(NodeHandle nodeHandle, TransformHandle handle)
     {
@@ -534,6 +534,13 @@ namespace ramses_internal
         collection.write(pass);
     }
 
+    void SceneActionCollectionCreator::setRenderPassFrustumCulling(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassFrustumCulling);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         collection.beginWriteSceneAction(ESceneActionId::AddRenderGroupToRenderPass);
@@ -55,6 +55,34 @@ namespace ramses_internal
         RecreateSceneReferences(         source, collector);
     }
 
+    void SceneDescriber::describeSnapshotObjects(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        RecreateNodes(                   source, collector);
+        RecreateTransformNodes(          source, collector);
+        RecreateTransformations(         source, collector);
+        RecreateRenderables(             source, collector);
+        RecreateDataLayouts(             source, collector);
+        RecreateDataInstances(           source, collector);
+        RecreateRenderGroups(            source, collector);
+    }
+
+    void SceneDescriber::describeNonSnapshotObjects(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        RecreateStates(                  source, collector);
+        RecreateCameras(                 source, collector);
+        RecreateAnimationSystems(        source, collector);
+        RecreateRenderPasses(            source, collector);
+        RecreateBlitPasses(              source, collector);
+        RecreatePickableObjects(         source, collector);
+        RecreateDataBuffers(             source, collector);
+        RecreateTextureBuffers(          source, collector);
+        RecreateTextureSamplers(         source, collector);
+        RecreateRenderBuffersAndTargets( source, collector);
+        RecreateStreamTextures(          source, collector);
+        RecreateDataSlots(               source, collector);
+        RecreateSceneReferences(         source, collector);
+    }
+
     void SceneDescriber::RecreateNodes(const IScene& source, SceneActionCollectionCreator& collector)
     {
         const UInt32 totalNodeCount = source.getNodeCount();
@@ -397,6 +425,8 @@ namespace ramses_internal
                 collector.setRenderPassEnabled(renderPass, rp.isEnabled);
                 if (rp.isRenderOnce)
                     collector.setRenderPassRenderOnce(renderPass, true);
+                if (rp.isFrustumCullingEnabled)
+                    collector.setRenderPassFrustumCulling(renderPass, true);
                 for (const auto& rgEntry : rp.renderGroups)
                     collector.addRenderGroupToRenderPass(renderPass, rgEntry.renderGroup, rgEntry.order);
             }
@@ -11,6 +11,7 @@
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneDescriber.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneSnapshot.h"
 #include "Utils/File.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
@@ -22,6 +23,7 @@
 namespace ramses_internal
 {
     static const UInt32 gSceneMarker = 0x534d4152;  // {'R', 'A', 'M', 'S'}
+    static const UInt32 gSceneSnapshotMarker = 0x50414e53;  // {'S', 'N', 'A', 'P'}
 
     void ScenePersistation::ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo)
     {
@@ -81,6 +83,29 @@ namespace ramses_internal
         creator.preallocateSceneSize(scene.getSceneSizeInformation());
         SceneDescriber::describeScene<ClientScene>(scene, creator);
 
+        WriteSceneActionsToStream(outStream, collection);
+    }
+
+    void ScenePersistation::WriteSceneSnapshotToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        std::vector<Byte> snapshotData;
+        SceneSnapshot::Serialize(scene, snapshotData);
+
+        outStream << static_cast<UInt32>(gSceneSnapshotMarker);
+        outStream << static_cast<UInt32>(SceneSnapshot::FormatVersion);
+        outStream << static_cast<UInt32>(snapshotData.size());
+        outStream.write(snapshotData.data(), snapshotData.size());
+
+        // objects not stored in snapshot follow in scene action format
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator(collection);
+        SceneDescriber::describeNonSnapshotObjects(scene, creator);
+
+        WriteSceneActionsToStream(outStream, collection);
+    }
+
+    void ScenePersistation::WriteSceneActionsToStream(IOutputStream& outStream, const SceneActionCollection& collection)
+    {
         const std::vector<Byte>& actionData = collection.collectionData();
 
         outStream << static_cast<UInt32>(gSceneMarker);
@@ -117,6 +142,14 @@ namespace ramses_internal
     {
         UInt32 sceneMarker = 0;
         inStream >> sceneMarker;
+        const bool hasSnapshot = (sceneMarker == gSceneSnapshotMarker);
+        if (hasSnapshot)
+        {
+            if (!ReadSceneSnapshotFromStream(inStream, scene))
+                return;
+            inStream >> sceneMarker;
+        }
+
         if (sceneMarker != gSceneMarker)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
@@ -160,6 +193,60 @@ namespace ramses_internal
                 }));
 
         SceneActionApplier::ApplyActionsOnScene(scene, actions, animSystemFactory);
+
+        if (hasSnapshot)
+            ResetRenderStatesMissingInScene(scene);
+    }
+
+    void ScenePersistation::ResetRenderStatesMissingInScene(IScene& scene)
+    {
+        // render states are loaded from scene actions after the snapshot, renderables restored from a corrupted
+        // snapshot must not keep pointing to a render state that does not exist
+        for (RenderableHandle r(0u); r < scene.getRenderableCount(); ++r)
+        {
+            if (!scene.isRenderableAllocated(r))
+                continue;
+            const RenderStateHandle renderState = scene.getRenderable(r).renderState;
+            if (renderState.isValid() && !scene.isRenderStateAllocated(renderState))
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream: renderable {} references render state {} which is not in scene, scene snapshot is corrupted", r, renderState);
+                scene.setRenderableRenderState(r, RenderStateHandle::Invalid());
+            }
+        }
+    }
+
+    bool ScenePersistation::ReadSceneSnapshotFromStream(IInputStream& inStream, IScene& scene)
+    {
+        UInt32 formatVersion = 0;
+        inStream >> formatVersion;
+        UInt32 snapshotSize = 0;
+        inStream >> snapshotSize;
+        if (inStream.getState() != EStatus::Ok || formatVersion != SceneSnapshot::FormatVersion)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneSnapshotFromStream: unsupported scene snapshot format version {}, expected {}", formatVersion, SceneSnapshot::FormatVersion);
+            return false;
+        }
+
+        // records are accessed in place, vector storage satisfies their alignment
+        std::vector<Byte> snapshotData(snapshotSize);
+        inStream.read(snapshotData.data(), snapshotData.size());
+
+        SceneSnapshot snapshot;
+        if (inStream.getState() != EStatus::Ok || !SceneSnapshot::Parse(absl::MakeConstSpan(snapshotData), snapshot))
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneSnapshotFromStream: scene snapshot is corrupted or was stored on incompatible platform");
+            return false;
+        }
+
+        auto pooledScene = dynamic_cast<Scene*>(&scene);
+        if (!pooledScene)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneSnapshotFromStream: scene snapshot can only be restored into a scene with pooled memory");
+            return false;
+        }
+
+        pooledScene->restoreFromSnapshot(snapshot);
+        return true;
     }
 
     void ScenePersistation::ReadSceneFromFile(const String& filename, IScene& scene, AnimationSystemFactory* animSystemFactory)
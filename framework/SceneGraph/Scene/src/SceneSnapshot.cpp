@@ -0,0 +1,499 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneSnapshot.h"
+#include "Scene/ClientScene.h"
+#include "Scene/DataLayout.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <type_traits>
+#include <algorithm>
+#include <numeric>
+#include <array>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // Serialized data starts with a table of arrays, followed by the arrays themselves.
+        // Every array starts at an offset aligned to ArrayAlignment, so that it can be accessed in place.
+        enum class ESnapshotArray : UInt32
+        {
+            NodeHandles = 0,
+            NodeParents,
+            NodeChildCounts,
+            NodeChildren,
+            TransformHandles,
+            Transforms,
+            DataLayoutHandles,
+            DataLayoutUsageCounts,
+            DataLayoutEffectHashes,
+            DataLayoutFieldCounts,
+            DataLayoutFields,
+            DataInstanceHandles,
+            DataInstanceLayouts,
+            DataInstanceSizes,
+            DataInstancePayloads,
+            RenderableHandles,
+            Renderables,
+            RenderGroupHandles,
+            RenderGroupRenderableCounts,
+            RenderGroupRenderables,
+            RenderGroupNestedGroupCounts,
+            RenderGroupNestedGroups,
+
+            COUNT
+        };
+
+        struct ArrayEntry
+        {
+            UInt32 offset;
+            UInt32 count;
+            UInt32 elementSize;
+        };
+
+        constexpr UInt32 ArrayCount = static_cast<UInt32>(ESnapshotArray::COUNT);
+        constexpr size_t ArrayAlignment = 8u;
+        constexpr size_t TableSize = sizeof(UInt32) + ArrayCount * sizeof(ArrayEntry);
+
+        size_t Align(size_t offset)
+        {
+            return (offset + ArrayAlignment - 1u) / ArrayAlignment * ArrayAlignment;
+        }
+
+        class SnapshotWriter
+        {
+        public:
+            explicit SnapshotWriter(std::vector<Byte>& data)
+                : m_data(data)
+            {
+                m_data.assign(Align(TableSize), 0u);
+                PlatformMemory::Copy(m_data.data(), &ArrayCount, sizeof(ArrayCount));
+            }
+
+            template <typename T>
+            void addArray(ESnapshotArray id, const std::vector<T>& values)
+            {
+                static_assert(std::is_trivially_copyable<T>::value, "snapshot records must be trivially copyable");
+                static_assert(alignof(T) <= ArrayAlignment, "snapshot records must not require bigger alignment");
+
+                const size_t offset = Align(m_data.size());
+                const size_t sizeInBytes = values.size() * sizeof(T);
+                m_data.resize(offset + sizeInBytes, 0u);
+                if (sizeInBytes > 0u)
+                    PlatformMemory::Copy(m_data.data() + offset, values.data(), sizeInBytes);
+
+                const ArrayEntry entry{ static_cast<UInt32>(offset), static_cast<UInt32>(values.size()), static_cast<UInt32>(sizeof(T)) };
+                PlatformMemory::Copy(m_data.data() + sizeof(UInt32) + static_cast<UInt32>(id) * sizeof(ArrayEntry), &entry, sizeof(entry));
+            }
+
+        private:
+            std::vector<Byte>& m_data;
+        };
+
+        class SnapshotReader
+        {
+        public:
+            explicit SnapshotReader(absl::Span<const Byte> data)
+                : m_data(data)
+            {
+            }
+
+            bool readTable()
+            {
+                if (m_data.size() < TableSize || reinterpret_cast<uintptr_t>(m_data.data()) % ArrayAlignment != 0u)
+                    return false;
+
+                UInt32 arrayCount = 0u;
+                PlatformMemory::Copy(&arrayCount, m_data.data(), sizeof(arrayCount));
+                if (arrayCount != ArrayCount)
+                    return false;
+
+                PlatformMemory::Copy(m_table.data(), m_data.data() + sizeof(UInt32), sizeof(m_table));
+                return true;
+            }
+
+            template <typename T>
+            bool getArray(ESnapshotArray id, absl::Span<const T>& values) const
+            {
+                const ArrayEntry& entry = m_table[static_cast<UInt32>(id)];
+                if (entry.elementSize != sizeof(T) || entry.offset % alignof(T) != 0u)
+                    return false;
+                if (static_cast<UInt64>(entry.offset) + static_cast<UInt64>(entry.count) * entry.elementSize > m_data.size())
+                    return false;
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) records were written from objects of same type and size
+                values = absl::Span<const T>(reinterpret_cast<const T*>(m_data.data() + entry.offset), entry.count);
+                return true;
+            }
+
+        private:
+            absl::Span<const Byte> m_data;
+            std::array<ArrayEntry, ArrayCount> m_table;
+        };
+
+        bool CountsMatchTotal(absl::Span<const UInt32> counts, size_t total)
+        {
+            return std::accumulate(counts.cbegin(), counts.cend(), UInt64(0u)) == total;
+        }
+
+        template <typename HANDLE>
+        bool AreHandlesAscending(absl::Span<const HANDLE> handles)
+        {
+            return std::adjacent_find(handles.cbegin(), handles.cend(), [](HANDLE a, HANDLE b) { return a.asMemoryHandle() >= b.asMemoryHandle(); }) == handles.cend();
+        }
+
+        // handles are ascending (checked before), returns handles.size() if handle is not in snapshot
+        template <typename HANDLE>
+        size_t FindHandleIndex(absl::Span<const HANDLE> handles, HANDLE handle)
+        {
+            // pools without released objects store handles 0..n-1, found without search then
+            const size_t denseIndex = handle.asMemoryHandle();
+            if (denseIndex < handles.size() && handles[denseIndex] == handle)
+                return denseIndex;
+
+            const auto it = std::lower_bound(handles.cbegin(), handles.cend(), handle, [](HANDLE a, HANDLE b) { return a.asMemoryHandle() < b.asMemoryHandle(); });
+            if (it == handles.cend() || *it != handle)
+                return handles.size();
+            return static_cast<size_t>(std::distance(handles.cbegin(), it));
+        }
+
+        template <typename HANDLE>
+        bool IsHandleInSnapshot(absl::Span<const HANDLE> handles, HANDLE handle)
+        {
+            return FindHandleIndex(handles, handle) != handles.size();
+        }
+
+        template <typename HANDLE>
+        bool IsInvalidOrInSnapshot(absl::Span<const HANDLE> handles, HANDLE handle)
+        {
+            return !handle.isValid() || IsHandleInSnapshot(handles, handle);
+        }
+
+        // every parent and child is a node in snapshot, links are consistent in both directions
+        // and the topology has no cycles, i.e. every node is reachable from a root node
+        bool NodeTopologyValid(const SceneSnapshot& snapshot)
+        {
+            const size_t nodeCount = snapshot.nodeHandles.size();
+            std::vector<size_t> firstChild(nodeCount + 1u, 0u);
+            for (size_t i = 0u; i < nodeCount; ++i)
+                firstChild[i + 1u] = firstChild[i] + snapshot.nodeChildCounts[i];
+
+            size_t nodesWithParent = 0u;
+            std::vector<size_t> pending;
+            for (size_t i = 0u; i < nodeCount; ++i)
+            {
+                const NodeHandle parent = snapshot.nodeParents[i];
+                if (!IsInvalidOrInSnapshot(snapshot.nodeHandles, parent))
+                    return false;
+                if (parent.isValid())
+                    ++nodesWithParent;
+                else
+                    pending.push_back(i);
+
+                for (size_t c = firstChild[i]; c < firstChild[i + 1u]; ++c)
+                {
+                    const size_t childIndex = FindHandleIndex(snapshot.nodeHandles, snapshot.nodeChildren[c]);
+                    if (childIndex == nodeCount || snapshot.nodeParents[childIndex] != snapshot.nodeHandles[i])
+                        return false;
+                }
+            }
+            // with matching parent of every child this rules out children listed twice
+            if (nodesWithParent != snapshot.nodeChildren.size())
+                return false;
+
+            size_t reachedNodes = 0u;
+            while (!pending.empty())
+            {
+                const size_t nodeIndex = pending.back();
+                pending.pop_back();
+                ++reachedNodes;
+                for (size_t c = firstChild[nodeIndex]; c < firstChild[nodeIndex + 1u]; ++c)
+                    pending.push_back(FindHandleIndex(snapshot.nodeHandles, snapshot.nodeChildren[c]));
+            }
+            return reachedNodes == nodeCount;
+        }
+
+        // render states are not part of snapshot, they are checked once the remaining scene objects are loaded
+        bool ObjectReferencesValid(const SceneSnapshot& snapshot)
+        {
+            for (const auto& transform : snapshot.transforms)
+            {
+                if (!IsHandleInSnapshot(snapshot.nodeHandles, transform.node))
+                    return false;
+            }
+
+            for (const auto& renderable : snapshot.renderables)
+            {
+                if (!IsHandleInSnapshot(snapshot.nodeHandles, renderable.node))
+                    return false;
+                for (const DataInstanceHandle instance : renderable.dataInstances)
+                {
+                    if (!IsInvalidOrInSnapshot(snapshot.dataInstanceHandles, instance))
+                        return false;
+                }
+            }
+
+            for (const auto& entry : snapshot.renderGroupRenderables)
+            {
+                if (!IsHandleInSnapshot(snapshot.renderableHandles, entry.renderable))
+                    return false;
+            }
+
+            for (const auto& entry : snapshot.renderGroupNestedGroups)
+            {
+                if (!IsHandleInSnapshot(snapshot.renderGroupHandles, entry.renderGroup))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool DataInstanceSizesMatchLayouts(const SceneSnapshot& snapshot)
+        {
+            std::vector<UInt32> layoutSizes;
+            layoutSizes.reserve(snapshot.dataLayoutHandles.size());
+            const DataFieldInfo* fields = snapshot.dataLayoutFields.data();
+            for (const UInt32 fieldCount : snapshot.dataLayoutFieldCounts)
+            {
+                DataLayout layout;
+                layout.setDataFields(DataFieldInfoVector(fields, fields + fieldCount));
+                layoutSizes.push_back(layout.getTotalSize());
+                fields += fieldCount;
+            }
+
+            for (size_t i = 0u; i < snapshot.dataInstanceHandles.size(); ++i)
+            {
+                const size_t layoutIndex = FindHandleIndex(snapshot.dataLayoutHandles, snapshot.dataInstanceLayouts[i]);
+                if (layoutIndex == layoutSizes.size() || layoutSizes[layoutIndex] != snapshot.dataInstanceSizes[i])
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    void SceneSnapshot::Serialize(const ClientScene& scene, std::vector<Byte>& data)
+    {
+        SnapshotWriter writer(data);
+
+        {
+            std::vector<NodeHandle> handles;
+            std::vector<NodeHandle> parents;
+            std::vector<UInt32> childCounts;
+            std::vector<NodeHandle> children;
+            handles.reserve(scene.getNodeCount());
+            parents.reserve(scene.getNodeCount());
+            childCounts.reserve(scene.getNodeCount());
+            children.reserve(scene.getNodeCount());
+            for (NodeHandle n(0u); n < scene.getNodeCount(); ++n)
+            {
+                if (scene.isNodeAllocated(n))
+                {
+                    handles.push_back(n);
+                    parents.push_back(scene.getParent(n));
+                    const UInt32 childCount = scene.getChildCount(n);
+                    childCounts.push_back(childCount);
+                    for (UInt32 c = 0u; c < childCount; ++c)
+                        children.push_back(scene.getChild(n, c));
+                }
+            }
+            writer.addArray(ESnapshotArray::NodeHandles, handles);
+            writer.addArray(ESnapshotArray::NodeParents, parents);
+            writer.addArray(ESnapshotArray::NodeChildCounts, childCounts);
+            writer.addArray(ESnapshotArray::NodeChildren, children);
+        }
+
+        {
+            std::vector<TransformHandle> handles;
+            std::vector<TopologyTransform> transforms;
+            handles.reserve(scene.getTransformCount());
+            transforms.reserve(scene.getTransformCount());
+            for (TransformHandle t(0u); t < scene.getTransformCount(); ++t)
+            {
+                if (scene.isTransformAllocated(t))
+                {
+                    handles.push_back(t);
+                    TopologyTransform transform;
+                    transform.translation = scene.getTranslation(t);
+                    transform.rotation = scene.getRotation(t);
+                    transform.scaling = scene.getScaling(t);
+                    transform.rotationConvention = scene.getRotationConvention(t);
+                    transform.node = scene.getTransformNode(t);
+                    transforms.push_back(transform);
+                }
+            }
+            writer.addArray(ESnapshotArray::TransformHandles, handles);
+            writer.addArray(ESnapshotArray::Transforms, transforms);
+        }
+
+        {
+            std::vector<DataLayoutHandle> handles;
+            std::vector<UInt32> usageCounts;
+            std::vector<ResourceContentHash> effectHashes;
+            std::vector<UInt32> fieldCounts;
+            std::vector<DataFieldInfo> fields;
+            for (DataLayoutHandle l(0u); l < scene.getDataLayoutCount(); ++l)
+            {
+                if (scene.isDataLayoutAllocated(l))
+                {
+                    const DataLayout& layout = scene.getDataLayout(l);
+                    handles.push_back(l);
+                    usageCounts.push_back(scene.getNumDataLayoutReferences(l));
+                    effectHashes.push_back(layout.getEffectHash());
+                    fieldCounts.push_back(layout.getFieldCount());
+                    fields.insert(fields.end(), layout.getDataFields().cbegin(), layout.getDataFields().cend());
+                }
+            }
+            writer.addArray(ESnapshotArray::DataLayoutHandles, handles);
+            writer.addArray(ESnapshotArray::DataLayoutUsageCounts, usageCounts);
+            writer.addArray(ESnapshotArray::DataLayoutEffectHashes, effectHashes);
+            writer.addArray(ESnapshotArray::DataLayoutFieldCounts, fieldCounts);
+            writer.addArray(ESnapshotArray::DataLayoutFields, fields);
+        }
+
+        {
+            std::vector<DataInstanceHandle> handles;
+            std::vector<DataLayoutHandle> layouts;
+            std::vector<UInt32> sizes;
+            std::vector<Byte> payloads;
+            handles.reserve(scene.getDataInstanceCount());
+            layouts.reserve(scene.getDataInstanceCount());
+            sizes.reserve(scene.getDataInstanceCount());
+            for (DataInstanceHandle i(0u); i < scene.getDataInstanceCount(); ++i)
+            {
+                if (scene.isDataInstanceAllocated(i))
+                {
+                    const DataInstance& instance = *scene.getDataInstances().getMemory(i);
+                    handles.push_back(i);
+                    layouts.push_back(instance.getLayoutHandle());
+                    sizes.push_back(instance.getSize());
+                    payloads.insert(payloads.end(), instance.getData(), instance.getData() + instance.getSize());
+                }
+            }
+            writer.addArray(ESnapshotArray::DataInstanceHandles, handles);
+            writer.addArray(ESnapshotArray::DataInstanceLayouts, layouts);
+            writer.addArray(ESnapshotArray::DataInstanceSizes, sizes);
+            writer.addArray(ESnapshotArray::DataInstancePayloads, payloads);
+        }
+
+        {
+            std::vector<RenderableHandle> handles;
+            std::vector<Renderable> renderables;
+            handles.reserve(scene.getRenderableCount());
+            renderables.reserve(scene.getRenderableCount());
+            for (RenderableHandle r(0u); r < scene.getRenderableCount(); ++r)
+            {
+                if (scene.isRenderableAllocated(r))
+                {
+                    handles.push_back(r);
+                    renderables.push_back(scene.getRenderable(r));
+                }
+            }
+            writer.addArray(ESnapshotArray::RenderableHandles, handles);
+            writer.addArray(ESnapshotArray::Renderables, renderables);
+        }
+
+        {
+            std::vector<RenderGroupHandle> handles;
+            std::vector<UInt32> renderableCounts;
+            std::vector<RenderableOrderEntry> renderables;
+            std::vector<UInt32> nestedGroupCounts;
+            std::vector<RenderGroupOrderEntry> nestedGroups;
+            for (RenderGroupHandle g(0u); g < scene.getRenderGroupCount(); ++g)
+            {
+                if (scene.isRenderGroupAllocated(g))
+                {
+                    const RenderGroup& group = scene.getRenderGroup(g);
+                    handles.push_back(g);
+                    renderableCounts.push_back(static_cast<UInt32>(group.renderables.size()));
+                    renderables.insert(renderables.end(), group.renderables.cbegin(), group.renderables.cend());
+                    nestedGroupCounts.push_back(static_cast<UInt32>(group.renderGroups.size()));
+                    nestedGroups.insert(nestedGroups.end(), group.renderGroups.cbegin(), group.renderGroups.cend());
+                }
+            }
+            writer.addArray(ESnapshotArray::RenderGroupHandles, handles);
+            writer.addArray(ESnapshotArray::RenderGroupRenderableCounts, renderableCounts);
+            writer.addArray(ESnapshotArray::RenderGroupRenderables, renderables);
+            writer.addArray(ESnapshotArray::RenderGroupNestedGroupCounts, nestedGroupCounts);
+            writer.addArray(ESnapshotArray::RenderGroupNestedGroups, nestedGroups);
+        }
+    }
+
+    bool SceneSnapshot::Parse(absl::Span<const Byte> data, SceneSnapshot& snapshot)
+    {
+        SnapshotReader reader(data);
+        if (!reader.readTable())
+            return false;
+
+        const bool allArraysValid =
+            reader.getArray(ESnapshotArray::NodeHandles, snapshot.nodeHandles) &&
+            reader.getArray(ESnapshotArray::NodeParents, snapshot.nodeParents) &&
+            reader.getArray(ESnapshotArray::NodeChildCounts, snapshot.nodeChildCounts) &&
+            reader.getArray(ESnapshotArray::NodeChildren, snapshot.nodeChildren) &&
+            reader.getArray(ESnapshotArray::TransformHandles, snapshot.transformHandles) &&
+            reader.getArray(ESnapshotArray::Transforms, snapshot.transforms) &&
+            reader.getArray(ESnapshotArray::DataLayoutHandles, snapshot.dataLayoutHandles) &&
+            reader.getArray(ESnapshotArray::DataLayoutUsageCounts, snapshot.dataLayoutUsageCounts) &&
+            reader.getArray(ESnapshotArray::DataLayoutEffectHashes, snapshot.dataLayoutEffectHashes) &&
+            reader.getArray(ESnapshotArray::DataLayoutFieldCounts, snapshot.dataLayoutFieldCounts) &&
+            reader.getArray(ESnapshotArray::DataLayoutFields, snapshot.dataLayoutFields) &&
+            reader.getArray(ESnapshotArray::DataInstanceHandles, snapshot.dataInstanceHandles) &&
+            reader.getArray(ESnapshotArray::DataInstanceLayouts, snapshot.dataInstanceLayouts) &&
+            reader.getArray(ESnapshotArray::DataInstanceSizes, snapshot.dataInstanceSizes) &&
+            reader.getArray(ESnapshotArray::DataInstancePayloads, snapshot.dataInstancePayloads) &&
+            reader.getArray(ESnapshotArray::RenderableHandles, snapshot.renderableHandles) &&
+            reader.getArray(ESnapshotArray::Renderables, snapshot.renderables) &&
+            reader.getArray(ESnapshotArray::RenderGroupHandles, snapshot.renderGroupHandles) &&
+            reader.getArray(ESnapshotArray::RenderGroupRenderableCounts, snapshot.renderGroupRenderableCounts) &&
+            reader.getArray(ESnapshotArray::RenderGroupRenderables, snapshot.renderGroupRenderables) &&
+            reader.getArray(ESnapshotArray::RenderGroupNestedGroupCounts, snapshot.renderGroupNestedGroupCounts) &&
+            reader.getArray(ESnapshotArray::RenderGroupNestedGroups, snapshot.renderGroupNestedGroups);
+        if (!allArraysValid)
+            return false;
+
+        const size_t nodeCount = snapshot.nodeHandles.size();
+        const size_t layoutCount = snapshot.dataLayoutHandles.size();
+        const size_t instanceCount = snapshot.dataInstanceHandles.size();
+        const size_t groupCount = snapshot.renderGroupHandles.size();
+
+        const bool arraySizesConsistent =
+            snapshot.nodeParents.size() == nodeCount &&
+            snapshot.nodeChildCounts.size() == nodeCount &&
+            CountsMatchTotal(snapshot.nodeChildCounts, snapshot.nodeChildren.size()) &&
+            snapshot.transforms.size() == snapshot.transformHandles.size() &&
+            snapshot.dataLayoutUsageCounts.size() == layoutCount &&
+            snapshot.dataLayoutEffectHashes.size() == layoutCount &&
+            snapshot.dataLayoutFieldCounts.size() == layoutCount &&
+            CountsMatchTotal(snapshot.dataLayoutFieldCounts, snapshot.dataLayoutFields.size()) &&
+            snapshot.dataInstanceLayouts.size() == instanceCount &&
+            snapshot.dataInstanceSizes.size() == instanceCount &&
+            CountsMatchTotal(snapshot.dataInstanceSizes, snapshot.dataInstancePayloads.size()) &&
+            snapshot.renderables.size() == snapshot.renderableHandles.size() &&
+            snapshot.renderGroupRenderableCounts.size() == groupCount &&
+            CountsMatchTotal(snapshot.renderGroupRenderableCounts, snapshot.renderGroupRenderables.size()) &&
+            snapshot.renderGroupNestedGroupCounts.size() == groupCount &&
+            CountsMatchTotal(snapshot.renderGroupNestedGroupCounts, snapshot.renderGroupNestedGroups.size());
+        if (!arraySizesConsistent)
+            return false;
+
+        if (std::find(snapshot.dataLayoutUsageCounts.cbegin(), snapshot.dataLayoutUsageCounts.cend(), 0u) != snapshot.dataLayoutUsageCounts.cend())
+            return false;
+
+        const bool handlesUnique =
+            AreHandlesAscending(snapshot.nodeHandles) &&
+            AreHandlesAscending(snapshot.transformHandles) &&
+            AreHandlesAscending(snapshot.dataLayoutHandles) &&
+            AreHandlesAscending(snapshot.dataInstanceHandles) &&
+            AreHandlesAscending(snapshot.renderableHandles) &&
+            AreHandlesAscending(snapshot.renderGroupHandles);
+        if (!handlesUnique)
+            return false;
+
+        return NodeTopologyValid(snapshot) && ObjectReferencesValid(snapshot) && DataInstanceSizesMatchLayouts(snapshot);
+    }
+}
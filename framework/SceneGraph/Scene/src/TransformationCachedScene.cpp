@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/TransformationCachedScene.h"
+#include "Scene/SceneSnapshot.h"
 #include "Utils/MemoryPoolExplicit.h"
 #include "Utils/MemoryPool.h"
 
@@ -23,10 +24,34 @@ namespace ramses_internal
     {
         SceneT<MEMORYPOOL>::preallocateSceneSize(sizeInfo);
 
-        m_nodeToTransformMap.reserve(sizeInfo.transformCount);
+        m_nodeToTransform.reserve(sizeInfo.nodeCount);
         m_matrixCachePool.preallocateSize(sizeInfo.nodeCount);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::restoreFromSnapshot(const SceneSnapshot& snapshot)
+    {
+        SceneT<MEMORYPOOL>::restoreFromSnapshot(snapshot);
+
+        // new cache entries are dirty, no propagation needed
+        if (!snapshot.nodeHandles.empty())
+            m_matrixCachePool.preallocateSize(snapshot.nodeHandles.back().asMemoryHandle() + 1u);
+        for (const NodeHandle node : snapshot.nodeHandles)
+            m_matrixCachePool.allocate(node);
+
+        for (size_t i = 0u; i < snapshot.transformHandles.size(); ++i)
+        {
+            const TopologyTransform& transform = snapshot.transforms[i];
+            if (transform.node.asMemoryHandle() >= m_nodeToTransform.size())
+                m_nodeToTransform.resize(transform.node.asMemoryHandle() + 1u);
+            m_nodeToTransform[transform.node.asMemoryHandle()] = snapshot.transformHandles[i];
+
+            // same as if transform components were set one by one
+            if (transform.translation != Vector3(0.f) || transform.rotation != Vector3(0.f) || transform.scaling != Vector3(1.f))
+                getMatrixCacheEntry(transform.node).m_isIdentity = false;
+        }
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::removeChildFromNode(NodeHandle parent, NodeHandle child)
     {
@@ -46,7 +71,9 @@ namespace ramses_internal
     {
         assert(nodeHandle.isValid());
         const TransformHandle actualHandle = SceneT<MEMORYPOOL>::allocateTransform(nodeHandle, handle);
-        m_nodeToTransformMap.put(nodeHandle, actualHandle);
+        if (nodeHandle.asMemoryHandle() >= m_nodeToTransform.size())
+            m_nodeToTransform.resize(nodeHandle.asMemoryHandle() + 1u);
+        m_nodeToTransform[nodeHandle.asMemoryHandle()] = actualHandle;
         propagateDirty(nodeHandle);
         return actualHandle;
     }
@@ -102,7 +129,8 @@ namespace ramses_internal
     void TransformationCachedSceneT<MEMORYPOOL>::releaseNode(NodeHandle node)
     {
         m_matrixCachePool.release(node);
-        m_nodeToTransformMap.remove(node);
+        if (node.asMemoryHandle() < m_nodeToTransform.size())
+            m_nodeToTransform[node.asMemoryHandle()] = TransformHandle::Invalid();
         SceneT<MEMORYPOOL>::releaseNode(node);
     }
 
@@ -151,8 +179,14 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     Matrix44f TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const
     {
-        Matrix44f chainMatrix = findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(matrixType, node, m_dirtyNodes);
-        updateMatrixCacheForDirtyNodes(matrixType, chainMatrix, m_dirtyNodes);
+        return updateMatrixCache(matrixType, node, m_dirtyNodes);
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    Matrix44f TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node, NodeHandleVector& dirtyNodesBuffer) const
+    {
+        Matrix44f chainMatrix = findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(matrixType, node, dirtyNodesBuffer);
+        updateMatrixCacheForDirtyNodes(matrixType, chainMatrix, dirtyNodesBuffer);
 
         return chainMatrix;
     }
@@ -220,34 +254,37 @@ namespace ramses_internal
     }
 
     template <template<typename, typename> class MEMORYPOOL>
-    void TransformationCachedSceneT<MEMORYPOOL>::computeWorldMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const
+    const TopologyTransform* TransformationCachedSceneT<MEMORYPOOL>::findTransformForNode(NodeHandle node) const
     {
-        const TransformHandle* transformHandlePtr = m_nodeToTransformMap.get(node);
-        if (transformHandlePtr != nullptr)
+        if (node.asMemoryHandle() < m_nodeToTransform.size())
         {
-            const auto& transform = SceneT<MEMORYPOOL>::getTransform(*transformHandlePtr);
-            const Matrix44f matrix =
-                Matrix44f::Translation(transform.translation) *
-                Matrix44f::RotationEuler(transform.rotation, transform.rotationConvention) *
-                Matrix44f::Scaling(transform.scaling);
+            const TransformHandle transformHandle = m_nodeToTransform[node.asMemoryHandle()];
+            if (transformHandle.isValid())
+                return &SceneT<MEMORYPOOL>::getTransform(transformHandle);
+        }
+
+        return nullptr;
+    }
 
-            chainMatrix *= matrix;
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::computeWorldMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const
+    {
+        const TopologyTransform* transform = findTransformForNode(node);
+        if (transform != nullptr)
+        {
+            const Matrix44f matrix = Matrix44f::Transformation(transform->translation, transform->rotation, transform->rotationConvention, transform->scaling);
+            chainMatrix = Matrix44f::Multiply(chainMatrix, matrix);
         }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::computeObjectMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const
     {
-        const TransformHandle* transformHandlePtr = m_nodeToTransformMap.get(node);
-        if (transformHandlePtr != nullptr)
+        const TopologyTransform* transform = findTransformForNode(node);
+        if (transform != nullptr)
         {
-            const auto& transform = SceneT<MEMORYPOOL>::getTransform(*transformHandlePtr);
-            const Matrix44f matrix =
-                Matrix44f::Scaling(transform.scaling.inverse()) *
-                Matrix44f::RotationEuler(transform.rotation, transform.rotationConvention).transpose() *
-                Matrix44f::Translation(-transform.translation);
-
-            chainMatrix = matrix * chainMatrix;
+            const Matrix44f matrix = Matrix44f::InverseTransformation(transform->translation, transform->rotation, transform->rotationConvention, transform->scaling);
+            chainMatrix = Matrix44f::Multiply(matrix, chainMatrix);
         }
     }
 
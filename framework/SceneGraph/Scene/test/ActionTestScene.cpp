@@ -1105,6 +1105,12 @@ namespace ramses_internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderPassFrustumCulling(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassFrustumCulling(pass, enable);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         m_actionCollector.addRenderGroupToRenderPass(passHandle, groupHandle, order);
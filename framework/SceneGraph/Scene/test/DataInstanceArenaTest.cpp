@@ -0,0 +1,246 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "Scene/DataInstanceArena.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <cstddef>
+#include <numeric>
+#include <iostream>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class ADataInstanceArena : public testing::Test
+    {
+    protected:
+        DataInstanceArena arena;
+        const DataLayoutHandle layout1{ 1u };
+        const DataLayoutHandle layout2{ 2u };
+    };
+
+    TEST_F(ADataInstanceArena, returnsNullForEmptyPayload)
+    {
+        EXPECT_EQ(nullptr, arena.allocate(layout1, 0u));
+        EXPECT_EQ(0u, arena.getInstanceCount(layout1));
+        arena.release(layout1, nullptr);
+    }
+
+    TEST_F(ADataInstanceArena, allocatesZeroInitializedPayload)
+    {
+        const Byte* payload = arena.allocate(layout1, 20u);
+        ASSERT_NE(nullptr, payload);
+        for (UInt32 i = 0u; i < 20u; ++i)
+            EXPECT_EQ(0u, payload[i]);
+        EXPECT_EQ(1u, arena.getInstanceCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, placesPayloadsOfSameLayoutNextToEachOtherWithAlignedStride)
+    {
+        const Byte* payload1 = arena.allocate(layout1, 20u);
+        const Byte* payload2 = arena.allocate(layout1, 20u);
+        const Byte* payload3 = arena.allocate(layout1, 20u);
+
+        const UInt32 stride = arena.getSlotStride(layout1);
+        EXPECT_LE(20u, stride);
+        EXPECT_EQ(0u, stride % alignof(std::max_align_t));
+        EXPECT_EQ(payload1 + stride, payload2);
+        EXPECT_EQ(payload2 + stride, payload3);
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, keepsLayoutsInSeparateSlabs)
+    {
+        arena.allocate(layout1, 20u);
+        arena.allocate(layout2, 64u);
+        arena.allocate(layout2, 64u);
+
+        EXPECT_EQ(1u, arena.getInstanceCount(layout1));
+        EXPECT_EQ(2u, arena.getInstanceCount(layout2));
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+        EXPECT_EQ(1u, arena.getChunkCount(layout2));
+    }
+
+    TEST_F(ADataInstanceArena, allocatesNewChunkWhenFullAndKeepsExistingPayloadsInPlace)
+    {
+        const UInt32 payloadSize = DataInstanceArena::ChunkSizeInBytes / 4u;
+        std::vector<Byte*> payloads;
+        for (UInt32 i = 0u; i < 4u; ++i)
+        {
+            payloads.push_back(arena.allocate(layout1, payloadSize));
+            payloads.back()[0] = static_cast<Byte>(i + 1u);
+        }
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+
+        arena.allocate(layout1, payloadSize);
+        EXPECT_EQ(2u, arena.getChunkCount(layout1));
+        for (UInt32 i = 0u; i < 4u; ++i)
+            EXPECT_EQ(i + 1u, payloads[i][0]);
+    }
+
+    TEST_F(ADataInstanceArena, canHoldPayloadBiggerThanChunkSize)
+    {
+        Byte* payload = arena.allocate(layout1, DataInstanceArena::ChunkSizeInBytes * 2u);
+        ASSERT_NE(nullptr, payload);
+        payload[DataInstanceArena::ChunkSizeInBytes * 2u - 1u] = 1u;
+        arena.allocate(layout1, DataInstanceArena::ChunkSizeInBytes * 2u);
+        EXPECT_EQ(2u, arena.getChunkCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, reusesReleasedSlotAndClearsIt)
+    {
+        arena.allocate(layout1, 20u);
+        Byte* payload = arena.allocate(layout1, 20u);
+        payload[0] = 5u;
+        arena.release(layout1, payload);
+        EXPECT_EQ(1u, arena.getInstanceCount(layout1));
+
+        EXPECT_EQ(payload, arena.allocate(layout1, 20u));
+        EXPECT_EQ(0u, payload[0]);
+        EXPECT_EQ(2u, arena.getInstanceCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, keepsOnlyFirstChunkWhenAllInstancesOfLayoutReleased)
+    {
+        const UInt32 payloadSize = DataInstanceArena::ChunkSizeInBytes / 2u;
+        std::vector<Byte*> payloads;
+        for (UInt32 i = 0u; i < 5u; ++i)
+            payloads.push_back(arena.allocate(layout1, payloadSize));
+        EXPECT_EQ(3u, arena.getChunkCount(layout1));
+
+        for (auto payload : payloads)
+            arena.release(layout1, payload);
+        EXPECT_EQ(0u, arena.getInstanceCount(layout1));
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+
+        EXPECT_EQ(payloads.front(), arena.allocate(layout1, payloadSize));
+    }
+
+    TEST_F(ADataInstanceArena, freesChunksWhenLayoutReleased)
+    {
+        Byte* payload = arena.allocate(layout1, 20u);
+        arena.release(layout1, payload);
+        arena.releaseLayout(layout1);
+        EXPECT_EQ(0u, arena.getChunkCount(layout1));
+        EXPECT_EQ(0u, arena.getSlotStride(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, keepsChunksOfLayoutReleasedWhileInstancesStillAlive)
+    {
+        Byte* payload = arena.allocate(layout1, 20u);
+        arena.releaseLayout(layout1);
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+        arena.release(layout1, payload);
+        EXPECT_EQ(0u, arena.getInstanceCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, adaptsToDifferentPayloadSizeIfLayoutHandleReused)
+    {
+        Byte* payload = arena.allocate(layout1, 20u);
+        arena.release(layout1, payload);
+        arena.releaseLayout(layout1);
+
+        arena.allocate(layout1, 200u);
+        arena.allocate(layout1, 200u);
+        EXPECT_LE(200u, arena.getSlotStride(layout1));
+        EXPECT_EQ(2u, arena.getInstanceCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, startsWithSmallChunkAndGrowsFollowingChunks)
+    {
+        for (UInt32 i = 0u; i < DataInstanceArena::InitialSlotsPerChunk; ++i)
+            arena.allocate(layout1, 16u);
+        EXPECT_EQ(1u, arena.getChunkCount(layout1));
+
+        // next chunk has twice the slots of first one
+        for (UInt32 i = 0u; i < DataInstanceArena::InitialSlotsPerChunk * 2u; ++i)
+            arena.allocate(layout1, 16u);
+        EXPECT_EQ(2u, arena.getChunkCount(layout1));
+
+        arena.allocate(layout1, 16u);
+        EXPECT_EQ(3u, arena.getChunkCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, keepsPayloadsOfPreviousLayoutValidWhenLayoutHandleReusedWithDifferentSize)
+    {
+        Byte* oldPayload1 = arena.allocate(layout1, 20u);
+        Byte* oldPayload2 = arena.allocate(layout1, 20u);
+        oldPayload1[0] = 1u;
+        oldPayload2[19] = 2u;
+        arena.releaseLayout(layout1);
+
+        Byte* newPayload = arena.allocate(layout1, 200u);
+        newPayload[199] = 3u;
+        EXPECT_EQ(1u, arena.getInstanceCount(layout1));
+        EXPECT_EQ(1u, oldPayload1[0]);
+        EXPECT_EQ(2u, oldPayload2[19]);
+
+        arena.release(layout1, oldPayload1);
+        EXPECT_EQ(2u, oldPayload2[19]);
+        arena.release(layout1, oldPayload2);
+        EXPECT_EQ(1u, arena.getInstanceCount(layout1));
+        EXPECT_EQ(3u, newPayload[199]);
+
+        arena.release(layout1, newPayload);
+        EXPECT_EQ(0u, arena.getInstanceCount(layout1));
+    }
+
+    TEST_F(ADataInstanceArena, DISABLED_BenchmarkAllocationsAndIterationComparedToVectorPerInstance)
+    {
+        constexpr UInt32 LayoutCount = 50u;
+        constexpr UInt32 InstanceCount = 200000u;
+        // payload of matrix, vector and 1 to 5 floats like in scene benchmark
+        const auto payloadSize = [](UInt32 layoutIdx) { return 16u * 4u + 4u * 4u + (layoutIdx % 5u + 1u) * 4u; };
+
+        // previous storage, every instance owned its payload vector
+        std::vector<std::vector<Byte>> vectors;
+        vectors.reserve(InstanceCount);
+        UInt64 start = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+            vectors.emplace_back(payloadSize(i % LayoutCount), Byte(i));
+        const UInt64 vectorLoadTime = PlatformTime::GetMicrosecondsMonotonic() - start;
+
+        std::vector<Byte*> payloads(InstanceCount);
+        start = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            payloads[i] = arena.allocate(DataLayoutHandle(i % LayoutCount), payloadSize(i % LayoutCount));
+            payloads[i][0] = Byte(i);
+        }
+        const UInt64 arenaLoadTime = PlatformTime::GetMicrosecondsMonotonic() - start;
+
+        UInt32 chunkCount = 0u;
+        for (UInt32 layoutIdx = 0u; layoutIdx < LayoutCount; ++layoutIdx)
+            chunkCount += arena.getChunkCount(DataLayoutHandle(layoutIdx));
+
+        // typical renderer access pattern, all instances of one layout (effect) are visited together
+        const auto measureIteration = [&](const auto& getPayload)
+        {
+            UInt64 sum = 0u;
+            const UInt64 iterationStart = PlatformTime::GetMicrosecondsMonotonic();
+            for (UInt32 layoutIdx = 0u; layoutIdx < LayoutCount; ++layoutIdx)
+            {
+                for (UInt32 i = layoutIdx; i < InstanceCount; i += LayoutCount)
+                {
+                    const Byte* payload = getPayload(i);
+                    sum = std::accumulate(payload, payload + payloadSize(layoutIdx), sum);
+                }
+            }
+            EXPECT_NE(0u, sum);
+            return PlatformTime::GetMicrosecondsMonotonic() - iterationStart;
+        };
+        const UInt64 vectorIterationTime = measureIteration([&](UInt32 i) { return vectors[i].data(); });
+        const UInt64 arenaIterationTime = measureIteration([&](UInt32 i) { return payloads[i]; });
+
+        std::cout << InstanceCount << " payloads of " << LayoutCount << " layouts: vector per instance " << InstanceCount << " allocations, load " << vectorLoadTime
+            << "us, iteration per layout " << vectorIterationTime << "us; arena " << chunkCount << " allocations, load " << arenaLoadTime
+            << "us, iteration per layout " << arenaIterationTime << "us" << std::endl;
+    }
+}
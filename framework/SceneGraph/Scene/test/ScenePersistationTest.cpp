@@ -9,8 +9,14 @@
 #include "framework_common_gmock_header.h"
 #include "gtest/gtest.h"
 #include "Scene/ScenePersistation.h"
+#include "Scene/SceneSnapshot.h"
+#include "Scene/SceneActionApplier.h"
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "PlatformAbstraction/PlatformTime.h"
 #include "TestingScene.h"
 
 using namespace testing;
@@ -42,4 +48,347 @@ namespace ramses_internal
         ScenePersistation::ReadSceneFromFile("testfile", loadedScene, &animSystemFactory);
         scene.CheckEquivalentTo<IScene>(loadedScene);
     }
+
+    TEST(AScenePersistation, canReadWriteMockSceneAsSnapshot)
+    {
+        TestingScene<ClientScene> scene;
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, scene.getScene());
+
+        Scene loadedScene;
+        SceneActionCollection dummyCollection;
+        AnimationSystemFactory animSystemFactory(EAnimationSystemOwner_Client, &dummyCollection);
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene, &animSystemFactory);
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST(AScenePersistation, clientSceneLoadedFromSnapshotCollectsActionsRecreatingIt)
+    {
+        TestingScene<ClientScene> scene;
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, scene.getScene());
+
+        ClientScene loadedScene;
+        SceneActionCollection dummyCollection;
+        AnimationSystemFactory animSystemFactory(EAnimationSystemOwner_Client, &dummyCollection);
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene, &animSystemFactory);
+        scene.CheckEquivalentTo<IScene>(loadedScene);
+        EXPECT_TRUE(loadedScene.haveResourcesChanged());
+
+        // collected actions are what gets sent to renderer on first flush
+        Scene sceneFromActions;
+        AnimationSystemFactory otherAnimSystemFactory(EAnimationSystemOwner_Client, &dummyCollection);
+        SceneActionApplier::ApplyActionsOnScene(sceneFromActions, loadedScene.getSceneActionCollection(), &otherAnimSystemFactory);
+        scene.CheckEquivalentTo<IScene>(sceneFromActions);
+    }
+
+    TEST(AScenePersistation, clientSceneLoadedFromSnapshotReusesCachedDataLayouts)
+    {
+        ClientScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+        scene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+        ASSERT_EQ(2u, scene.getNumDataLayoutReferences(layout));
+
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, scene);
+
+        ClientScene loadedScene;
+        BinaryInputStream inStream(outStream.getData());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+        EXPECT_EQ(2u, loadedScene.getNumDataLayoutReferences(layout));
+        EXPECT_EQ(layout, loadedScene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u)));
+        EXPECT_EQ(3u, loadedScene.getNumDataLayoutReferences(layout));
+    }
+
+    TEST(AScenePersistation, snapshotSerializedAndParsedKeepsAllRecords)
+    {
+        ClientScene scene;
+        const NodeHandle parent = scene.allocateNode();
+        const NodeHandle child = scene.allocateNode();
+        scene.releaseNode(scene.allocateNode());
+        scene.addChildToNode(parent, child);
+        const TransformHandle transform = scene.allocateTransform(child);
+        scene.setTranslation(transform, Vector3(1.f, 2.f, 3.f));
+
+        std::vector<Byte> data;
+        SceneSnapshot::Serialize(scene, data);
+        SceneSnapshot snapshot;
+        ASSERT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+
+        ASSERT_EQ(2u, snapshot.nodeHandles.size());
+        EXPECT_EQ(parent, snapshot.nodeHandles[0]);
+        EXPECT_EQ(child, snapshot.nodeHandles[1]);
+        EXPECT_EQ(parent, snapshot.nodeParents[1]);
+        ASSERT_EQ(1u, snapshot.nodeChildren.size());
+        EXPECT_EQ(child, snapshot.nodeChildren[0]);
+        ASSERT_EQ(1u, snapshot.transforms.size());
+        EXPECT_EQ(Vector3(1.f, 2.f, 3.f), snapshot.transforms[0].translation);
+        EXPECT_EQ(child, snapshot.transforms[0].node);
+    }
+
+    TEST(AScenePersistation, failsToParseSnapshotWithDifferentRecordSizeOrTruncatedData)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+
+        std::vector<Byte> data;
+        SceneSnapshot::Serialize(scene, data);
+        SceneSnapshot snapshot;
+
+        std::vector<Byte> truncatedData(data.cbegin(), data.cend() - 1);
+        EXPECT_FALSE(SceneSnapshot::Parse(absl::MakeConstSpan(truncatedData), snapshot));
+
+        // element size of first array as if it was written on other platform
+        const UInt32 otherElementSize = sizeof(NodeHandle) * 2u;
+        PlatformMemory::Copy(data.data() + 3u * sizeof(UInt32), &otherElementSize, sizeof(otherElementSize));
+        EXPECT_FALSE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+    }
+
+    TEST(AScenePersistation, sceneLoadedFromSnapshotEqualsSceneLoadedFromActions)
+    {
+        constexpr UInt32 NodeCount = 50u;
+        ClientScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F), DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+        const RenderGroupHandle group = scene.allocateRenderGroup();
+        const RenderStateHandle renderState = scene.allocateRenderState();
+        const NodeHandle root = scene.allocateNode();
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode();
+            scene.addChildToNode(root, node);
+            scene.setTranslation(scene.allocateTransform(node), Vector3(static_cast<Float>(i)));
+            const RenderableHandle renderable = scene.allocateRenderable(node);
+            const DataInstanceHandle instance = scene.allocateDataInstance(layout);
+            scene.setDataSingleVector4f(instance, DataFieldHandle(1u), Vector4(static_cast<Float>(i)));
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, instance);
+            scene.setRenderableRenderState(renderable, renderState);
+            scene.addRenderableToRenderGroup(group, renderable, static_cast<Int32>(i));
+        }
+
+        BinaryOutputStream actionStream;
+        ScenePersistation::WriteSceneToStream(actionStream, scene);
+        BinaryOutputStream snapshotStream;
+        ScenePersistation::WriteSceneSnapshotToStream(snapshotStream, scene);
+
+        Scene sceneFromActions;
+        BinaryInputStream actionInStream(actionStream.getData());
+        ScenePersistation::ReadSceneFromStream(actionInStream, sceneFromActions);
+        Scene sceneFromSnapshot;
+        BinaryInputStream snapshotInStream(snapshotStream.getData());
+        ScenePersistation::ReadSceneFromStream(snapshotInStream, sceneFromSnapshot);
+
+        ASSERT_EQ(NodeCount + 1u, sceneFromSnapshot.getNodeCount());
+        EXPECT_EQ(sceneFromActions.getChildCount(root), sceneFromSnapshot.getChildCount(root));
+        EXPECT_EQ(sceneFromActions.getRenderGroup(group).renderables.size(), sceneFromSnapshot.getRenderGroup(group).renderables.size());
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            const NodeHandle node = sceneFromActions.getChild(root, i);
+            EXPECT_EQ(node, sceneFromSnapshot.getChild(root, i));
+            EXPECT_EQ(root, sceneFromSnapshot.getParent(node));
+
+            const TransformHandle transform(i);
+            EXPECT_EQ(sceneFromActions.getTransformNode(transform), sceneFromSnapshot.getTransformNode(transform));
+            EXPECT_EQ(Vector3(static_cast<Float>(i)), sceneFromSnapshot.getTranslation(transform));
+
+            const RenderableHandle renderable(i);
+            const Renderable& fromActions = sceneFromActions.getRenderable(renderable);
+            const Renderable& fromSnapshot = sceneFromSnapshot.getRenderable(renderable);
+            EXPECT_EQ(fromActions.node, fromSnapshot.node);
+            EXPECT_EQ(renderState, fromSnapshot.renderState);
+            const DataInstanceHandle instance = fromSnapshot.dataInstances[ERenderableDataSlotType_Uniforms];
+            EXPECT_EQ(fromActions.dataInstances[ERenderableDataSlotType_Uniforms], instance);
+            EXPECT_EQ(Vector4(static_cast<Float>(i)), sceneFromSnapshot.getDataSingleVector4f(instance, DataFieldHandle(1u)));
+        }
+    }
+
+    class AScenePersistationWithCorruptedSnapshot : public ::testing::Test
+    {
+    protected:
+        AScenePersistationWithCorruptedSnapshot()
+        {
+            const NodeHandle parent = scene.allocateNode();
+            const NodeHandle child = scene.allocateNode();
+            scene.addChildToNode(parent, child);
+            scene.allocateTransform(child);
+            const RenderableHandle renderable = scene.allocateRenderable(child);
+            const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, scene.allocateDataInstance(layout));
+            scene.setRenderableRenderState(renderable, scene.allocateRenderState());
+            const RenderGroupHandle group = scene.allocateRenderGroup();
+            scene.addRenderableToRenderGroup(group, renderable, 0);
+            scene.addRenderGroupToRenderGroup(scene.allocateRenderGroup(), group, 0);
+
+            SceneSnapshot::Serialize(scene, data);
+            SceneSnapshot snapshot;
+            EXPECT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+        }
+
+        // overwrites first record of given type in data, records are located by parsing the data
+        template <typename T>
+        void corruptRecord(absl::Span<const T> SceneSnapshot::* array, const T& corruptedValue)
+        {
+            SceneSnapshot snapshot;
+            ASSERT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+            const Byte* record = reinterpret_cast<const Byte*>((snapshot.*array).data());
+            PlatformMemory::Copy(data.data() + (record - data.data()), &corruptedValue, sizeof(T));
+        }
+
+        bool parse()
+        {
+            SceneSnapshot snapshot;
+            return SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot);
+        }
+
+        ClientScene scene;
+        std::vector<Byte> data;
+        const NodeHandle unknownNode{ 7u };
+    };
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, failsToParseIfNodeParentOrChildIsNotInSnapshot)
+    {
+        std::vector<Byte> original = data;
+        corruptRecord(&SceneSnapshot::nodeParents, unknownNode);
+        EXPECT_FALSE(parse());
+
+        data = original;
+        corruptRecord(&SceneSnapshot::nodeChildren, unknownNode);
+        EXPECT_FALSE(parse());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, failsToParseIfNodeLinksAreInconsistentOrCyclic)
+    {
+        std::vector<Byte> original = data;
+        // child points to itself instead of parent
+        corruptRecord(&SceneSnapshot::nodeChildren, NodeHandle(0u));
+        EXPECT_FALSE(parse());
+
+        // parent has parent which does not list it as child, parent and child form a cycle
+        data = original;
+        corruptRecord(&SceneSnapshot::nodeParents, NodeHandle(1u));
+        EXPECT_FALSE(parse());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, failsToParseIfTransformNodeIsNotInSnapshot)
+    {
+        SceneSnapshot snapshot;
+        ASSERT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+        TopologyTransform transform = snapshot.transforms[0];
+        transform.node = unknownNode;
+        corruptRecord(&SceneSnapshot::transforms, transform);
+        EXPECT_FALSE(parse());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, failsToParseIfRenderableReferencesNodeOrDataInstanceNotInSnapshot)
+    {
+        SceneSnapshot snapshot;
+        ASSERT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+        const Renderable original = snapshot.renderables[0];
+        const std::vector<Byte> originalData = data;
+
+        Renderable renderable = original;
+        renderable.node = unknownNode;
+        corruptRecord(&SceneSnapshot::renderables, renderable);
+        EXPECT_FALSE(parse());
+
+        data = originalData;
+        renderable = original;
+        renderable.dataInstances[ERenderableDataSlotType_Geometry] = DataInstanceHandle(5u);
+        corruptRecord(&SceneSnapshot::renderables, renderable);
+        EXPECT_FALSE(parse());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, failsToParseIfRenderGroupEntryIsNotInSnapshot)
+    {
+        const std::vector<Byte> original = data;
+        corruptRecord(&SceneSnapshot::renderGroupRenderables, RenderableOrderEntry{ RenderableHandle(3u), 0 });
+        EXPECT_FALSE(parse());
+
+        data = original;
+        corruptRecord(&SceneSnapshot::renderGroupNestedGroups, RenderGroupOrderEntry{ RenderGroupHandle(3u), 0 });
+        EXPECT_FALSE(parse());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, loadsSceneWithoutCrashingAndDropsReferenceToRenderStateNotInScene)
+    {
+        SceneSnapshot snapshot;
+        ASSERT_TRUE(SceneSnapshot::Parse(absl::MakeConstSpan(data), snapshot));
+        Renderable renderable = snapshot.renderables[0];
+        renderable.renderState = RenderStateHandle(9u);
+        corruptRecord(&SceneSnapshot::renderables, renderable);
+
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, scene);
+        std::vector<Byte> streamData(outStream.getData(), outStream.getData() + outStream.getSize());
+        // snapshot follows marker, version and size
+        const size_t snapshotOffset = 3u * sizeof(UInt32);
+        ASSERT_LE(snapshotOffset + data.size(), streamData.size());
+        PlatformMemory::Copy(streamData.data() + snapshotOffset, data.data(), data.size());
+
+        Scene loadedScene;
+        BinaryInputStream inStream(streamData.data());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+        ASSERT_TRUE(loadedScene.isRenderableAllocated(RenderableHandle(0u)));
+        EXPECT_FALSE(loadedScene.getRenderable(RenderableHandle(0u)).renderState.isValid());
+    }
+
+    TEST_F(AScenePersistationWithCorruptedSnapshot, doesNotRestoreAnyObjectsIfSnapshotReferencesObjectNotInIt)
+    {
+        corruptRecord(&SceneSnapshot::nodeChildren, unknownNode);
+
+        BinaryOutputStream outStream;
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, scene);
+        std::vector<Byte> streamData(outStream.getData(), outStream.getData() + outStream.getSize());
+        const size_t snapshotOffset = 3u * sizeof(UInt32);
+        PlatformMemory::Copy(streamData.data() + snapshotOffset, data.data(), data.size());
+
+        Scene loadedScene;
+        BinaryInputStream inStream(streamData.data());
+        ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+        EXPECT_EQ(0u, loadedScene.getRenderableCount());
+    }
+
+    TEST(AScenePersistation, DISABLED_BenchmarkLoadFromActionsAndFromSnapshot)
+    {
+        constexpr UInt32 NodeCount = 200000u;
+        ClientScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F), DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+        const RenderGroupHandle group = scene.allocateRenderGroup();
+        const NodeHandle root = scene.allocateNode();
+        for (UInt32 i = 0u; i < NodeCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode();
+            scene.addChildToNode(root, node);
+            scene.setTranslation(scene.allocateTransform(node), Vector3(static_cast<Float>(i)));
+            const RenderableHandle renderable = scene.allocateRenderable(node);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, scene.allocateDataInstance(layout));
+            scene.addRenderableToRenderGroup(group, renderable, static_cast<Int32>(i));
+        }
+
+        BinaryOutputStream actionStream;
+        ScenePersistation::WriteSceneToStream(actionStream, scene);
+        BinaryOutputStream snapshotStream;
+        ScenePersistation::WriteSceneSnapshotToStream(snapshotStream, scene);
+
+        // client scene additionally describes objects restored from snapshot as scene actions for its first flush
+        const auto measureLoad = [](const BinaryOutputStream& stream, IScene& loadedScene)
+        {
+            BinaryInputStream inStream(stream.getData());
+            const UInt64 start = PlatformTime::GetMicrosecondsMonotonic();
+            ScenePersistation::ReadSceneFromStream(inStream, loadedScene);
+            const UInt64 loadTime = PlatformTime::GetMicrosecondsMonotonic() - start;
+            EXPECT_EQ(NodeCount + 1u, loadedScene.getNodeCount());
+            return loadTime;
+        };
+
+        ClientScene clientSceneFromActions;
+        ClientScene clientSceneFromSnapshot;
+        Scene sceneFromActions;
+        Scene sceneFromSnapshot;
+        std::cout << NodeCount << " nodes with transform and renderable (" << actionStream.getSize() << " bytes as actions, " << snapshotStream.getSize() << " bytes as snapshot)" << std::endl;
+        std::cout << "  ClientScene: load from actions " << measureLoad(actionStream, clientSceneFromActions) << "us, load from snapshot " << measureLoad(snapshotStream, clientSceneFromSnapshot) << "us" << std::endl;
+        std::cout << "  Scene: load from actions " << measureLoad(actionStream, sceneFromActions) << "us, load from snapshot " << measureLoad(snapshotStream, sceneFromSnapshot) << "us" << std::endl;
+    }
 }
@@ -19,6 +19,8 @@
 #include "Math3d/Matrix22f.h"
 #include "Math3d/Matrix33f.h"
 #include "Math3d/Matrix44f.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <iostream>
 
 using namespace testing;
 
@@ -223,4 +225,138 @@ namespace ramses_internal
         EXPECT_EQ(offsetInBytes, dataResourceOut.offsetWithinElementInBytes);
         EXPECT_EQ(stride, dataResourceOut.stride);
     }
+
+    TYPED_TEST(AScene, PlacesDataOfInstancesWithSameLayoutContiguously)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash::Invalid());
+        const DataLayoutHandle otherDataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F) }, ResourceContentHash::Invalid());
+
+        const DataInstanceHandle instance1 = this->m_scene.allocateDataInstance(dataLayout);
+        this->m_scene.allocateDataInstance(otherDataLayout);
+        const DataInstanceHandle instance2 = this->m_scene.allocateDataInstance(dataLayout);
+
+        const Vector4* data1 = this->m_scene.getDataVector4fArray(instance1, DataFieldHandle(0u));
+        const Vector4* data2 = this->m_scene.getDataVector4fArray(instance2, DataFieldHandle(0u));
+        EXPECT_EQ(data1 + 1, data2);
+    }
+
+    TYPED_TEST(AScene, KeepsDataOfInstanceValidWhenOtherInstancesAllocatedAndReleased)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout);
+        this->m_scene.setDataSingleFloat(instance, DataFieldHandle(0u), 42.f);
+        const Float* data = this->m_scene.getDataFloatArray(instance, DataFieldHandle(0u));
+
+        std::vector<DataInstanceHandle> otherInstances;
+        for (UInt32 i = 0u; i < 10000u; ++i)
+            otherInstances.push_back(this->m_scene.allocateDataInstance(dataLayout));
+        for (const auto otherInstance : otherInstances)
+            this->m_scene.releaseDataInstance(otherInstance);
+
+        EXPECT_EQ(data, this->m_scene.getDataFloatArray(instance, DataFieldHandle(0u)));
+        EXPECT_EQ(42.f, this->m_scene.getDataSingleFloat(instance, DataFieldHandle(0u)));
+    }
+
+    TYPED_TEST(AScene, InitializesDataInstanceReusingReleasedMemory)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Float), DataFieldInfo(EDataType::DataReference) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance1 = this->m_scene.allocateDataInstance(dataLayout);
+        this->m_scene.allocateDataInstance(dataLayout);
+        this->m_scene.setDataSingleFloat(instance1, DataFieldHandle(0u), 42.f);
+        this->m_scene.setDataReference(instance1, DataFieldHandle(1u), DataInstanceHandle(3u));
+        this->m_scene.releaseDataInstance(instance1);
+
+        const DataInstanceHandle instance3 = this->m_scene.allocateDataInstance(dataLayout);
+        EXPECT_EQ(0.f, this->m_scene.getDataSingleFloat(instance3, DataFieldHandle(0u)));
+        EXPECT_FALSE(this->m_scene.getDataReference(instance3, DataFieldHandle(1u)).isValid());
+    }
+
+    TYPED_TEST(AScene, CanReallocateDataInstancesAfterLayoutReleasedAndReallocatedWithDifferentSize)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash::Invalid());
+        this->m_scene.releaseDataInstance(this->m_scene.allocateDataInstance(dataLayout));
+        this->m_scene.releaseDataLayout(dataLayout);
+
+        const DataLayoutHandle newDataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F, 2u) }, ResourceContentHash::Invalid(), dataLayout);
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(newDataLayout);
+        const Matrix44f values[2] = { Matrix44f::Identity, Matrix44f::Translation(Vector3(1.f, 2.f, 3.f)) };
+        this->m_scene.setDataMatrix44fArray(instance, DataFieldHandle(0u), 2u, values);
+        EXPECT_EQ(values[1], this->m_scene.getDataMatrix44fArray(instance, DataFieldHandle(0u))[1]);
+    }
+
+    TYPED_TEST(AScene, KeepsValuesOfManyInterleavedDataInstancesOfDifferentLayouts)
+    {
+        constexpr UInt32 LayoutCount = 5u;
+        constexpr UInt32 InstanceCount = 500u;
+        std::vector<DataLayoutHandle> layouts;
+        for (UInt32 i = 0u; i < LayoutCount; ++i)
+            layouts.push_back(this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F), DataFieldInfo(EDataType::Vector4F), DataFieldInfo(EDataType::Float, i + 1u) }, ResourceContentHash::Invalid()));
+
+        // instances of different layouts are created interleaved like when loading a scene with many meshes
+        std::vector<DataInstanceHandle> instances(InstanceCount);
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            instances[i] = this->m_scene.allocateDataInstance(layouts[i % LayoutCount]);
+            this->m_scene.setDataSingleMatrix44f(instances[i], DataFieldHandle(0u), Matrix44f::Translation(Vector3(static_cast<Float>(i))));
+            this->m_scene.setDataSingleVector4f(instances[i], DataFieldHandle(1u), Vector4(static_cast<Float>(i)));
+        }
+
+        // release every other instance and reallocate, reused payloads must not overlap with live ones
+        for (UInt32 i = 0u; i < InstanceCount; i += 2u)
+            this->m_scene.releaseDataInstance(instances[i]);
+        for (UInt32 i = 0u; i < InstanceCount; i += 2u)
+        {
+            instances[i] = this->m_scene.allocateDataInstance(layouts[i % LayoutCount]);
+            EXPECT_EQ(Vector4(0.f), this->m_scene.getDataSingleVector4f(instances[i], DataFieldHandle(1u)));
+            this->m_scene.setDataSingleMatrix44f(instances[i], DataFieldHandle(0u), Matrix44f::Translation(Vector3(static_cast<Float>(i))));
+            this->m_scene.setDataSingleVector4f(instances[i], DataFieldHandle(1u), Vector4(static_cast<Float>(i)));
+        }
+
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            EXPECT_EQ(Matrix44f::Translation(Vector3(static_cast<Float>(i))), this->m_scene.getDataSingleMatrix44f(instances[i], DataFieldHandle(0u)));
+            EXPECT_EQ(Vector4(static_cast<Float>(i)), this->m_scene.getDataSingleVector4f(instances[i], DataFieldHandle(1u)));
+        }
+    }
+
+    TYPED_TEST(AScene, DISABLED_BenchmarkDataInstanceLoadAndIteration)
+    {
+        constexpr UInt32 LayoutCount = 50u;
+        constexpr UInt32 InstanceCount = 200000u;
+        std::vector<DataLayoutHandle> layouts;
+        for (UInt32 i = 0u; i < LayoutCount; ++i)
+            layouts.push_back(this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Matrix44F), DataFieldInfo(EDataType::Vector4F), DataFieldInfo(EDataType::Float, i % 5u + 1u) }, ResourceContentHash::Invalid()));
+
+        // instances of different layouts are created interleaved like when loading a scene with many meshes
+        std::vector<DataInstanceHandle> instances(InstanceCount);
+        const UInt64 loadStart = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            instances[i] = this->m_scene.allocateDataInstance(layouts[i % LayoutCount]);
+            this->m_scene.setDataSingleMatrix44f(instances[i], DataFieldHandle(0u), Matrix44f::Identity);
+            this->m_scene.setDataSingleVector4f(instances[i], DataFieldHandle(1u), Vector4(static_cast<Float>(i)));
+        }
+        const UInt64 loadTime = PlatformTime::GetMicrosecondsMonotonic() - loadStart;
+
+        // typical renderer access pattern, all instances of one layout (effect) are visited together
+        Float sum = 0.f;
+        const UInt64 iterationStart = PlatformTime::GetMicrosecondsMonotonic();
+        for (UInt32 layoutIdx = 0u; layoutIdx < LayoutCount; ++layoutIdx)
+        {
+            for (UInt32 i = layoutIdx; i < InstanceCount; i += LayoutCount)
+            {
+                sum += this->m_scene.getDataSingleMatrix44f(instances[i], DataFieldHandle(0u)).m44;
+                sum += this->m_scene.getDataSingleVector4f(instances[i], DataFieldHandle(1u)).x;
+            }
+        }
+        const UInt64 iterationTime = PlatformTime::GetMicrosecondsMonotonic() - iterationStart;
+
+        const UInt64 releaseStart = PlatformTime::GetMicrosecondsMonotonic();
+        for (const auto instance : instances)
+            this->m_scene.releaseDataInstance(instance);
+        const UInt64 releaseTime = PlatformTime::GetMicrosecondsMonotonic() - releaseStart;
+
+        std::cout << InstanceCount << " data instances of " << LayoutCount << " layouts: load " << loadTime << "us, iteration per layout " << iterationTime
+            << "us, release " << releaseTime << "us (checksum " << sum << ")" << std::endl;
+    }
 }
@@ -171,4 +171,19 @@ namespace ramses_internal
         this->m_scene.setRenderPassRenderOnce(pass, false);
         EXPECT_FALSE(this->m_scene.getRenderPass(pass).isRenderOnce);
     }
+
+    TYPED_TEST(AScene, hasFrustumCullingDisabledByDefault)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass();
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isFrustumCullingEnabled);
+    }
+
+    TYPED_TEST(AScene, canSetFrustumCulling)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass();
+        this->m_scene.setRenderPassFrustumCulling(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isFrustumCullingEnabled);
+        this->m_scene.setRenderPassFrustumCulling(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isFrustumCullingEnabled);
+    }
 }
@@ -149,6 +149,7 @@ namespace ramses_internal
             scene.setRenderPassRenderOrder(renderPass, 1);
             scene.setRenderPassEnabled(renderPass, false);
             scene.setRenderPassRenderOnce(renderPass, true);
+            scene.setRenderPassFrustumCulling(renderPass, true);
 
             scene.addRenderGroupToRenderPass(renderPass, renderGroup, 15);
             scene.addRenderGroupToRenderPass(renderPass, renderGroup2, 5);
@@ -477,6 +478,7 @@ namespace ramses_internal
             EXPECT_EQ(static_cast<UInt32>(EClearFlags::EClearFlags_None), rp.clearFlags);
             EXPECT_FALSE(rp.isEnabled);
             EXPECT_TRUE(rp.isRenderOnce);
+            EXPECT_TRUE(rp.isFrustumCullingEnabled);
 
             ASSERT_TRUE(RenderGroupUtils::ContainsRenderGroup(renderGroup, rp));
             EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(renderGroup2, rp));
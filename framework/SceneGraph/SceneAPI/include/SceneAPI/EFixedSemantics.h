@@ -37,6 +37,9 @@ namespace ramses_internal
         TextPositionsAttribute,
         TextTextureCoordinatesAttribute,
         TimeMs,
+
+        // Used by renderer to find vertex positions for bounding volume of geometry
+        VertexPositionsAttribute,
     };
 
     static constexpr const char* const EFixedSemanticsNames[] =
@@ -56,6 +59,7 @@ namespace ramses_internal
         "TextPositionsAttribute",
         "TextTextureCoordinatesAttribute",
         "TimeMs",
+        "VertexPositionsAttribute",
     };
 
     inline bool IsSemanticCompatibleWithDataType(EFixedSemantics semantics, EDataType dataType)
@@ -85,6 +89,9 @@ namespace ramses_internal
             return dataType == EDataType::Vector2F;
         case EFixedSemantics::TimeMs:
             return dataType == EDataType::Int32;
+        case EFixedSemantics::VertexPositionsAttribute:
+            return dataType == EDataType::Vector3F
+                || dataType == EDataType::Vector4F;
         case EFixedSemantics::Invalid:
             return false;
         }
@@ -97,6 +104,6 @@ namespace ramses_internal
 MAKE_ENUM_CLASS_PRINTABLE_NO_EXTRA_LAST(ramses_internal::EFixedSemantics,
                                         "EFixedSemantics",
                                         ramses_internal::EFixedSemanticsNames,
-                                        ramses_internal::EFixedSemantics::TimeMs);
+                                        ramses_internal::EFixedSemantics::VertexPositionsAttribute);
 
 #endif
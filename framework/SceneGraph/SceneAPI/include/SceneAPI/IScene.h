@@ -242,6 +242,7 @@ namespace ramses_internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) = 0;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) = 0;
+        virtual void                        setRenderPassFrustumCulling     (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order) = 0;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) = 0;
         virtual const RenderPass&           getRenderPass                   (RenderPassHandle passHandle) const = 0;
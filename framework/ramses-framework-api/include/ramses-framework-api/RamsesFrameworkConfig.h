@@ -125,6 +125,19 @@ namespace ramses
         */
         void setPeriodicLogsEnabled(bool enabled);
 
+        /**
+        * @brief Enables or disables delta encoding of scene updates sent to remote renderers
+        *
+        * If enabled, scene actions of a flush are encoded against the ones of the previous flush sent to the same renderers
+        * and compressed. This reduces network traffic if the same scene objects are modified in every flush, at the cost
+        * of CPU time on both sides. Scene updates to a renderer in the same process are never encoded.
+        *
+        * The default value is disabled.
+        *
+        * @param[in] enabled If true scene updates sent to remote renderers are delta encoded
+        */
+        void setSceneActionDeltaEncodingEnabled(bool enabled);
+
         /**
         * @brief Sets the IP address that is used to select the local network interface
         * The value is only evaluated if SOME/IP is not used. This communication type is intended for prototype use-cases only.
@@ -51,6 +51,7 @@ namespace ramses
         IThreadWatchdogNotification* getWatchdogNotificationCallback() const;
 
         void setPeriodicLogsEnabled(bool enabled);
+        void setSceneActionDeltaEncodingEnabled(bool enabled);
         ramses_internal::Guid getUserProvidedGuid() const;
 
         SOMEIPICConfig   m_someipICConfig;
@@ -59,6 +60,7 @@ namespace ramses
         ERamsesShellType m_shellType;
         ramses_internal::ThreadWatchdogConfig m_watchdogConfig;
         bool m_periodicLogsEnabled;
+        bool m_sceneActionDeltaEncodingEnabled = false;
         std::chrono::milliseconds someipKeepAliveInterval{500};
         std::chrono::milliseconds someipKeepAliveTimeout{2500};
 
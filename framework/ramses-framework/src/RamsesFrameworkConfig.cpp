@@ -72,6 +72,11 @@ namespace ramses
         impl.setPeriodicLogsEnabled(enabled);
     }
 
+    void RamsesFrameworkConfig::setSceneActionDeltaEncodingEnabled(bool enabled)
+    {
+        impl.setSceneActionDeltaEncodingEnabled(enabled);
+    }
+
     void RamsesFrameworkConfig::setInterfaceSelectionIPForTCPCommunication(const char* ip)
     {
         impl.m_tcpConfig.setIPAddress(ip);
@@ -245,6 +245,11 @@ namespace ramses
         m_periodicLogsEnabled = enabled;
     }
 
+    void RamsesFrameworkConfigImpl::setSceneActionDeltaEncodingEnabled(bool enabled)
+    {
+        m_sceneActionDeltaEncodingEnabled = enabled;
+    }
+
     ramses_internal::Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
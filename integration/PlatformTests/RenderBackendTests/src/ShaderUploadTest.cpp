@@ -26,6 +26,7 @@
 #include "Platform_Base/Device_Base.h"
 #include "Platform_Base/Platform_Base.h"
 #include <memory>
+#include <array>
 
 using namespace testing;
 
@@ -196,6 +197,94 @@ namespace ramses_internal
         }
     };
 
+    // Needed so that these tests can be blacklisted on drivers which don't support uniform blocks (OpenGL ES 3.0)
+    class ADeviceSupportingUniformBlocks : public ADevice
+    {
+    public:
+        using Pixel = std::array<UInt8, 4u>;
+
+        static EffectResource* CreateTestEffectResourceWithUniformBlock()
+        {
+            // single triangle covering whole viewport, no vertex data needed
+            const String vertexShader(R"SHADER(
+                #version 300 es
+
+                void main()
+                {
+                    gl_Position = vec4(float((gl_VertexID & 1) << 2) - 1.0, float((gl_VertexID & 2) << 1) - 1.0, 0.0, 1.0);
+                }
+                )SHADER");
+
+            // std140 layout pads mat2 columns and float array elements to 16 bytes each
+            const String fragmentShader(R"SHADER(
+                #version 300 es
+
+                layout(std140) uniform Material
+                {
+                    highp vec4 u_color;
+                    highp mat2 u_scale;
+                    highp float u_weights[2];
+                };
+                out highp vec4 color;
+
+                void main(void)
+                {
+                    color = vec4(u_scale * u_color.xy * (u_weights[0] + u_weights[1]), u_color.zw);
+                }
+                )SHADER");
+
+            EffectInputInformationVector uniformInputs;
+            uniformInputs.push_back(EffectInputInformation("u_color", 1, EDataType::Vector4F, EFixedSemantics::Invalid));
+            uniformInputs.push_back(EffectInputInformation("u_scale", 1, EDataType::Matrix22F, EFixedSemantics::Invalid));
+            uniformInputs.push_back(EffectInputInformation("u_weights", 2, EDataType::Float, EFixedSemantics::Invalid));
+
+            return new EffectResource(vertexShader, fragmentShader, "", absl::nullopt, uniformInputs, {}, "uniform block test effect", ResourceCacheFlag_DoNotCache);
+        }
+
+        DeviceResourceHandle uploadAndActivateShader(const EffectResource& effect)
+        {
+            auto shaderGpuResource = testDevice->uploadShader(effect);
+            EXPECT_NE(nullptr, shaderGpuResource);
+            const DeviceResourceHandle handle = testDevice->registerShader(std::move(shaderGpuResource));
+            EXPECT_TRUE(handle.isValid());
+            testDevice->activateShader(handle);
+            return handle;
+        }
+
+        void setMaterial(const EffectResource& effect, const Vector4& color)
+        {
+            const Matrix22f scale = Matrix22f::Identity;
+            const std::array<Float, 2u> weights{ 0.25f, 0.75f };
+            testDevice->setConstant(DataFieldHandle(effect.getUniformDataFieldHandleByName("u_color")), 1, &color);
+            testDevice->setConstant(DataFieldHandle(effect.getUniformDataFieldHandleByName("u_scale")), 1, &scale);
+            testDevice->setConstant(DataFieldHandle(effect.getUniformDataFieldHandleByName("u_weights")), 2, weights.data());
+        }
+
+        Pixel drawWithActiveShader()
+        {
+            testDevice->activateRenderTarget(testDevice->getFramebufferRenderTarget());
+            testDevice->setViewport(0, 0, 16u, 16u);
+            testDevice->colorMask(true, true, true, true);
+            testDevice->clearColor(Vector4(0.f));
+            testDevice->clear(EClearFlags_Color);
+            testDevice->depthFunc(EDepthFunc::Disabled);
+            testDevice->stencilFunc(EStencilFunc::Disabled, 0u, 0xFF);
+            testDevice->cullMode(ECullMode::Disabled);
+            testDevice->blendOperations(EBlendOperation::Disabled, EBlendOperation::Disabled);
+            testDevice->scissorTest(EScissorTest::Disabled, {});
+            testDevice->drawMode(EDrawMode::Triangles);
+            testDevice->drawTriangles(0, 3, 1u);
+            EXPECT_TRUE(testDevice->isDeviceStatusHealthy());
+
+            Pixel pixel{};
+            testDevice->readPixels(pixel.data(), 8u, 8u, 1u, 1u);
+            return pixel;
+        }
+
+        const Pixel red{ 255u, 0u, 0u, 255u };
+        const Pixel green{ 0u, 255u, 0u, 255u };
+    };
+
     TEST_F(ADevice, CreatesShaderFromEffect)
     {
         ASSERT_TRUE(testDevice != nullptr);
@@ -554,4 +643,76 @@ namespace ramses_internal
 
         testDevice->deleteShader(handle);
     }
+
+    TEST_F(ADeviceSupportingUniformBlocks, RendersUniformBlockMembersSetAsConstants)
+    {
+        const std::unique_ptr<EffectResource> testEffect(CreateTestEffectResourceWithUniformBlock());
+        const DeviceResourceHandle handle = uploadAndActivateShader(*testEffect);
+
+        setMaterial(*testEffect, Vector4(1.f, 0.f, 0.f, 1.f));
+        EXPECT_TRUE(testDevice->isDeviceStatusHealthy());
+        EXPECT_EQ(red, drawWithActiveShader());
+
+        testDevice->deleteShader(handle);
+    }
+
+    TEST_F(ADeviceSupportingUniformBlocks, UploadsUniformBlockAgainOnlyIfMemberValueChanged)
+    {
+        const std::unique_ptr<EffectResource> testEffect(CreateTestEffectResourceWithUniformBlock());
+        const DeviceResourceHandle handle = uploadAndActivateShader(*testEffect);
+        setMaterial(*testEffect, Vector4(1.f, 0.f, 0.f, 1.f));
+        EXPECT_EQ(red, drawWithActiveShader());
+        testDevice->getAndResetUploadedUniformCount();
+        testDevice->getAndResetSkippedUniformCount();
+
+        // same values again, nothing changes in block
+        setMaterial(*testEffect, Vector4(1.f, 0.f, 0.f, 1.f));
+        EXPECT_EQ(0u, testDevice->getAndResetUploadedUniformCount());
+        EXPECT_EQ(3u, testDevice->getAndResetSkippedUniformCount());
+        EXPECT_EQ(red, drawWithActiveShader());
+
+        // only changed member is counted, whole block is uploaded for next draw
+        setMaterial(*testEffect, Vector4(0.f, 1.f, 0.f, 1.f));
+        EXPECT_EQ(1u, testDevice->getAndResetUploadedUniformCount());
+        EXPECT_EQ(2u, testDevice->getAndResetSkippedUniformCount());
+        EXPECT_EQ(green, drawWithActiveShader());
+
+        testDevice->deleteShader(handle);
+    }
+
+    TEST_F(ADeviceSupportingUniformBlocks, KeepsUniformBlockContentsOfEachShaderWhenSwitchingShaders)
+    {
+        const std::unique_ptr<EffectResource> testEffect(CreateTestEffectResourceWithUniformBlock());
+        const DeviceResourceHandle handle1 = uploadAndActivateShader(*testEffect);
+        setMaterial(*testEffect, Vector4(1.f, 0.f, 0.f, 1.f));
+        EXPECT_EQ(red, drawWithActiveShader());
+
+        // same block binding is used by both shaders, each has own contents in uniform buffer
+        const DeviceResourceHandle handle2 = uploadAndActivateShader(*testEffect);
+        setMaterial(*testEffect, Vector4(0.f, 1.f, 0.f, 1.f));
+        EXPECT_EQ(green, drawWithActiveShader());
+
+        testDevice->activateShader(handle1);
+        EXPECT_EQ(red, drawWithActiveShader());
+        testDevice->activateShader(handle2);
+        EXPECT_EQ(green, drawWithActiveShader());
+
+        testDevice->deleteShader(handle1);
+        testDevice->deleteShader(handle2);
+    }
+
+    TEST_F(ADeviceSupportingUniformBlocks, StartsWithZeroedUniformBlockForShaderRegisteredAfterDeletingOther)
+    {
+        const std::unique_ptr<EffectResource> testEffect(CreateTestEffectResourceWithUniformBlock());
+        const DeviceResourceHandle handle = uploadAndActivateShader(*testEffect);
+        setMaterial(*testEffect, Vector4(1.f, 0.f, 0.f, 1.f));
+        EXPECT_EQ(red, drawWithActiveShader());
+        testDevice->deleteShader(handle);
+
+        // device handle of deleted shader can be reused, contents of its uniform block must not be
+        const DeviceResourceHandle newHandle = uploadAndActivateShader(*testEffect);
+        EXPECT_EQ((Pixel{ 0u, 0u, 0u, 0u }), drawWithActiveShader());
+
+        testDevice->deleteShader(newHandle);
+    }
 }
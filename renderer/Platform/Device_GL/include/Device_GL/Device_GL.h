@@ -19,6 +19,7 @@
 namespace ramses_internal
 {
     class ShaderGPUResource_GL;
+    struct UniformBlockMemberInfo;
     class RenderBufferGPUResource;
     class IDeviceExtension;
     struct GLTextureInfo;
@@ -94,6 +95,7 @@ namespace ramses_internal
 
         virtual void                    bindTexture         (DeviceResourceHandle handle) override;
         virtual void                    generateMipmaps     (DeviceResourceHandle handle) override;
+        virtual void                    setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                    uploadTextureData   (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const TextureSwizzleArray& swizzle) override;
         virtual void                    deleteTexture       (DeviceResourceHandle handle) override;
@@ -161,6 +163,47 @@ namespace ramses_internal
 
         std::unordered_map<uint64_t, DeviceResourceHandle> m_textureSamplerObjectsCache;
 
+        // uniform blocks of all shaders are uploaded into one ring buffer, which is orphaned when full
+        // so that draw calls already issued keep reading their data while new data is written
+        struct UniformBufferRange
+        {
+            UInt32 generation = 0u;
+            UInt32 offset = 0u;
+            UInt32 size = 0u;
+        };
+        GLHandle                        m_uniformBufferRing = InvalidGLHandle;
+        UInt32                          m_uniformBufferRingSize = 0u;
+        UInt32                          m_uniformBufferRingOffset = 0u;
+        UInt32                          m_uniformBufferRingGeneration = 1u;
+        UInt32                          m_uniformBufferOffsetAlignment = 256u;
+        std::vector<UniformBufferRange> m_boundUniformBufferRanges;
+
+        // CPU side copy of a uniform block of a shader, packed using the block layout of the shader
+        // and uploaded to uniform buffer only when content changed since last upload
+        struct UniformBlockData
+        {
+            UInt32 binding = 0u;
+            std::vector<Byte> data;
+            bool dirty = true;
+            UInt32 uploadedBufferGeneration = 0u;
+            UInt32 uploadedBufferOffset = 0u;
+        };
+
+        // uniform values change with every draw call while shader resource is immutable, device keeps them per shader,
+        // indexed by shader device handle, values last set to each program are cached to skip redundant uploads
+        struct ShaderUniformState
+        {
+            std::vector<UniformBlockData> uniformBlocks;
+            std::vector<std::vector<Byte>> uniformValues;
+        };
+        std::vector<ShaderUniformState> m_shaderUniformStates;
+        ShaderUniformState*             m_activeShaderUniformState = nullptr;
+
+        static Bool SetUniformBlockMemberData(UniformBlockData& block, const UniformBlockMemberInfo& member, UInt32 count, const Byte* data, UInt32 elementSize, UInt32 columnCount);
+        Bool setUniformBlockMember(DataFieldHandle field, UInt32 count, const void* value, UInt32 elementSize, UInt32 columnCount = 1u);
+        void uploadUniformBlocks();
+        Bool hasUniformValueChanged(DataFieldHandle field, UInt32 count, const void* value, UInt32 elementSize);
+
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
         Bool getAttributeLocation(DataFieldHandle field, GLInputLocation& location) const;
 
@@ -114,6 +114,12 @@
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
 #define glGetInternalformativ(...)      glGetInternalformativNative(__VA_ARGS__)
 #define glInvalidateFramebuffer(...)    glInvalidateFramebufferNative(__VA_ARGS__)
+#define glBufferSubData(...)            glBufferSubDataNative(__VA_ARGS__)
+#define glBindBufferRange(...)          glBindBufferRangeNative(__VA_ARGS__)
+#define glGetUniformIndices(...)        glGetUniformIndicesNative(__VA_ARGS__)
+#define glGetActiveUniformsiv(...)      glGetActiveUniformsivNative(__VA_ARGS__)
+#define glGetActiveUniformBlockiv(...)  glGetActiveUniformBlockivNative(__VA_ARGS__)
+#define glUniformBlockBinding(...)      glUniformBlockBindingNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -202,6 +208,12 @@ DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
 DECLARE_API_PROC(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                          \
 DECLARE_API_PROC(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                      \
+DECLARE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DECLARE_API_PROC(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                                  \
+DECLARE_API_PROC(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                              \
+DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                          \
+DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);                  \
+DECLARE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
 
 #define LOAD_ALL_API_PROCS(CONTEXT)                                                               \
 LOAD_API_PROC(CONTEXT, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -290,6 +302,12 @@ LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage
 LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
 LOAD_API_PROC(CONTEXT, PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                      \
 LOAD_API_PROC(CONTEXT, PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                  \
+LOAD_API_PROC(CONTEXT, PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                  \
+LOAD_API_PROC(CONTEXT, PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                              \
+LOAD_API_PROC(CONTEXT, PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                          \
+LOAD_API_PROC(CONTEXT, PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                      \
+LOAD_API_PROC(CONTEXT, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);              \
+LOAD_API_PROC(CONTEXT, PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                      \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -379,5 +397,11 @@ DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
 DEFINE_API_PROC(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                          \
 DEFINE_API_PROC(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                      \
+DEFINE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DEFINE_API_PROC(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                                  \
+DEFINE_API_PROC(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);                              \
+DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);                          \
+DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);                  \
+DEFINE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
 
 #endif
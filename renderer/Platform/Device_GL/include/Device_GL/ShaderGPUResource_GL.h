@@ -12,6 +12,7 @@
 #include "Platform_Base/ShaderGPUResource.h"
 #include "Device_GL/ShaderProgramInfo.h"
 #include "Resource/EffectInputInformation.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -29,6 +30,23 @@ namespace ramses_internal
         EEffectInputTextureType textureType;
     };
 
+    struct UniformBlockMemberInfo
+    {
+        UInt32 blockIndex = InvalidBlockIndex;
+        UInt32 offset = 0u;
+        UInt32 arrayStride = 0u;
+        UInt32 matrixStride = 0u;
+
+        static constexpr UInt32 InvalidBlockIndex = 0xFFFFFFFFu;
+    };
+
+    // layout of a uniform block as reported by GL (std140 for blocks declared as such), contents are kept by device
+    struct UniformBlockInfo
+    {
+        UInt32 binding = 0u;
+        UInt32 size = 0u;
+    };
+
     class ShaderGPUResource_GL : public ShaderGPUResource
     {
     public:
@@ -39,12 +57,17 @@ namespace ramses_internal
         GLInputLocation     getAttributeLocation(DataFieldHandle) const;
         TextureSlotInfo     getTextureSlot(DataFieldHandle) const;
 
+        bool                            isUniformBlockMember(DataFieldHandle field) const;
+        const UniformBlockMemberInfo&   getUniformBlockMember(DataFieldHandle field) const;
+        const std::vector<UniformBlockInfo>& getUniformBlocks() const;
+
         bool                getBinaryInfo(UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
     private:
         void                preloadVariableLocations(const EffectResource& effect);
         GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
+        bool                loadUniformBlockMember(const EffectInputInformation& input, DataFieldHandle field);
 
         ShaderProgramInfo m_shaderProgramInfo;
 
@@ -54,6 +77,10 @@ namespace ramses_internal
         BufferSlotMap    m_bufferSlots;
         InputLocationMap m_uniformLocationMap;
         InputLocationMap m_attributeLocationMap;
+
+        std::vector<UniformBlockMemberInfo> m_uniformBlockMembers;
+        std::vector<GLHandle>               m_uniformBlockGLIndices;
+        std::vector<UniformBlockInfo>       m_uniformBlocks;
     };
 }
 
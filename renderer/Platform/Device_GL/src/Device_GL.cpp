@@ -39,6 +39,8 @@
 #include "PlatformAbstraction/PlatformStringUtils.h"
 #include "PlatformAbstraction/Macros.h"
 
+#include <cstring>
+
 namespace ramses_internal
 {
     static constexpr GLboolean ToGLboolean(bool b)
@@ -46,6 +48,8 @@ namespace ramses_internal
         return b ? GL_TRUE : GL_FALSE;
     }
 
+    static constexpr UInt32 UniformBufferRingMinimumSize = 256u * 1024u;
+
     // TODO Violin move again to other files, once GL headers are consolidated
     struct GLTextureInfo
     {
@@ -121,6 +125,9 @@ namespace ramses_internal
         for (const auto& it : m_textureSamplerObjectsCache)
             deleteTextureSampler(it.second);
 
+        if (m_uniformBufferRing != InvalidGLHandle)
+            glDeleteBuffers(1, &m_uniformBufferRing);
+
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -184,6 +191,8 @@ namespace ramses_internal
             return;
         }
 
+        uploadUniformBlocks();
+
         const UInt startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
         const GLvoid* startOffsetAddress = reinterpret_cast<void*>(startOffsetAddressAsUInt);
 
@@ -200,6 +209,8 @@ namespace ramses_internal
 
     void Device_GL::drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
     {
+        uploadUniformBlocks();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         if (instanceCount > 1u)
         {
@@ -430,10 +441,143 @@ namespace ramses_internal
         return location != GLInputLocationInvalid;
     }
 
+    Bool Device_GL::SetUniformBlockMemberData(UniformBlockData& block, const UniformBlockMemberInfo& member, UInt32 count, const Byte* data, UInt32 elementSize, UInt32 columnCount)
+    {
+        // matrices are stored column by column using matrix stride, array elements using array stride
+        const UInt32 columnSize = elementSize / columnCount;
+        const UInt32 columnStride = (columnCount > 1u ? member.matrixStride : columnSize);
+        const UInt32 elementStride = (member.arrayStride > 0u ? member.arrayStride : columnStride * columnCount);
+        Bool changed = false;
+        for (UInt32 element = 0u; element < count; ++element)
+        {
+            for (UInt32 column = 0u; column < columnCount; ++column)
+            {
+                const UInt32 dstOffset = member.offset + element * elementStride + column * columnStride;
+                if (dstOffset + columnSize > block.data.size())
+                    return changed;
+
+                const Byte* src = data + element * elementSize + column * columnSize;
+                Byte* dst = block.data.data() + dstOffset;
+                // values which do not change between draw calls (e.g. camera matrices) must not trigger re-upload
+                if (std::memcmp(dst, src, columnSize) != 0)
+                {
+                    std::memcpy(dst, src, columnSize);
+                    block.dirty = true;
+                    changed = true;
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    Bool Device_GL::setUniformBlockMember(DataFieldHandle field, UInt32 count, const void* value, UInt32 elementSize, UInt32 columnCount)
+    {
+        assert(nullptr != m_activeShader);
+        if (!m_activeShader->isUniformBlockMember(field))
+            return false;
+
+        assert(nullptr != value);
+        assert(nullptr != m_activeShaderUniformState);
+        const UniformBlockMemberInfo& member = m_activeShader->getUniformBlockMember(field);
+        UniformBlockData& block = m_activeShaderUniformState->uniformBlocks[member.blockIndex];
+        if (SetUniformBlockMemberData(block, member, count, static_cast<const Byte*>(value), elementSize, columnCount))
+            ++m_uploadedUniforms;
+        else
+            ++m_skippedUniforms;
+        return true;
+    }
+
+    Bool Device_GL::hasUniformValueChanged(DataFieldHandle field, UInt32 count, const void* value, UInt32 elementSize)
+    {
+        assert(nullptr != m_activeShaderUniformState);
+        assert(nullptr != value);
+        auto& uniformValues = m_activeShaderUniformState->uniformValues;
+        if (field.asMemoryHandle() >= uniformValues.size())
+            uniformValues.resize(field.asMemoryHandle() + 1u);
+
+        // GL keeps uniform values per program, same value as set last time to this program does not need upload
+        std::vector<Byte>& cachedValue = uniformValues[field.asMemoryHandle()];
+        const UInt32 dataSize = count * elementSize;
+        if (cachedValue.size() == dataSize && std::memcmp(cachedValue.data(), value, dataSize) == 0)
+        {
+            ++m_skippedUniforms;
+            return false;
+        }
+
+        const Byte* data = static_cast<const Byte*>(value);
+        cachedValue.assign(data, data + dataSize);
+        ++m_uploadedUniforms;
+        return true;
+    }
+
+    void Device_GL::uploadUniformBlocks()
+    {
+        assert(nullptr != m_activeShaderUniformState);
+        std::vector<UniformBlockData>& blocks = m_activeShaderUniformState->uniformBlocks;
+        if (blocks.empty())
+            return;
+
+        const auto alignedSize = [this](UInt32 size) { return (size + m_uniformBufferOffsetAlignment - 1u) / m_uniformBufferOffsetAlignment * m_uniformBufferOffsetAlignment; };
+        const auto needsUpload = [this](const UniformBlockData& block) { return block.dirty || block.uploadedBufferGeneration != m_uniformBufferRingGeneration; };
+
+        UInt32 requiredSize = 0u;
+        UInt32 totalSize = 0u;
+        for (const auto& block : blocks)
+        {
+            const UInt32 blockSize = alignedSize(static_cast<UInt32>(block.data.size()));
+            totalSize += blockSize;
+            if (needsUpload(block))
+                requiredSize += blockSize;
+        }
+
+        if (requiredSize > 0u)
+        {
+            if (m_uniformBufferRing == InvalidGLHandle)
+                glGenBuffers(1, &m_uniformBufferRing);
+            glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBufferRing);
+
+            if (m_uniformBufferRingOffset + requiredSize > m_uniformBufferRingSize)
+            {
+                // new storage invalidates all previous uploads, so all blocks of this shader have to fit in
+                m_uniformBufferRingSize = std::max({ m_uniformBufferRingSize, UniformBufferRingMinimumSize, totalSize });
+                glBufferData(GL_UNIFORM_BUFFER, m_uniformBufferRingSize, nullptr, GL_STREAM_DRAW);
+                m_uniformBufferRingOffset = 0u;
+                ++m_uniformBufferRingGeneration;
+            }
+        }
+
+        for (auto& block : blocks)
+        {
+            const UInt32 blockSize = static_cast<UInt32>(block.data.size());
+            if (needsUpload(block))
+            {
+                glBufferSubData(GL_UNIFORM_BUFFER, m_uniformBufferRingOffset, blockSize, block.data.data());
+                block.uploadedBufferGeneration = m_uniformBufferRingGeneration;
+                block.uploadedBufferOffset = m_uniformBufferRingOffset;
+                block.dirty = false;
+                m_uniformBufferRingOffset += alignedSize(blockSize);
+            }
+
+            // binding points are shared by all shaders, rebind only if other range is bound
+            if (block.binding >= m_boundUniformBufferRanges.size())
+                m_boundUniformBufferRanges.resize(block.binding + 1u);
+            UniformBufferRange& boundRange = m_boundUniformBufferRanges[block.binding];
+            if (boundRange.generation != block.uploadedBufferGeneration || boundRange.offset != block.uploadedBufferOffset || boundRange.size != blockSize)
+            {
+                glBindBufferRange(GL_UNIFORM_BUFFER, block.binding, m_uniformBufferRing, block.uploadedBufferOffset, blockSize);
+                boundRange = { block.uploadedBufferGeneration, block.uploadedBufferOffset, blockSize };
+            }
+        }
+    }
+
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Float* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(Float)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(Float)))
         {
             assert(nullptr != value);
             glUniform1fv(uniformLocation.getValue(), count, value);
@@ -442,8 +586,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform2fv(uniformLocation.getValue(), count, value[0].data);
@@ -452,8 +599,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform3fv(uniformLocation.getValue(), count, value[0].data);
@@ -462,8 +612,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform4fv(uniformLocation.getValue(), count, value[0].data);
@@ -472,8 +625,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Int32* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(Int32)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(Int32)))
         {
             assert(nullptr != value);
             glUniform1iv(uniformLocation.getValue(), count, value);
@@ -482,8 +638,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2i* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform2iv(uniformLocation.getValue(), count, value[0].data);
@@ -492,8 +651,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3i* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform3iv(uniformLocation.getValue(), count, value[0].data);
@@ -502,8 +664,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data)))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniform4iv(uniformLocation.getValue(), count, value[0].data);
@@ -512,8 +677,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data), 2u))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniformMatrix2fv(uniformLocation.getValue(), count, ToGLboolean(false), value[0].data);
@@ -522,8 +690,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data), 3u))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniformMatrix3fv(uniformLocation.getValue(), count, ToGLboolean(false), value[0].data);
@@ -532,8 +703,11 @@ namespace ramses_internal
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value)
     {
+        if (setUniformBlockMember(field, count, value, sizeof(value[0].data), 4u))
+            return;
+
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && hasUniformValueChanged(field, count, value, sizeof(value[0].data)))
         {
             assert(nullptr != value);
             glUniformMatrix4fv(uniformLocation.getValue(), count, ToGLboolean(false), value[0].data);
@@ -602,6 +776,12 @@ namespace ramses_internal
         glGenerateMipmap(gpuResource.m_textureInfo.target);
     }
 
+    void Device_GL::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
+        glTexParameteri(gpuResource.m_textureInfo.target, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseMipLevel));
+    }
+
     void Device_GL::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize)
     {
         const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
@@ -1306,8 +1486,13 @@ namespace ramses_internal
         if (m_activeShader == &shaderProgramGL)
         {
             m_activeShader = nullptr;
+            m_activeShaderUniformState = nullptr;
         }
 
+        // handle can be reused for other shader
+        if (handle.asMemoryHandle() < m_shaderUniformStates.size())
+            m_shaderUniformStates[handle.asMemoryHandle()] = {};
+
         m_resourceMapper.deleteResource(handle);
     }
 
@@ -1316,6 +1501,23 @@ namespace ramses_internal
         const ShaderGPUResource_GL& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
         glUseProgram(shaderProgramGL.getGPUAddress());
         m_activeShader = &shaderProgramGL;
+
+        if (handle.asMemoryHandle() >= m_shaderUniformStates.size())
+            m_shaderUniformStates.resize(handle.asMemoryHandle() + 1u);
+        m_activeShaderUniformState = &m_shaderUniformStates[handle.asMemoryHandle()];
+
+        // uniform block contents of shader are created on its first activation
+        auto& uniformBlocks = m_activeShaderUniformState->uniformBlocks;
+        if (uniformBlocks.empty())
+        {
+            for (const auto& blockInfo : shaderProgramGL.getUniformBlocks())
+            {
+                UniformBlockData block;
+                block.binding = blockInfo.binding;
+                block.data.resize(blockInfo.size, 0u);
+                uniformBlocks.push_back(std::move(block));
+            }
+        }
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
@@ -1497,6 +1699,11 @@ namespace ramses_internal
             LOG_WARN(CONTEXT_RENDERER, "Device_GL::queryDeviceDependentFeatures: anisotropic filtering not available on this device");
         }
 
+        GLint uniformBufferOffsetAlignment{ 0 };
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment);
+        if (uniformBufferOffsetAlignment > 0)
+            m_uniformBufferOffsetAlignment = static_cast<UInt32>(uniformBufferOffsetAlignment);
+
         GLint maxDrawBuffers{ 0 };
         glGetIntegerv(GL_MAX_DRAW_BUFFERS, &maxDrawBuffers);
         m_limits.setMaximumDrawBuffers(maxDrawBuffers);
@@ -10,6 +10,7 @@
 #include "Device_GL/Device_GL_platform.h"
 #include "Resource/EffectResource.h"
 #include "Utils/ThreadLocalLogForced.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -63,6 +64,23 @@ namespace ramses_internal
         return slot;
     }
 
+    bool ShaderGPUResource_GL::isUniformBlockMember(DataFieldHandle field) const
+    {
+        assert(field.asMemoryHandle() < m_uniformBlockMembers.size());
+        return m_uniformBlockMembers[field.asMemoryHandle()].blockIndex != UniformBlockMemberInfo::InvalidBlockIndex;
+    }
+
+    const UniformBlockMemberInfo& ShaderGPUResource_GL::getUniformBlockMember(DataFieldHandle field) const
+    {
+        assert(isUniformBlockMember(field));
+        return m_uniformBlockMembers[field.asMemoryHandle()];
+    }
+
+    const std::vector<UniformBlockInfo>& ShaderGPUResource_GL::getUniformBlocks() const
+    {
+        return m_uniformBlocks;
+    }
+
     void ShaderGPUResource_GL::preloadVariableLocations(const EffectResource& effect)
     {
         const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
@@ -73,6 +91,7 @@ namespace ramses_internal
 
         m_attributeLocationMap.resize(vertexInputCount);
         m_uniformLocationMap.resize(globalInputCount);
+        m_uniformBlockMembers.resize(globalInputCount);
 
         for (UInt32 i = 0u; i < vertexInputCount; ++i)
         {
@@ -91,12 +110,65 @@ namespace ramses_internal
                 bufferSlot.textureType = GetTextureTypeFromDataType(input.dataType);
                 m_bufferSlots.put(DataFieldHandle(i), bufferSlot);
             }
+            else if (loadUniformBlockMember(input, DataFieldHandle(i)))
+            {
+                // block members have no location, they are set via uniform buffer
+                m_uniformLocationMap[i] = GLInputLocationInvalid;
+                continue;
+            }
 
             const GLInputLocation location = loadUniformLocation(effect, input);
             m_uniformLocationMap[i] = location;
         }
     }
 
+    bool ShaderGPUResource_GL::loadUniformBlockMember(const EffectInputInformation& input, DataFieldHandle field)
+    {
+        const GLHandle program = m_shaderProgramInfo.shaderProgramHandle;
+        const GLchar* varName = input.inputName.c_str();
+        GLuint uniformIndex = GL_INVALID_INDEX;
+        glGetUniformIndices(program, 1, &varName, &uniformIndex);
+        if (uniformIndex == GL_INVALID_INDEX)
+            return false;
+
+        GLint glBlockIndex = -1;
+        glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_BLOCK_INDEX, &glBlockIndex);
+        if (glBlockIndex < 0)
+            return false;
+
+        GLint offset = 0;
+        GLint arrayStride = 0;
+        GLint matrixStride = 0;
+        glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_OFFSET, &offset);
+        glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_ARRAY_STRIDE, &arrayStride);
+        glGetActiveUniformsiv(program, 1, &uniformIndex, GL_UNIFORM_MATRIX_STRIDE, &matrixStride);
+
+        auto blockIt = std::find(m_uniformBlockGLIndices.cbegin(), m_uniformBlockGLIndices.cend(), static_cast<GLHandle>(glBlockIndex));
+        if (blockIt == m_uniformBlockGLIndices.cend())
+        {
+            GLint blockSize = 0;
+            glGetActiveUniformBlockiv(program, glBlockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+
+            // binding points are assigned per program in order of first use, device rebinds buffer ranges when program changes
+            UniformBlockInfo block;
+            block.binding = static_cast<UInt32>(m_uniformBlocks.size());
+            block.size = static_cast<UInt32>(blockSize);
+            glUniformBlockBinding(program, glBlockIndex, block.binding);
+
+            m_uniformBlocks.push_back(block);
+            m_uniformBlockGLIndices.push_back(static_cast<GLHandle>(glBlockIndex));
+            blockIt = std::prev(m_uniformBlockGLIndices.cend());
+        }
+
+        UniformBlockMemberInfo& member = m_uniformBlockMembers[field.asMemoryHandle()];
+        member.blockIndex = static_cast<UInt32>(std::distance(m_uniformBlockGLIndices.cbegin(), blockIt));
+        member.offset = static_cast<UInt32>(offset);
+        member.arrayStride = static_cast<UInt32>(arrayStride);
+        member.matrixStride = static_cast<UInt32>(matrixStride);
+
+        return true;
+    }
+
     GLInputLocation ShaderGPUResource_GL::loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const
     {
         const Char* varName = input.inputName.c_str();
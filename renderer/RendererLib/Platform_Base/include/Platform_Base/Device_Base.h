@@ -24,6 +24,8 @@ namespace ramses_internal
 
         // from IDevice
         virtual uint32_t getAndResetDrawCallCount() override;
+        virtual uint32_t getAndResetUploadedUniformCount() override;
+        virtual uint32_t getAndResetSkippedUniformCount() override;
         virtual void     drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
         virtual void     drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
         virtual uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
@@ -36,6 +38,8 @@ namespace ramses_internal
 
         RendererLimits m_limits;
         UInt32 m_drawCalls = 0u;
+        UInt32 m_uploadedUniforms = 0u;
+        UInt32 m_skippedUniforms = 0u;
     };
 }
 
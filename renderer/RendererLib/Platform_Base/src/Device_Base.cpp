@@ -47,4 +47,18 @@ namespace ramses_internal
         m_drawCalls = 0u;
         return dc;
     }
+
+    uint32_t Device_Base::getAndResetUploadedUniformCount()
+    {
+        const auto count = m_uploadedUniforms;
+        m_uploadedUniforms = 0u;
+        return count;
+    }
+
+    uint32_t Device_Base::getAndResetSkippedUniformCount()
+    {
+        const auto count = m_skippedUniforms;
+        m_skippedUniforms = 0u;
+        return count;
+    }
 }
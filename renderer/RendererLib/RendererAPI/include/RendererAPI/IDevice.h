@@ -106,6 +106,7 @@ namespace ramses_internal
 
         virtual void                    bindTexture                 (DeviceResourceHandle handle) = 0;
         virtual void                    generateMipmaps             (DeviceResourceHandle handle) = 0;
+        virtual void                    setTextureBaseMipLevel      (DeviceResourceHandle handle, UInt32 baseMipLevel) = 0;
         virtual void                    uploadTextureData           (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) = 0;
         virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const TextureSwizzleArray& swizzle) = 0;
         virtual void                    deleteTexture               (DeviceResourceHandle handle) = 0;
@@ -141,6 +142,8 @@ namespace ramses_internal
 
         virtual uint32_t getTotalGpuMemoryUsageInKB() const = 0;
         virtual uint32_t getAndResetDrawCallCount() = 0;
+        virtual uint32_t getAndResetUploadedUniformCount() = 0;
+        virtual uint32_t getAndResetSkippedUniformCount() = 0;
 
         virtual void    validateDeviceStatusHealthy() const = 0;
         virtual bool    isDeviceStatusHealthy() const = 0;
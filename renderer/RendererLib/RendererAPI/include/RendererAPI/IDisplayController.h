@@ -24,6 +24,7 @@ namespace ramses_internal
     class WarpingMeshData;
     class ProjectionParams;
     class FrameTimer;
+    class RenderPassCostEstimator;
 
     class IDisplayController
     {
@@ -34,7 +35,7 @@ namespace ramses_internal
         virtual Bool                    canRenderNewFrame() const = 0;
         virtual void                    enableContext() = 0;
         virtual void                    swapBuffers() = 0;
-        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr) = 0;
+        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr, RenderPassCostEstimator* passCostEstimator = nullptr) = 0;
         virtual void                    executePostProcessing() = 0;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, uint32_t clearFlags, const Vector4& clearColor) = 0;
 
@@ -49,6 +50,11 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
+
+        // returns number of GPU state changes avoided by sorting draw calls since last call
+        virtual UInt32                  getAndResetStateChangesSavedByDrawCallSorting() = 0;
+        virtual UInt32                  getAndResetCulledRenderables() = 0;
+        virtual UInt32                  getAndResetDrawCallsSavedByBatching() = 0;
     };
 }
 
@@ -40,6 +40,9 @@ namespace ramses_internal
     using StreamBufferHandle = TypedMemoryHandle<StreamBufferHandleTag>;
     struct ExternalTextureHandleTag {};
     using ExternalBufferHandle = TypedMemoryHandle<ExternalTextureHandleTag>;
+    struct RenderableBatchHandleTag {};
+    using RenderableBatchHandle = TypedMemoryHandle<RenderableBatchHandleTag>;
+    using RenderableBatchHandleVector = std::vector<RenderableBatchHandle>;
 
     struct DmaBufferFourccFormatTag{};
     using DmaBufferFourccFormat = StronglyTypedValue<uint32_t, std::numeric_limits<uint32_t>::max(), DmaBufferFourccFormatTag>;
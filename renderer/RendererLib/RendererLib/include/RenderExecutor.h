@@ -10,6 +10,7 @@
 #define RAMSES_RENDEREXECUTOR_H
 
 #include "RenderExecutorInternalState.h"
+#include "RendererLib/RenderableBatchCache.h"
 #include "SceneAPI/EDataType.h"
 #include "SceneAPI/EFixedSemantics.h"
 
@@ -19,13 +20,25 @@ namespace ramses_internal
     struct RenderingContext;
     class FrameTimer;
     class IScene;
+    class RenderPassCostEstimator;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr);
+        // If sortDrawCallsByState is enabled, renderables which can be rendered in any order (same render group and same order)
+        // are sorted by shader, textures, vertex array and render state to minimize state changes, redundant texture and
+        // vertex array activations are then skipped.
+        // If passCostEstimator is given, cost of executed passes is recorded to it and together with frameTimer
+        // it is used to interrupt rendering before a pass which is not expected to fit into remaining time budget
+        RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr, bool sortDrawCallsByState = false, RenderPassCostEstimator* passCostEstimator = nullptr);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
+        // Number of shader, texture, vertex array and render state changes avoided by sorting draw calls
+        UInt32 getStateChangesSavedBySorting() const;
+        // Number of renderables skipped because they were outside of camera frustum in passes with frustum culling enabled
+        UInt32 getCulledRenderables() const;
+        // Number of draw calls avoided by drawing batches of renderables with merged geometry
+        UInt32 getDrawCallsSavedByBatching() const;
 
         // This is exposed and can be modified but acts as a global parameter
         static constexpr const UInt32 DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks = 10u;
@@ -54,6 +67,13 @@ namespace ramses_internal
         Bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
         bool canDiscardDepthBuffer() const;
+        const RenderableVector& getRenderablesSortedByState(const RendererCachedScene& scene, const RenderPassHandle pass) const;
+        const RenderableBatchCache::Batch* findBatchToDraw(const RendererCachedScene& scene, RenderPassHandle pass, const RenderableVector& renderables, UInt32 renderableIdx) const;
+        void executeBatch(const RenderableBatchCache::Batch& batch) const;
+        bool shouldDeferRenderPass(const RendererCachedScene& scene, RenderPassHandle pass) const;
+
+        const bool m_sortDrawCallsByState;
+        RenderPassCostEstimator* const m_passCostEstimator;
 
         static RenderBufferHandle FindDepthRenderBufferInRenderTarget(const IScene& scene, RenderTargetHandle renderTarget);
     };
@@ -12,6 +12,7 @@
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
 #include "SceneAPI/Handles.h"
+#include "SceneAPI/SceneTypes.h"
 #include "SceneAPI/Viewport.h"
 #include "RendererAPI/SceneRenderExecutionIterator.h"
 #include "RendererAPI/RenderingContext.h"
@@ -120,10 +121,14 @@ namespace ramses_internal
         RenderableHandle           getRenderable() const;
 
         Bool hasExceededTimeBudgetForRendering() const;
+        std::chrono::microseconds getRemainingTimeBudgetForRendering() const;
 
         CachedState < DeviceResourceHandle >    shaderDeviceHandle;
         DeviceResourceHandle                    vertexArrayDeviceHandle;
         bool                                    vertexArrayUsesIndices = false;
+        UInt32                                  drawStartIndex = 0u;
+        UInt32                                  drawIndexCount = 0u;
+        UInt32                                  drawInstanceCount = 1u;
         CachedState < ScissorState >            scissorState;
         CachedState < EDepthFunc >              depthFuncState;
         CachedState < EDepthWrite >             depthWriteState;
@@ -140,6 +145,14 @@ namespace ramses_internal
 
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
+        // used only when sorting draw calls by state
+        std::vector<TextureSamplerHandle>       boundTextureSamplers;
+        DeviceResourceHandle                    boundVertexArrayDeviceHandle;
+        UInt32                                  stateChangesSavedBySorting = 0u;
+
+        UInt32                                  culledRenderables = 0u;
+        UInt32                                  drawCallsSavedByBatching = 0u;
+
     private:
         IDevice&                    m_device;
         const RendererCachedScene*  m_scene;
@@ -219,6 +232,11 @@ namespace ramses_internal
     {
         return m_frameTimer != nullptr ? m_frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : false;
     }
+
+    inline std::chrono::microseconds RenderExecutorInternalState::getRemainingTimeBudgetForRendering() const
+    {
+        return m_frameTimer != nullptr ? m_frameTimer->getRemainingTimeBudgetForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : std::chrono::microseconds::max();
+    }
 }
 
 #endif
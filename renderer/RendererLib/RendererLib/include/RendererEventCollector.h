@@ -41,6 +41,7 @@ namespace ramses_internal
         void addStreamSourceEvent(ERendererEventType eventType, WaylandIviSurfaceId streamSourceId);
         void addPickedEvent(ERendererEventType eventType, const SceneId& sceneId, PickableObjectIds&& pickedObjectIds);
         void addFrameTimingReport(DisplayHandle display, bool isFirstDisplay, std::chrono::microseconds maxLoopTime, std::chrono::microseconds avgLooptime);
+        void addGpuMemoryBudgetExceededEvent(DisplayHandle display, UInt64 usedBytes, UInt64 budgetBytes);
 
     private:
         void pushToRendererEventQueue(RendererEvent&& newEvent);
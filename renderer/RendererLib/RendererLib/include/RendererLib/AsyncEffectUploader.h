@@ -17,6 +17,7 @@
 #include <future>
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
 
 namespace ramses_internal
 {
@@ -29,6 +30,31 @@ namespace ramses_internal
     using EffectsGpuResources = std::vector<std::pair<ResourceContentHash, std::unique_ptr<const GPUResource>>>;
     using EffectsRawResources = std::vector<const EffectResource*>;
 
+    struct EffectUploadRequest
+    {
+        const EffectResource* effect;
+        // lower value is uploaded first, same meaning as scene priority in DisplayConfig
+        Int32 priority;
+    };
+    using EffectUploadRequests = std::vector<EffectUploadRequest>;
+
+    struct EffectUploadTimes
+    {
+        // time spent in compiling and uploading the shader
+        std::chrono::microseconds uploadTime;
+        // time since effect was submitted until its upload finished
+        std::chrono::microseconds latency;
+    };
+
+    struct EffectsSyncResult
+    {
+        EffectsGpuResources uploaded;
+        // same order as uploaded
+        std::vector<EffectUploadTimes> uploadTimes;
+        // effects which were cancelled before their upload started
+        ResourceContentHashVector cancelled;
+    };
+
     class AsyncEffectUploader : private Runnable
     {
     public:
@@ -39,10 +65,22 @@ namespace ramses_internal
         void destroyResourceUploadRenderBackendAndStopThread();
 
         void sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut);
+        // Pending effects are uploaded one by one in order of their priority, effects of same priority in order of submission.
+        // Cancelled effects are reported as cancelled if their upload did not start yet, otherwise they are reported as uploaded.
+        void sync(const EffectUploadRequests& effectsToUpload, const ResourceContentHashVector& effectsToCancel, EffectsSyncResult& resultOut);
 
     private:
+        struct PendingEffect
+        {
+            const EffectResource* effect;
+            Int32 priority;
+            UInt64 submissionIndex;
+            std::chrono::steady_clock::time_point submissionTime;
+        };
+
         virtual void run() override;
-        void uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        void uploadEffectOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        static bool IsUploadedLater(const PendingEffect& a, const PendingEffect& b);
 
         IPlatform& m_platform;
         IRenderBackend& m_renderBackend;
@@ -51,10 +89,10 @@ namespace ramses_internal
         mutable std::mutex m_mutex;
         std::condition_variable m_sleepConditionVar;
 
-        EffectsRawResources m_effectsToUpload;
-        EffectsGpuResources m_effectsUploaded;
-
-        EffectsGpuResources m_effectsUploadedCache; //to avoid acquiring mutex twice in resource upload thread
+        // heap ordered by priority, next effect to upload at front
+        std::vector<PendingEffect> m_effectsToUpload;
+        UInt64 m_submissionCounter = 0u;
+        EffectsSyncResult m_syncResult;
 
         std::promise<bool> m_creationSuccess;
 
@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGVOLUME_H
+#define RAMSES_BOUNDINGVOLUME_H
+
+#include "SceneAPI/EDataType.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Matrix44f.h"
+#include <array>
+
+namespace ramses_internal
+{
+    class ArrayResource;
+
+    // Axis aligned box in model space of renderable, half extents are negative if bounds are not known
+    struct BoundingVolume
+    {
+        Vector3 center{ 0.f };
+        Vector3 halfExtents{ -1.f };
+
+        bool isValid() const
+        {
+            return halfExtents.x >= 0.f;
+        }
+
+        // only tightly packed vec3/vec4 float vertex arrays are supported, returns invalid volume otherwise
+        static BoundingVolume FromVertexArray(const ArrayResource& vertexArray);
+        static BoundingVolume FromPositions(const Float* positions, UInt32 vertexCount, UInt32 componentsPerVertex);
+    };
+
+    class ViewFrustum
+    {
+    public:
+        explicit ViewFrustum(const Matrix44f& viewProjectionMatrix);
+
+        // conservative test of model space volume transformed by model matrix, invalid volume is never outside
+        bool isOutside(const BoundingVolume& volume, const Matrix44f& modelMatrix) const;
+
+    private:
+        // plane (a, b, c, d) with normal pointing inside of frustum, point is inside if a*x + b*y + c*z + d >= 0
+        std::array<Vector4, 6u> m_planes;
+    };
+}
+
+#endif
@@ -114,6 +114,25 @@ namespace ramses_internal
         void setResourceUploadBatchSize(uint32_t batchSize);
         uint32_t getResourceUploadBatchSize() const;
 
+        void setTransformationUpdateThreadCount(uint32_t threadCount);
+        uint32_t getTransformationUpdateThreadCount() const;
+
+        void setDrawCallSortingEnabled(bool enabled);
+        bool isDrawCallSortingEnabled() const;
+
+        void setDrawCallBatchingEnabled(bool enabled);
+        bool isDrawCallBatchingEnabled() const;
+
+        void setResourceDecompressionThreadCount(uint32_t threadCount);
+        uint32_t getResourceDecompressionThreadCount() const;
+
+        void setResourceDiskCache(const String& filePath, UInt64 maxSize);
+        const String& getResourceDiskCacheFilePath() const;
+        UInt64 getResourceDiskCacheMaxSize() const;
+
+        void setTextureStreamingEnabled(bool enabled);
+        bool isTextureStreamingEnabled() const;
+
         Bool operator==(const DisplayConfig& other) const;
         Bool operator!=(const DisplayConfig& other) const;
 
@@ -154,6 +173,13 @@ namespace ramses_internal
         int32_t m_swapInterval = -1;
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
         uint32_t m_resourceUploadBatchSize = 10u;
+        uint32_t m_transformationUpdateThreadCount = 0u;
+        bool m_drawCallSortingEnabled = false;
+        bool m_drawCallBatchingEnabled = false;
+        uint32_t m_resourceDecompressionThreadCount = 0u;
+        String m_resourceDiskCacheFilePath;
+        UInt64 m_resourceDiskCacheMaxSize = 0u;
+        bool m_textureStreamingEnabled = false;
     };
 }
 
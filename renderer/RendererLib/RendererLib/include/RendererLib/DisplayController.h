@@ -30,13 +30,13 @@ namespace ramses_internal
         friend class RendererLogger;
 
     public:
-        explicit DisplayController(IRenderBackend& renderer, UInt32 samples = 1, UInt32 postProcessingEffectIds = EPostProcessingEffect_None);
+        explicit DisplayController(IRenderBackend& renderer, UInt32 samples = 1, UInt32 postProcessingEffectIds = EPostProcessingEffect_None, bool drawCallSortingEnabled = false);
 
         virtual void                    handleWindowEvents() override;
         virtual Bool                    canRenderNewFrame() const override;
         virtual void                    enableContext() override;
         virtual void                    swapBuffers() override;
-        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr) override;
+        virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr, RenderPassCostEstimator* passCostEstimator = nullptr) override;
         virtual void                    executePostProcessing() override;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, uint32_t clearFlags, const Vector4& clearColor) override;
 
@@ -51,6 +51,9 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
 
         virtual void validateRenderingStatusHealthy() const override;
+        virtual UInt32 getAndResetStateChangesSavedByDrawCallSorting() override;
+        virtual UInt32 getAndResetCulledRenderables() override;
+        virtual UInt32 getAndResetDrawCallsSavedByBatching() override;
 
     private:
         IRenderBackend&         m_renderBackend;
@@ -61,6 +64,11 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+
+        const bool              m_drawCallSortingEnabled;
+        UInt32                  m_stateChangesSavedByDrawCallSorting = 0u;
+        UInt32                  m_culledRenderables = 0u;
+        UInt32                  m_drawCallsSavedByBatching = 0u;
     };
 }
 
@@ -61,6 +61,12 @@ namespace ramses_internal
             return m_sectionBudgets[static_cast<size_t>(section)];
         }
 
+        std::chrono::microseconds getRemainingTimeBudgetForSection(EFrameTimerSectionBudget section) const
+        {
+            const auto sectionDuration = std::chrono::duration_cast<Duration>(Clock::now() - m_frameStartTimeStamp);
+            return std::max(m_sectionBudgets[static_cast<size_t>(section)] - sectionDuration, Duration(0));
+        }
+
         Clock::time_point getFrameStartTime() const
         {
             return m_frameStartTimeStamp;
@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GPUMEMORYBUDGET_H
+#define RAMSES_GPUMEMORYBUDGET_H
+
+#include "SceneAPI/ResourceContentHash.h"
+#include "SceneAPI/SceneId.h"
+#include "Resource/ResourceTypes.h"
+#include "Collections/HashMap.h"
+#include "PlatformAbstraction/Macros.h"
+#include <array>
+#include <unordered_map>
+
+namespace ramses_internal
+{
+    // Tracks GPU memory used by uploaded client resources against a budget (display's GPU memory cache size).
+    // Resources are accounted with the VRAM size reported by their upload, or with their decompressed size
+    // if upload did not report any (e.g. for buffers whose size on GPU equals data size).
+    //
+    // Eviction order of unused resources is least recently used first, weighted by priority of the scenes which
+    // used the resource: resources of less important scenes (higher priority value) are evicted before resources
+    // of more important scenes, regardless of when they became unused.
+    //
+    // Usage is also accounted per scene: every uploaded resource counts fully for each scene using it, so sum of
+    // per scene usages can exceed total usage if resources are shared.
+    //
+    // Scene resources (render buffers, texture buffers, data buffers) and offscreen buffers are not tracked, neither
+    // in total nor per scene or per type: they are not evictable and stay allocated as long as their scene is mapped
+    // or until the offscreen buffer is destroyed, their memory is sampled separately (see GpuMemorySample).
+    class GpuMemoryBudget
+    {
+    public:
+        explicit GpuMemoryBudget(UInt64 budget);
+
+        void onResourceUploaded(const ResourceContentHash& hash, EResourceType type, UInt32 size, Int32 scenePriority, const SceneIdVector& sceneUsage);
+        void onResourceUnloaded(const ResourceContentHash& hash);
+        // resource got used by scene with given priority, eviction priority is raised if scene is more important
+        void onResourceUsedByScene(const ResourceContentHash& hash, SceneId sceneId, Int32 scenePriority);
+        // resource is not used by scene anymore (all its references from the scene were removed)
+        void onResourceUnusedByScene(const ResourceContentHash& hash, SceneId sceneId);
+
+        RNODISCARD bool isEnabled() const;
+        RNODISCARD UInt64 getBudget() const;
+        RNODISCARD UInt64 getUsage() const;
+        RNODISCARD UInt64 getUsage(EResourceType type) const;
+        RNODISCARD UInt64 getUsage(SceneId sceneId) const;
+        // scenes which use or used uploaded resources, scenes whose resources were all unloaded or unused are kept with zero usage
+        RNODISCARD const std::unordered_map<SceneId, UInt64>& getUsagePerScene() const;
+        RNODISCARD UInt32 getResourceSize(const ResourceContentHash& hash) const;
+        // amount of memory to be freed so that resources of given size fit in budget, max value if budget is disabled
+        RNODISCARD UInt64 getAmountOfMemoryToBeFreed(UInt64 sizeToUpload) const;
+
+        // Sorts unused resources (given in order they became unused) in order they should be evicted,
+        // resources not tracked by budget (i.e. not uploaded) are kept at their position relative to others of priority 0
+        void sortByEvictionOrder(ResourceContentHashVector& unusedResources) const;
+
+        // Budget is under pressure if it is still exceeded after unused resources were evicted, i.e. resources
+        // in use by scenes do not fit in it. Returns true only when pressure starts, not while it lasts.
+        bool updatePressureState();
+        RNODISCARD bool isUnderPressure() const;
+
+    private:
+        struct Entry
+        {
+            EResourceType type;
+            UInt32 size;
+            Int32 scenePriority;
+            SceneIdVector scenes;
+        };
+
+        void addSceneUsage(Entry& entry, SceneId sceneId);
+
+        const UInt64 m_budget;
+        UInt64 m_usage = 0u;
+        std::array<UInt64, EResourceType_NUMBER_OF_ELEMENTS> m_usagePerType{};
+        std::unordered_map<SceneId, UInt64> m_usagePerScene;
+        HashMap<ResourceContentHash, Entry> m_entries;
+        bool m_underPressure = false;
+    };
+}
+
+#endif
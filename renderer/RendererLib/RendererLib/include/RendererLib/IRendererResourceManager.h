@@ -24,7 +24,9 @@
 namespace ramses_internal
 {
     struct RenderTarget;
+    struct RenderableBatchInfo;
     class IRendererResourceCache;
+    class GpuMemoryBudget;
     enum class EDataBufferType : UInt8;
 
     struct StreamUsage
@@ -46,6 +48,10 @@ namespace ramses_internal
         virtual void             provideResourceData(const ManagedResource& mr) = 0;
         virtual Bool             hasResourcesToBeUploaded() const = 0;
         virtual void             uploadAndUnloadPendingResources() = 0;
+        virtual const SceneIdVector& getScenesWithStreamedTextureUpdates() const = 0;
+        // true if resources in use exceeded GPU memory cache size for the first time in last uploadAndUnloadPendingResources
+        virtual bool             hasGpuMemoryBudgetBeenExceeded() const = 0;
+        virtual const GpuMemoryBudget& getGpuMemoryBudget() const = 0;
 
         // Scene resources
         virtual void             uploadRenderTargetBuffer(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer) = 0;
@@ -70,6 +76,12 @@ namespace ramses_internal
         virtual void             uploadVertexArray(RenderableHandle renderableHandle, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId) = 0;
         virtual void             unloadVertexArray(RenderableHandle renderableHandle, SceneId sceneId) = 0;
 
+        virtual void             uploadRenderableBatch(RenderableBatchHandle batchHandle, const RenderableBatchInfo& batchInfo, SceneId sceneId) = 0;
+        virtual void             unloadRenderableBatch(RenderableBatchHandle batchHandle, SceneId sceneId) = 0;
+        // geometry data is kept in system memory after upload while draw call batching is enabled, this releases it for resources
+        // used by scene unless contained in given sorted list of resources still needed to merge batches
+        virtual void             releaseGeometryDataNotNeededForBatching(SceneId sceneId, const ResourceContentHashVector& sortedGeometryOfPendingBatches) = 0;
+
         virtual void             unloadAllSceneResourcesForScene(SceneId sceneId) = 0;
         virtual void             unreferenceAllResourcesForScene(SceneId sceneId) = 0;
         virtual const ResourceContentHashVector* getResourcesInUseByScene(SceneId sceneId) const = 0;
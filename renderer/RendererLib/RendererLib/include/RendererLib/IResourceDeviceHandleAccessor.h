@@ -13,6 +13,7 @@
 #include "SceneAPI/Handles.h"
 #include "SceneAPI/SceneId.h"
 #include "RendererAPI/Types.h"
+#include "RendererLib/BoundingVolume.h"
 
 namespace ramses_internal
 {
@@ -37,6 +38,8 @@ namespace ramses_internal
         virtual DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle textureBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle renderableHandle, SceneId sceneId) const = 0;
+        virtual DeviceResourceHandle getRenderableBatchDeviceHandle(RenderableBatchHandle batchHandle, SceneId sceneId) const = 0;
+        virtual BoundingVolume       getResourceBoundingVolume(const ResourceContentHash& resourceHash) const = 0;
     };
 }
 #endif
@@ -19,6 +19,7 @@
 namespace ramses_internal
 {
     class IResource;
+    class TextureResource;
     class IRenderBackend;
     struct ResourceDescriptor;
 
@@ -30,6 +31,12 @@ namespace ramses_internal
         virtual absl::optional<DeviceResourceHandle> uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, UInt32& outVRAMSize) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
         virtual void                 storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) = 0;
+
+        // allocates all mip levels of texture but uploads only levels starting from firstMipLevel, which becomes the base level to sample from
+        virtual DeviceResourceHandle uploadTextureFromMipLevel(IRenderBackend& renderBackend, const TextureResource& texture, UInt32 firstMipLevel, UInt32& outVRAMSize) = 0;
+        // uploads rows [firstRow, firstRow + rowCount) of single mip level of texture uploaded by uploadTextureFromMipLevel,
+        // level becomes the base level when its last row is uploaded (see ResourceUploader::GetTextureMipLevelRowCount)
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle handle, const TextureResource& texture, UInt32 mipLevel, UInt32 firstRow, UInt32 rowCount) = 0;
     };
 }
 
@@ -70,6 +70,7 @@ namespace ramses_internal
         virtual DeviceResourceHandle getEmptyExternalTexture() const override;
         virtual void                 bindTexture(DeviceResourceHandle handle) override;
         virtual void                 generateMipmaps(DeviceResourceHandle handle) override;
+        virtual void                 setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                 uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const TextureSwizzleArray& swizzle) override;
         virtual void deleteTexture(DeviceResourceHandle handle) override;
@@ -102,6 +103,8 @@ namespace ramses_internal
 
         virtual uint32_t getTotalGpuMemoryUsageInKB() const override;
         virtual uint32_t getAndResetDrawCallCount() override;
+        virtual uint32_t getAndResetUploadedUniformCount() override;
+        virtual uint32_t getAndResetSkippedUniformCount() override;
 
         virtual void clearDepth(Float d) override;
         virtual void clearStencil(Int32 s) override;
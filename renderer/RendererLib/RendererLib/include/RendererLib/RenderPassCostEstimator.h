@@ -0,0 +1,50 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERPASSCOSTESTIMATOR_H
+#define RAMSES_RENDERPASSCOSTESTIMATOR_H
+
+#include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
+#include "Collections/HashMap.h"
+#include <chrono>
+
+namespace ramses_internal
+{
+    // Learns cost of executing render passes from previous frames, used to predict whether a pass
+    // still fits into remaining time budget of interruptible offscreen buffer rendering
+    class RenderPassCostEstimator
+    {
+    public:
+        // weight of newest measurement in moving averages
+        static constexpr Float SmoothingFactor = 0.25f;
+
+        // cost must be measured for pass executed as a whole (i.e. not interrupted or resumed in the middle)
+        void recordPassCost(SceneId sceneId, RenderPassHandle pass, UInt32 renderableCount, std::chrono::microseconds cost);
+
+        // Returns averaged cost of pass measured in previous frames, if pass was never measured it is estimated
+        // from average cost of a renderable in any pass. Zero if nothing was measured yet.
+        std::chrono::microseconds estimatePassCost(SceneId sceneId, RenderPassHandle pass, UInt32 renderableCount) const;
+
+        void removeScene(SceneId sceneId);
+
+    private:
+        struct PassCost
+        {
+            Float averageMicrosec = 0.f;
+            bool measured = false;
+        };
+        using PassCosts = std::vector<PassCost>;
+
+        HashMap<SceneId, PassCosts> m_passCosts;
+        Float m_averageRenderableCostMicrosec = 0.f;
+        bool m_renderableCostMeasured = false;
+    };
+}
+
+#endif
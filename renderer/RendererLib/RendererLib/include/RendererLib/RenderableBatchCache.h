@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERABLEBATCHCACHE_H
+#define RAMSES_RENDERABLEBATCHCACHE_H
+
+#include "RendererAPI/Types.h"
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Collections/HashMap.h"
+
+namespace ramses_internal
+{
+    class RendererCachedScene;
+
+    // Tracks runs of consecutive renderables in render passes which can be drawn by single draw call because they share
+    // effect, uniforms, render state and world transformation and differ only in geometry. Once a run stayed unchanged
+    // for several scene updates its geometry is merged into one vertex array and the run is drawn as a batch.
+    class RenderableBatchCache
+    {
+    public:
+        // number of consecutive scene updates a run must stay unchanged before its geometry gets merged
+        static constexpr UInt32 StableUpdatesBeforeMerging = 10u;
+
+        struct Member
+        {
+            RenderableHandle renderable;
+            UInt32 vertexArrayRevision = 0u;
+            UInt32 startIndex = 0u;
+            UInt32 indexCount = 0u;
+
+            bool operator==(const Member& other) const
+            {
+                return renderable == other.renderable && vertexArrayRevision == other.vertexArrayRevision
+                    && startIndex == other.startIndex && indexCount == other.indexCount;
+            }
+        };
+        using Members = std::vector<Member>;
+
+        struct Batch
+        {
+            RenderPassHandle pass;
+            Members members;
+            UInt32 stableUpdates = 0u;
+            bool uploaded = false;
+            // invalid if batch is not uploaded yet or its geometry could not be merged
+            DeviceResourceHandle vertexArray;
+            UInt32 drawCount = 0u;
+            bool usesIndexArray = false;
+            UInt32 lastUpdate = 0u;
+        };
+
+        // Finds runs of batchable renderables in scene's render passes, batches whose run changed or disappeared are
+        // put to batchesToUnload, batches which became stable are put to batchesToUpload
+        void update(const RendererCachedScene& scene, RenderableBatchHandleVector& batchesToUnload, RenderableBatchHandleVector& batchesToUpload);
+        void setBatchVertexArray(RenderableBatchHandle batch, DeviceResourceHandle vertexArray);
+        // batch taken from batchesToUpload but not uploaded (e.g. frame time budget exceeded), it is put there again in next update
+        void postponeUpload(RenderableBatchHandle batch);
+        void reset();
+
+        const Batch& getBatch(RenderableBatchHandle batch) const;
+        // returns batch containing renderable in pass only if batch has merged geometry ready to be drawn
+        const Batch* findMergedBatch(RenderPassHandle pass, RenderableHandle renderable) const;
+        // true if there are batches waiting to become stable, these need update even if scene is not modified
+        bool hasPendingBatches() const;
+        // changes whenever a batch gets or loses merged geometry
+        UInt32 getMergedBatchesRevision() const;
+        // geometry resources of batches not merged yet, their data has to stay in system memory until batch is uploaded
+        void collectGeometryOfPendingBatches(const RendererCachedScene& scene, ResourceContentHashVector& geometry) const;
+
+    private:
+        void collectRunsInPass(const RendererCachedScene& scene, RenderPassHandle pass);
+        void processRun(const RendererCachedScene& scene, RenderPassHandle pass, Members& run, RenderableBatchHandleVector& batchesToUnload, RenderableBatchHandleVector& batchesToUpload);
+        void releaseBatch(RenderableBatchHandle batchHandle);
+        RenderableBatchHandle findBatch(RenderPassHandle pass, RenderableHandle renderable) const;
+
+        static bool IsBatchable(const RendererCachedScene& scene, RenderableHandle renderable);
+        static bool CanBeBatchedTogether(const RendererCachedScene& scene, RenderableHandle first, RenderableHandle other);
+        static bool HasListDrawMode(const RendererCachedScene& scene, RenderableHandle renderable);
+
+        HashMap<RenderableBatchHandle, Batch> m_batches;
+        // batch of each renderable per pass, indexed by pass handle
+        std::vector<HashMap<RenderableHandle, RenderableBatchHandle>> m_batchOfRenderable;
+        RenderableBatchHandle m_nextBatchHandle{ 0u };
+        UInt32 m_updateCounter = 0u;
+        UInt32 m_mergedBatchesRevision = 0u;
+
+        // runs found in current update, members only to avoid allocations
+        std::vector<std::pair<RenderPassHandle, Members>> m_runs;
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERABLEBATCHGEOMETRY_H
+#define RAMSES_RENDERABLEBATCHGEOMETRY_H
+
+#include "SceneAPI/EDataType.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class ArrayResource;
+
+    // Geometry resources of renderables which are to be drawn by single draw call
+    struct RenderableBatchInfo
+    {
+        struct Member
+        {
+            ResourceContentHash indices;
+            ResourceContentHashVector vertexAttributes;
+            UInt32 startVertex = 0u;
+            UInt32 startIndex = 0u;
+            UInt32 indexCount = 0u;
+        };
+
+        ResourceContentHash effect;
+        // buffer data type of each vertex attribute, same for all members
+        std::vector<EDataType> vertexAttributeTypes;
+        std::vector<Member> members;
+    };
+
+    // Vertex and index data of batch members merged into one buffer per attribute and one index buffer,
+    // indices are rebased so that single draw call of drawCount indices (or vertices if not indexed) renders all members
+    struct RenderableBatchGeometry
+    {
+        struct MemberData
+        {
+            const ArrayResource* indices = nullptr;
+            std::vector<const ArrayResource*> vertexAttributes;
+            UInt32 startVertex = 0u;
+            UInt32 startIndex = 0u;
+            UInt32 indexCount = 0u;
+        };
+
+        // returns false if members' data do not match each other or their draw ranges are out of bounds
+        static bool Merge(const std::vector<MemberData>& members, RenderableBatchGeometry& geometryOut);
+
+        EDataType indexType = EDataType::Invalid;
+        std::vector<Byte> indexData;
+        std::vector<std::vector<Byte>> vertexData;
+        UInt32 drawCount = 0u;
+    };
+}
+
+#endif
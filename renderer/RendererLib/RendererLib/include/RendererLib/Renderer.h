@@ -14,6 +14,7 @@
 #include "RendererAPI/EDeviceTypeId.h"
 #include "RendererLib/RendererStatistics.h"
 #include "RendererLib/FrameProfilerStatistics.h"
+#include "RendererLib/RenderPassCostEstimator.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
 #include "RendererLib/DisplayEventHandler.h"
@@ -137,6 +138,7 @@ namespace ramses_internal
         MemoryStatistics                       m_memoryStatistics;
 
         RendererInterruptState                 m_rendererInterruptState;
+        RenderPassCostEstimator                m_passCostEstimator;
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                m_expirationMonitor;
 
@@ -10,20 +10,42 @@
 #define RAMSES_RENDERERCACHEDSCENE_H
 
 #include "RendererLib/TextureLinkCachedScene.h"
+#include "RendererLib/RenderableBatchCache.h"
 #include "RenderingPassInfo.h"
+#include <limits>
+#include <array>
 
 namespace ramses_internal
 {
     class IResourceDeviceHandleAccessor;
+    class ITaskQueue;
 
     class RendererCachedScene final : public TextureLinkCachedScene
     {
     public:
+        // [begin, end) index range into ordered renderables of a pass
+        using RenderableIndexRange = std::pair<UInt32, UInt32>;
+        using RenderableIndexRanges = std::vector<RenderableIndexRange>;
+
+        // Ordered renderables of a pass with reorderable ranges sorted by draw state, filled in by updateDrawStateSorting
+        struct DrawStateSortedRenderables
+        {
+            RenderableVector renderables;
+            UInt32 stateChangesSaved = 0u;
+            bool valid = false;
+        };
+
         explicit RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo = SceneInfo());
 
         void updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager);
         void updateRenderableWorldMatrices();
+        // Sorts reorderable ranges of all rendered passes whose draw state sorting is not valid,
+        // to be called after renderable resources and merged batches were updated
+        void updateDrawStateSorting();
         void updateRenderableWorldMatricesWithLinks();
+        // Produces same results as updateRenderableWorldMatrices, dirty node chains which do not share any node
+        // are computed in parallel using given task queue (e.g. ThreadedTaskExecutor with workerCount threads)
+        void updateRenderableWorldMatricesParallel(ITaskQueue& taskQueue, UInt32 workerCount);
 
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
@@ -48,12 +70,16 @@ namespace ramses_internal
         bool hasActiveShaderAnimation() const;
 
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
+        virtual void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
 
         virtual void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         virtual void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order) override;
         virtual void                        removeRenderableFromRenderGroup (RenderGroupHandle groupHandle, RenderableHandle renderableHandle) override;
 
+        virtual RenderPassHandle            allocateRenderPass              (UInt32 renderGroupCount = 0u, RenderPassHandle passHandle = RenderPassHandle::Invalid()) override;
         virtual void                        releaseRenderPass               (RenderPassHandle passHandle) override;
+        virtual void                        setRenderPassCamera             (RenderPassHandle passHandle, CameraHandle cameraHandle) override;
         virtual void                        setRenderPassRenderOrder        (RenderPassHandle passHandle, Int32 renderOrder) override;
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, Bool isEnabled) override;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, Bool enable) override;
@@ -70,26 +96,117 @@ namespace ramses_internal
 
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
+        // Ranges of ordered renderables (at least 2) which were added to same render group with same order,
+        // their relative order is not defined and they can be rendered in any order
+        const RenderableIndexRanges&        getReorderableRenderableRangesForPass(RenderPassHandle pass) const;
+        // Cached draw state sorting of a pass, it is invalidated when renderables of the pass change or when render state,
+        // effect, texture, vertex array or merged batch of any renderable in scene might have changed
+        const DrawStateSortedRenderables&   getDrawStateSortedRenderablesForPass(RenderPassHandle pass) const;
         const Matrix44f&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
+        // batches of renderables drawn with merged geometry, maintained only if draw call batching is enabled
+        const RenderableBatchCache&         getRenderableBatches            () const;
+        RenderableBatchCache&               getRenderableBatches            ();
+
     private:
+        static constexpr UInt32 InvalidSpanIndex = std::numeric_limits<UInt32>::max();
+        // above this number of renderables waiting for insertion the affected passes are rebuilt instead
+        static constexpr UInt32 MaxPendingRenderableInsertions = 1000u;
+
+        // Range of ordered renderables of a pass which come from a render group (including its nested groups)
+        struct RenderGroupSpan
+        {
+            RenderGroupHandle renderGroup;
+            Int32 order;                    // order of group within parent group or pass
+            UInt32 parentSpan;              // InvalidSpanIndex for groups directly in pass
+            UInt32 descendantSpanCount;     // nested group spans directly follow the span of their parent
+            UInt32 begin;
+            UInt32 end;
+        };
+
+        // Group span a renderable was added from, its order within that group and its position in group's renderables,
+        // position breaks ties between entries the comparator considers equal
+        struct RenderableOrigin
+        {
+            UInt32 span;
+            Int32 order;
+            UInt32 groupIndex;
+        };
+
+        struct PassRenderables
+        {
+            RenderableVector renderables;
+            std::vector<RenderableOrigin> origins;
+            std::vector<RenderGroupSpan> groupSpans;
+            // index to groupSpans, InvalidSpanIndex if group appears more than once in pass
+            HashMap<RenderGroupHandle, UInt32> groupSpanIndices;
+            RenderableIndexRanges reorderableRanges;
+            DrawStateSortedRenderables drawStateSorted;
+            Bool needsRebuild = true;
+            Bool changed = false;
+        };
+
+        struct PendingRenderableInsertion
+        {
+            RenderGroupHandle renderGroup;
+            RenderableHandle renderable;
+            Int32 order;
+        };
+
         void updatePassRenderableSorting();
-        void updateRenderablesInPass(RenderPassHandle passHandle);
-        void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        void rebuildRenderablesInPass(RenderPassHandle passHandle);
+        void addRenderablesFromRenderGroup(PassRenderables& passRenderables, RenderGroupHandle renderGroupHandle, Int32 order, UInt32 parentSpan);
+        void sortRenderablesOfRenderGroup(RenderGroupHandle renderGroup, RenderableOrderVector& renderables);
+        // group renderables moved, position of each is looked up by its previous position
+        void updateRenderGroupIndicesInValidPasses(RenderGroupHandle renderGroup, const std::vector<UInt32>& newGroupIndices);
+        void updateReorderableRanges(PassRenderables& passRenderables) const;
+        void invalidateOutdatedDrawStateSorting();
+        void invalidateDrawStateSorting();
         Bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void collectIndependentWorldMatrixUpdateGroups();
+        void updateWorldMatricesForGroups(UInt32 firstGroup, UInt32 endGroup, NodeHandleVector& dirtyNodesBuffer);
+
+        // incremental maintenance of ordered renderables of passes which do not need rebuild
+        Bool isRenderGroupInAnyValidPass(RenderGroupHandle renderGroup) const;
+        void markPassesContainingRenderGroupForRebuild(RenderGroupHandle renderGroup);
+        void scheduleRenderableInsertion(RenderGroupHandle renderGroup, RenderableHandle renderable, Int32 order);
+        void insertPendingRenderables();
+        void insertRenderableIntoPass(PassRenderables& passRenderables, UInt32 spanIdx, RenderableHandle renderable, Int32 order) const;
+        void removeRenderableFromPasses(RenderGroupHandle renderGroup, RenderableHandle renderable, Int32 order);
 
         RenderingPassInfoVector m_sortedRenderingPasses;
-        using PassRenderableOrder = std::vector<RenderableVector>;
-        PassRenderableOrder     m_passRenderableOrder;
-        mutable Bool            m_renderableOrderingDirty;
+        std::vector<PassRenderables> m_passRenderables;
+        mutable Bool            m_renderingPassesDirty;
+
+        // groups (and order within group) each renderable was added to, indexed by renderable handle
+        std::vector<RenderGroupOrderVector> m_renderableGroups;
+        std::vector<PendingRenderableInsertion> m_pendingRenderableInsertions;
 
         using MatrixVector = std::vector<Matrix44f>;
         MatrixVector            m_renderableMatrices;
 
+        // parallel world matrix update, members only to avoid allocations
+        struct DirtyRenderableChain
+        {
+            RenderableHandle renderable;
+            NodeHandle topDirtyNode;
+            NodeHandle subtreeRootNode;
+        };
+        std::vector<DirtyRenderableChain> m_dirtyRenderableChains;
+        std::vector<RenderableVector> m_worldMatrixUpdateGroups;
+        UInt32 m_worldMatrixUpdateGroupCount = 0u;
+        HashMap<NodeHandle, UInt32> m_subtreeRootToUpdateGroup;
+        std::vector<NodeHandleVector> m_dirtyNodesBuffers;
+
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
 
         bool m_hasActiveShaderAnimation = false;
+
+        // revisions of renderable resources and merged batches draw state sorting of passes is based on
+        std::array<UInt32, 2u> m_drawStateSortingRevisions{};
+
+        RenderableBatchCache m_renderableBatches;
     };
 
     inline void RendererCachedScene::setActiveShaderAnimation(bool hasAnimation)
@@ -101,6 +218,16 @@ namespace ramses_internal
     {
         return m_hasActiveShaderAnimation;
     }
+
+    inline const RenderableBatchCache& RendererCachedScene::getRenderableBatches() const
+    {
+        return m_renderableBatches;
+    }
+
+    inline RenderableBatchCache& RendererCachedScene::getRenderableBatches()
+    {
+        return m_renderableBatches;
+    }
 }
 
 #endif
@@ -93,6 +93,7 @@ namespace ramses_internal
         StreamBufferDisabled,
         ObjectsPicked,
         FrameTimingReport,
+        GpuMemoryBudgetExceeded,
         NUMBER_OF_ELEMENTS
     };
 
@@ -160,6 +161,7 @@ namespace ramses_internal
         "StreamBufferDisabled",
         "ObjectsPicked",
         "FrameTimingReport",
+        "GpuMemoryBudgetExceeded",
     };
 
     struct MouseEvent
@@ -193,6 +195,12 @@ namespace ramses_internal
         std::chrono::microseconds averageLoopTimeWithinPeriod;
     };
 
+    struct GpuMemoryUsage
+    {
+        UInt64 usedBytes;
+        UInt64 budgetBytes;
+    };
+
     struct RendererEvent
     {
         RendererEvent(ERendererEventType type = ERendererEventType::Invalid, SceneId sId = {})  //NOLINT(google-explicit-constructor) for RendererEventVector creation convenience
@@ -222,6 +230,7 @@ namespace ramses_internal
         WaylandIviSurfaceId         streamSourceId;
         PickableObjectIds           pickedObjectIds;
         FrameTimings                frameTimings;
+        GpuMemoryUsage              gpuMemoryUsage;
         bool                        isFirstDisplay;
         int                         dmaBufferFD = -1;
         uint32_t                    dmaBufferStride = 0u;
@@ -50,6 +50,9 @@ namespace ramses_internal
         virtual void                 provideResourceData(const ManagedResource& mr) override;
         virtual Bool                 hasResourcesToBeUploaded() const override;
         virtual void                 uploadAndUnloadPendingResources() override;
+        virtual const SceneIdVector& getScenesWithStreamedTextureUpdates() const override;
+        virtual bool                 hasGpuMemoryBudgetBeenExceeded() const override;
+        virtual const GpuMemoryBudget& getGpuMemoryBudget() const override;
 
         virtual DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& hash) const override;
         virtual EResourceStatus      getResourceStatus(const ResourceContentHash& hash) const override;
@@ -95,6 +98,11 @@ namespace ramses_internal
         virtual void                 uploadVertexArray(RenderableHandle renderableHandle, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId) override;
         virtual void                 unloadVertexArray(RenderableHandle renderableHandle, SceneId sceneId) override;
         virtual DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle renderableHandle, SceneId sceneId) const override;
+        virtual void                 uploadRenderableBatch(RenderableBatchHandle batchHandle, const RenderableBatchInfo& batchInfo, SceneId sceneId) override;
+        virtual void                 unloadRenderableBatch(RenderableBatchHandle batchHandle, SceneId sceneId) override;
+        virtual void                 releaseGeometryDataNotNeededForBatching(SceneId sceneId, const ResourceContentHashVector& sortedGeometryOfPendingBatches) override;
+        virtual DeviceResourceHandle getRenderableBatchDeviceHandle(RenderableBatchHandle batchHandle, SceneId sceneId) const override;
+        virtual BoundingVolume       getResourceBoundingVolume(const ResourceContentHash& hash) const override;
 
         virtual void                 unloadAllSceneResourcesForScene(SceneId sceneId) override;
         virtual void                 unreferenceAllResourcesForScene(SceneId sceneId) override;
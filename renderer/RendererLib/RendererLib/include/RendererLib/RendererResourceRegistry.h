@@ -24,7 +24,13 @@ namespace ramses_internal
 
         void                       setResourceData      (const ResourceContentHash& hash, const ManagedResource& resourceObject);
         void                       setResourceScheduledForUpload(const ResourceContentHash& hash);
-        void                       setResourceUploaded  (const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize);
+        // returns resource to provided state, resource is unregistered if not used by any scene anymore
+        void                       setResourceUploadCancelled(const ResourceContentHash& hash);
+        // resource data is released from system memory unless keepResourceData is set
+        void                       setResourceUploaded  (const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize, bool keepResourceData = false);
+        // releases resource data kept in system memory after upload
+        void                       releaseResourceData  (const ResourceContentHash& hash);
+        void                       setResourceBoundingVolume(const ResourceContentHash& hash, const BoundingVolume& boundingVolume);
         void                       setResourceBroken    (const ResourceContentHash& hash);
 
         void                       addResourceRef       (const ResourceContentHash& hash, SceneId sceneId);
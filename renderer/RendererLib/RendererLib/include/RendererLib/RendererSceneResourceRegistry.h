@@ -33,6 +33,15 @@ namespace ramses_internal
     class RendererSceneResourceRegistry
     {
     public:
+        // device resources holding merged geometry of renderable batch, all invalid if geometry could not be merged
+        struct RenderableBatchEntry
+        {
+            DeviceResourceHandle vertexArray;
+            DeviceResourceHandle indexBuffer;
+            DeviceHandleVector vertexBuffers;
+            UInt32 size = 0u;
+        };
+
         RendererSceneResourceRegistry();
         ~RendererSceneResourceRegistry();
 
@@ -75,6 +84,11 @@ namespace ramses_internal
         DeviceResourceHandle            getVertexArrayDeviceHandle(RenderableHandle renderableHandle) const;
         void                            getAllVertexArrayRenderables(RenderableVector& vertexArrayRenderables) const;
 
+        void                            addRenderableBatch(RenderableBatchHandle batchHandle, const RenderableBatchEntry& entry);
+        void                            removeRenderableBatch(RenderableBatchHandle batchHandle);
+        const RenderableBatchEntry&     getRenderableBatch(RenderableBatchHandle batchHandle) const;
+        void                            getAllRenderableBatches(RenderableBatchHandleVector& batches) const;
+
         UInt32                          getSceneResourceMemoryUsage(ESceneResourceType resourceType) const;
 
     private:
@@ -113,6 +127,7 @@ namespace ramses_internal
         using TextureBufferMap       = HashMap<TextureBufferHandle,  TextureBufferEntry>;
         using TextureSamplerMap      = HashMap<TextureSamplerHandle, DeviceResourceHandle>;
         using VertexArrayMap         = HashMap<RenderableHandle,   DeviceResourceHandle>;
+        using RenderableBatchMap     = HashMap<RenderableBatchHandle, RenderableBatchEntry>;
 
         RenderBufferMap        m_renderBuffers;
         RenderTargetMap        m_renderTargets;
@@ -121,6 +136,7 @@ namespace ramses_internal
         DataBufferMap          m_dataBuffers;
         TextureBufferMap       m_textureBuffers;
         VertexArrayMap         m_vertexArrays;
+        RenderableBatchMap     m_renderableBatches;
     };
 }
 
@@ -21,6 +21,7 @@
 #include "RendererLib/IRendererResourceManager.h"
 #include "Scene/EScenePublicationMode.h"
 #include "AsyncEffectUploader.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
 #include <unordered_map>
 
 namespace ramses_internal
@@ -140,6 +141,8 @@ namespace ramses_internal
         void processStagedResourceChangesFromAppliedFlushes();
         void handleECStreamAvailabilityChanges();
         void uploadAndUnloadVertexArrays();
+        void updateRenderableBatches();
+        void updateDrawStateSorting();
         void updateScenesResourceCache();
         void updateScenesRendererAnimations();
         void updateScenesTransformationCache();
@@ -172,6 +175,10 @@ namespace ramses_internal
 
         std::unique_ptr<IRendererResourceManager> m_displayResourceManager;
         std::unique_ptr<AsyncEffectUploader> m_asyncEffectUploader;
+        std::unique_ptr<ThreadedTaskExecutor> m_transformationUpdateExecutor;
+        UInt32 m_transformationUpdateThreadCount = 0u;
+        bool m_drawCallBatchingEnabled = false;
+        bool m_drawCallSortingEnabled = false;
 
         struct SceneMapRequest
         {
@@ -197,6 +204,10 @@ namespace ramses_internal
         // keep as members to avoid runtime re-allocs
         StreamSourceUpdates m_streamUpdates;
         RenderableVector m_tempRenderablesWithUpdatedVertexArrays;
+        RenderableBatchHandleVector m_tempRenderableBatchesToUnload;
+        RenderableBatchHandleVector m_tempRenderableBatchesToUpload;
+        SceneIdVector m_tempScenesWithUpdatedBatches;
+        ResourceContentHashVector m_tempGeometryOfPendingBatches;
     };
 }
 
@@ -40,7 +40,14 @@ namespace ramses_internal
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
         void streamTextureUpdated(WaylandIviSurfaceId sourceId, UInt numUpdates);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, const String& name, SceneId sceneid);
+        // time since shader was submitted for compilation until it was compiled
+        void shaderCompileLatency(std::chrono::microseconds latency);
         void setVRAMUsage(uint64_t totalUploaded, uint64_t gpuCacheSize);
+        void setVRAMUsagePerType(uint64_t textures, uint64_t geometry, uint64_t effects);
+        // GPU memory of uploaded resources used by scene, resources shared by scenes count for each of them
+        void setSceneVRAMUsage(SceneId sceneId, uint64_t usage);
+        // resources in use did not fit in GPU memory cache size
+        void gpuMemoryBudgetExceeded();
 
         void untrackScene(SceneId sceneId);
         void untrackOffscreenBuffer(DeviceResourceHandle offscreenBuffer);
@@ -48,6 +55,19 @@ namespace ramses_internal
 
         void addExpirationOffset(SceneId sceneId, int64_t expirationOffset);
 
+        void uniformsUploaded(UInt32 uploadedCount, UInt32 skippedCount);
+        UInt32 getUploadedUniformsPerFrame() const;
+        UInt32 getSkippedUniformsPerFrame() const;
+
+        void drawCallsSorted(UInt32 stateChangesSaved);
+        UInt32 getStateChangesSavedByDrawCallSortingPerFrame() const;
+
+        void renderablesCulled(UInt32 culledCount);
+        UInt32 getCulledRenderablesPerFrame() const;
+
+        void renderablesBatched(UInt32 drawCallsSaved);
+        UInt32 getDrawCallsSavedByBatchingPerFrame() const;
+
         void frameFinished(UInt32 drawCalls);
         void reset();
 
@@ -57,6 +77,11 @@ namespace ramses_internal
         Int32 m_frameNumber = 0;
         UInt64 m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         UInt32 m_drawCalls = 0u;
+        UInt32 m_stateChangesSavedByDrawCallSorting = 0u;
+        UInt32 m_culledRenderables = 0u;
+        UInt32 m_drawCallsSavedByBatching = 0u;
+        UInt32 m_uploadedUniforms = 0u;
+        UInt32 m_skippedUniforms = 0u;
         UInt64 m_lastFrameTick = 0u;
         UInt32 m_frameDurationMin = std::numeric_limits<UInt32>::max();
         UInt32 m_frameDurationMax = 0u;
@@ -65,10 +90,17 @@ namespace ramses_internal
         UInt m_shadersCompiled = 0u;
         uint64_t m_totalResourceUploadedSize = 0u;
         uint64_t m_gpuCacheSize = 0u;
+        uint64_t m_textureResourceUploadedSize = 0u;
+        uint64_t m_geometryResourceUploadedSize = 0u;
+        uint64_t m_effectResourceUploadedSize = 0u;
+        UInt m_gpuMemoryBudgetExceeded = 0u;
         UInt64 m_microsecondsForShaderCompilation = 0u;
         String m_maximumDurationShaderName;
         std::chrono::microseconds m_maximumDurationShaderTime = {};
         SceneId m_maximumDurationShaderScene;
+        UInt m_shaderCompileLatencies = 0u;
+        UInt64 m_microsecondsShaderCompileLatency = 0u;
+        std::chrono::microseconds m_maximumShaderCompileLatency = {};
 
         struct SceneStatistics
         {
@@ -97,6 +129,7 @@ namespace ramses_internal
 
             UInt sceneResourcesUploaded = 0u;
             UInt sceneResourcesBytesUploaded = 0u;
+            uint64_t vramUsage = 0u;
 
             UInt numRendered = 0u;
         };
@@ -11,6 +11,7 @@
 
 #include "RendererAPI/Types.h"
 #include "RendererLib/DataReferenceLinkCachedScene.h"
+#include "RendererLib/BoundingVolume.h"
 
 namespace ramses_internal
 {
@@ -21,6 +22,10 @@ namespace ramses_internal
     {
         DeviceResourceHandle deviceHandle;
         bool usesIndexArray = false;
+        // model space bounds of vertex positions, invalid if they cannot be determined
+        BoundingVolume boundingVolume;
+        // incremented whenever vertex array is updated, allows to detect geometry changes even if device handle gets reused
+        UInt32 revision = 0u;
     };
     using VertexArrayCache = std::vector<VertexArrayCacheEntry>;
 
@@ -57,6 +62,8 @@ namespace ramses_internal
         Bool                                renderableResourcesDirty    (const RenderableVector& handles) const;
 
         DeviceResourceHandle                getRenderableEffectDeviceHandle(RenderableHandle renderable) const;
+        // changes whenever cached effect, texture or vertex array device handles of any renderable were updated
+        UInt32                              getRenderableResourcesRevision() const;
         const VertexArrayCache&             getCachedHandlesForVertexArrays() const;
         const DeviceHandleVector&           getCachedHandlesForTextureSamplers() const;
         const DeviceHandleVector&           getCachedHandlesForRenderTargets() const;
@@ -92,6 +99,7 @@ namespace ramses_internal
         Bool checkAndUpdateEffectResource(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         Bool checkAndUpdateTextureResources(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager, RenderableHandle renderable);
         bool checkGeometryResources(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
+        BoundingVolume getRenderableBoundingVolume(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable) const;
         void checkAndUpdateRenderTargetResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void checkAndUpdateBlitPassResources(const IResourceDeviceHandleAccessor& resourceAccessor);
 
@@ -115,6 +123,7 @@ namespace ramses_internal
 
         Bool m_renderTargetsDirty = false;
         Bool m_blitPassesDirty = false;
+        UInt32 m_renderableResourcesRevision = 0u;
     };
 }
 
@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEDECOMPRESSIONSTAGE_H
+#define RAMSES_RESOURCEDECOMPRESSIONSTAGE_H
+
+#include "Components/ManagedResource.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Collections/HashSet.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+
+namespace ramses_internal
+{
+    // Decompresses resources in worker threads ahead of their upload, so that render thread
+    // only needs to pass already decompressed data to device.
+    // All methods are to be called from render thread only.
+    class ResourceDecompressionStage
+    {
+    public:
+        explicit ResourceDecompressionStage(UInt32 threadCount);
+        ~ResourceDecompressionStage();
+
+        // Starts decompression of resource in worker thread if it is compressed and not decompressed yet.
+        // Returns true if resource is being decompressed, i.e. it is not ready for upload yet.
+        bool prepare(const ResourceContentHash& hash, const ManagedResource& resource);
+
+        // Marks resources decompressed by worker threads since last call as ready
+        void collectFinished();
+
+        UInt32 getPendingCount() const;
+
+        // resources decompressed by workers, shared with tasks, defined in implementation
+        struct FinishedResources;
+
+    private:
+        std::shared_ptr<FinishedResources> m_finished;
+        HashSet<ResourceContentHash> m_pending;
+        ResourceContentHashVector m_finishedTemp;
+
+        ThreadedTaskExecutor m_executor;
+    };
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define RAMSES_RESOURCEDESCRIPTOR_H
 
 #include "RendererLib/EResourceStatus.h"
+#include "RendererLib/BoundingVolume.h"
 #include "Resource/ResourceTypes.h"
 #include "RendererAPI/Types.h"
 #include "SceneAPI/SceneId.h"
@@ -30,6 +31,8 @@ namespace ramses_internal
         UInt32 compressedSize = 0;
         UInt32 decompressedSize = 0;
         UInt32 vramSize = 0;
+        // only for vertex arrays, kept after resource data is released from system memory
+        BoundingVolume boundingVolume;
     };
 
     using ResourceDescriptors = HashMap<ResourceContentHash, ResourceDescriptor>;
@@ -0,0 +1,118 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEDISKCACHE_H
+#define RAMSES_RESOURCEDISKCACHE_H
+
+#include "Components/ManagedResource.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Collections/String.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "Utils/File.h"
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+
+namespace ramses_internal
+{
+    class MemoryMappedFile;
+
+    // Persistent cache of decompressed resources, keyed by resource content hash. Resources stored in one
+    // run are served in later runs directly from memory mapped cache file, so that they do not need to be
+    // decompressed again before upload.
+    //
+    // Cache file is an append-only sequence of checksummed records. Records are appended by a writer thread,
+    // a truncated or corrupt tail (e.g. after power loss) is dropped when file is opened, checksum of record
+    // is verified when it is loaded first. Least recently used records are dropped when size limit is exceeded.
+    // Usage and drop of records are marked in file by writer thread right away, so that they survive a crash,
+    // space of dropped records is reclaimed by compacting file when it is opened, so that it does not exceed
+    // size limit then. Until then file grows to at most twice the size limit, resources are not stored anymore
+    // when that is reached.
+    //
+    // All methods except the writer task are to be called from render thread only.
+    class ResourceDiskCache
+    {
+    public:
+        ResourceDiskCache(String filePath, UInt64 maxSizeInBytes);
+        ~ResourceDiskCache();
+
+        ResourceDiskCache(const ResourceDiskCache&) = delete;
+        ResourceDiskCache& operator=(const ResourceDiskCache&) = delete;
+
+        // Returns decompressed resource referencing the cache file, or null if resource was not cached
+        // when cache was opened or its record is corrupt
+        ManagedResource load(const ResourceContentHash& hash);
+
+        // Schedules writing of decompressed resource to cache file in writer thread, resource is kept alive until written
+        void store(const ManagedResource& resource);
+
+        RNODISCARD bool contains(const ResourceContentHash& hash) const;
+        RNODISCARD UInt64 getCachedSize() const;
+
+        // blocks until all scheduled resources were written
+        void flush();
+
+        // record layout, defined in implementation
+        struct RecordHeader;
+
+    private:
+        struct Entry
+        {
+            UInt64 offset;
+            UInt32 dataSize;
+            UInt32 checksum;
+            UInt64 lastUsed;
+            bool mapped;
+            bool verified;
+        };
+
+        class WriteTask;
+        class UpdateRecordsTask;
+
+        void open();
+        void recreateFile();
+        void scanRecords();
+        bool compactMappedFile();
+        void write(const IResource& resource);
+        void evictLeastRecentlyUsed(const ResourceContentHash& keep);
+        void removeEntry(const ResourceContentHash& hash);
+        void dropRecord(const ResourceContentHash& hash, UInt64 offset);
+        void markRecordUsed(const ResourceContentHash& hash);
+        void scheduleRecordUpdates();
+        void writeRecordUpdates();
+
+        const String m_filePath;
+        const UInt64 m_maxSize;
+
+        std::shared_ptr<const MemoryMappedFile> m_mappedFile;
+        File m_file;
+        bool m_fileValid = false;
+        UInt64 m_fileEnd = 0u;
+        UInt64 m_generation = 0u;
+
+        // guards index, pending set and record updates, which are accessed from writer thread too
+        mutable std::mutex m_lock;
+        HashMap<ResourceContentHash, Entry> m_entries;
+        HashSet<ResourceContentHash> m_pending;
+        // signalled when pending set becomes empty
+        std::condition_variable m_pendingWritten;
+        UInt64 m_cachedSize = 0u;
+        UInt64 m_deadSize = 0u;
+        // offsets of records to be marked in file by writer thread
+        std::vector<UInt64> m_usedRecords;
+        std::vector<UInt64> m_droppedRecords;
+        bool m_recordUpdatesScheduled = false;
+
+        ThreadedTaskExecutor m_writer;
+    };
+}
+
+#endif
@@ -28,9 +28,16 @@ namespace ramses_internal
         virtual absl::optional<DeviceResourceHandle> uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& rd, UInt32& outVRAMSize) override;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
         void                         storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) override;
+        virtual DeviceResourceHandle uploadTextureFromMipLevel(IRenderBackend& renderBackend, const TextureResource& texture, UInt32 firstMipLevel, UInt32& outVRAMSize) override;
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle handle, const TextureResource& texture, UInt32 mipLevel, UInt32 firstRow, UInt32 rowCount) override;
+
+        // rows a mip level can be uploaded in: image rows of 2D texture and of each face of cube texture, depth slices of 3D texture,
+        // compressed texture has single row as its blocks cannot be split
+        static UInt32 GetTextureMipLevelRowCount(const TextureResource& texture, UInt32 mipLevel);
 
     private:
-        DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize);
+        static DeviceResourceHandle UploadTexture(IDevice& device, const TextureResource& texture, UInt32 firstMipLevel, UInt32& vramSize);
+        static void UploadTextureMipLevelData(IDevice& device, DeviceResourceHandle handle, const TextureResource& texture, UInt32 mipLevel, UInt32 firstRow, UInt32 rowCount);
         DeviceResourceHandle queryBinaryShaderCache(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
 
         static UInt32 EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate);
@@ -12,8 +12,12 @@
 #include "RendererLib/ResourceDescriptor.h"
 #include "RendererLib/IResourceUploader.h"
 #include "RendererLib/AsyncEffectUploader.h"
+#include "RendererLib/ResourceDecompressionStage.h"
+#include "RendererLib/ResourceDiskCache.h"
+#include "RendererLib/GpuMemoryBudget.h"
 #include "Collections/HashMap.h"
 #include <map>
+#include <deque>
 
 namespace ramses_internal
 {
@@ -40,6 +44,32 @@ namespace ramses_internal
         Bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
 
+        // Raises eviction priority of uploaded resource if it got used by more important scene than before
+        // and accounts it in scene's GPU memory usage
+        void onResourceUsedByScene(const ResourceContentHash& hash, SceneId sceneId);
+        // Removes resource from scene's GPU memory usage if scene does not reference it anymore
+        void onResourceUnreferencedByScene(const ResourceContentHash& hash, SceneId sceneId);
+
+        // True if resources in use exceeded GPU memory cache size for the first time in last uploadAndUnloadPendingResources
+        bool hasGpuMemoryBudgetBeenExceeded() const
+        {
+            return m_gpuMemoryBudgetExceeded;
+        }
+
+        const GpuMemoryBudget& getGpuMemoryBudget() const
+        {
+            return m_gpuMemoryBudget;
+        }
+
+        // Returns decompressed copy of resource from disk cache, null if disk cache is disabled or does not have it
+        ManagedResource loadFromDiskCache(const ResourceContentHash& hash);
+
+        // Scenes using textures which got another mip level streamed in last uploadAndUnloadPendingResources
+        const SceneIdVector& getScenesWithStreamedTextureUpdates() const
+        {
+            return m_scenesWithStreamedTextureUpdates;
+        }
+
         UInt32 getResourceUploadBatchSize() const
         {
             return m_resourceUploadBatchSize;
@@ -51,33 +81,62 @@ namespace ramses_internal
         void unloadResources(const ResourceContentHashVector& resourcesToUnload);
         void uploadResources(const ResourceContentHashVector& resourcesToUpload);
         void syncEffects();
+        void collectEffectsToCancel();
         void uploadResource(const ResourceDescriptor& rd);
+        void uploadStreamedTextureMipLevels(bool checkTimeLimitBeforeFirst);
+        UInt32 getFirstMipLevelToUpload(const IResource& resource) const;
         void unloadResource(const ResourceDescriptor& rd);
         void getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const;
-        void getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
+        void getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize);
         Int32 getScenePriority(const ResourceDescriptor& rd) const;
-        UInt64 getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const;
+        Int32 getScenePriority(SceneId sceneId) const;
+        Int32 getHighestScenePriority(const ResourceDescriptor& rd) const;
+        void uploadedToGpuMemory(const ResourceDescriptor& rd, UInt32 vramSize);
 
         RendererResourceRegistry& m_resources;
         std::unique_ptr<IResourceUploader> m_uploader;
         IRenderBackend&                 m_renderBackend;
         AsyncEffectUploader&            m_asyncEffectUploader;
-        EffectsRawResources             m_effectsToUpload;
-        EffectsGpuResources             m_effectsUploadedTemp; //to avoid re-allocation each frame
+        EffectUploadRequests            m_effectsToUpload;
+        ResourceContentHashVector       m_effectsToCancel;
+        EffectsSyncResult               m_effectsSyncResultTemp; //to avoid re-allocation each frame
+        // effects uploaded by async effect uploader, value is set once their upload was requested to be cancelled
+        HashMap<ResourceContentHash, bool> m_effectsScheduledForUpload;
 
         const Bool   m_keepEffects;
+        // geometry data is needed in system memory to merge geometry of batched renderables
+        const bool   m_keepGeometryResourceData;
         const FrameTimer& m_frameTimer;
+        // decompresses provided resources in worker threads, null if decompression is done right before upload
+        std::unique_ptr<ResourceDecompressionStage> m_decompressionStage;
+        // keeps decompressed resources across runs, null if not configured
+        std::unique_ptr<ResourceDiskCache> m_diskCache;
+
+        // textures uploaded with their smallest mip levels only, remaining levels are uploaded from smallest to largest,
+        // each in pieces of rows which are not considered large resource
+        struct StreamedTexture
+        {
+            ResourceContentHash hash;
+            DeviceResourceHandle deviceHandle;
+            // keeps texture data in system memory until all mip levels are uploaded
+            ManagedResource resource;
+            UInt32 baseMipLevel;
+            // rows of level below base level uploaded already
+            UInt32 uploadedRows;
+        };
+        const bool m_textureStreamingEnabled;
+        std::deque<StreamedTexture> m_streamedTextures;
+        SceneIdVector m_scenesWithStreamedTextureUpdates;
 
-        using SizeMap = HashMap<ResourceContentHash, UInt32>;
-        SizeMap       m_resourceSizes;
-        UInt64        m_resourceTotalUploadedSize = 0u;
-        const UInt64  m_resourceCacheSize = 0u;
+        GpuMemoryBudget m_gpuMemoryBudget;
+        bool          m_gpuMemoryBudgetExceeded = false;
         const UInt32  m_resourceUploadBatchSize   = 10u;
 
         RendererStatistics& m_stats;
 
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
         mutable std::map<int32_t, ResourceContentHashVector> m_buckets;
+        mutable ResourceContentHashVector m_evictionOrder;
     };
 }
 
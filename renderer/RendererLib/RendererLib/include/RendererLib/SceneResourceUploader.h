@@ -10,6 +10,7 @@
 #define RAMSES_SCENERESOURCEUPLOADER_H
 
 #include "SceneAPI/Handles.h"
+#include "RendererLib/RenderableBatchCache.h"
 
 namespace ramses_internal
 {
@@ -25,6 +26,7 @@ namespace ramses_internal
         static void UploadTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
         static void UpdateTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
         static void UploadVertexArray(const IScene& scene, RenderableHandle renderableHandle, IRendererResourceManager& resourceManager);
+        static void UploadRenderableBatch(const IScene& scene, RenderableBatchHandle batchHandle, const RenderableBatchCache::Batch& batch, IRendererResourceManager& resourceManager);
     };
 }
 
@@ -16,7 +16,9 @@
 #include "Resource/EffectResource.h"
 #include "Watchdog/IThreadAliveNotifier.h"
 #include "Utils/ThreadLocalLogForced.h"
+#include "Collections/Vector.h"
 #include "absl/algorithm/container.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -67,99 +69,127 @@ namespace ramses_internal
         m_thread.join();
     }
 
-    void AsyncEffectUploader::uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend)
+    bool AsyncEffectUploader::IsUploadedLater(const PendingEffect& a, const PendingEffect& b)
     {
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: starting");
+        if (a.priority != b.priority)
+            return a.priority > b.priority;
+        return a.submissionIndex > b.submissionIndex;
+    }
+
+    void AsyncEffectUploader::uploadEffectOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectOrWait: starting");
 
-        EffectsRawResources effectsToUpload;
+        // effects are taken one at a time, so that effects submitted meanwhile with higher priority
+        // or cancellation of pending effects take effect already before next upload
+        PendingEffect effectToUpload{};
+        bool wasLastPending = false;
         {
             std::unique_lock<std::mutex> guard(m_mutex);
             do
                 m_notifier.notifyAlive(m_aliveIdentifier);
             while (!m_sleepConditionVar.wait_for(guard, m_notifier.calculateTimeout(),
-                [&]() { return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || isCancelRequested(); }));
-
-            m_effectsUploaded.insert(m_effectsUploaded.end(), std::make_move_iterator(m_effectsUploadedCache.begin()), std::make_move_iterator(m_effectsUploadedCache.end()));
-            m_effectsUploadedCache.clear();
-
-            //assert none of the shaders to be uploaded next was already uploaded since last sync
-            assert(absl::c_all_of(m_effectsToUpload, [&](const auto& toUpload) {
-                return absl::c_find_if(m_effectsUploaded, [&](const auto& uploaded) {return uploaded.first == toUpload->getHash(); }) == m_effectsUploaded.cend();
-                }));
-
-            m_effectsToUpload.swap(effectsToUpload);
-        }
-
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: will upload: " << effectsToUpload.size() << ",  uploaded in cache:" << m_effectsUploadedCache.size());
+                [&]() { return !m_effectsToUpload.empty() || isCancelRequested(); }));
 
-        std::chrono::microseconds maxShaderUploadTime{ 0u };
-        std::chrono::microseconds totalShaderUploadTime{ 0u };
-        ResourceContentHash effectWithMaxUploadTime;
-
-        for (const auto effectRes : effectsToUpload)
-        {
             if (isCancelRequested())
             {
-                LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading cancelled");
-                break;
+                if (!m_effectsToUpload.empty())
+                    LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading cancelled, " << m_effectsToUpload.size() << " effects not uploaded");
+                return;
             }
 
-            const auto& effectHash = effectRes->getHash();
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading: " << effectHash);
-
-            assert(absl::c_find_if(m_effectsUploadedCache, [&effectHash](const auto& u) {return effectHash == u.first; }) == m_effectsUploadedCache.cend());
-            m_notifier.notifyAlive(m_aliveIdentifier);
-            const auto shaderUploadStart = std::chrono::steady_clock::now();
-            auto shaderResource = resourceUploadRenderBackend.getDevice().uploadShader(*effectRes);
-            const auto shaderUploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - shaderUploadStart);
+            std::pop_heap(m_effectsToUpload.begin(), m_effectsToUpload.end(), IsUploadedLater);
+            effectToUpload = m_effectsToUpload.back();
+            m_effectsToUpload.pop_back();
+            wasLastPending = m_effectsToUpload.empty();
+        }
 
-            m_effectsUploadedCache.emplace_back(effectHash, std::move(shaderResource));
+        const auto& effectHash = effectToUpload.effect->getHash();
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader uploading: " << effectHash << " (priority " << effectToUpload.priority << ")");
 
-            if (shaderUploadTime > maxShaderUploadTime || !effectWithMaxUploadTime.isValid())
-            {
-                maxShaderUploadTime = shaderUploadTime;
-                effectWithMaxUploadTime = effectHash;
-            }
-            totalShaderUploadTime += shaderUploadTime;
-        }
+        m_notifier.notifyAlive(m_aliveIdentifier);
+        const auto shaderUploadStart = std::chrono::steady_clock::now();
+        auto shaderResource = resourceUploadRenderBackend.getDevice().uploadShader(*effectToUpload.effect);
+        const auto shaderUploadEnd = std::chrono::steady_clock::now();
+        const EffectUploadTimes uploadTimes{
+            std::chrono::duration_cast<std::chrono::microseconds>(shaderUploadEnd - shaderUploadStart),
+            std::chrono::duration_cast<std::chrono::microseconds>(shaderUploadEnd - effectToUpload.submissionTime) };
 
-        if (!effectsToUpload.empty())
-        {
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader " << effectsToUpload.size() << " uploaded in "
-                << totalShaderUploadTime.count() << " us ("
-                << "Max: " << maxShaderUploadTime.count() << " us " << effectWithMaxUploadTime << ")");
+        LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploaded: " << effectHash << " in " << uploadTimes.uploadTime.count() << " us, "
+            << uploadTimes.latency.count() << " us since submission");
 
 #if defined(_WIN32)
-            // Workaround for bug https://github.com/COVESA/ramses/issues/61
-            // Only perform this flush on Windows, unclear if required/mandatory on other platforms
-            // See bug comments for more info
+        // Workaround for bug https://github.com/COVESA/ramses/issues/61
+        // Only perform this flush on Windows, unclear if required/mandatory on other platforms
+        // See bug comments for more info
+        if (wasLastPending)
             resourceUploadRenderBackend.getDevice().flush();
+#else
+        UNUSED(wasLastPending);
 #endif
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            //assert shader was not uploaded already since last sync
+            assert(absl::c_find_if(m_syncResult.uploaded, [&effectHash](const auto& u) {return effectHash == u.first; }) == m_syncResult.uploaded.cend());
+            m_syncResult.uploaded.emplace_back(effectHash, std::move(shaderResource));
+            m_syncResult.uploadTimes.push_back(uploadTimes);
         }
 
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: finished");
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectOrWait: finished");
     }
 
     void AsyncEffectUploader::sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut)
     {
         assert(uploadedResourcesOut.empty());
 
+        EffectUploadRequests requests;
+        requests.reserve(effectsToUpload.size());
+        for (const auto effect : effectsToUpload)
+            requests.push_back({ effect, 0 });
+
+        EffectsSyncResult result;
+        sync(requests, {}, result);
+        uploadedResourcesOut.swap(result.uploaded);
+    }
+
+    void AsyncEffectUploader::sync(const EffectUploadRequests& effectsToUpload, const ResourceContentHashVector& effectsToCancel, EffectsSyncResult& resultOut)
+    {
+        assert(resultOut.uploaded.empty() && resultOut.uploadTimes.empty() && resultOut.cancelled.empty());
+
         std::size_t totalEffectsToUpload = 0u;
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::sync: starting");
         {
             std::lock_guard<std::mutex> guard(m_mutex);
 
-            m_effectsToUpload.insert(m_effectsToUpload.cend(), effectsToUpload.cbegin(), effectsToUpload.cend());
-            uploadedResourcesOut.swap(m_effectsUploaded);
+            const auto submissionTime = std::chrono::steady_clock::now();
+            for (const auto& request : effectsToUpload)
+            {
+                m_effectsToUpload.push_back({ request.effect, request.priority, m_submissionCounter++, submissionTime });
+                std::push_heap(m_effectsToUpload.begin(), m_effectsToUpload.end(), IsUploadedLater);
+            }
+
+            if (!effectsToCancel.empty())
+            {
+                const auto cancelledBegin = std::partition(m_effectsToUpload.begin(), m_effectsToUpload.end(), [&](const PendingEffect& e) {
+                    return !contains_c(effectsToCancel, e.effect->getHash());
+                });
+                for (auto it = cancelledBegin; it != m_effectsToUpload.end(); ++it)
+                    m_syncResult.cancelled.push_back(it->effect->getHash());
+                m_effectsToUpload.erase(cancelledBegin, m_effectsToUpload.end());
+                std::make_heap(m_effectsToUpload.begin(), m_effectsToUpload.end(), IsUploadedLater);
+            }
 
+            std::swap(resultOut, m_syncResult);
             totalEffectsToUpload = m_effectsToUpload.size();
         }
 
-        if (!effectsToUpload.empty() || !uploadedResourcesOut.empty())
+        if (!effectsToUpload.empty() || !effectsToCancel.empty() || !resultOut.uploaded.empty())
         {
             LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader newToUpload: " << effectsToUpload.size()
                 << ", totalPending: " << totalEffectsToUpload
-                << ", uploaded: " << uploadedResourcesOut.size());
+                << ", uploaded: " << resultOut.uploaded.size()
+                << ", cancelled: " << resultOut.cancelled.size() << "/" << effectsToCancel.size());
         }
 
         if (!effectsToUpload.empty())
@@ -193,7 +223,7 @@ namespace ramses_internal
 #endif
 
         while (!isCancelRequested())
-            uploadEffectsOrWait(*resourceUploadRenderBackend);
+            uploadEffectOrWait(*resourceUploadRenderBackend);
 
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader will destroy resource upload render backend");
         m_platform.destroyResourceUploadRenderBackend();
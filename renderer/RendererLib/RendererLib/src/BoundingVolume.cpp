@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/BoundingVolume.h"
+#include "Resource/ArrayResource.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+namespace ramses_internal
+{
+    BoundingVolume BoundingVolume::FromVertexArray(const ArrayResource& vertexArray)
+    {
+        UInt32 componentsPerVertex = 0u;
+        switch (vertexArray.getElementType())
+        {
+        case EDataType::Vector3F:
+            componentsPerVertex = 3u;
+            break;
+        case EDataType::Vector4F:
+            componentsPerVertex = 4u;
+            break;
+        default:
+            return {};
+        }
+
+        const auto& data = vertexArray.getResourceData();
+        if (data.size() < vertexArray.getElementCount() * componentsPerVertex * sizeof(Float))
+            return {};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return FromPositions(reinterpret_cast<const Float*>(data.data()), vertexArray.getElementCount(), componentsPerVertex);
+    }
+
+    BoundingVolume BoundingVolume::FromPositions(const Float* positions, UInt32 vertexCount, UInt32 componentsPerVertex)
+    {
+        assert(componentsPerVertex >= 3u);
+        if (vertexCount == 0u)
+            return {};
+
+        Vector3 minPos(std::numeric_limits<Float>::max());
+        Vector3 maxPos(std::numeric_limits<Float>::lowest());
+        for (UInt32 i = 0u; i < vertexCount; ++i)
+        {
+            const Float* pos = positions + i * componentsPerVertex;
+            if (!std::isfinite(pos[0]) || !std::isfinite(pos[1]) || !std::isfinite(pos[2]))
+                return {};
+
+            minPos.x = std::min(minPos.x, pos[0]);
+            minPos.y = std::min(minPos.y, pos[1]);
+            minPos.z = std::min(minPos.z, pos[2]);
+            maxPos.x = std::max(maxPos.x, pos[0]);
+            maxPos.y = std::max(maxPos.y, pos[1]);
+            maxPos.z = std::max(maxPos.z, pos[2]);
+        }
+
+        BoundingVolume volume;
+        volume.center = (minPos + maxPos) * 0.5f;
+        volume.halfExtents = (maxPos - minPos) * 0.5f;
+        return volume;
+    }
+
+    ViewFrustum::ViewFrustum(const Matrix44f& m)
+    {
+        // Gribb/Hartmann plane extraction from rows of clip space transformation, OpenGL clip volume -w <= x,y,z <= w
+        const Vector4 row1(m.m11, m.m12, m.m13, m.m14);
+        const Vector4 row2(m.m21, m.m22, m.m23, m.m24);
+        const Vector4 row3(m.m31, m.m32, m.m33, m.m34);
+        const Vector4 row4(m.m41, m.m42, m.m43, m.m44);
+
+        m_planes[0] = row4 + row1;
+        m_planes[1] = row4 - row1;
+        m_planes[2] = row4 + row2;
+        m_planes[3] = row4 - row2;
+        m_planes[4] = row4 + row3;
+        m_planes[5] = row4 - row3;
+    }
+
+    bool ViewFrustum::isOutside(const BoundingVolume& volume, const Matrix44f& modelMatrix) const
+    {
+        if (!volume.isValid())
+            return false;
+
+        // box stays a box (oriented) in world space, its extent along plane normal is the projection of its scaled axes
+        const Vector3 axisX = Vector3(modelMatrix.m11, modelMatrix.m21, modelMatrix.m31) * volume.halfExtents.x;
+        const Vector3 axisY = Vector3(modelMatrix.m12, modelMatrix.m22, modelMatrix.m32) * volume.halfExtents.y;
+        const Vector3 axisZ = Vector3(modelMatrix.m13, modelMatrix.m23, modelMatrix.m33) * volume.halfExtents.z;
+        const Vector4 worldCenter = modelMatrix * Vector4(volume.center.x, volume.center.y, volume.center.z, 1.f);
+
+        for (const auto& plane : m_planes)
+        {
+            const Vector3 normal(plane.x, plane.y, plane.z);
+            const Float distance = normal.x * worldCenter.x + normal.y * worldCenter.y + normal.z * worldCenter.z + plane.w;
+            const Float radius = std::abs(normal.dot(axisX)) + std::abs(normal.dot(axisY)) + std::abs(normal.dot(axisZ));
+            if (distance < -radius)
+                return true;
+        }
+
+        return false;
+    }
+}
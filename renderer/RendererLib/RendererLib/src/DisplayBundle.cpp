@@ -106,6 +106,10 @@ namespace ramses_internal
             auto& device = m_renderer.getDisplayController().getRenderBackend().getDevice();
             const auto drawCallCount = device.getAndResetDrawCallCount();
             const auto usedGPUMemory = device.getTotalGpuMemoryUsageInKB();
+            m_renderer.getStatistics().uniformsUploaded(device.getAndResetUploadedUniformCount(), device.getAndResetSkippedUniformCount());
+            m_renderer.getStatistics().drawCallsSorted(m_renderer.getDisplayController().getAndResetStateChangesSavedByDrawCallSorting());
+            m_renderer.getStatistics().renderablesCulled(m_renderer.getDisplayController().getAndResetCulledRenderables());
+            m_renderer.getStatistics().renderablesBatched(m_renderer.getDisplayController().getAndResetDrawCallsSavedByBatching());
 
             m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::DrawCalls, drawCallCount);
             m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::UsedGPUMemory, usedGPUMemory / 1024);
@@ -325,6 +325,72 @@ namespace ramses_internal
         return m_resourceUploadBatchSize;
     }
 
+    void DisplayConfig::setTransformationUpdateThreadCount(uint32_t threadCount)
+    {
+        m_transformationUpdateThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfig::getTransformationUpdateThreadCount() const
+    {
+        return m_transformationUpdateThreadCount;
+    }
+
+    void DisplayConfig::setDrawCallSortingEnabled(bool enabled)
+    {
+        m_drawCallSortingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isDrawCallSortingEnabled() const
+    {
+        return m_drawCallSortingEnabled;
+    }
+
+    void DisplayConfig::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_drawCallBatchingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isDrawCallBatchingEnabled() const
+    {
+        return m_drawCallBatchingEnabled;
+    }
+
+    void DisplayConfig::setResourceDecompressionThreadCount(uint32_t threadCount)
+    {
+        m_resourceDecompressionThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfig::getResourceDecompressionThreadCount() const
+    {
+        return m_resourceDecompressionThreadCount;
+    }
+
+    void DisplayConfig::setResourceDiskCache(const String& filePath, UInt64 maxSize)
+    {
+        m_resourceDiskCacheFilePath = filePath;
+        m_resourceDiskCacheMaxSize = maxSize;
+    }
+
+    const String& DisplayConfig::getResourceDiskCacheFilePath() const
+    {
+        return m_resourceDiskCacheFilePath;
+    }
+
+    UInt64 DisplayConfig::getResourceDiskCacheMaxSize() const
+    {
+        return m_resourceDiskCacheMaxSize;
+    }
+
+    void DisplayConfig::setTextureStreamingEnabled(bool enabled)
+    {
+        m_textureStreamingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isTextureStreamingEnabled() const
+    {
+        return m_textureStreamingEnabled;
+    }
+
     Bool DisplayConfig::operator == (const DisplayConfig& other) const
     {
         return
@@ -354,7 +420,14 @@ namespace ramses_internal
             m_platformRenderNode         == other.m_platformRenderNode &&
             m_swapInterval               == other.m_swapInterval &&
             m_scenePriorities            == other.m_scenePriorities &&
-            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize;
+            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize &&
+            m_transformationUpdateThreadCount == other.m_transformationUpdateThreadCount &&
+            m_drawCallSortingEnabled     == other.m_drawCallSortingEnabled &&
+            m_drawCallBatchingEnabled    == other.m_drawCallBatchingEnabled &&
+            m_resourceDecompressionThreadCount == other.m_resourceDecompressionThreadCount &&
+            m_resourceDiskCacheFilePath  == other.m_resourceDiskCacheFilePath &&
+            m_resourceDiskCacheMaxSize   == other.m_resourceDiskCacheMaxSize &&
+            m_textureStreamingEnabled    == other.m_textureStreamingEnabled;
     }
 
     Bool DisplayConfig::operator != (const DisplayConfig& other) const
@@ -20,13 +20,14 @@
 
 namespace ramses_internal
 {
-    DisplayController::DisplayController(IRenderBackend& renderer, UInt32 /*samples*/, UInt32 postProcessingEffectIds)
+    DisplayController::DisplayController(IRenderBackend& renderer, UInt32 /*samples*/, UInt32 postProcessingEffectIds, bool drawCallSortingEnabled)
         : m_renderBackend(renderer)
         , m_device(m_renderBackend.getDevice())
         , m_embeddedCompositingManager(m_device, m_renderBackend.getEmbeddedCompositor(), m_renderBackend.getTextureUploadingAdapter())
         , m_displayWidth(m_renderBackend.getWindow().getWidth())
         , m_displayHeight(m_renderBackend.getWindow().getHeight())
         , m_postProcessing(new Postprocessing(postProcessingEffectIds, m_displayWidth, m_displayHeight, m_device))
+        , m_drawCallSortingEnabled(drawCallSortingEnabled)
     {
     }
 
@@ -53,11 +54,16 @@ namespace ramses_internal
         validateRenderingStatusHealthy();
     }
 
-    SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer)
+    SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer, RenderPassCostEstimator* passCostEstimator)
     {
-        RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer, m_drawCallSortingEnabled, passCostEstimator);
 
-        return executor.executeScene(scene);
+        const SceneRenderExecutionIterator iterator = executor.executeScene(scene);
+        m_stateChangesSavedByDrawCallSorting += executor.getStateChangesSavedBySorting();
+        m_culledRenderables += executor.getCulledRenderables();
+        m_drawCallsSavedByBatching += executor.getDrawCallsSavedByBatching();
+
+        return iterator;
     }
 
     void DisplayController::executePostProcessing()
@@ -137,4 +143,25 @@ namespace ramses_internal
     {
         m_renderBackend.getDevice().validateDeviceStatusHealthy();
     }
+
+    UInt32 DisplayController::getAndResetStateChangesSavedByDrawCallSorting()
+    {
+        const UInt32 count = m_stateChangesSavedByDrawCallSorting;
+        m_stateChangesSavedByDrawCallSorting = 0u;
+        return count;
+    }
+
+    UInt32 DisplayController::getAndResetCulledRenderables()
+    {
+        const UInt32 count = m_culledRenderables;
+        m_culledRenderables = 0u;
+        return count;
+    }
+
+    UInt32 DisplayController::getAndResetDrawCallsSavedByBatching()
+    {
+        const UInt32 count = m_drawCallsSavedByBatching;
+        m_drawCallsSavedByBatching = 0u;
+        return count;
+    }
 }
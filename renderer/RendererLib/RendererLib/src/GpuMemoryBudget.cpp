@@ -0,0 +1,152 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuMemoryBudget.h"
+#include <algorithm>
+#include <limits>
+#include <cassert>
+
+namespace ramses_internal
+{
+    GpuMemoryBudget::GpuMemoryBudget(UInt64 budget)
+        : m_budget(budget)
+    {
+    }
+
+    void GpuMemoryBudget::onResourceUploaded(const ResourceContentHash& hash, EResourceType type, UInt32 size, Int32 scenePriority, const SceneIdVector& sceneUsage)
+    {
+        assert(!m_entries.contains(hash));
+        Entry& entry = m_entries.put(hash, { type, size, scenePriority, {} })->value;
+        m_usage += size;
+        m_usagePerType[type] += size;
+        for (const auto sceneId : sceneUsage)
+            addSceneUsage(entry, sceneId);
+    }
+
+    void GpuMemoryBudget::onResourceUnloaded(const ResourceContentHash& hash)
+    {
+        const auto it = m_entries.find(hash);
+        assert(it != m_entries.end());
+        const Entry& entry = it->value;
+        assert(m_usage >= entry.size);
+        assert(m_usagePerType[entry.type] >= entry.size);
+        m_usage -= entry.size;
+        m_usagePerType[entry.type] -= entry.size;
+        for (const auto sceneId : entry.scenes)
+        {
+            assert(m_usagePerScene[sceneId] >= entry.size);
+            m_usagePerScene[sceneId] -= entry.size;
+        }
+        m_entries.remove(it);
+    }
+
+    void GpuMemoryBudget::onResourceUsedByScene(const ResourceContentHash& hash, SceneId sceneId, Int32 scenePriority)
+    {
+        Entry* entry = m_entries.get(hash);
+        if (entry != nullptr)
+        {
+            entry->scenePriority = std::min(entry->scenePriority, scenePriority);
+            addSceneUsage(*entry, sceneId);
+        }
+    }
+
+    void GpuMemoryBudget::onResourceUnusedByScene(const ResourceContentHash& hash, SceneId sceneId)
+    {
+        Entry* entry = m_entries.get(hash);
+        if (entry == nullptr)
+            return;
+
+        const auto sceneIt = std::find(entry->scenes.begin(), entry->scenes.end(), sceneId);
+        if (sceneIt != entry->scenes.end())
+        {
+            entry->scenes.erase(sceneIt);
+            assert(m_usagePerScene[sceneId] >= entry->size);
+            m_usagePerScene[sceneId] -= entry->size;
+        }
+    }
+
+    void GpuMemoryBudget::addSceneUsage(Entry& entry, SceneId sceneId)
+    {
+        if (std::find(entry.scenes.cbegin(), entry.scenes.cend(), sceneId) == entry.scenes.cend())
+        {
+            entry.scenes.push_back(sceneId);
+            m_usagePerScene[sceneId] += entry.size;
+        }
+    }
+
+    bool GpuMemoryBudget::isEnabled() const
+    {
+        return m_budget > 0u;
+    }
+
+    UInt64 GpuMemoryBudget::getBudget() const
+    {
+        return m_budget;
+    }
+
+    UInt64 GpuMemoryBudget::getUsage() const
+    {
+        return m_usage;
+    }
+
+    UInt64 GpuMemoryBudget::getUsage(EResourceType type) const
+    {
+        return m_usagePerType[type];
+    }
+
+    UInt64 GpuMemoryBudget::getUsage(SceneId sceneId) const
+    {
+        const auto it = m_usagePerScene.find(sceneId);
+        return it != m_usagePerScene.cend() ? it->second : 0u;
+    }
+
+    const std::unordered_map<SceneId, UInt64>& GpuMemoryBudget::getUsagePerScene() const
+    {
+        return m_usagePerScene;
+    }
+
+    UInt32 GpuMemoryBudget::getResourceSize(const ResourceContentHash& hash) const
+    {
+        const Entry* entry = m_entries.get(hash);
+        return entry ? entry->size : 0u;
+    }
+
+    UInt64 GpuMemoryBudget::getAmountOfMemoryToBeFreed(UInt64 sizeToUpload) const
+    {
+        // unload all if no caching is allowed
+        if (!isEnabled())
+            return std::numeric_limits<UInt64>::max();
+
+        // if budget is already exceeded try unloading all that is above budget plus size for new resources to be uploaded
+        const UInt64 requiredSize = m_usage + sizeToUpload;
+        return requiredSize > m_budget ? requiredSize - m_budget : 0u;
+    }
+
+    void GpuMemoryBudget::sortByEvictionOrder(ResourceContentHashVector& unusedResources) const
+    {
+        // stable sort keeps least recently used order within same scene priority
+        const auto getPriority = [this](const ResourceContentHash& hash)
+        {
+            const Entry* entry = m_entries.get(hash);
+            return entry ? entry->scenePriority : 0;
+        };
+        std::stable_sort(unusedResources.begin(), unusedResources.end(), [&](const auto& a, const auto& b) { return getPriority(a) > getPriority(b); });
+    }
+
+    bool GpuMemoryBudget::updatePressureState()
+    {
+        const bool wasUnderPressure = m_underPressure;
+        m_underPressure = isEnabled() && m_usage > m_budget;
+        return m_underPressure && !wasUnderPressure;
+    }
+
+    bool GpuMemoryBudget::isUnderPressure() const
+    {
+        return m_underPressure;
+    }
+}
@@ -309,6 +309,11 @@ namespace ramses_internal
         m_logContext << "generate mipmaps for texture [handle:" << handle << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        m_logContext << "set texture base mip level [handle:" << handle << " baseMipLevel:" << baseMipLevel << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte*, UInt32 dataSize)
     {
         m_logContext << "update texture data [handle:" << handle << " mipLevel:" << mipLevel << " (x,y,z):(" << x << "," << y << "," << z << ") (w,h,d):(" << width << "," << height << "," << depth << ") dataSize:" << dataSize << "]" << RendererLogContext::NewLine;
@@ -500,6 +505,16 @@ namespace ramses_internal
         return 0;
     }
 
+    uint32_t LoggingDevice::getAndResetUploadedUniformCount()
+    {
+        return 0;
+    }
+
+    uint32_t LoggingDevice::getAndResetSkippedUniformCount()
+    {
+        return 0;
+    }
+
     void LoggingDevice::flush()
     {
     }
@@ -8,19 +8,39 @@
 
 #include "RenderExecutor.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/BoundingVolume.h"
+#include "RendererLib/RenderPassCostEstimator.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
 #include "Components/EffectUniformTime.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer, bool sortDrawCallsByState, RenderPassCostEstimator* passCostEstimator)
         : m_state(device, renderContext, frameTimer)
+        , m_sortDrawCallsByState(sortDrawCallsByState)
+        , m_passCostEstimator(passCostEstimator)
     {
     }
 
+    UInt32 RenderExecutor::getStateChangesSavedBySorting() const
+    {
+        return m_state.stateChangesSavedBySorting;
+    }
+
+    UInt32 RenderExecutor::getCulledRenderables() const
+    {
+        return m_state.culledRenderables;
+    }
+
+    UInt32 RenderExecutor::getDrawCallsSavedByBatching() const
+    {
+        return m_state.drawCallsSavedByBatching;
+    }
+
     SceneRenderExecutionIterator RenderExecutor::executeScene(const RendererCachedScene& scene) const
     {
         setGlobalInternalStates(scene);
@@ -32,14 +52,30 @@ namespace ramses_internal
             switch (passInfo.getType())
             {
             case ERenderingPassType::RenderPass:
-                if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
+            {
+                const RenderPassHandle pass = passInfo.getRenderPassHandle();
+                if (shouldDeferRenderPass(scene, pass))
                 {
                     assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
                     return m_state.m_currentRenderIterator;
                 }
+
+                const bool passExecutedFromBeginning = (m_state.m_currentRenderIterator.getRenderableIdx() == 0u);
+                const auto passStartTime = FrameTimer::Clock::now();
+                if (!executeRenderPass(scene, pass))
+                {
+                    assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
+                    return m_state.m_currentRenderIterator;
+                }
+                if (m_passCostEstimator && passExecutedFromBeginning)
+                {
+                    const auto passCost = std::chrono::duration_cast<std::chrono::microseconds>(FrameTimer::Clock::now() - passStartTime);
+                    m_passCostEstimator->recordPassCost(scene.getSceneId(), pass, static_cast<UInt32>(scene.getOrderedRenderablesForPass(pass).size()), passCost);
+                }
                 if (canDiscardDepthBuffer())
                     m_state.getDevice().discardDepthStencil();
                 break;
+            }
             case ERenderingPassType::BlitPass:
                 executeBlitPass(scene, passInfo.getBlitPassHandle());
                 break;
@@ -98,26 +134,104 @@ namespace ramses_internal
             }
         }
 
-        const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+        // textures and vertex array bound by previous pass are not tracked
+        m_state.boundTextureSamplers.clear();
+        m_state.boundVertexArrayDeviceHandle = DeviceResourceHandle::Invalid();
+
+        const bool frustumCulling = renderPass.isFrustumCullingEnabled;
+        const ViewFrustum frustum(m_state.getProjectionMatrix() * m_state.getViewMatrix());
+        const VertexArrayCache& vertexArrays = scene.getCachedHandlesForVertexArrays();
+
+        const RenderableVector& orderedRenderables = (m_sortDrawCallsByState ? getRenderablesSortedByState(scene, pass) : scene.getOrderedRenderablesForPass(pass));
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
+            const UInt32 timeBudgetCheckIdx = m_state.m_currentRenderIterator.getFlattenedRenderableIdx() / NumRenderablesToRenderInBetweenTimeBudgetChecks;
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
-            if (!scene.renderableResourcesDirty(renderableHandle))
+            const RenderableBatchCache::Batch* batch = findBatchToDraw(scene, pass, orderedRenderables, m_state.m_currentRenderIterator.getRenderableIdx());
+            if (batch)
+            {
+                executeBatch(*batch);
+                for (size_t i = 0u; i < batch->members.size(); ++i)
+                    m_state.m_currentRenderIterator.incrementRenderableIdx();
+            }
+            else
             {
-                assert(!scene.isRenderableVertexArrayDirty(renderableHandle));
-                setRenderableInternalStates(renderableHandle);
-                setSemanticDataFields();
-                executeRenderable();
+                if (!scene.renderableResourcesDirty(renderableHandle))
+                {
+                    assert(!scene.isRenderableVertexArrayDirty(renderableHandle));
+                    if (frustumCulling && frustum.isOutside(vertexArrays[renderableHandle.asMemoryHandle()].boundingVolume, scene.getRenderableWorldMatrix(renderableHandle)))
+                    {
+                        ++m_state.culledRenderables;
+                    }
+                    else
+                    {
+                        setRenderableInternalStates(renderableHandle);
+                        setSemanticDataFields();
+                        executeRenderable();
+                    }
+                }
+                m_state.m_currentRenderIterator.incrementRenderableIdx();
             }
-            m_state.m_currentRenderIterator.incrementRenderableIdx();
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            // batch can skip over multiple of check interval
+            const bool timeBudgetCheckDue = (m_state.m_currentRenderIterator.getFlattenedRenderableIdx() / NumRenderablesToRenderInBetweenTimeBudgetChecks != timeBudgetCheckIdx);
+            if (timeBudgetCheckDue && m_state.hasExceededTimeBudgetForRendering())
                 return false;
         }
 
         return true;
     }
 
+    bool RenderExecutor::shouldDeferRenderPass(const RendererCachedScene& scene, RenderPassHandle pass) const
+    {
+        if (!m_passCostEstimator)
+            return false;
+
+        // pass is deferred to next frame only at its beginning and only if this execution already rendered something,
+        // so that interrupted rendering always makes progress
+        const SceneRenderExecutionIterator& renderFrom = m_state.getRenderingContext().renderFrom;
+        if (m_state.m_currentRenderIterator.getRenderableIdx() != 0u || m_state.m_currentRenderIterator.getFlattenedRenderableIdx() == renderFrom.getFlattenedRenderableIdx())
+            return false;
+
+        const auto estimatedCost = m_passCostEstimator->estimatePassCost(scene.getSceneId(), pass, static_cast<UInt32>(scene.getOrderedRenderablesForPass(pass).size()));
+        return estimatedCost > m_state.getRemainingTimeBudgetForRendering();
+    }
+
+    const RenderableBatchCache::Batch* RenderExecutor::findBatchToDraw(const RendererCachedScene& scene, RenderPassHandle pass, const RenderableVector& renderables, UInt32 renderableIdx) const
+    {
+        const RenderableBatchCache::Batch* batch = scene.getRenderableBatches().findMergedBatch(pass, renderables[renderableIdx]);
+        if (!batch || batch->members.front().renderable != renderables[renderableIdx] || renderableIdx + batch->members.size() > renderables.size())
+            return nullptr;
+
+        // batch is drawn only if its members are rendered in sequence and none of them changed since merging,
+        // otherwise they are rendered individually
+        const VertexArrayCache& vertexArrays = scene.getCachedHandlesForVertexArrays();
+        for (UInt32 i = 0u; i < batch->members.size(); ++i)
+        {
+            const auto& member = batch->members[i];
+            if (renderables[renderableIdx + i] != member.renderable || scene.renderableResourcesDirty(member.renderable)
+                || vertexArrays[member.renderable.asMemoryHandle()].revision != member.vertexArrayRevision)
+                return nullptr;
+        }
+
+        return batch;
+    }
+
+    void RenderExecutor::executeBatch(const RenderableBatchCache::Batch& batch) const
+    {
+        // members share all states and uniforms, first member represents them all
+        setRenderableInternalStates(batch.members.front().renderable);
+        m_state.vertexArrayDeviceHandle = batch.vertexArray;
+        m_state.vertexArrayUsesIndices = batch.usesIndexArray;
+        m_state.drawStartIndex = 0u;
+        m_state.drawIndexCount = batch.drawCount;
+        m_state.drawInstanceCount = 1u;
+        setSemanticDataFields();
+        executeRenderable();
+
+        m_state.drawCallsSavedByBatching += static_cast<UInt32>(batch.members.size()) - 1u;
+    }
+
     void RenderExecutor::executeRenderable() const
     {
         executeRenderStates();
@@ -219,9 +333,17 @@ namespace ramses_internal
         assert(uniformData.isValid());
 
         if (m_state.shaderDeviceHandle.hasChanged())
+        {
             device.activateShader(m_state.shaderDeviceHandle.getState());
+            // texture slots are assigned per shader, texture activation cannot be skipped after shader change
+            m_state.boundTextureSamplers.clear();
+        }
 
-        device.activateVertexArray(m_state.vertexArrayDeviceHandle);
+        if (!m_sortDrawCallsByState || m_state.vertexArrayDeviceHandle != m_state.boundVertexArrayDeviceHandle)
+        {
+            device.activateVertexArray(m_state.vertexArrayDeviceHandle);
+            m_state.boundVertexArrayDeviceHandle = m_state.vertexArrayDeviceHandle;
+        }
 
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
         const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
@@ -338,6 +460,16 @@ namespace ramses_internal
         {
             const TextureSamplerHandle samplerHandle = renderScene.getDataTextureSamplerHandle(dataInstance, dataInstancefield);
             assert(samplerHandle.isValid());
+            if (m_sortDrawCallsByState)
+            {
+                // same sampler in same field with same shader means same texture and sampler states already active
+                auto& boundSamplers = m_state.boundTextureSamplers;
+                if (uniformInputField.asMemoryHandle() >= boundSamplers.size())
+                    boundSamplers.resize(uniformInputField.asMemoryHandle() + 1u);
+                if (boundSamplers[uniformInputField.asMemoryHandle()] == samplerHandle)
+                    break;
+                boundSamplers[uniformInputField.asMemoryHandle()] = samplerHandle;
+            }
 
             const DeviceResourceHandle textureDeviceHandle = renderScene.getCachedHandlesForTextureSamplers()[samplerHandle.asMemoryHandle()];
             assert(textureDeviceHandle.isValid());
@@ -368,13 +500,11 @@ namespace ramses_internal
     void RenderExecutor::executeDrawCall() const
     {
         IDevice& device = m_state.getDevice();
-        const auto& renderScene = m_state.getScene();
-        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
 
         if (m_state.vertexArrayUsesIndices)
-            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawIndexedTriangles(m_state.drawStartIndex, m_state.drawIndexCount, m_state.drawInstanceCount);
         else
-            device.drawTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawTriangles(m_state.drawStartIndex, m_state.drawIndexCount, m_state.drawInstanceCount);
     }
 
     void RenderExecutor::setGlobalInternalStates(const RendererCachedScene& scene) const
@@ -395,6 +525,9 @@ namespace ramses_internal
         const auto& vertexArray = renderScene.getCachedHandlesForVertexArrays()[m_state.getRenderable().asMemoryHandle()];
         m_state.vertexArrayDeviceHandle = vertexArray.deviceHandle;
         m_state.vertexArrayUsesIndices = vertexArray.usesIndexArray;
+        m_state.drawStartIndex = renderable.startIndex;
+        m_state.drawIndexCount = renderable.indexCount;
+        m_state.drawInstanceCount = renderable.instanceCount;
 
         const RenderState& renderState = renderScene.getRenderState(renderable.renderState);
         ScissorState scissorState;
@@ -622,6 +755,18 @@ namespace ramses_internal
         return true;
     }
 
+    const RenderableVector& RenderExecutor::getRenderablesSortedByState(const RendererCachedScene& scene, const RenderPassHandle pass) const
+    {
+        // sorting is kept in scene and redone by scene update only when renderables of the pass or their draw states changed,
+        // pass is rendered in its defined order if it has nothing to reorder or the sorting is not up to date
+        const RendererCachedScene::DrawStateSortedRenderables& sorted = scene.getDrawStateSortedRenderablesForPass(pass);
+        if (!sorted.valid)
+            return scene.getOrderedRenderablesForPass(pass);
+
+        m_state.stateChangesSavedBySorting += sorted.stateChangesSaved;
+        return sorted.renderables;
+    }
+
     RenderBufferHandle RenderExecutor::FindDepthRenderBufferInRenderTarget(const IScene& scene, RenderTargetHandle renderTarget)
     {
         if (!renderTarget.isValid())
@@ -54,6 +54,8 @@ namespace ramses_internal
         const RenderPass& rp = scene.getRenderPass(pass);
         if (rp.isRenderOnce)
             m_logContext << " - 'render once' pass" << RendererLogContext::NewLine;
+        if (rp.isFrustumCullingEnabled)
+            m_logContext << " - frustum culling enabled" << RendererLogContext::NewLine;
         m_logContext.indent();
 
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
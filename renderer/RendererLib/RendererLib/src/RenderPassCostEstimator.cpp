@@ -0,0 +1,55 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderPassCostEstimator.h"
+
+namespace ramses_internal
+{
+    namespace
+    {
+        void UpdateAverage(Float& average, bool& measured, Float value)
+        {
+            average = (measured ? average + RenderPassCostEstimator::SmoothingFactor * (value - average) : value);
+            measured = true;
+        }
+    }
+
+    void RenderPassCostEstimator::recordPassCost(SceneId sceneId, RenderPassHandle pass, UInt32 renderableCount, std::chrono::microseconds cost)
+    {
+        const Float costMicrosec = static_cast<Float>(cost.count());
+
+        PassCosts* passCosts = m_passCosts.get(sceneId);
+        if (!passCosts)
+        {
+            m_passCosts.put(sceneId, {});
+            passCosts = m_passCosts.get(sceneId);
+        }
+        if (pass.asMemoryHandle() >= passCosts->size())
+            passCosts->resize(pass.asMemoryHandle() + 1u);
+
+        PassCost& passCost = (*passCosts)[pass.asMemoryHandle()];
+        UpdateAverage(passCost.averageMicrosec, passCost.measured, costMicrosec);
+
+        if (renderableCount > 0u)
+            UpdateAverage(m_averageRenderableCostMicrosec, m_renderableCostMeasured, costMicrosec / static_cast<Float>(renderableCount));
+    }
+
+    std::chrono::microseconds RenderPassCostEstimator::estimatePassCost(SceneId sceneId, RenderPassHandle pass, UInt32 renderableCount) const
+    {
+        const PassCosts* passCosts = m_passCosts.get(sceneId);
+        if (passCosts && pass.asMemoryHandle() < passCosts->size() && (*passCosts)[pass.asMemoryHandle()].measured)
+            return std::chrono::microseconds(static_cast<Int64>((*passCosts)[pass.asMemoryHandle()].averageMicrosec));
+
+        return std::chrono::microseconds(static_cast<Int64>(m_averageRenderableCostMicrosec * static_cast<Float>(renderableCount)));
+    }
+
+    void RenderPassCostEstimator::removeScene(SceneId sceneId)
+    {
+        m_passCosts.remove(sceneId);
+    }
+}
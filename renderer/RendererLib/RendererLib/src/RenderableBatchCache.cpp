@@ -0,0 +1,293 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderableBatchCache.h"
+#include "RendererLib/RendererCachedScene.h"
+
+namespace ramses_internal
+{
+    void RenderableBatchCache::update(const RendererCachedScene& scene, RenderableBatchHandleVector& batchesToUnload, RenderableBatchHandleVector& batchesToUpload)
+    {
+        ++m_updateCounter;
+
+        m_runs.clear();
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            // culled renderables would be drawn as part of batch, therefore passes with culling are not batched
+            if (passInfo.getType() == ERenderingPassType::RenderPass && !scene.getRenderPass(passInfo.getRenderPassHandle()).isFrustumCullingEnabled)
+                collectRunsInPass(scene, passInfo.getRenderPassHandle());
+        }
+
+        for (auto& run : m_runs)
+            processRun(scene, run.first, run.second, batchesToUnload, batchesToUpload);
+
+        // batches whose run was not found anymore
+        RenderableBatchHandleVector obsoleteBatches;
+        for (const auto& batchIt : m_batches)
+        {
+            if (batchIt.value.lastUpdate != m_updateCounter)
+                obsoleteBatches.push_back(batchIt.key);
+        }
+        for (const auto batchHandle : obsoleteBatches)
+        {
+            if (m_batches.get(batchHandle)->uploaded)
+                batchesToUnload.push_back(batchHandle);
+            releaseBatch(batchHandle);
+        }
+    }
+
+    void RenderableBatchCache::collectRunsInPass(const RendererCachedScene& scene, RenderPassHandle pass)
+    {
+        // merged geometry keeps order of members' primitives, so any run of consecutive renderables is rendered same way when batched
+        const RenderableVector& renderables = scene.getOrderedRenderablesForPass(pass);
+        const VertexArrayCache& vertexArrays = scene.getCachedHandlesForVertexArrays();
+        UInt32 runBegin = 0u;
+        while (runBegin < renderables.size())
+        {
+            UInt32 runEnd = runBegin + 1u;
+            if (IsBatchable(scene, renderables[runBegin]))
+            {
+                while (runEnd < renderables.size() && IsBatchable(scene, renderables[runEnd]) && CanBeBatchedTogether(scene, renderables[runBegin], renderables[runEnd]))
+                    ++runEnd;
+            }
+
+            if (runEnd - runBegin >= 2u)
+            {
+                Members run;
+                run.reserve(runEnd - runBegin);
+                for (UInt32 i = runBegin; i < runEnd; ++i)
+                {
+                    const RenderableHandle renderable = renderables[i];
+                    const Renderable& renderableData = scene.getRenderable(renderable);
+                    run.push_back({ renderable, vertexArrays[renderable.asMemoryHandle()].revision, renderableData.startIndex, renderableData.indexCount });
+                }
+                m_runs.push_back({ pass, std::move(run) });
+            }
+
+            runBegin = runEnd;
+        }
+    }
+
+    void RenderableBatchCache::processRun(const RendererCachedScene& scene, RenderPassHandle pass, Members& run, RenderableBatchHandleVector& batchesToUnload, RenderableBatchHandleVector& batchesToUpload)
+    {
+        const RenderableBatchHandle existingBatch = findBatch(pass, run.front().renderable);
+        if (existingBatch.isValid())
+        {
+            Batch& batch = *m_batches.get(existingBatch);
+            if (batch.members == run)
+            {
+                batch.lastUpdate = m_updateCounter;
+                if (!batch.uploaded && ++batch.stableUpdates >= StableUpdatesBeforeMerging)
+                {
+                    batch.uploaded = true;
+                    batchesToUpload.push_back(existingBatch);
+                }
+                return;
+            }
+        }
+
+        // renderable can appear in pass more than once, it can be member of one batch only
+        for (const auto& member : run)
+        {
+            const RenderableBatchHandle batchHandle = findBatch(pass, member.renderable);
+            if (batchHandle.isValid() && m_batches.get(batchHandle)->lastUpdate == m_updateCounter)
+                return;
+        }
+
+        // run is new or changed, batches overlapping with it are obsolete
+        for (const auto& member : run)
+        {
+            const RenderableBatchHandle batchHandle = findBatch(pass, member.renderable);
+            if (batchHandle.isValid())
+            {
+                if (m_batches.get(batchHandle)->uploaded)
+                    batchesToUnload.push_back(batchHandle);
+                releaseBatch(batchHandle);
+            }
+        }
+
+        // batch handles are never reused so that unloading of obsolete batch cannot be confused with new one
+        const RenderableBatchHandle batchHandle = m_nextBatchHandle;
+        m_nextBatchHandle = RenderableBatchHandle(m_nextBatchHandle.asMemoryHandle() + 1u);
+
+        const UInt32 passIdx = pass.asMemoryHandle();
+        if (passIdx >= m_batchOfRenderable.size())
+            m_batchOfRenderable.resize(passIdx + 1u);
+        for (const auto& member : run)
+            m_batchOfRenderable[passIdx].put(member.renderable, batchHandle);
+
+        Batch batch;
+        batch.pass = pass;
+        batch.usesIndexArray = scene.getCachedHandlesForVertexArrays()[run.front().renderable.asMemoryHandle()].usesIndexArray;
+        for (const auto& member : run)
+            batch.drawCount += member.indexCount;
+        batch.members = std::move(run);
+        batch.lastUpdate = m_updateCounter;
+        m_batches.put(batchHandle, std::move(batch));
+    }
+
+    void RenderableBatchCache::releaseBatch(RenderableBatchHandle batchHandle)
+    {
+        const Batch& batch = *m_batches.get(batchHandle);
+        auto& batchOfRenderable = m_batchOfRenderable[batch.pass.asMemoryHandle()];
+        for (const auto& member : batch.members)
+            batchOfRenderable.remove(member.renderable);
+        if (batch.vertexArray.isValid())
+            ++m_mergedBatchesRevision;
+        m_batches.remove(batchHandle);
+    }
+
+    RenderableBatchHandle RenderableBatchCache::findBatch(RenderPassHandle pass, RenderableHandle renderable) const
+    {
+        if (pass.asMemoryHandle() >= m_batchOfRenderable.size())
+            return RenderableBatchHandle::Invalid();
+
+        const RenderableBatchHandle* batchHandle = m_batchOfRenderable[pass.asMemoryHandle()].get(renderable);
+        return batchHandle ? *batchHandle : RenderableBatchHandle::Invalid();
+    }
+
+    void RenderableBatchCache::setBatchVertexArray(RenderableBatchHandle batchHandle, DeviceResourceHandle vertexArray)
+    {
+        Batch* batch = m_batches.get(batchHandle);
+        assert(batch && batch->uploaded);
+        batch->vertexArray = vertexArray;
+        ++m_mergedBatchesRevision;
+    }
+
+    void RenderableBatchCache::postponeUpload(RenderableBatchHandle batchHandle)
+    {
+        Batch* batch = m_batches.get(batchHandle);
+        assert(batch && batch->uploaded && !batch->vertexArray.isValid());
+        // batch stays stable, next update puts it to upload again
+        batch->uploaded = false;
+    }
+
+    void RenderableBatchCache::reset()
+    {
+        m_batches.clear();
+        m_batchOfRenderable.clear();
+        ++m_mergedBatchesRevision;
+    }
+
+    const RenderableBatchCache::Batch& RenderableBatchCache::getBatch(RenderableBatchHandle batchHandle) const
+    {
+        const Batch* batch = m_batches.get(batchHandle);
+        assert(batch);
+        return *batch;
+    }
+
+    const RenderableBatchCache::Batch* RenderableBatchCache::findMergedBatch(RenderPassHandle pass, RenderableHandle renderable) const
+    {
+        const RenderableBatchHandle batchHandle = findBatch(pass, renderable);
+        if (!batchHandle.isValid())
+            return nullptr;
+
+        const Batch& batch = getBatch(batchHandle);
+        return batch.vertexArray.isValid() ? &batch : nullptr;
+    }
+
+    bool RenderableBatchCache::hasPendingBatches() const
+    {
+        for (const auto& batchIt : m_batches)
+        {
+            if (!batchIt.value.uploaded)
+                return true;
+        }
+        return false;
+    }
+
+    UInt32 RenderableBatchCache::getMergedBatchesRevision() const
+    {
+        return m_mergedBatchesRevision;
+    }
+
+    void RenderableBatchCache::collectGeometryOfPendingBatches(const RendererCachedScene& scene, ResourceContentHashVector& geometry) const
+    {
+        for (const auto& batchIt : m_batches)
+        {
+            if (batchIt.value.uploaded)
+                continue;
+            for (const auto& member : batchIt.value.members)
+            {
+                const DataInstanceHandle geometryInstance = scene.getRenderable(member.renderable).dataInstances[ERenderableDataSlotType_Geometry];
+                const DataLayout& geometryLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(geometryInstance));
+                for (DataFieldHandle field(0u); field < geometryLayout.getFieldCount(); ++field)
+                {
+                    const ResourceContentHash& hash = scene.getDataResource(geometryInstance, field).hash;
+                    if (hash.isValid())
+                        geometry.push_back(hash);
+                }
+            }
+        }
+    }
+
+    bool RenderableBatchCache::IsBatchable(const RendererCachedScene& scene, RenderableHandle renderable)
+    {
+        const Renderable& renderableData = scene.getRenderable(renderable);
+        if (renderableData.visibilityMode != EVisibilityMode::Visible || renderableData.instanceCount != 1u || renderableData.indexCount == 0u
+            || scene.renderableResourcesDirty(renderable) || scene.isRenderableVertexArrayDirty(renderable)
+            || !scene.getCachedHandlesForVertexArrays()[renderable.asMemoryHandle()].deviceHandle.isValid()
+            || !HasListDrawMode(scene, renderable))
+            return false;
+
+        // only static geometry from client resources can be merged, data buffers can be modified any time
+        const DataInstanceHandle geometryInstance = renderableData.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& geometryLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(geometryInstance));
+        for (DataFieldHandle field(0u); field < geometryLayout.getFieldCount(); ++field)
+        {
+            const ResourceField& dataResource = scene.getDataResource(geometryInstance, field);
+            if (dataResource.dataBuffer.isValid() || dataResource.instancingDivisor != 0u || dataResource.offsetWithinElementInBytes != 0u || dataResource.stride != 0u)
+                return false;
+            // only indices are optional
+            if (field.asMemoryHandle() > 0u && !dataResource.hash.isValid())
+                return false;
+        }
+
+        return true;
+    }
+
+    bool RenderableBatchCache::CanBeBatchedTogether(const RendererCachedScene& scene, RenderableHandle first, RenderableHandle other)
+    {
+        const Renderable& firstData = scene.getRenderable(first);
+        const Renderable& otherData = scene.getRenderable(other);
+        if (firstData.dataInstances[ERenderableDataSlotType_Uniforms] != otherData.dataInstances[ERenderableDataSlotType_Uniforms] || firstData.renderState != otherData.renderState
+            || !HasListDrawMode(scene, first) || !HasListDrawMode(scene, other))
+            return false;
+
+        const DataInstanceHandle firstGeometry = firstData.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataInstanceHandle otherGeometry = otherData.dataInstances[ERenderableDataSlotType_Geometry];
+        if (scene.getLayoutOfDataInstance(firstGeometry) != scene.getLayoutOfDataInstance(otherGeometry))
+            return false;
+
+        const VertexArrayCache& vertexArrays = scene.getCachedHandlesForVertexArrays();
+        if (vertexArrays[first.asMemoryHandle()].usesIndexArray != vertexArrays[other.asMemoryHandle()].usesIndexArray)
+            return false;
+
+        // semantic uniforms (e.g. model matrix) are set only once for whole batch
+        return scene.getRenderableWorldMatrix(first) == scene.getRenderableWorldMatrix(other);
+    }
+
+    bool RenderableBatchCache::HasListDrawMode(const RendererCachedScene& scene, RenderableHandle renderable)
+    {
+        // strips, fans and loops connect each primitive to previous one, concatenated geometry of several members
+        // would be connected too, only lists of independent primitives can be merged
+        const RenderStateHandle renderState = scene.getRenderable(renderable).renderState;
+        if (!renderState.isValid() || !scene.isRenderStateAllocated(renderState))
+            return false;
+
+        switch (scene.getRenderState(renderState).drawMode)
+        {
+        case EDrawMode::Points:
+        case EDrawMode::Lines:
+        case EDrawMode::Triangles:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
@@ -0,0 +1,158 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderableBatchGeometry.h"
+#include "Resource/ArrayResource.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        UInt32 GetIndex(const ArrayResource& indices, UInt32 i)
+        {
+            const Byte* data = indices.getResourceData().data();
+            if (indices.getElementType() == EDataType::UInt16)
+            {
+                UInt16 value = 0u;
+                std::memcpy(&value, data + i * sizeof(UInt16), sizeof(UInt16));
+                return value;
+            }
+
+            UInt32 value = 0u;
+            std::memcpy(&value, data + i * sizeof(UInt32), sizeof(UInt32));
+            return value;
+        }
+
+        template <typename INDEXTYPE>
+        void AppendIndex(std::vector<Byte>& indexData, UInt32 index)
+        {
+            const INDEXTYPE value = static_cast<INDEXTYPE>(index);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const Byte* valueBytes = reinterpret_cast<const Byte*>(&value);
+            indexData.insert(indexData.end(), valueBytes, valueBytes + sizeof(INDEXTYPE));
+        }
+
+        // [first, end) range of vertices of member which is copied into merged vertex data
+        struct VertexRange
+        {
+            UInt32 first = 0u;
+            UInt32 end = 0u;
+        };
+    }
+
+    bool RenderableBatchGeometry::Merge(const std::vector<MemberData>& members, RenderableBatchGeometry& geometryOut)
+    {
+        if (members.empty() || members.front().vertexAttributes.empty())
+            return false;
+
+        const bool indexed = (members.front().indices != nullptr);
+        const size_t attributeCount = members.front().vertexAttributes.size();
+        std::vector<EDataType> attributeTypes;
+        for (const auto attribute : members.front().vertexAttributes)
+        {
+            // vertex count of interleaved data cannot be derived from resource
+            if (attribute->getElementType() == EDataType::ByteBlob)
+                return false;
+            attributeTypes.push_back(attribute->getElementType());
+        }
+
+        // validate members and determine vertex range of each to copy
+        std::vector<VertexRange> vertexRanges(members.size());
+        UInt32 totalVertexCount = 0u;
+        UInt32 totalDrawCount = 0u;
+        for (size_t m = 0u; m < members.size(); ++m)
+        {
+            const MemberData& member = members[m];
+            if ((member.indices != nullptr) != indexed || member.vertexAttributes.size() != attributeCount || member.indexCount == 0u)
+                return false;
+
+            UInt32 availableVertices = std::numeric_limits<UInt32>::max();
+            for (size_t a = 0u; a < attributeCount; ++a)
+            {
+                const ArrayResource& attribute = *member.vertexAttributes[a];
+                if (attribute.getElementType() != attributeTypes[a] || attribute.getElementCount() < member.startVertex)
+                    return false;
+                availableVertices = std::min(availableVertices, attribute.getElementCount() - member.startVertex);
+            }
+
+            VertexRange& range = vertexRanges[m];
+            if (indexed)
+            {
+                const ArrayResource& indices = *member.indices;
+                if ((indices.getElementType() != EDataType::UInt16 && indices.getElementType() != EDataType::UInt32) ||
+                    member.startIndex > indices.getElementCount() || member.indexCount > indices.getElementCount() - member.startIndex)
+                    return false;
+
+                // only vertices referenced by member's indices are copied
+                range.first = std::numeric_limits<UInt32>::max();
+                for (UInt32 i = member.startIndex; i < member.startIndex + member.indexCount; ++i)
+                {
+                    const UInt32 index = GetIndex(indices, i);
+                    if (index >= availableVertices)
+                        return false;
+                    range.first = std::min(range.first, index);
+                    range.end = std::max(range.end, index + 1u);
+                }
+            }
+            else
+            {
+                if (member.startIndex > availableVertices || member.indexCount > availableVertices - member.startIndex)
+                    return false;
+                range.first = member.startIndex;
+                range.end = member.startIndex + member.indexCount;
+            }
+
+            totalVertexCount += range.end - range.first;
+            totalDrawCount += member.indexCount;
+        }
+
+        geometryOut.vertexData.assign(attributeCount, {});
+        for (size_t a = 0u; a < attributeCount; ++a)
+        {
+            const UInt32 elementSize = EnumToSize(attributeTypes[a]);
+            auto& vertexData = geometryOut.vertexData[a];
+            vertexData.reserve(totalVertexCount * elementSize);
+            for (size_t m = 0u; m < members.size(); ++m)
+            {
+                const Byte* data = members[m].vertexAttributes[a]->getResourceData().data();
+                const UInt32 first = members[m].startVertex + vertexRanges[m].first;
+                const UInt32 end = members[m].startVertex + vertexRanges[m].end;
+                vertexData.insert(vertexData.end(), data + first * elementSize, data + end * elementSize);
+            }
+        }
+
+        geometryOut.indexData.clear();
+        geometryOut.indexType = EDataType::Invalid;
+        if (indexed)
+        {
+            geometryOut.indexType = (totalVertexCount > std::numeric_limits<UInt16>::max() + 1u ? EDataType::UInt32 : EDataType::UInt16);
+            geometryOut.indexData.reserve(totalDrawCount * EnumToSize(geometryOut.indexType));
+
+            UInt32 vertexBase = 0u;
+            for (size_t m = 0u; m < members.size(); ++m)
+            {
+                const MemberData& member = members[m];
+                for (UInt32 i = member.startIndex; i < member.startIndex + member.indexCount; ++i)
+                {
+                    const UInt32 index = GetIndex(*member.indices, i) - vertexRanges[m].first + vertexBase;
+                    if (geometryOut.indexType == EDataType::UInt16)
+                        AppendIndex<UInt16>(geometryOut.indexData, index);
+                    else
+                        AppendIndex<UInt32>(geometryOut.indexData, index);
+                }
+                vertexBase += vertexRanges[m].end - vertexRanges[m].first;
+            }
+        }
+
+        geometryOut.drawCount = totalDrawCount;
+        return true;
+    }
+}
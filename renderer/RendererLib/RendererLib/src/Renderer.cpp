@@ -370,7 +370,7 @@ namespace ramses_internal
 
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
                 renderContext.renderFrom = m_rendererInterruptState.getExecutorState();
-                const SceneRenderExecutionIterator interruptState = m_displayController->renderScene(scene, renderContext, &m_frameTimer);
+                const SceneRenderExecutionIterator interruptState = m_displayController->renderScene(scene, renderContext, &m_frameTimer, &m_passCostEstimator);
 
                 if (RendererInterruptState::IsInterrupted(interruptState))
                 {
@@ -472,6 +472,7 @@ namespace ramses_internal
     {
         assert(m_rendererScenes.hasScene(sceneId));
         m_displayBuffersSetup.unassignScene(sceneId);
+        m_passCostEstimator.removeScene(sceneId);
     }
 
     void Renderer::setSceneShown(SceneId sceneId, Bool show)
@@ -558,7 +559,7 @@ namespace ramses_internal
         const UInt32 postProcessorEffects = config.isWarpingEnabled() ? EPostProcessingEffect_Warping : EPostProcessingEffect_None;
         const UInt32 numSamples = config.getAntialiasingSampleCount();
 
-        return new DisplayController(*renderBackend, numSamples, postProcessorEffects);
+        return new DisplayController(*renderBackend, numSamples, postProcessorEffects, config.isDrawCallSortingEnabled());
     }
 
     void Renderer::setClearFlags(DeviceResourceHandle bufferDeviceHandle, uint32_t clearFlags)
@@ -9,57 +9,206 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/RenderableComparator.h"
 #include "RenderingPassOrderComparator.h"
+#include "TaskFramework/ParallelTaskGroup.h"
 #include <algorithm>
+#include <numeric>
+#include <tuple>
 
 namespace ramses_internal
 {
     RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : TextureLinkCachedScene(sceneLinksManager, sceneInfo)
-        , m_renderableOrderingDirty(true)
+        , m_renderingPassesDirty(true)
     {
     }
 
+    namespace
+    {
+        struct DrawStateKey
+        {
+            DeviceResourceHandle shader;
+            DeviceResourceHandle texture;
+            DeviceResourceHandle vertexArray;
+            RenderStateHandle renderState;
+
+            bool operator<(const DrawStateKey& other) const
+            {
+                return std::tie(shader, texture, vertexArray, renderState) < std::tie(other.shader, other.texture, other.vertexArray, other.renderState);
+            }
+        };
+
+        DrawStateKey GetDrawStateKey(const RendererCachedScene& scene, RenderPassHandle pass, RenderableHandle renderableHandle)
+        {
+            const Renderable& renderable = scene.getRenderable(renderableHandle);
+            DrawStateKey key;
+            key.shader = scene.getRenderableEffectDeviceHandle(renderableHandle);
+            // members of batch share merged vertex array, this keeps them next to each other after sorting
+            const RenderableBatchCache::Batch* batch = scene.getRenderableBatches().findMergedBatch(pass, renderableHandle);
+            key.vertexArray = (batch ? batch->vertexArray : scene.getCachedHandlesForVertexArrays()[renderableHandle.asMemoryHandle()].deviceHandle);
+            key.renderState = renderable.renderState;
+
+            // first texture is used as representative, in most cases renderables with same first texture share also the other ones
+            const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+            if (uniformData.isValid())
+            {
+                const DataLayout& dataLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(uniformData));
+                for (DataFieldHandle field(0u); field < dataLayout.getFieldCount(); ++field)
+                {
+                    if (IsTextureSamplerType(dataLayout.getField(field).dataType))
+                    {
+                        const TextureSamplerHandle sampler = scene.getDataTextureSamplerHandle(uniformData, field);
+                        if (sampler.isValid())
+                            key.texture = scene.getCachedHandlesForTextureSamplers()[sampler.asMemoryHandle()];
+                        break;
+                    }
+                }
+            }
+
+            return key;
+        }
+
+        UInt32 CountStateChanges(const std::vector<DrawStateKey>& keys)
+        {
+            UInt32 count = 0u;
+            for (size_t i = 1u; i < keys.size(); ++i)
+            {
+                count += (keys[i].shader != keys[i - 1].shader ? 1u : 0u);
+                count += (keys[i].texture != keys[i - 1].texture ? 1u : 0u);
+                count += (keys[i].vertexArray != keys[i - 1].vertexArray ? 1u : 0u);
+                count += (keys[i].renderState != keys[i - 1].renderState ? 1u : 0u);
+            }
+            return count;
+        }
+    }
+
+    static Bool IsRenderableVisible(const IScene& scene, RenderableHandle renderable)
+    {
+        return scene.getRenderable(renderable).visibilityMode == EVisibilityMode::Visible;
+    }
+
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
+        const Bool wasVisible = IsRenderableVisible(*this, renderableHandle);
         TextureLinkCachedScene::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+        const Bool isVisible = (visible == EVisibilityMode::Visible);
+
+        if (wasVisible == isVisible || renderableHandle.asMemoryHandle() >= m_renderableGroups.size())
+            return;
+
+        for (const auto& groupEntry : m_renderableGroups[renderableHandle.asMemoryHandle()])
+        {
+            if (isVisible)
+                scheduleRenderableInsertion(groupEntry.renderGroup, renderableHandle, groupEntry.order);
+            else
+                removeRenderableFromPasses(groupEntry.renderGroup, renderableHandle, groupEntry.order);
+        }
+    }
+
+    void RendererCachedScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
+    {
+        TextureLinkCachedScene::setRenderableRenderState(renderableHandle, stateHandle);
+        invalidateDrawStateSorting();
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        const Bool orderingChanged = (slot == ERenderableDataSlotType_Geometry && getRenderable(renderableHandle).dataInstances[slot] != newDataInstance);
+        TextureLinkCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+
+        // geometry instance and effect of its layout are part of renderable's ordering within a group, position in passes is not known anymore
+        if (orderingChanged && renderableHandle.asMemoryHandle() < m_renderableGroups.size())
+        {
+            for (const auto& groupEntry : m_renderableGroups[renderableHandle.asMemoryHandle()])
+                markPassesContainingRenderGroupForRebuild(groupEntry.renderGroup);
+        }
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        for (const auto& entry : TextureLinkCachedScene::getRenderGroup(groupHandle).renderables)
+        {
+            if (entry.renderable.asMemoryHandle() < m_renderableGroups.size())
+            {
+                RenderGroupOrderVector& groups = m_renderableGroups[entry.renderable.asMemoryHandle()];
+                groups.erase(std::remove_if(groups.begin(), groups.end(), [groupHandle](const RenderGroupOrderEntry& e) { return e.renderGroup == groupHandle; }), groups.end());
+            }
+        }
+        m_pendingRenderableInsertions.erase(std::remove_if(m_pendingRenderableInsertions.begin(), m_pendingRenderableInsertions.end(),
+            [groupHandle](const PendingRenderableInsertion& p) { return p.renderGroup == groupHandle; }), m_pendingRenderableInsertions.end());
+        markPassesContainingRenderGroupForRebuild(groupHandle);
+
         TextureLinkCachedScene::releaseRenderGroup(groupHandle);
-        m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+
+        if (renderableHandle.asMemoryHandle() >= m_renderableGroups.size())
+            m_renderableGroups.resize(renderableHandle.asMemoryHandle() + 1u);
+        m_renderableGroups[renderableHandle.asMemoryHandle()].push_back({ groupHandle, order });
+
+        if (IsRenderableVisible(*this, renderableHandle))
+            scheduleRenderableInsertion(groupHandle, renderableHandle, order);
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
+        assert(renderableHandle.asMemoryHandle() < m_renderableGroups.size());
+        RenderGroupOrderVector& groups = m_renderableGroups[renderableHandle.asMemoryHandle()];
+        const auto it = std::find_if(groups.begin(), groups.end(), [groupHandle](const RenderGroupOrderEntry& e) { return e.renderGroup == groupHandle; });
+        assert(it != groups.end());
+        const Int32 order = it->order;
+        groups.erase(it);
+
+        // renderable might be already released, its visibility cannot be checked
+        removeRenderableFromPasses(groupHandle, renderableHandle, order);
+
+        // renderables behind removed one move up in group
+        const RenderableOrderVector& groupRenderables = TextureLinkCachedScene::getRenderGroup(groupHandle).renderables;
+        const auto removedIndex = static_cast<UInt32>(std::find_if(groupRenderables.cbegin(), groupRenderables.cend(),
+            [renderableHandle](const RenderableOrderEntry& e) { return e.renderable == renderableHandle; }) - groupRenderables.cbegin());
+        std::vector<UInt32> newGroupIndices(groupRenderables.size());
+        std::iota(newGroupIndices.begin(), newGroupIndices.end(), 0u);
+        for (UInt32 i = removedIndex + 1u; i < newGroupIndices.size(); ++i)
+            --newGroupIndices[i];
         TextureLinkCachedScene::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+        updateRenderGroupIndicesInValidPasses(groupHandle, newGroupIndices);
+    }
+
+    RenderPassHandle RendererCachedScene::allocateRenderPass(UInt32 renderGroupCount, RenderPassHandle passHandle)
+    {
+        const RenderPassHandle renderPass = TextureLinkCachedScene::allocateRenderPass(renderGroupCount, passHandle);
+        m_renderingPassesDirty = true;
+
+        return renderPass;
+    }
+
+    void RendererCachedScene::setRenderPassCamera(RenderPassHandle passHandle, CameraHandle cameraHandle)
+    {
+        TextureLinkCachedScene::setRenderPassCamera(passHandle, cameraHandle);
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
         m_renderOncePassesToRender.remove(passHandle);
         TextureLinkCachedScene::releaseRenderPass(passHandle);
-        m_renderableOrderingDirty = true;
+        if (passHandle.asMemoryHandle() < m_passRenderables.size())
+            m_passRenderables[passHandle.asMemoryHandle()] = PassRenderables();
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOrder(RenderPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setRenderPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     BlitPassHandle RendererCachedScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle /*= BlitPassHandle::Invalid()*/)
     {
         const BlitPassHandle blitPass = TextureLinkCachedScene::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
 
         return blitPass;
     }
@@ -67,19 +216,19 @@ namespace ramses_internal
     void RendererCachedScene::releaseBlitPass(BlitPassHandle passHandle)
     {
         TextureLinkCachedScene::releaseBlitPass(passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassRenderOrder(BlitPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setBlitPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassEnabled(BlitPassHandle passHandle, Bool isEnabled)
     {
         TextureLinkCachedScene::setBlitPassEnabled(passHandle, isEnabled);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, Bool isEnabled)
@@ -93,7 +242,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOnce(RenderPassHandle passHandle, Bool enable)
@@ -107,7 +256,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::retriggerRenderPassRenderOnce(RenderPassHandle passHandle)
@@ -116,32 +265,36 @@ namespace ramses_internal
         if (TextureLinkCachedScene::getRenderPass(passHandle).isEnabled)
         {
             m_renderOncePassesToRender.put(passHandle);
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
-        m_renderableOrderingDirty = true;
+        if (passHandle.asMemoryHandle() < m_passRenderables.size())
+            m_passRenderables[passHandle.asMemoryHandle()].needsRebuild = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderPass(passHandle, groupHandle);
-        m_renderableOrderingDirty = true;
+        if (passHandle.asMemoryHandle() < m_passRenderables.size())
+            m_passRenderables[passHandle.asMemoryHandle()].needsRebuild = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+        markPassesContainingRenderGroupForRebuild(groupHandleParent);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
-        m_renderableOrderingDirty = true;
+        markPassesContainingRenderGroupForRebuild(groupHandleParent);
     }
 
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
@@ -151,8 +304,85 @@ namespace ramses_internal
 
     const RenderableVector& RendererCachedScene::getOrderedRenderablesForPass(RenderPassHandle pass) const
     {
-        assert(pass.asMemoryHandle() < m_passRenderableOrder.size());
-        return m_passRenderableOrder[pass.asMemoryHandle()];
+        assert(pass.asMemoryHandle() < m_passRenderables.size());
+        return m_passRenderables[pass.asMemoryHandle()].renderables;
+    }
+
+    const RendererCachedScene::RenderableIndexRanges& RendererCachedScene::getReorderableRenderableRangesForPass(RenderPassHandle pass) const
+    {
+        assert(pass.asMemoryHandle() < m_passRenderables.size());
+        return m_passRenderables[pass.asMemoryHandle()].reorderableRanges;
+    }
+
+    const RendererCachedScene::DrawStateSortedRenderables& RendererCachedScene::getDrawStateSortedRenderablesForPass(RenderPassHandle pass) const
+    {
+        assert(pass.asMemoryHandle() < m_passRenderables.size());
+        return m_passRenderables[pass.asMemoryHandle()].drawStateSorted;
+    }
+
+    void RendererCachedScene::updateDrawStateSorting()
+    {
+        invalidateOutdatedDrawStateSorting();
+
+        std::vector<std::pair<DrawStateKey, RenderableHandle>> rangeEntries;
+        std::vector<DrawStateKey> rangeKeys;
+        for (const auto& passInfo : m_sortedRenderingPasses)
+        {
+            if (passInfo.getType() != ERenderingPassType::RenderPass)
+                continue;
+
+            const RenderPassHandle pass = passInfo.getRenderPassHandle();
+            PassRenderables& passRenderables = m_passRenderables[pass.asMemoryHandle()];
+            DrawStateSortedRenderables& sorted = passRenderables.drawStateSorted;
+            if (sorted.valid || passRenderables.reorderableRanges.empty())
+                continue;
+
+            // sorting is deterministic so that rendering interrupted within this pass continues with same order
+            const RenderableVector& orderedRenderables = passRenderables.renderables;
+            sorted.renderables = orderedRenderables;
+            sorted.stateChangesSaved = 0u;
+            for (const auto& range : passRenderables.reorderableRanges)
+            {
+                rangeEntries.clear();
+                for (UInt32 i = range.first; i < range.second; ++i)
+                    rangeEntries.push_back({ GetDrawStateKey(*this, pass, orderedRenderables[i]), orderedRenderables[i] });
+
+                rangeKeys.clear();
+                for (const auto& entry : rangeEntries)
+                    rangeKeys.push_back(entry.first);
+                const UInt32 stateChangesBefore = CountStateChanges(rangeKeys);
+
+                std::stable_sort(rangeEntries.begin(), rangeEntries.end(), [](const auto& e1, const auto& e2) { return e1.first < e2.first; });
+
+                rangeKeys.clear();
+                for (UInt32 i = 0u; i < rangeEntries.size(); ++i)
+                {
+                    rangeKeys.push_back(rangeEntries[i].first);
+                    sorted.renderables[range.first + i] = rangeEntries[i].second;
+                }
+                const UInt32 stateChangesAfter = CountStateChanges(rangeKeys);
+
+                if (stateChangesBefore > stateChangesAfter)
+                    sorted.stateChangesSaved += stateChangesBefore - stateChangesAfter;
+            }
+            sorted.valid = true;
+        }
+    }
+
+    void RendererCachedScene::invalidateOutdatedDrawStateSorting()
+    {
+        const std::array<UInt32, 2u> revisions{ getRenderableResourcesRevision(), m_renderableBatches.getMergedBatchesRevision() };
+        if (revisions != m_drawStateSortingRevisions)
+        {
+            invalidateDrawStateSorting();
+            m_drawStateSortingRevisions = revisions;
+        }
+    }
+
+    void RendererCachedScene::invalidateDrawStateSorting()
+    {
+        for (auto& passRenderables : m_passRenderables)
+            passRenderables.drawStateSorted.valid = false;
     }
 
     void RendererCachedScene::updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager)
@@ -163,7 +393,7 @@ namespace ramses_internal
 
     void RendererCachedScene::updatePassRenderableSorting()
     {
-        if (m_renderableOrderingDirty)
+        if (m_renderingPassesDirty)
         {
             m_sortedRenderingPasses.clear();
 
@@ -171,10 +401,9 @@ namespace ramses_internal
             const UInt32 totalNumberOfBlitPasses = TextureLinkCachedScene::getBlitPassCount();
 
             //add render passes
-            m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+            m_passRenderables.resize(totalNumberOfRenderPasses);
             for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
             {
-                m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
                 if (shouldRenderPassBeRendered(passHandle))
                     m_sortedRenderingPasses.emplace_back(passHandle);
             }
@@ -198,15 +427,30 @@ namespace ramses_internal
             RenderingPassOrderComparator comparator(*this);
             std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
 
-            //update renderables according to sorted render passes
-            for (const auto& pass : m_sortedRenderingPasses)
+            m_renderingPassesDirty = false;
+        }
+
+        // renderables added to render groups (or made visible) are inserted into passes which stay valid,
+        // only passes whose render group structure changed are rebuilt from scratch
+        insertPendingRenderables();
+
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass == pass.getType() && m_passRenderables[pass.getRenderPassHandle().asMemoryHandle()].needsRebuild)
+                rebuildRenderablesInPass(pass.getRenderPassHandle());
+        }
+
+        for (auto& passRenderables : m_passRenderables)
+        {
+            if (passRenderables.changed)
             {
-                if (ERenderingPassType::RenderPass == pass.getType())
-                    updateRenderablesInPass(pass.getRenderPassHandle());
+                updateReorderableRanges(passRenderables);
+                passRenderables.drawStateSorted.valid = false;
+                passRenderables.changed = false;
             }
-
-            m_renderableOrderingDirty = false;
         }
+
+        invalidateOutdatedDrawStateSorting();
     }
 
     const Matrix44f& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
@@ -215,78 +459,384 @@ namespace ramses_internal
         return m_renderableMatrices[renderable.asMemoryHandle()];
     }
 
-    void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
+    void RendererCachedScene::rebuildRenderablesInPass(RenderPassHandle passHandle)
     {
-        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        PassRenderables& passRenderables = m_passRenderables[passHandle.asMemoryHandle()];
+        passRenderables.renderables.clear();
+        passRenderables.origins.clear();
+        passRenderables.groupSpans.clear();
+        passRenderables.groupSpanIndices.clear();
 
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
-
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        if (!std::is_sorted(orderedRenderGroups.cbegin(), orderedRenderGroups.cend()))
+            std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
 
         for(const auto& renderGroup : orderedRenderGroups)
         {
-            addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
+            addRenderablesFromRenderGroup(passRenderables, renderGroup.renderGroup, renderGroup.order, InvalidSpanIndex);
         }
-    }
 
-    static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
-    {
-        if (scene.getRenderable(renderable).visibilityMode == EVisibilityMode::Visible)
-        {
-            orderedRenderables.push_back(renderable);
-        }
+        passRenderables.needsRebuild = false;
+        passRenderables.changed = true;
     }
 
-    void RendererCachedScene::addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle)
+    void RendererCachedScene::addRenderablesFromRenderGroup(PassRenderables& passRenderables, RenderGroupHandle renderGroupHandle, Int32 order, UInt32 parentSpan)
     {
         assert(isRenderGroupAllocated(renderGroupHandle));
 
         RenderGroup& renderGroup = getRenderGroupInternal(renderGroupHandle);
-        // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently
+        // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently,
+        // renderables are sorted stably and only if not sorted already so that entries with equal order keep their relative position
         RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
         RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
 
-        RenderableComparator renderableComp(*this);
-        std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        if (!std::is_sorted(orderedGroupRenderables.cbegin(), orderedGroupRenderables.cend(), RenderableComparator(*this)))
+            sortRenderablesOfRenderGroup(renderGroupHandle, orderedGroupRenderables);
+        if (!std::is_sorted(orderedRenderGroups.cbegin(), orderedRenderGroups.cend()))
+            std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+
+        const UInt32 spanIdx = static_cast<UInt32>(passRenderables.groupSpans.size());
+        const UInt32 spanBegin = static_cast<UInt32>(passRenderables.renderables.size());
+        passRenderables.groupSpans.push_back({ renderGroupHandle, order, parentSpan, 0u, spanBegin, spanBegin });
+        UInt32* existingSpanIdx = passRenderables.groupSpanIndices.get(renderGroupHandle);
+        if (existingSpanIdx != nullptr)
+            *existingSpanIdx = InvalidSpanIndex;
+        else
+            passRenderables.groupSpanIndices.put(renderGroupHandle, spanIdx);
 
         RenderableOrderVector::iterator renderablesIterator = orderedGroupRenderables.begin();
         RenderGroupOrderVector::iterator renderGroupIterator = orderedRenderGroups.begin();
+        const auto addRenderable = [&](const RenderableOrderEntry& entry)
+        {
+            if (IsRenderableVisible(*this, entry.renderable))
+            {
+                passRenderables.renderables.push_back(entry.renderable);
+                passRenderables.origins.push_back({ spanIdx, entry.order, static_cast<UInt32>(renderablesIterator - orderedGroupRenderables.begin()) });
+            }
+        };
+
         while (renderablesIterator != orderedGroupRenderables.end()
             || renderGroupIterator != orderedRenderGroups.end())
         {
             if (renderGroupIterator == orderedRenderGroups.end())
             {
-                AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                addRenderable(*renderablesIterator);
                 ++renderablesIterator;
             }
             else if (renderablesIterator == orderedGroupRenderables.end())
             {
-                addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                addRenderablesFromRenderGroup(passRenderables, renderGroupIterator->renderGroup, renderGroupIterator->order, spanIdx);
                 ++renderGroupIterator;
             }
             else
             {
                 if (renderablesIterator->order < renderGroupIterator->order)
                 {
-                    AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                    addRenderable(*renderablesIterator);
                     ++renderablesIterator;
                 }
                 else
                 {
-                    addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                    addRenderablesFromRenderGroup(passRenderables, renderGroupIterator->renderGroup, renderGroupIterator->order, spanIdx);
                     ++renderGroupIterator;
                 }
             }
         }
+
+        RenderGroupSpan& span = passRenderables.groupSpans[spanIdx];
+        span.end = static_cast<UInt32>(passRenderables.renderables.size());
+        span.descendantSpanCount = static_cast<UInt32>(passRenderables.groupSpans.size()) - spanIdx - 1u;
+    }
+
+    void RendererCachedScene::sortRenderablesOfRenderGroup(RenderGroupHandle renderGroup, RenderableOrderVector& renderables)
+    {
+        // sorted stably so that entries with equal order keep their relative position, valid passes keep referring to it
+        std::vector<UInt32> sortedGroupIndices(renderables.size());
+        std::iota(sortedGroupIndices.begin(), sortedGroupIndices.end(), 0u);
+        RenderableComparator renderableComp(*this);
+        std::stable_sort(sortedGroupIndices.begin(), sortedGroupIndices.end(), [&](UInt32 i1, UInt32 i2) { return renderableComp(renderables[i1], renderables[i2]); });
+
+        RenderableOrderVector sortedRenderables;
+        sortedRenderables.reserve(renderables.size());
+        std::vector<UInt32> newGroupIndices(renderables.size());
+        for (UInt32 i = 0u; i < sortedGroupIndices.size(); ++i)
+        {
+            sortedRenderables.push_back(renderables[sortedGroupIndices[i]]);
+            newGroupIndices[sortedGroupIndices[i]] = i;
+        }
+        renderables.swap(sortedRenderables);
+
+        updateRenderGroupIndicesInValidPasses(renderGroup, newGroupIndices);
+    }
+
+    void RendererCachedScene::updateRenderGroupIndicesInValidPasses(RenderGroupHandle renderGroup, const std::vector<UInt32>& newGroupIndices)
+    {
+        for (auto& passRenderables : m_passRenderables)
+        {
+            if (passRenderables.needsRebuild || !passRenderables.groupSpanIndices.contains(renderGroup))
+                continue;
+
+            // group might be used more than once in pass
+            const std::vector<RenderGroupSpan>& spans = passRenderables.groupSpans;
+            for (UInt32 spanIdx = 0u; spanIdx < spans.size(); ++spanIdx)
+            {
+                if (spans[spanIdx].renderGroup != renderGroup)
+                    continue;
+                for (UInt32 i = spans[spanIdx].begin; i < spans[spanIdx].end; ++i)
+                {
+                    RenderableOrigin& origin = passRenderables.origins[i];
+                    if (origin.span == spanIdx)
+                        origin.groupIndex = newGroupIndices[origin.groupIndex];
+                }
+            }
+        }
+    }
+
+    void RendererCachedScene::updateReorderableRanges(PassRenderables& passRenderables) const
+    {
+        // renderables of a group with same order are always placed consecutively (nested groups with same order go before them),
+        // report such ranges so that renderer can reorder renderables within them
+        RenderableIndexRanges& ranges = passRenderables.reorderableRanges;
+        const std::vector<RenderableOrigin>& origins = passRenderables.origins;
+        ranges.clear();
+
+        UInt32 rangeBegin = 0u;
+        for (UInt32 i = 1u; i <= origins.size(); ++i)
+        {
+            if (i == origins.size() || origins[i].span != origins[rangeBegin].span || origins[i].order != origins[rangeBegin].order)
+            {
+                if (i - rangeBegin > 1u)
+                    ranges.push_back({ rangeBegin, i });
+                rangeBegin = i;
+            }
+        }
+    }
+
+    Bool RendererCachedScene::isRenderGroupInAnyValidPass(RenderGroupHandle renderGroup) const
+    {
+        return std::any_of(m_passRenderables.cbegin(), m_passRenderables.cend(), [renderGroup](const PassRenderables& passRenderables)
+        {
+            return !passRenderables.needsRebuild && passRenderables.groupSpanIndices.contains(renderGroup);
+        });
+    }
+
+    void RendererCachedScene::markPassesContainingRenderGroupForRebuild(RenderGroupHandle renderGroup)
+    {
+        for (auto& passRenderables : m_passRenderables)
+        {
+            if (passRenderables.groupSpanIndices.contains(renderGroup))
+                passRenderables.needsRebuild = true;
+        }
+    }
+
+    void RendererCachedScene::scheduleRenderableInsertion(RenderGroupHandle renderGroup, RenderableHandle renderable, Int32 order)
+    {
+        // group is not used by any valid pass, it will be fully processed when a pass containing it is rebuilt
+        if (!isRenderGroupInAnyValidPass(renderGroup))
+            return;
+
+        // insertion is deferred until update so that renderable's effect (used for ordering) is known
+        if (m_pendingRenderableInsertions.size() >= MaxPendingRenderableInsertions)
+        {
+            markPassesContainingRenderGroupForRebuild(renderGroup);
+            return;
+        }
+
+        // renderable added invisible and made visible before update is already scheduled
+        const auto it = std::find_if(m_pendingRenderableInsertions.cbegin(), m_pendingRenderableInsertions.cend(),
+            [&](const PendingRenderableInsertion& p) { return p.renderGroup == renderGroup && p.renderable == renderable; });
+        if (it == m_pendingRenderableInsertions.cend())
+            m_pendingRenderableInsertions.push_back({ renderGroup, renderable, order });
+    }
+
+    void RendererCachedScene::insertPendingRenderables()
+    {
+        for (const auto& pending : m_pendingRenderableInsertions)
+        {
+            if (!isRenderableAllocated(pending.renderable) || !IsRenderableVisible(*this, pending.renderable))
+                continue;
+
+            for (auto& passRenderables : m_passRenderables)
+            {
+                if (passRenderables.needsRebuild)
+                    continue;
+
+                const UInt32* spanIdx = passRenderables.groupSpanIndices.get(pending.renderGroup);
+                if (spanIdx == nullptr)
+                    continue;
+
+                if (*spanIdx == InvalidSpanIndex)
+                {
+                    // group is used more than once in pass
+                    passRenderables.needsRebuild = true;
+                    continue;
+                }
+
+                insertRenderableIntoPass(passRenderables, *spanIdx, pending.renderable, pending.order);
+                passRenderables.changed = true;
+            }
+        }
+        m_pendingRenderableInsertions.clear();
+    }
+
+    void RendererCachedScene::insertRenderableIntoPass(PassRenderables& passRenderables, UInt32 spanIdx, RenderableHandle renderable, Int32 order) const
+    {
+        std::vector<RenderGroupSpan>& spans = passRenderables.groupSpans;
+        const RenderGroupSpan& span = spans[spanIdx];
+
+        // entries the comparator considers equal keep their relative position within the group (group is stable sorted on rebuild),
+        // renderable made visible again is therefore inserted at its original position among them
+        const RenderableOrderVector& groupRenderables = getRenderGroup(span.renderGroup).renderables;
+        const auto newGroupIndex = static_cast<UInt32>(std::find_if(groupRenderables.cbegin(), groupRenderables.cend(),
+            [renderable](const RenderableOrderEntry& e) { return e.renderable == renderable; }) - groupRenderables.cbegin());
+
+        RenderableComparator renderableComp(*this);
+        const RenderableOrderEntry newEntry{ renderable, order };
+        const auto goesAfterNewEntry = [&](UInt32 idx)
+        {
+            const RenderableOrigin& origin = passRenderables.origins[idx];
+            const RenderableOrderEntry entry{ passRenderables.renderables[idx], origin.order };
+            if (renderableComp(newEntry, entry))
+                return true;
+            if (renderableComp(entry, newEntry))
+                return false;
+            return newGroupIndex < origin.groupIndex;
+        };
+
+        // find first entry of group span which would be ordered after new renderable, merging rules same as in addRenderablesFromRenderGroup
+        UInt32 insertIdx = span.begin;
+        if (span.descendantSpanCount == 0u)
+        {
+            // no nested groups, renderables of span are sorted
+            UInt32 endIdx = span.end;
+            while (insertIdx < endIdx)
+            {
+                const UInt32 midIdx = insertIdx + (endIdx - insertIdx) / 2u;
+                if (goesAfterNewEntry(midIdx))
+                    endIdx = midIdx;
+                else
+                    insertIdx = midIdx + 1u;
+            }
+        }
+        else
+        {
+            const UInt32 endSpanIdx = spanIdx + 1u + span.descendantSpanCount;
+            UInt32 childSpanIdx = spanIdx + 1u;
+            for (;;)
+            {
+                if (childSpanIdx < endSpanIdx && spans[childSpanIdx].begin == insertIdx)
+                {
+                    const RenderGroupSpan& childSpan = spans[childSpanIdx];
+                    if (order < childSpan.order)
+                        break;
+                    insertIdx = childSpan.end;
+                    childSpanIdx += childSpan.descendantSpanCount + 1u;
+                }
+                else if (insertIdx == span.end || goesAfterNewEntry(insertIdx))
+                {
+                    break;
+                }
+                else
+                {
+                    ++insertIdx;
+                }
+            }
+        }
+
+        passRenderables.renderables.insert(passRenderables.renderables.begin() + insertIdx, renderable);
+        passRenderables.origins.insert(passRenderables.origins.begin() + insertIdx, { spanIdx, order, newGroupIndex });
+
+        // shift all spans following the new renderable, empty spans at insert position are shifted only if ordered after it
+        const auto isOrderedAfterNewEntry = [&](UInt32 otherSpanIdx)
+        {
+            if (otherSpanIdx <= spanIdx)
+                return false;
+            if (otherSpanIdx > spanIdx + span.descendantSpanCount)
+                return true;
+            while (spans[otherSpanIdx].parentSpan != spanIdx)
+                otherSpanIdx = spans[otherSpanIdx].parentSpan;
+            return order < spans[otherSpanIdx].order;
+        };
+        for (UInt32 i = 0u; i < spans.size(); ++i)
+        {
+            if (spans[i].begin > insertIdx || (spans[i].begin == insertIdx && isOrderedAfterNewEntry(i)))
+            {
+                ++spans[i].begin;
+                ++spans[i].end;
+            }
+        }
+        for (UInt32 i = spanIdx; i != InvalidSpanIndex; i = spans[i].parentSpan)
+            ++spans[i].end;
+    }
+
+    void RendererCachedScene::removeRenderableFromPasses(RenderGroupHandle renderGroup, RenderableHandle renderable, Int32 order)
+    {
+        m_pendingRenderableInsertions.erase(std::remove_if(m_pendingRenderableInsertions.begin(), m_pendingRenderableInsertions.end(),
+            [&](const PendingRenderableInsertion& p) { return p.renderGroup == renderGroup && p.renderable == renderable; }), m_pendingRenderableInsertions.end());
+
+        for (auto& passRenderables : m_passRenderables)
+        {
+            if (passRenderables.needsRebuild)
+                continue;
+
+            const UInt32* spanIdxPtr = passRenderables.groupSpanIndices.get(renderGroup);
+            if (spanIdxPtr == nullptr)
+                continue;
+
+            const UInt32 spanIdx = *spanIdxPtr;
+            if (spanIdx == InvalidSpanIndex)
+            {
+                passRenderables.needsRebuild = true;
+                continue;
+            }
+
+            std::vector<RenderGroupSpan>& spans = passRenderables.groupSpans;
+            const RenderGroupSpan& span = spans[spanIdx];
+            const std::vector<RenderableOrigin>& origins = passRenderables.origins;
+
+            // renderable can be contained in nested group as well, look for the one coming directly from the group
+            UInt32 idx = span.begin;
+            UInt32 searchEnd = span.end;
+            if (span.descendantSpanCount == 0u)
+            {
+                // no nested groups, renderables of span are sorted
+                const auto sameOrderRange = std::equal_range(origins.cbegin() + span.begin, origins.cbegin() + span.end, RenderableOrigin{ spanIdx, order },
+                    [](const RenderableOrigin& o1, const RenderableOrigin& o2) { return o1.order < o2.order; });
+                idx = static_cast<UInt32>(sameOrderRange.first - origins.cbegin());
+                searchEnd = static_cast<UInt32>(sameOrderRange.second - origins.cbegin());
+            }
+            while (idx < searchEnd && !(passRenderables.renderables[idx] == renderable && origins[idx].span == spanIdx))
+                ++idx;
+            if (idx == searchEnd)
+                continue; // renderable was not visible
+
+            passRenderables.renderables.erase(passRenderables.renderables.begin() + idx);
+            passRenderables.origins.erase(passRenderables.origins.begin() + idx);
+
+            for (auto& otherSpan : spans)
+            {
+                if (otherSpan.begin > idx)
+                {
+                    --otherSpan.begin;
+                    --otherSpan.end;
+                }
+            }
+            for (UInt32 i = spanIdx; i != InvalidSpanIndex; i = spans[i].parentSpan)
+                --spans[i].end;
+
+            passRenderables.changed = true;
+        }
     }
 
     void RendererCachedScene::updateRenderableWorldMatrices()
     {
         m_renderableMatrices.resize(TextureLinkCachedScene::getRenderableCount());
-        for (const auto& renderables : m_passRenderableOrder)
+        for (const auto& pass : m_sortedRenderingPasses)
         {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+            const RenderableVector& renderables = getOrderedRenderablesForPass(pass.getRenderPassHandle());
             for (const auto renderable : renderables)
             {
                 assert(renderable.isValid());
@@ -300,8 +850,11 @@ namespace ramses_internal
     void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
     {
         m_renderableMatrices.resize(TextureLinkCachedScene::getRenderableCount());
-        for (const auto& renderables : m_passRenderableOrder)
+        for (const auto& pass : m_sortedRenderingPasses)
         {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+            const RenderableVector& renderables = getOrderedRenderablesForPass(pass.getRenderPassHandle());
             for (const auto renderable : renderables)
             {
                 assert(renderable.isValid());
@@ -312,6 +865,144 @@ namespace ramses_internal
         }
     }
 
+    void RendererCachedScene::updateRenderableWorldMatricesParallel(ITaskQueue& taskQueue, UInt32 workerCount)
+    {
+        m_renderableMatrices.resize(TextureLinkCachedScene::getRenderableCount());
+        if (m_dirtyNodesBuffers.empty())
+            m_dirtyNodesBuffers.resize(1u);
+
+        collectIndependentWorldMatrixUpdateGroups();
+        if (m_worldMatrixUpdateGroupCount == 0u)
+            return;
+
+        // use few more chunks than workers so that uneven subtree sizes are balanced out,
+        // last chunk is processed in calling thread
+        const UInt32 maxChunkCount = std::min(m_worldMatrixUpdateGroupCount, std::max(workerCount, 1u) * 4u);
+        if (maxChunkCount < 2u)
+        {
+            updateWorldMatricesForGroups(0u, m_worldMatrixUpdateGroupCount, m_dirtyNodesBuffers.front());
+            return;
+        }
+
+        if (m_dirtyNodesBuffers.size() < maxChunkCount)
+            m_dirtyNodesBuffers.resize(maxChunkCount);
+
+        size_t groupedRenderablesCount = 0u;
+        for (UInt32 i = 0u; i < m_worldMatrixUpdateGroupCount; ++i)
+            groupedRenderablesCount += m_worldMatrixUpdateGroups[i].size();
+        const size_t renderablesPerChunk = (groupedRenderablesCount + maxChunkCount - 1u) / maxChunkCount;
+
+        ParallelTaskGroup taskGroup(taskQueue);
+        UInt32 chunkIdx = 0u;
+        UInt32 chunkStart = 0u;
+        size_t renderablesInChunk = 0u;
+        for (UInt32 groupIdx = 0u; groupIdx < m_worldMatrixUpdateGroupCount; ++groupIdx)
+        {
+            renderablesInChunk += m_worldMatrixUpdateGroups[groupIdx].size();
+            const UInt32 chunkEnd = groupIdx + 1u;
+            if (chunkEnd == m_worldMatrixUpdateGroupCount)
+            {
+                updateWorldMatricesForGroups(chunkStart, chunkEnd, m_dirtyNodesBuffers[chunkIdx]);
+            }
+            else if (renderablesInChunk >= renderablesPerChunk)
+            {
+                assert(chunkIdx + 1u < maxChunkCount);
+                NodeHandleVector& dirtyNodesBuffer = m_dirtyNodesBuffers[chunkIdx++];
+                taskGroup.run([this, chunkStart, chunkEnd, &dirtyNodesBuffer]() { updateWorldMatricesForGroups(chunkStart, chunkEnd, dirtyNodesBuffer); });
+                chunkStart = chunkEnd;
+                renderablesInChunk = 0u;
+            }
+        }
+        taskGroup.wait();
+    }
+
+    void RendererCachedScene::collectIndependentWorldMatrixUpdateGroups()
+    {
+        // Dirty state always covers whole subtree (it is propagated down and cleaned from top), therefore the topmost dirty
+        // node on a renderable's chain has a clean parent. Once those top nodes are updated, dirty chains of renderables
+        // below different children of the top nodes cannot share any node and can be updated independently.
+        m_dirtyRenderableChains.clear();
+        NodeHandleVector& dirtyNodes = m_dirtyNodesBuffers.front();
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+            const RenderableVector& renderables = getOrderedRenderablesForPass(pass.getRenderPassHandle());
+            for (const auto renderable : renderables)
+            {
+                assert(renderable.isValid());
+                const NodeHandle node = getRenderable(renderable).node;
+                assert(node.isValid());
+                if (!isMatrixCacheDirty(ETransformationMatrixType_World, node))
+                {
+                    m_renderableMatrices[renderable.asMemoryHandle()] = getMatrixCacheEntry(node).m_matrix[ETransformationMatrixType_World];
+                    continue;
+                }
+
+                findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(ETransformationMatrixType_World, node, dirtyNodes);
+                assert(!dirtyNodes.empty());
+                const NodeHandle subtreeRoot = (dirtyNodes.size() > 1u ? dirtyNodes[dirtyNodes.size() - 2u] : NodeHandle::Invalid());
+                m_dirtyRenderableChains.push_back({ renderable, dirtyNodes.back(), subtreeRoot });
+            }
+        }
+
+        for (const auto& chain : m_dirtyRenderableChains)
+        {
+            MatrixCacheEntry& topEntry = getMatrixCacheEntry(chain.topDirtyNode);
+            if (topEntry.m_matrixDirty[ETransformationMatrixType_World])
+            {
+                const NodeHandle parent = getParent(chain.topDirtyNode);
+                assert(!parent.isValid() || !isMatrixCacheDirty(ETransformationMatrixType_World, parent));
+                Matrix44f chainMatrix = (parent.isValid() ? getMatrixCacheEntry(parent).m_matrix[ETransformationMatrixType_World] : Matrix44f::Identity);
+                if (!topEntry.m_isIdentity)
+                    computeMatrixForNode(ETransformationMatrixType_World, chain.topDirtyNode, chainMatrix);
+                setMatrixCache(ETransformationMatrixType_World, topEntry, chainMatrix);
+            }
+        }
+
+        for (UInt32 i = 0u; i < m_worldMatrixUpdateGroupCount; ++i)
+            m_worldMatrixUpdateGroups[i].clear();
+        m_worldMatrixUpdateGroupCount = 0u;
+        m_subtreeRootToUpdateGroup.clear();
+
+        for (const auto& chain : m_dirtyRenderableChains)
+        {
+            if (!chain.subtreeRootNode.isValid())
+            {
+                // renderable node was the top dirty node itself
+                m_renderableMatrices[chain.renderable.asMemoryHandle()] = getMatrixCacheEntry(chain.topDirtyNode).m_matrix[ETransformationMatrixType_World];
+                continue;
+            }
+
+            UInt32 groupIdx = m_worldMatrixUpdateGroupCount;
+            const UInt32* existingGroupIdx = m_subtreeRootToUpdateGroup.get(chain.subtreeRootNode);
+            if (existingGroupIdx != nullptr)
+            {
+                groupIdx = *existingGroupIdx;
+            }
+            else
+            {
+                m_subtreeRootToUpdateGroup.put(chain.subtreeRootNode, groupIdx);
+                ++m_worldMatrixUpdateGroupCount;
+                if (m_worldMatrixUpdateGroups.size() < m_worldMatrixUpdateGroupCount)
+                    m_worldMatrixUpdateGroups.emplace_back();
+            }
+            m_worldMatrixUpdateGroups[groupIdx].push_back(chain.renderable);
+        }
+    }
+
+    void RendererCachedScene::updateWorldMatricesForGroups(UInt32 firstGroup, UInt32 endGroup, NodeHandleVector& dirtyNodesBuffer)
+    {
+        for (UInt32 groupIdx = firstGroup; groupIdx < endGroup; ++groupIdx)
+        {
+            for (const auto renderable : m_worldMatrixUpdateGroups[groupIdx])
+            {
+                const NodeHandle node = getRenderable(renderable).node;
+                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node, dirtyNodesBuffer);
+            }
+        }
+    }
+
     Bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
     {
         if (!TextureLinkCachedScene::isRenderPassAllocated(handle))
@@ -343,7 +1034,7 @@ namespace ramses_internal
             }
         }
 
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::markAllRenderOncePassesAsRendered() const
@@ -353,7 +1044,7 @@ namespace ramses_internal
             // some render once passes were rendered, remove them from list
             // and force update of cached render pass list for next update
             m_renderOncePassesToRender.clear();
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 }
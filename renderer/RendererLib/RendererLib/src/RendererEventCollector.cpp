@@ -215,6 +215,14 @@ namespace ramses_internal
         pushToRendererEventQueue(std::move(event));
     }
 
+    void RendererEventCollector::addGpuMemoryBudgetExceededEvent(DisplayHandle display, UInt64 usedBytes, UInt64 budgetBytes)
+    {
+        RendererEvent event{ ERendererEventType::GpuMemoryBudgetExceeded };
+        event.displayHandle = display;
+        event.gpuMemoryUsage = { usedBytes, budgetBytes };
+        pushToRendererEventQueue(std::move(event));
+    }
+
     void RendererEventCollector::pushToRendererEventQueue(RendererEvent&& newEvent)
     {
         m_rendererEvents.push_back(std::move(newEvent));
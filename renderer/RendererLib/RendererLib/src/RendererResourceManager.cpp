@@ -11,6 +11,7 @@
 #include "RendererLib/IResourceUploader.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "RendererLib/RenderableBatchGeometry.h"
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IDevice.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
@@ -19,11 +20,13 @@
 #include "SceneAPI/EDataBufferType.h"
 #include "Components/ManagedResource.h"
 #include "Resource/ResourceInfo.h"
+#include "Resource/ArrayResource.h"
 #include "Utils/ThreadLocalLogForced.h"
 #include "Utils/TextureMathUtils.h"
 #include "Utils/LogMacros.h"
 #include "Math3d/Vector4.h"
 #include <memory>
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -81,13 +84,17 @@ namespace ramses_internal
                 m_resourceRegistry.registerResource(resHash);
 
             m_resourceRegistry.addResourceRef(resHash, sceneId);
+            m_resourceUploadingManager.onResourceUsedByScene(resHash, sceneId);
         }
     }
 
     void RendererResourceManager::unreferenceResourcesForScene(SceneId sceneId, const ResourceContentHashVector& resources)
     {
         for (const auto& resHash : resources)
+        {
             m_resourceRegistry.removeResourceRef(resHash, sceneId);
+            m_resourceUploadingManager.onResourceUnreferencedByScene(resHash, sceneId);
+        }
     }
 
     RendererSceneResourceRegistry& RendererResourceManager::getSceneResourceRegistry(SceneId sceneId)
@@ -137,6 +144,11 @@ namespace ramses_internal
             for (const auto& st : streamTextures)
                 unloadStreamTexture(st, sceneId);
 
+            RenderableBatchHandleVector renderableBatches;
+            sceneResources.getAllRenderableBatches(renderableBatches);
+            for (const auto batch : renderableBatches)
+                unloadRenderableBatch(batch, sceneId);
+
             RenderableVector vertexArrayRenderables;
             sceneResources.getAllVertexArrayRenderables(vertexArrayRenderables);
             for (const auto r : vertexArrayRenderables)
@@ -166,6 +178,7 @@ namespace ramses_internal
             {
                 while (m_resourceRegistry.containsResource(res) && contains_c(m_resourceRegistry.getResourceDescriptor(res).sceneUsage, sceneId))
                     m_resourceRegistry.removeResourceRef(res, sceneId);
+                m_resourceUploadingManager.onResourceUnreferencedByScene(res, sceneId);
             }
         }
     }
@@ -181,7 +194,11 @@ namespace ramses_internal
         assert(m_resourceRegistry.containsResource(resHash));
 
         if (m_resourceRegistry.getResourceStatus(resHash) == EResourceStatus::Registered)
-            m_resourceRegistry.setResourceData(resHash, mr);
+        {
+            // decompressed copy from disk cache saves decompression before upload
+            const ManagedResource cached = mr->isDeCompressedAvailable() ? ManagedResource{} : m_resourceUploadingManager.loadFromDiskCache(resHash);
+            m_resourceRegistry.setResourceData(resHash, cached ? cached : mr);
+        }
     }
 
     Bool RendererResourceManager::hasResourcesToBeUploaded() const
@@ -194,6 +211,21 @@ namespace ramses_internal
         m_resourceUploadingManager.uploadAndUnloadPendingResources();
     }
 
+    const SceneIdVector& RendererResourceManager::getScenesWithStreamedTextureUpdates() const
+    {
+        return m_resourceUploadingManager.getScenesWithStreamedTextureUpdates();
+    }
+
+    bool RendererResourceManager::hasGpuMemoryBudgetBeenExceeded() const
+    {
+        return m_resourceUploadingManager.hasGpuMemoryBudgetBeenExceeded();
+    }
+
+    const GpuMemoryBudget& RendererResourceManager::getGpuMemoryBudget() const
+    {
+        return m_resourceUploadingManager.getGpuMemoryBudget();
+    }
+
     EResourceStatus RendererResourceManager::getResourceStatus(const ResourceContentHash& hash) const
     {
         return m_resourceRegistry.getResourceStatus(hash);
@@ -209,6 +241,11 @@ namespace ramses_internal
         return m_resourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    BoundingVolume RendererResourceManager::getResourceBoundingVolume(const ResourceContentHash& hash) const
+    {
+        return m_resourceRegistry.getResourceDescriptor(hash).boundingVolume;
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
@@ -816,4 +853,126 @@ namespace ramses_internal
         const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
         return sceneResources.getVertexArrayDeviceHandle(renderableHandle);
     }
+
+    void RendererResourceManager::uploadRenderableBatch(RenderableBatchHandle batchHandle, const RenderableBatchInfo& batchInfo, SceneId sceneId)
+    {
+        RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
+        // entry is registered even if geometry cannot be merged, batch is then rendered as individual renderables
+        RendererSceneResourceRegistry::RenderableBatchEntry entry;
+
+        // geometry resources are kept in system memory after upload while draw call batching is enabled until no pending batch needs them,
+        // they can be missing if released before (e.g. resource shared with scene whose renderables were not batchable) or still pending
+        const auto getArrayResource = [this](const ResourceContentHash& hash) -> const ArrayResource*
+        {
+            if (!m_resourceRegistry.containsResource(hash))
+                return nullptr;
+            const ManagedResource& resource = m_resourceRegistry.getResourceDescriptor(hash).resource;
+            return resource ? resource->convertTo<ArrayResource>() : nullptr;
+        };
+
+        std::vector<RenderableBatchGeometry::MemberData> membersData;
+        membersData.reserve(batchInfo.members.size());
+        bool allDataAvailable = true;
+        for (const auto& member : batchInfo.members)
+        {
+            RenderableBatchGeometry::MemberData memberData;
+            if (member.indices.isValid())
+            {
+                memberData.indices = getArrayResource(member.indices);
+                allDataAvailable &= (memberData.indices != nullptr);
+            }
+            for (const auto& attribute : member.vertexAttributes)
+            {
+                memberData.vertexAttributes.push_back(getArrayResource(attribute));
+                allDataAvailable &= (memberData.vertexAttributes.back() != nullptr);
+            }
+            memberData.startVertex = member.startVertex;
+            memberData.startIndex = member.startIndex;
+            memberData.indexCount = member.indexCount;
+            membersData.push_back(std::move(memberData));
+        }
+
+        RenderableBatchGeometry geometry;
+        const DeviceResourceHandle shader = getResourceDeviceHandle(batchInfo.effect);
+        if (!allDataAvailable || !shader.isValid() || !RenderableBatchGeometry::Merge(membersData, geometry) || geometry.vertexData.size() != batchInfo.vertexAttributeTypes.size())
+        {
+            LOG_INFO_P(CONTEXT_RENDERER, "RendererResourceManager::uploadRenderableBatch sceneId={} batch={} geometry of {} renderables cannot be merged, they will be rendered individually",
+                sceneId, batchHandle, batchInfo.members.size());
+            sceneResources.addRenderableBatch(batchHandle, entry);
+            return;
+        }
+
+        IDevice& device = m_renderBackend.getDevice();
+        VertexArrayInfo vertexArrayInfo;
+        vertexArrayInfo.shader = shader;
+        if (geometry.indexType != EDataType::Invalid)
+        {
+            const UInt32 indexDataSize = static_cast<UInt32>(geometry.indexData.size());
+            entry.indexBuffer = device.allocateIndexBuffer(geometry.indexType, indexDataSize);
+            device.uploadIndexBufferData(entry.indexBuffer, geometry.indexData.data(), indexDataSize);
+            vertexArrayInfo.indexBuffer = entry.indexBuffer;
+            entry.size += indexDataSize;
+        }
+
+        for (UInt32 attribute = 0u; attribute < geometry.vertexData.size(); ++attribute)
+        {
+            const UInt32 vertexDataSize = static_cast<UInt32>(geometry.vertexData[attribute].size());
+            const DeviceResourceHandle vertexBuffer = device.allocateVertexBuffer(vertexDataSize);
+            device.uploadVertexBufferData(vertexBuffer, geometry.vertexData[attribute].data(), vertexDataSize);
+            entry.vertexBuffers.push_back(vertexBuffer);
+            entry.size += vertexDataSize;
+            vertexArrayInfo.vertexBuffers.push_back({ vertexBuffer, DataFieldHandle{ attribute }, 0u, 0u, batchInfo.vertexAttributeTypes[attribute], 0u, 0u });
+        }
+
+        entry.vertexArray = device.allocateVertexArray(vertexArrayInfo);
+        assert(entry.vertexArray.isValid());
+        if (!entry.vertexArray.isValid())
+        {
+            LOG_ERROR_P(CONTEXT_RENDERER, "RendererResourceManager::uploadRenderableBatch sceneId={} batch={} failed to allocate vertex array, this is fatal...", sceneId, batchHandle);
+            device.isDeviceStatusHealthy();
+        }
+
+        sceneResources.addRenderableBatch(batchHandle, entry);
+        m_stats.sceneResourceUploaded(sceneId, entry.size);
+    }
+
+    void RendererResourceManager::unloadRenderableBatch(RenderableBatchHandle batchHandle, SceneId sceneId)
+    {
+        assert(m_sceneResourceRegistryMap.contains(sceneId));
+        RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+        const auto& entry = sceneResources.getRenderableBatch(batchHandle);
+
+        IDevice& device = m_renderBackend.getDevice();
+        if (entry.vertexArray.isValid())
+            device.deleteVertexArray(entry.vertexArray);
+        if (entry.indexBuffer.isValid())
+            device.deleteIndexBuffer(entry.indexBuffer);
+        for (const auto vertexBuffer : entry.vertexBuffers)
+            device.deleteVertexBuffer(vertexBuffer);
+
+        sceneResources.removeRenderableBatch(batchHandle);
+    }
+
+    void RendererResourceManager::releaseGeometryDataNotNeededForBatching(SceneId sceneId, const ResourceContentHashVector& sortedGeometryOfPendingBatches)
+    {
+        assert(std::is_sorted(sortedGeometryOfPendingBatches.cbegin(), sortedGeometryOfPendingBatches.cend()));
+        const ResourceContentHashVector* sceneResources = m_resourceRegistry.getResourcesInUseByScene(sceneId);
+        if (!sceneResources)
+            return;
+
+        for (const auto& hash : *sceneResources)
+        {
+            const ResourceDescriptor& rd = m_resourceRegistry.getResourceDescriptor(hash);
+            if (rd.status == EResourceStatus::Uploaded && rd.resource && (rd.type == EResourceType_VertexArray || rd.type == EResourceType_IndexArray)
+                && !std::binary_search(sortedGeometryOfPendingBatches.cbegin(), sortedGeometryOfPendingBatches.cend(), hash))
+                m_resourceRegistry.releaseResourceData(hash);
+        }
+    }
+
+    DeviceResourceHandle RendererResourceManager::getRenderableBatchDeviceHandle(RenderableBatchHandle batchHandle, SceneId sceneId) const
+    {
+        assert(m_sceneResourceRegistryMap.contains(sceneId));
+        const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+        return sceneResources.getRenderableBatch(batchHandle).vertexArray;
+    }
 }
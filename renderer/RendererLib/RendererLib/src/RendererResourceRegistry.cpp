@@ -142,7 +142,17 @@ namespace ramses_internal
         setResourceStatus(hash, EResourceStatus::ScheduledForUpload);
     }
 
-    void RendererResourceRegistry::setResourceUploaded(const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize)
+    void RendererResourceRegistry::setResourceUploadCancelled(const ResourceContentHash& hash)
+    {
+        assert(m_resources.contains(hash));
+        setResourceStatus(hash, EResourceStatus::Provided);
+
+        // resource was kept registered only because of pending upload
+        if (m_resources.get(hash)->sceneUsage.empty())
+            unregisterResource(hash);
+    }
+
+    void RendererResourceRegistry::setResourceUploaded(const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize, bool keepResourceData)
     {
         assert(m_resources.contains(hash));
         ResourceDescriptor& rd = *m_resources.get(hash);
@@ -150,11 +160,26 @@ namespace ramses_internal
         rd.deviceHandle = deviceHandle;
         rd.vramSize = vramSize;
         // release resource data
-        rd.resource.reset();
+        if (!keepResourceData)
+            rd.resource.reset();
 
         setResourceStatus(hash, EResourceStatus::Uploaded);
     }
 
+    void RendererResourceRegistry::releaseResourceData(const ResourceContentHash& hash)
+    {
+        assert(m_resources.contains(hash));
+        ResourceDescriptor& rd = *m_resources.get(hash);
+        assert(rd.status == EResourceStatus::Uploaded);
+        rd.resource.reset();
+    }
+
+    void RendererResourceRegistry::setResourceBoundingVolume(const ResourceContentHash& hash, const BoundingVolume& boundingVolume)
+    {
+        assert(m_resources.contains(hash));
+        m_resources.get(hash)->boundingVolume = boundingVolume;
+    }
+
     void RendererResourceRegistry::setResourceBroken(const ResourceContentHash& hash)
     {
         // release resource data
@@ -260,7 +285,7 @@ namespace ramses_internal
         switch (newStatus)
         {
         case EResourceStatus::Provided:
-            return currentStatus == EResourceStatus::Registered;
+            return currentStatus == EResourceStatus::Registered || currentStatus == EResourceStatus::ScheduledForUpload;
         case EResourceStatus::Uploaded:
         case EResourceStatus::Broken:
             return currentStatus == EResourceStatus::Provided || currentStatus == EResourceStatus::ScheduledForUpload;
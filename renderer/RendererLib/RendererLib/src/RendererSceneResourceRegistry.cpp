@@ -247,6 +247,32 @@ namespace ramses_internal
             vertexArrayRenderables.push_back(va.key);
     }
 
+    void RendererSceneResourceRegistry::addRenderableBatch(RenderableBatchHandle batchHandle, const RenderableBatchEntry& entry)
+    {
+        assert(!m_renderableBatches.contains(batchHandle));
+        m_renderableBatches.put(batchHandle, entry);
+    }
+
+    void RendererSceneResourceRegistry::removeRenderableBatch(RenderableBatchHandle batchHandle)
+    {
+        assert(m_renderableBatches.contains(batchHandle));
+        m_renderableBatches.remove(batchHandle);
+    }
+
+    const RendererSceneResourceRegistry::RenderableBatchEntry& RendererSceneResourceRegistry::getRenderableBatch(RenderableBatchHandle batchHandle) const
+    {
+        assert(m_renderableBatches.contains(batchHandle));
+        return *m_renderableBatches.get(batchHandle);
+    }
+
+    void RendererSceneResourceRegistry::getAllRenderableBatches(RenderableBatchHandleVector& batches) const
+    {
+        assert(batches.empty());
+        batches.reserve(m_renderableBatches.size());
+        for (const auto& batch : m_renderableBatches)
+            batches.push_back(batch.key);
+    }
+
     UInt32 RendererSceneResourceRegistry::getSceneResourceMemoryUsage(ESceneResourceType resourceType) const
     {
         UInt32 result = 0;
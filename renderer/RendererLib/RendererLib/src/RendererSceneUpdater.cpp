@@ -131,6 +131,12 @@ namespace ramses_internal
                                                         displayConfig,
                                                         binaryShaderCache);
 
+            m_transformationUpdateThreadCount = displayConfig.getTransformationUpdateThreadCount();
+            m_drawCallBatchingEnabled = displayConfig.isDrawCallBatchingEnabled();
+            m_drawCallSortingEnabled = displayConfig.isDrawCallSortingEnabled();
+            if (m_transformationUpdateThreadCount > 0u)
+                m_transformationUpdateExecutor = std::make_unique<ThreadedTaskExecutor>(static_cast<UInt16>(m_transformationUpdateThreadCount));
+
             m_rendererEventCollector.addDisplayEvent(ERendererEventType::DisplayCreated, m_display);
 
             LOG_INFO_P(CONTEXT_RENDERER, "Created display: {}x{}{}{} MSAA{}",
@@ -188,6 +194,10 @@ namespace ramses_internal
 
         m_asyncEffectUploader->destroyResourceUploadRenderBackendAndStopThread();
         m_asyncEffectUploader.reset();
+        m_transformationUpdateExecutor.reset();
+        m_transformationUpdateThreadCount = 0u;
+        m_drawCallBatchingEnabled = false;
+        m_drawCallSortingEnabled = false;
         destroyResourceManager();
 
         m_renderer.resetRenderInterruptState();
@@ -276,7 +286,22 @@ namespace ramses_internal
             updateScenesDataLinks();
         }
 
-        m_renderer.m_traceId = 12;
+        if (m_drawCallBatchingEnabled)
+        {
+            m_renderer.m_traceId = 12;
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update batches of renderables with merged geometry");
+            FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::UpdateResourceCache);
+            updateRenderableBatches();
+        }
+
+        if (m_drawCallSortingEnabled)
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update draw state sorting of renderables");
+            FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::UpdateResourceCache);
+            updateDrawStateSorting();
+        }
+
+        m_renderer.m_traceId = 13;
         for (const auto scene : m_modifiedScenesToRerender)
         {
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState::Rendered)
@@ -478,7 +503,17 @@ namespace ramses_internal
 
         // if there are resources to upload, unload and upload pending resources
         if (m_displayResourceManager->hasResourcesToBeUploaded())
+        {
             m_displayResourceManager->uploadAndUnloadPendingResources();
+            // textures got more detailed mip level, scenes using them must be re-rendered even if not modified
+            for (const auto sceneId : m_displayResourceManager->getScenesWithStreamedTextureUpdates())
+                m_modifiedScenesToRerender.put(sceneId);
+            if (m_displayResourceManager->hasGpuMemoryBudgetBeenExceeded())
+            {
+                const auto& gpuMemoryBudget = m_displayResourceManager->getGpuMemoryBudget();
+                m_rendererEventCollector.addGpuMemoryBudgetExceededEvent(m_display, gpuMemoryBudget.getUsage(), gpuMemoryBudget.getBudget());
+            }
+        }
     }
 
     void RendererSceneUpdater::uploadUpdatedECStreams()
@@ -775,6 +810,75 @@ namespace ramses_internal
         }
     }
 
+    void RendererSceneUpdater::updateDrawStateSorting()
+    {
+        // sorting of passes is reused until their renderables or draw states change, so this is cheap for unmodified scenes
+        for (const auto& sceneIt : m_rendererScenes)
+        {
+            if (m_sceneStateExecutor.getSceneState(sceneIt.key) == ESceneState::Rendered)
+                sceneIt.value.scene->updateDrawStateSorting();
+        }
+    }
+
+    void RendererSceneUpdater::updateRenderableBatches()
+    {
+        m_tempScenesWithUpdatedBatches.clear();
+        UInt32 uploadedBatches = 0u;
+        for (const auto& sceneIt : m_rendererScenes)
+        {
+            const SceneId sceneId = sceneIt.key;
+            RendererCachedScene& rendererScene = *(sceneIt.value.scene);
+            RenderableBatchCache& batches = rendererScene.getRenderableBatches();
+            // unmodified scene can only make pending batches stable
+            if (m_sceneStateExecutor.getSceneState(sceneId) != ESceneState::Rendered || (!m_modifiedScenesToRerender.contains(sceneId) && !batches.hasPendingBatches()))
+                continue;
+
+            m_tempRenderableBatchesToUnload.clear();
+            m_tempRenderableBatchesToUpload.clear();
+            batches.update(rendererScene, m_tempRenderableBatchesToUnload, m_tempRenderableBatchesToUpload);
+            m_tempScenesWithUpdatedBatches.push_back(sceneId);
+
+            for (const auto batch : m_tempRenderableBatchesToUnload)
+                m_displayResourceManager->unloadRenderableBatch(batch, sceneId);
+
+            bool batchUploaded = false;
+            for (const auto batch : m_tempRenderableBatchesToUpload)
+            {
+                // merging geometry is not needed for correct rendering, members are rendered individually until batch is uploaded
+                // in one of next frames, at least one batch per frame is uploaded so that batching makes progress with any budget
+                if (uploadedBatches > 0u && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::SceneResourcesUpload))
+                {
+                    batches.postponeUpload(batch);
+                    continue;
+                }
+
+                SceneResourceUploader::UploadRenderableBatch(rendererScene, batch, batches.getBatch(batch), *m_displayResourceManager);
+                batches.setBatchVertexArray(batch, m_displayResourceManager->getRenderableBatchDeviceHandle(batch, sceneId));
+                batchUploaded = true;
+                ++uploadedBatches;
+            }
+
+            // merged batches replace draw calls of their members, scene has to be re-rendered
+            if (!m_tempRenderableBatchesToUnload.empty() || batchUploaded)
+                m_modifiedScenesToRerender.put(sceneId);
+        }
+
+        if (m_tempScenesWithUpdatedBatches.empty())
+            return;
+
+        // geometry data is kept after upload only until it is clear which renderables form batches,
+        // resources can be shared so pending batches of all rendered scenes are considered
+        m_tempGeometryOfPendingBatches.clear();
+        for (const auto& sceneIt : m_rendererScenes)
+        {
+            if (m_sceneStateExecutor.getSceneState(sceneIt.key) == ESceneState::Rendered)
+                sceneIt.value.scene->getRenderableBatches().collectGeometryOfPendingBatches(*sceneIt.value.scene, m_tempGeometryOfPendingBatches);
+        }
+        std::sort(m_tempGeometryOfPendingBatches.begin(), m_tempGeometryOfPendingBatches.end());
+        for (const auto sceneId : m_tempScenesWithUpdatedBatches)
+            m_displayResourceManager->releaseGeometryDataNotNeededForBatching(sceneId, m_tempGeometryOfPendingBatches);
+    }
+
     void RendererSceneUpdater::updateScenesResourceCache()
     {
         // update renderer scenes renderables and resource cache
@@ -998,6 +1102,8 @@ namespace ramses_internal
 
         RendererCachedScene& rendererScene = m_rendererScenes.getScene(sceneId);
         rendererScene.resetResourceCache();
+        // merged geometry of batches was unloaded together with other scene resources
+        rendererScene.getRenderableBatches().reset();
     }
 
     bool RendererSceneUpdater::markClientAndSceneResourcesForReupload(SceneId sceneId)
@@ -1742,7 +1848,10 @@ namespace ramses_internal
         for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
         {
             RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-            renderScene.updateRenderableWorldMatrices();
+            if (m_transformationUpdateExecutor)
+                renderScene.updateRenderableWorldMatricesParallel(*m_transformationUpdateExecutor, m_transformationUpdateThreadCount);
+            else
+                renderScene.updateRenderableWorldMatrices();
         }
     }
 
@@ -87,12 +87,46 @@ namespace ramses_internal
         }
     }
 
+    void RendererStatistics::shaderCompileLatency(std::chrono::microseconds latency)
+    {
+        m_shaderCompileLatencies++;
+        m_microsecondsShaderCompileLatency += latency.count();
+        m_maximumShaderCompileLatency = std::max(m_maximumShaderCompileLatency, latency);
+    }
+
     void RendererStatistics::setVRAMUsage(uint64_t totalUploaded, uint64_t gpuCacheSize)
     {
         m_totalResourceUploadedSize = totalUploaded;
         m_gpuCacheSize = gpuCacheSize;
     }
 
+    void RendererStatistics::setVRAMUsagePerType(uint64_t textures, uint64_t geometry, uint64_t effects)
+    {
+        m_textureResourceUploadedSize = textures;
+        m_geometryResourceUploadedSize = geometry;
+        m_effectResourceUploadedSize = effects;
+    }
+
+    void RendererStatistics::setSceneVRAMUsage(SceneId sceneId, uint64_t usage)
+    {
+        // do not start tracking scene (again) just because it has no GPU memory in use
+        if (usage > 0u)
+        {
+            m_sceneStatistics[sceneId].vramUsage = usage;
+        }
+        else
+        {
+            const auto it = m_sceneStatistics.find(sceneId);
+            if (it != m_sceneStatistics.end())
+                it->second.vramUsage = 0u;
+        }
+    }
+
+    void RendererStatistics::gpuMemoryBudgetExceeded()
+    {
+        ++m_gpuMemoryBudgetExceeded;
+    }
+
     void RendererStatistics::trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedResources, UInt numRemovedResources, UInt numSceneResourceActions, std::chrono::milliseconds latency)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -151,6 +185,52 @@ namespace ramses_internal
         m_streamTextureStatistics.erase(sourceId);
     }
 
+    void RendererStatistics::uniformsUploaded(UInt32 uploadedCount, UInt32 skippedCount)
+    {
+        m_uploadedUniforms += uploadedCount;
+        m_skippedUniforms += skippedCount;
+    }
+
+    UInt32 RendererStatistics::getUploadedUniformsPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_uploadedUniforms / static_cast<UInt32>(m_frameNumber);
+    }
+
+    UInt32 RendererStatistics::getSkippedUniformsPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_skippedUniforms / static_cast<UInt32>(m_frameNumber);
+    }
+
+    void RendererStatistics::drawCallsSorted(UInt32 stateChangesSaved)
+    {
+        m_stateChangesSavedByDrawCallSorting += stateChangesSaved;
+    }
+
+    UInt32 RendererStatistics::getStateChangesSavedByDrawCallSortingPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_stateChangesSavedByDrawCallSorting / static_cast<UInt32>(m_frameNumber);
+    }
+
+    void RendererStatistics::renderablesCulled(UInt32 culledCount)
+    {
+        m_culledRenderables += culledCount;
+    }
+
+    UInt32 RendererStatistics::getCulledRenderablesPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_culledRenderables / static_cast<UInt32>(m_frameNumber);
+    }
+
+    void RendererStatistics::renderablesBatched(UInt32 drawCallsSaved)
+    {
+        m_drawCallsSavedByBatching += drawCallsSaved;
+    }
+
+    UInt32 RendererStatistics::getDrawCallsSavedByBatchingPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_drawCallsSavedByBatching / static_cast<UInt32>(m_frameNumber);
+    }
+
     void RendererStatistics::frameFinished(UInt32 drawCalls)
     {
         const UInt64 currTick = PlatformTime::GetMicrosecondsMonotonic();
@@ -192,15 +272,24 @@ namespace ramses_internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls = 0u;
+        m_stateChangesSavedByDrawCallSorting = 0u;
+        m_culledRenderables = 0u;
+        m_drawCallsSavedByBatching = 0u;
+        m_uploadedUniforms = 0u;
+        m_skippedUniforms = 0u;
         m_frameDurationMin = std::numeric_limits<UInt32>::max();
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
         m_resourcesBytesUploaded = 0u;
         m_shadersCompiled = 0u;
+        m_gpuMemoryBudgetExceeded = 0u;
         m_microsecondsForShaderCompilation = 0u;
         m_maximumDurationShaderName = "";
         m_maximumDurationShaderTime = std::chrono::microseconds(0u);
         m_maximumDurationShaderScene = SceneId::Invalid();
+        m_shaderCompileLatencies = 0u;
+        m_microsecondsShaderCompileLatency = 0u;
+        m_maximumShaderCompileLatency = std::chrono::microseconds(0u);
 
         for (auto& sceneStatIt : m_sceneStatistics)
         {
@@ -255,15 +344,31 @@ namespace ramses_internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
             ", numFrames " << m_frameNumber;
+        if (m_uploadedUniforms > 0u || m_skippedUniforms > 0u)
+            str << ", uniformsUploadedPerFrame " << getUploadedUniformsPerFrame() << ", uniformsSkippedPerFrame " << getSkippedUniformsPerFrame();
+        if (m_stateChangesSavedByDrawCallSorting > 0u)
+            str << ", stateChangesSavedBySortingPerFrame " << getStateChangesSavedByDrawCallSortingPerFrame();
+        if (m_culledRenderables > 0u)
+            str << ", culledDrawCallsPerFrame " << getCulledRenderablesPerFrame();
+        if (m_drawCallsSavedByBatching > 0u)
+            str << ", drawCallsSavedByBatchingPerFrame " << getDrawCallsSavedByBatchingPerFrame();
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
-        str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB)";
+        str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB;"
+            << " tex " << (m_textureResourceUploadedSize >> 20) << " MB, geom " << (m_geometryResourceUploadedSize >> 20) << " MB, eff " << (m_effectResourceUploadedSize >> 20) << " MB)";
+        if (m_gpuMemoryBudgetExceeded > 0u)
+            str << ", gpuCacheExceeded " << m_gpuMemoryBudgetExceeded;
         if (m_shadersCompiled > 0u)
         {
             str << ", shadersCompiled " << m_shadersCompiled << " for total ms:" << m_microsecondsForShaderCompilation / 1000;
             str << ", avg microsec " << m_microsecondsForShaderCompilation / m_shadersCompiled;
             str << "; longest: " << m_maximumDurationShaderName << " from scene:" << m_maximumDurationShaderScene << " ms:" << m_maximumDurationShaderTime.count() / 1000;
         }
+        if (m_shaderCompileLatencies > 0u)
+        {
+            str << ", shaderLatency avg ms:" << m_microsecondsShaderCompileLatency / m_shaderCompileLatencies / 1000;
+            str << " max ms:" << m_maximumShaderCompileLatency.count() / 1000;
+        }
         str << "\n";
 
         str << "FB: " << m_displayStatistics.numFrameBufferSwapped;
@@ -307,6 +412,8 @@ namespace ramses_internal
 
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.vramUsage > 0u)
+                str << ", RCVRAM " << (sceneStats.vramUsage >> 10) << " KB";
             str << "\n";
         }
 
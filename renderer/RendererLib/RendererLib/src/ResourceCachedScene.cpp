@@ -197,6 +197,11 @@ namespace ramses_internal
         return m_effectDeviceHandleCache[renderableAsIndex];
     }
 
+    UInt32 ResourceCachedScene::getRenderableResourcesRevision() const
+    {
+        return m_renderableResourcesRevision;
+    }
+
     const VertexArrayCache& ResourceCachedScene::getCachedHandlesForVertexArrays() const
     {
         return m_vertexArrayCache;
@@ -474,6 +479,7 @@ namespace ramses_internal
                     checkGeometryResources(resourceAccessor, renderable))
                 {
                     setRenderableResourcesDirtyFlag(renderable, false);
+                    ++m_renderableResourcesRevision;
                 }
             }
         }
@@ -633,12 +639,16 @@ namespace ramses_internal
 
     void ResourceCachedScene::updateRenderableVertexArrays(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderableVector& renderablesWithUpdatedVertexArrays)
     {
+        if (!renderablesWithUpdatedVertexArrays.empty())
+            ++m_renderableResourcesRevision;
         for (const auto renderableHandle : renderablesWithUpdatedVertexArrays)
         {
             const UInt32 renderableAsIndex = renderableHandle.asMemoryHandle();
             assert(m_renderableVertexArrayDirty[renderableAsIndex]);
 
             m_vertexArrayCache[renderableAsIndex].deviceHandle = {};
+            m_vertexArrayCache[renderableAsIndex].boundingVolume = {};
+            ++m_vertexArrayCache[renderableAsIndex].revision;
             if (!isRenderableAllocated(renderableHandle))
                 setRenderableVertexArrayDirtyFlag(renderableHandle, false);
             else if (!m_renderableResourcesDirty[renderableAsIndex])
@@ -652,12 +662,52 @@ namespace ramses_internal
 
                 m_vertexArrayCache[renderableAsIndex].usesIndexArray = usesIndices;
                 m_vertexArrayCache[renderableAsIndex].deviceHandle = resourceAccessor.getVertexArrayDeviceHandle(renderableHandle, getSceneId());
+                m_vertexArrayCache[renderableAsIndex].boundingVolume = getRenderableBoundingVolume(resourceAccessor, renderableHandle);
 
                 setRenderableVertexArrayDirtyFlag(renderableHandle, false);
             }
         }
     }
 
+    BoundingVolume ResourceCachedScene::getRenderableBoundingVolume(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable) const
+    {
+        const Renderable& renderableData = getRenderable(renderable);
+        if (renderableData.instanceCount > 1u)
+            return {};
+
+        // positions are taken from attribute marked with semantic, otherwise from the only float vec3/vec4 attribute,
+        // if there are several candidates it cannot be decided which holds positions, renderable is then never culled
+        const auto geometryInstance = renderableData.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& geometryLayout = getDataLayout(getLayoutOfDataInstance(geometryInstance));
+        DataFieldHandle positionsField;
+        UInt32 positionCandidates = 0u;
+        // attributes start after indices field
+        for (DataFieldHandle attributeField(1u); attributeField < geometryLayout.getFieldCount(); ++attributeField)
+        {
+            const DataFieldInfo& field = geometryLayout.getField(attributeField);
+            if (field.semantics == EFixedSemantics::VertexPositionsAttribute)
+            {
+                positionsField = attributeField;
+                positionCandidates = 1u;
+                break;
+            }
+            if (field.dataType == EDataType::Vector3Buffer || field.dataType == EDataType::Vector4Buffer)
+            {
+                positionsField = attributeField;
+                ++positionCandidates;
+            }
+        }
+        if (positionCandidates != 1u)
+            return {};
+
+        // interleaved and instanced vertex data and data buffers (can be modified without affecting vertex array) are not supported
+        const ResourceField& dataResource = getDataResource(geometryInstance, positionsField);
+        if (!dataResource.hash.isValid() || dataResource.instancingDivisor != 0u || dataResource.offsetWithinElementInBytes != 0u || dataResource.stride != 0u)
+            return {};
+
+        return resourceAccessor.getResourceBoundingVolume(dataResource.hash);
+    }
+
     void ResourceCachedScene::markVertexArraysClean()
     {
         m_renderableVertexArraysDirty = false;
@@ -704,6 +754,7 @@ namespace ramses_internal
 
         m_renderTargetsDirty = !m_renderTargetCache.empty();
         m_blitPassesDirty = !m_blitPassCache.empty();
+        ++m_renderableResourcesRevision;
     }
 
 }
@@ -0,0 +1,97 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ResourceDecompressionStage.h"
+#include "Resource/IResource.h"
+#include "TaskFramework/ITask.h"
+#include <mutex>
+
+namespace ramses_internal
+{
+    struct ResourceDecompressionStage::FinishedResources
+    {
+        std::mutex lock;
+        ResourceContentHashVector hashes;
+    };
+
+    namespace
+    {
+        class DecompressionTask final : public ITask
+        {
+        public:
+            DecompressionTask(ManagedResource resource, const ResourceContentHash& hash, std::shared_ptr<ResourceDecompressionStage::FinishedResources> finished)
+                : m_resource(std::move(resource))
+                , m_hash(hash)
+                , m_finished(std::move(finished))
+            {
+            }
+
+            virtual void execute() override
+            {
+                m_resource->decompress();
+
+                std::lock_guard<std::mutex> guard(m_finished->lock);
+                m_finished->hashes.push_back(m_hash);
+            }
+
+        private:
+            // keeps resource alive even if it gets unregistered from renderer meanwhile
+            ManagedResource m_resource;
+            ResourceContentHash m_hash;
+            std::shared_ptr<ResourceDecompressionStage::FinishedResources> m_finished;
+        };
+    }
+
+    ResourceDecompressionStage::ResourceDecompressionStage(UInt32 threadCount)
+        : m_finished(std::make_shared<FinishedResources>())
+        , m_executor(static_cast<UInt16>(threadCount))
+    {
+        assert(threadCount > 0u);
+    }
+
+    ResourceDecompressionStage::~ResourceDecompressionStage() = default;
+
+    bool ResourceDecompressionStage::prepare(const ResourceContentHash& hash, const ManagedResource& resource)
+    {
+        if (m_pending.contains(hash))
+            return true;
+
+        if (!resource->isCompressedAvailable() || resource->isDeCompressedAvailable())
+            return false;
+
+        auto task = new DecompressionTask(resource, hash, m_finished);
+        if (!m_executor.enqueue(*task))
+        {
+            // executor refused the task, resource will be decompressed right before upload
+            task->release();
+            return false;
+        }
+        // executor holds its own reference, task deletes itself when worker releases it
+        task->release();
+        m_pending.put(hash);
+
+        return true;
+    }
+
+    void ResourceDecompressionStage::collectFinished()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_finished->lock);
+            m_finishedTemp.swap(m_finished->hashes);
+        }
+
+        for (const auto& hash : m_finishedTemp)
+            m_pending.remove(hash);
+        m_finishedTemp.clear();
+    }
+
+    UInt32 ResourceDecompressionStage::getPendingCount() const
+    {
+        return static_cast<UInt32>(m_pending.size());
+    }
+}
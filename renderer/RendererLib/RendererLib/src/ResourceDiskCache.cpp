@@ -0,0 +1,518 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ResourceDiskCache.h"
+#include "Components/SingleResourceSerialization.h"
+#include "Resource/IResource.h"
+#include "TaskFramework/ITask.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/Adler32Checksum.h"
+#include "Utils/LogMacros.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        constexpr UInt32 FileMagic = 0x43445252u; // "RRDC"
+        constexpr UInt32 RecordMagic = 0x43455252u; // "RREC"
+        constexpr UInt32 FileVersion = 1u;
+
+        struct FileHeader
+        {
+            UInt32 magic;
+            UInt32 version;
+            UInt64 generation;
+        };
+    }
+
+    // Written as is, the cache file is not meant to be moved between machines
+    struct ResourceDiskCache::RecordHeader
+    {
+        UInt32 magic;
+        UInt32 dataSize;
+        UInt64 hashLow;
+        UInt64 hashHigh;
+        UInt32 checksum;
+        UInt32 flags;
+        // generation of cache in which record was last used, stamped in place when record is used
+        UInt64 lastUsed;
+    };
+
+    namespace
+    {
+        // set in place on records which were evicted or replaced, they are skipped and reclaimed when file is opened
+        constexpr UInt32 RecordFlag_Dropped = 1u;
+    }
+
+    class ResourceDiskCache::WriteTask final : public ITask
+    {
+    public:
+        WriteTask(ResourceDiskCache& cache, ManagedResource resource)
+            : m_cache(cache)
+            , m_resource(std::move(resource))
+        {
+        }
+
+        virtual void execute() override
+        {
+            m_cache.write(*m_resource);
+        }
+
+    private:
+        // cache stops writer before it is destroyed
+        ResourceDiskCache& m_cache;
+        // keeps decompressed data alive even if renderer released resource after upload meanwhile
+        ManagedResource m_resource;
+    };
+
+    class ResourceDiskCache::UpdateRecordsTask final : public ITask
+    {
+    public:
+        explicit UpdateRecordsTask(ResourceDiskCache& cache)
+            : m_cache(cache)
+        {
+        }
+
+        virtual void execute() override
+        {
+            m_cache.writeRecordUpdates();
+        }
+
+    private:
+        ResourceDiskCache& m_cache;
+    };
+
+    ResourceDiskCache::ResourceDiskCache(String filePath, UInt64 maxSizeInBytes)
+        : m_filePath(std::move(filePath))
+        , m_maxSize(maxSizeInBytes)
+        , m_file(m_filePath)
+        , m_writer(1u)
+    {
+        assert(m_maxSize > 0u);
+        open();
+    }
+
+    ResourceDiskCache::~ResourceDiskCache()
+    {
+        m_writer.disableAcceptingTasksAfterExecutingCurrentQueue();
+        m_writer.stop();
+
+        if (m_fileValid)
+            writeRecordUpdates();
+    }
+
+    void ResourceDiskCache::open()
+    {
+        if (File(m_filePath).exists())
+        {
+            m_mappedFile = std::make_shared<const MemoryMappedFile>(m_filePath);
+            if (!m_mappedFile->isMapped())
+            {
+                LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: cannot map cache file '{}', cache disabled", m_filePath);
+                return;
+            }
+
+            FileHeader header{};
+            if (m_mappedFile->size() >= sizeof(FileHeader))
+                PlatformMemory::Copy(&header, m_mappedFile->data(), sizeof(header));
+
+            if (header.magic == FileMagic && header.version == FileVersion)
+            {
+                m_generation = header.generation + 1u;
+                scanRecords();
+                evictLeastRecentlyUsed(ResourceContentHash::Invalid());
+
+                // file is rewritten if it exceeds size limit or most of it is not used anymore
+                const bool compact = m_deadSize > 0u && (m_cachedSize + m_deadSize > m_maxSize || m_deadSize > m_cachedSize);
+                if (compact && !compactMappedFile())
+                    return;
+            }
+            else
+            {
+                LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: invalid header of cache file '{}', cache will be repopulated", m_filePath);
+                m_mappedFile.reset();
+                recreateFile();
+            }
+        }
+        else
+        {
+            recreateFile();
+        }
+
+        // generation is stored right away, records used in this run are stamped with it
+        const bool opened = m_file.open(File::Mode::WriteExistingBinary) &&
+            m_file.seek(static_cast<std::intptr_t>(offsetof(FileHeader, generation)), File::SeekOrigin::BeginningOfFile) &&
+            m_file.write(&m_generation, sizeof(m_generation)) &&
+            m_file.seek(static_cast<std::intptr_t>(m_fileEnd), File::SeekOrigin::BeginningOfFile);
+        if (!opened)
+        {
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: cannot open cache file '{}' for writing, cache disabled", m_filePath);
+            m_entries.clear();
+            m_cachedSize = 0u;
+            m_droppedRecords.clear();
+            return;
+        }
+
+        writeRecordUpdates();
+        m_fileValid = true;
+
+        LOG_INFO_P(CONTEXT_RENDERER, "ResourceDiskCache: opened '{}' with {} resources of {} bytes (max {} bytes)", m_filePath, m_entries.size(), m_cachedSize, m_maxSize);
+    }
+
+    void ResourceDiskCache::recreateFile()
+    {
+        File file(m_filePath);
+        const FileHeader header{ FileMagic, FileVersion, 0u };
+        if (file.open(File::Mode::WriteOverWriteOldBinary) && file.write(&header, sizeof(header)))
+            m_fileEnd = sizeof(header);
+        file.close();
+    }
+
+    void ResourceDiskCache::scanRecords()
+    {
+        const Byte* data = m_mappedFile->data();
+        const UInt64 fileSize = m_mappedFile->size();
+        UInt64 offset = sizeof(FileHeader);
+
+        while (fileSize - offset >= sizeof(RecordHeader))
+        {
+            RecordHeader header{};
+            PlatformMemory::Copy(&header, data + offset, sizeof(header));
+            const UInt64 recordSize = sizeof(RecordHeader) + header.dataSize;
+            if (header.magic != RecordMagic || recordSize > fileSize - offset)
+                break;
+
+            if ((header.flags & RecordFlag_Dropped) != 0u)
+            {
+                m_deadSize += recordSize;
+                offset += recordSize;
+                continue;
+            }
+
+            // later record of same resource replaces earlier one
+            const ResourceContentHash hash{ header.hashLow, header.hashHigh };
+            if (m_entries.contains(hash))
+                removeEntry(hash);
+
+            m_entries.put(hash, Entry{ offset, header.dataSize, header.checksum, header.lastUsed, true, false });
+            m_cachedSize += recordSize;
+            offset += recordSize;
+        }
+
+        // truncated or corrupt tail gets overwritten by next records
+        if (offset != fileSize)
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: dropping {} bytes of truncated or corrupt data at end of cache file '{}'", fileSize - offset, m_filePath);
+        m_fileEnd = offset;
+    }
+
+    ManagedResource ResourceDiskCache::load(const ResourceContentHash& hash)
+    {
+        Entry entry{};
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            const Entry* existingEntry = m_entries.get(hash);
+            if (!existingEntry || !existingEntry->mapped)
+                return {};
+            entry = *existingEntry;
+        }
+
+        // mapped file is not modified while cache exists, record is verified and deserialized without
+        // holding the lock so that writer thread does not block render thread meanwhile
+        Byte* data = m_mappedFile->data() + entry.offset + sizeof(RecordHeader);
+        if (!entry.verified)
+        {
+            Adler32Checksum checksum;
+            checksum.addData(data, entry.dataSize);
+            if (checksum.getResult() != entry.checksum)
+            {
+                LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache::load: checksum mismatch of cached resource {}, dropping it from cache", hash);
+                dropRecord(hash, entry.offset);
+                return {};
+            }
+        }
+
+        std::unique_ptr<IResource> resource = SingleResourceSerialization::DeserializeResourceInPlace(absl::Span<Byte>(data, entry.dataSize), m_mappedFile, hash);
+        if (!resource || !resource->isDeCompressedAvailable())
+        {
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache::load: failed to deserialize cached resource {}, dropping it from cache", hash);
+            dropRecord(hash, entry.offset);
+            return {};
+        }
+
+        markRecordUsed(hash);
+        return ManagedResource{ std::move(resource) };
+    }
+
+    void ResourceDiskCache::dropRecord(const ResourceContentHash& hash, UInt64 offset)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            // record might have been evicted by writer thread meanwhile
+            const Entry* entry = m_entries.get(hash);
+            if (!entry || entry->offset != offset)
+                return;
+            removeEntry(hash);
+        }
+        scheduleRecordUpdates();
+    }
+
+    void ResourceDiskCache::markRecordUsed(const ResourceContentHash& hash)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            Entry* entry = m_entries.get(hash);
+            if (!entry)
+                return;
+            entry->verified = true;
+            if (entry->lastUsed == m_generation)
+                return;
+            entry->lastUsed = m_generation;
+            m_usedRecords.push_back(entry->offset);
+        }
+        scheduleRecordUpdates();
+    }
+
+    void ResourceDiskCache::scheduleRecordUpdates()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (!m_fileValid || m_recordUpdatesScheduled)
+                return;
+            m_recordUpdatesScheduled = true;
+        }
+
+        auto task = new UpdateRecordsTask(*this);
+        if (!m_writer.enqueue(*task))
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_recordUpdatesScheduled = false;
+        }
+        task->release();
+    }
+
+    void ResourceDiskCache::writeRecordUpdates()
+    {
+        std::vector<UInt64> usedRecords;
+        std::vector<UInt64> droppedRecords;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            usedRecords.swap(m_usedRecords);
+            droppedRecords.swap(m_droppedRecords);
+            m_recordUpdatesScheduled = false;
+        }
+        if (usedRecords.empty() && droppedRecords.empty())
+            return;
+
+        // file is only accessed by writer thread until cache gets destroyed
+        bool success = true;
+        for (const auto offset : usedRecords)
+        {
+            success = success &&
+                m_file.seek(static_cast<std::intptr_t>(offset + offsetof(RecordHeader, lastUsed)), File::SeekOrigin::BeginningOfFile) &&
+                m_file.write(&m_generation, sizeof(m_generation));
+        }
+        for (const auto offset : droppedRecords)
+        {
+            success = success &&
+                m_file.seek(static_cast<std::intptr_t>(offset + offsetof(RecordHeader, flags)), File::SeekOrigin::BeginningOfFile) &&
+                m_file.write(&RecordFlag_Dropped, sizeof(RecordFlag_Dropped));
+        }
+        success = success && m_file.flush();
+        if (!success)
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: failed to mark usage of cached resources in '{}'", m_filePath);
+
+        if (!m_file.seek(static_cast<std::intptr_t>(m_fileEnd), File::SeekOrigin::BeginningOfFile))
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: failed to restore write position in cache file '{}'", m_filePath);
+    }
+
+    void ResourceDiskCache::store(const ManagedResource& resource)
+    {
+        assert(resource && resource->isDeCompressedAvailable());
+        if (!m_fileValid)
+            return;
+
+        const ResourceContentHash hash = resource->getHash();
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (m_entries.contains(hash) || m_pending.contains(hash))
+                return;
+            m_pending.put(hash);
+        }
+
+        auto task = new WriteTask(*this, resource);
+        if (!m_writer.enqueue(*task))
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_pending.remove(hash);
+            if (m_pending.size() == 0u)
+                m_pendingWritten.notify_all();
+        }
+        // executor holds its own reference, task deletes itself when writer releases it
+        task->release();
+    }
+
+    void ResourceDiskCache::write(const IResource& resource)
+    {
+        const ResourceContentHash hash = resource.getHash();
+        const UInt32 dataSize = SingleResourceSerialization::SizeOfSerializedResource(resource, false);
+        const UInt64 recordSize = sizeof(RecordHeader) + dataSize;
+
+        // space of dropped records is reclaimed only when file is opened, limit its growth until then
+        if (m_fileEnd + recordSize > sizeof(FileHeader) + 2u * m_maxSize)
+            LOG_DEBUG_P(CONTEXT_RENDERER, "ResourceDiskCache: not storing resource {}, cache file '{}' is full until reopened", hash, m_filePath);
+        else if (recordSize <= m_maxSize)
+        {
+            BinaryOutputStream stream(dataSize);
+            SingleResourceSerialization::SerializeResource(stream, resource, false);
+            assert(stream.getSize() == dataSize);
+
+            Adler32Checksum checksum;
+            checksum.addData(stream.getData(), dataSize);
+            const RecordHeader header{ RecordMagic, dataSize, hash.lowPart, hash.highPart, checksum.getResult(), 0u, m_generation };
+
+            const bool written = m_file.write(&header, sizeof(header)) && m_file.write(stream.getData(), dataSize) && m_file.flush();
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (written)
+            {
+                // records written in this run are not mapped, they become loadable when cache is opened next time
+                m_entries.put(hash, Entry{ m_fileEnd, dataSize, header.checksum, m_generation, false, true });
+                m_cachedSize += recordSize;
+                m_fileEnd += recordSize;
+                evictLeastRecentlyUsed(hash);
+            }
+            else
+            {
+                LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: failed to write resource {} to cache file '{}'", hash, m_filePath);
+                if (!m_file.seek(static_cast<std::intptr_t>(m_fileEnd), File::SeekOrigin::BeginningOfFile))
+                    LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: failed to restore write position in cache file '{}'", m_filePath);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_pending.remove(hash);
+            if (m_pending.size() == 0u)
+                m_pendingWritten.notify_all();
+        }
+        writeRecordUpdates();
+    }
+
+    void ResourceDiskCache::evictLeastRecentlyUsed(const ResourceContentHash& keep)
+    {
+        if (m_cachedSize <= m_maxSize)
+            return;
+
+        std::vector<std::pair<UInt64, ResourceContentHash>> candidates;
+        candidates.reserve(m_entries.size());
+        for (const auto& entry : m_entries)
+        {
+            if (entry.key != keep)
+                candidates.emplace_back(entry.value.lastUsed, entry.key);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto& candidate : candidates)
+        {
+            if (m_cachedSize <= m_maxSize)
+                break;
+            removeEntry(candidate.second);
+        }
+    }
+
+    void ResourceDiskCache::removeEntry(const ResourceContentHash& hash)
+    {
+        const Entry* entry = m_entries.get(hash);
+        assert(entry);
+        const UInt64 recordSize = sizeof(RecordHeader) + entry->dataSize;
+        m_cachedSize -= recordSize;
+        m_deadSize += recordSize;
+        m_droppedRecords.push_back(entry->offset);
+        m_entries.remove(hash);
+    }
+
+    bool ResourceDiskCache::contains(const ResourceContentHash& hash) const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_entries.contains(hash);
+    }
+
+    UInt64 ResourceDiskCache::getCachedSize() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_cachedSize;
+    }
+
+    void ResourceDiskCache::flush()
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_pendingWritten.wait(lock, [&] { return m_pending.size() == 0u; });
+    }
+
+    bool ResourceDiskCache::compactMappedFile()
+    {
+        std::vector<std::pair<UInt64, ResourceContentHash>> records;
+        records.reserve(m_entries.size());
+        for (const auto& entry : m_entries)
+            records.emplace_back(entry.value.offset, entry.key);
+        std::sort(records.begin(), records.end());
+
+        const String tempFilePath = m_filePath + ".tmp";
+        File tempFile(tempFilePath);
+        const FileHeader header{ FileMagic, FileVersion, m_generation };
+        bool success = tempFile.open(File::Mode::WriteOverWriteOldBinary) && tempFile.write(&header, sizeof(header));
+
+        std::vector<UInt64> newOffsets;
+        newOffsets.reserve(records.size());
+        UInt64 newFileEnd = sizeof(header);
+        for (const auto& record : records)
+        {
+            if (!success)
+                break;
+            const UInt64 recordSize = sizeof(RecordHeader) + m_entries.get(record.second)->dataSize;
+            success = tempFile.write(m_mappedFile->data() + record.first, recordSize);
+            newOffsets.push_back(newFileEnd);
+            newFileEnd += recordSize;
+        }
+        success = success && tempFile.flush();
+        tempFile.close();
+
+        // file is unmapped before it is replaced, not all platforms allow replacing mapped file
+        m_mappedFile.reset();
+        if (success && tempFile.renameTo(m_filePath))
+        {
+            for (size_t i = 0u; i < records.size(); ++i)
+                m_entries.get(records[i].second)->offset = newOffsets[i];
+            m_fileEnd = newFileEnd;
+            m_deadSize = 0u;
+            m_droppedRecords.clear();
+            LOG_INFO_P(CONTEXT_RENDERER, "ResourceDiskCache: compacted '{}' to {} bytes", m_filePath, m_fileEnd);
+        }
+        else
+        {
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: failed to compact cache file '{}'", m_filePath);
+            tempFile.remove();
+        }
+
+        m_mappedFile = std::make_shared<const MemoryMappedFile>(m_filePath);
+        if (!m_mappedFile->isMapped())
+        {
+            LOG_WARN_P(CONTEXT_RENDERER, "ResourceDiskCache: cannot map cache file '{}', cache disabled", m_filePath);
+            m_entries.clear();
+            m_cachedSize = 0u;
+            m_droppedRecords.clear();
+            return false;
+        }
+        return true;
+    }
+}
@@ -18,6 +18,7 @@
 #include "Utils/TextureMathUtils.h"
 #include "Components/ManagedResource.h"
 #include "RendererLib/ResourceDescriptor.h"
+#include <numeric>
 
 namespace ramses_internal
 {
@@ -53,7 +54,7 @@ namespace ramses_internal
         case EResourceType_Texture2D:
         case EResourceType_Texture3D:
         case EResourceType_TextureCube:
-            return uploadTexture(device, *resourceObject.convertTo<TextureResource>(), outVRAMSize);
+            return UploadTexture(device, *resourceObject.convertTo<TextureResource>(), 0u, outVRAMSize);
         case EResourceType_Effect:
         {
             const EffectResource* effectRes = resourceObject.convertTo<EffectResource>();
@@ -97,7 +98,32 @@ namespace ramses_internal
         }
     }
 
-    DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize)
+    DeviceResourceHandle ResourceUploader::uploadTextureFromMipLevel(IRenderBackend& renderBackend, const TextureResource& texture, UInt32 firstMipLevel, UInt32& outVRAMSize)
+    {
+        assert(!texture.getGenerateMipChainFlag());
+        assert(firstMipLevel < texture.getMipDataSizes().size());
+        return UploadTexture(renderBackend.getDevice(), texture, firstMipLevel, outVRAMSize);
+    }
+
+    void ResourceUploader::uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle handle, const TextureResource& texture, UInt32 mipLevel, UInt32 firstRow, UInt32 rowCount)
+    {
+        IDevice& device = renderBackend.getDevice();
+        device.bindTexture(handle);
+        UploadTextureMipLevelData(device, handle, texture, mipLevel, firstRow, rowCount);
+        if (firstRow + rowCount == GetTextureMipLevelRowCount(texture, mipLevel))
+            device.setTextureBaseMipLevel(handle, mipLevel);
+    }
+
+    UInt32 ResourceUploader::GetTextureMipLevelRowCount(const TextureResource& texture, UInt32 mipLevel)
+    {
+        if (IsFormatCompressed(texture.getTextureFormat()))
+            return 1u;
+        if (texture.getTypeID() == EResourceType_Texture3D)
+            return TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
+        return TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
+    }
+
+    DeviceResourceHandle ResourceUploader::UploadTexture(IDevice& device, const TextureResource& texture, UInt32 firstMipLevel, UInt32& vramSize)
     {
         const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
         const auto& mipDataSizes = texture.getMipDataSizes();
@@ -125,43 +151,60 @@ namespace ramses_internal
         assert(textureDeviceHandle.isValid());
 
         // upload texture data
-        const Byte* pData = texture.getResourceData().data();
+        for (UInt32 mipLevel = firstMipLevel; mipLevel < numProvidedMipLevels; ++mipLevel)
+            UploadTextureMipLevelData(device, textureDeviceHandle, texture, mipLevel, 0u, GetTextureMipLevelRowCount(texture, mipLevel));
+
+        // lower mip levels are streamed later, until then sampling is restricted to uploaded ones
+        if (firstMipLevel > 0u)
+            device.setTextureBaseMipLevel(textureDeviceHandle, firstMipLevel);
+
+        if (generateMipsFlag)
+        {
+            device.generateMipmaps(textureDeviceHandle);
+        }
+
+        return textureDeviceHandle;
+    }
+
+    void ResourceUploader::UploadTextureMipLevelData(IDevice& device, DeviceResourceHandle handle, const TextureResource& texture, UInt32 mipLevel, UInt32 firstRow, UInt32 rowCount)
+    {
+        const auto& mipDataSizes = texture.getMipDataSizes();
+        assert(mipLevel < mipDataSizes.size());
+        const UInt32 mipLevelRowCount = GetTextureMipLevelRowCount(texture, mipLevel);
+        assert(rowCount > 0u && firstRow + rowCount <= mipLevelRowCount);
+        // rows of uncompressed texture data are tightly packed, compressed texture is uploaded as a whole
+        const UInt32 rowDataSize = mipDataSizes[mipLevel] / mipLevelRowCount;
+        const bool wholeLevel = (firstRow == 0u && rowCount == mipLevelRowCount);
+        // data of all mip levels follow each other, for cube texture face by face
+        const UInt32 mipLevelOffset = std::accumulate(mipDataSizes.cbegin(), mipDataSizes.cbegin() + mipLevel, 0u);
+        const Byte* pData = texture.getResourceData().data() + mipLevelOffset + firstRow * rowDataSize;
+        const UInt32 dataSize = wholeLevel ? mipDataSizes[mipLevel] : rowCount * rowDataSize;
+
+        const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
+        const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
+        const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
         switch (texture.getTypeID())
         {
         case EResourceType_Texture2D:
+            device.uploadTextureData(handle, mipLevel, 0u, firstRow, 0u, width, wholeLevel ? height : rowCount, 1u, pData, dataSize);
+            break;
         case EResourceType_Texture3D:
-            for (UInt32 mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipDataSizes.size()); ++mipLevel)
-            {
-                const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
-                const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
-                device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
-                pData += mipDataSizes[mipLevel];
-            }
+            device.uploadTextureData(handle, mipLevel, 0u, 0u, firstRow, width, height, wholeLevel ? depth : rowCount, pData, dataSize);
             break;
         case EResourceType_TextureCube:
+        {
+            const UInt32 faceDataSize = std::accumulate(mipDataSizes.cbegin(), mipDataSizes.cend(), 0u);
             for (UInt32 i = 0; i < 6u; ++i)
             {
                 const ETextureCubeFace faceId = static_cast<ETextureCubeFace>(i);
-                for (UInt32 mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipDataSizes.size()); ++mipLevel)
-                {
-                    const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                    // texture faceID is encoded in Z offset
-                    device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, faceId, faceSize, faceSize, 1u, pData, mipDataSizes[mipLevel]);
-                    pData += mipDataSizes[mipLevel];
-                }
+                // texture faceID is encoded in Z offset
+                device.uploadTextureData(handle, mipLevel, 0u, firstRow, faceId, width, wholeLevel ? width : rowCount, 1u, pData + i * faceDataSize, dataSize);
             }
             break;
+        }
         default:
             assert(false);
         }
-
-        if (generateMipsFlag)
-        {
-            device.generateMipmaps(textureDeviceHandle);
-        }
-
-        return textureDeviceHandle;
     }
 
     DeviceResourceHandle ResourceUploader::queryBinaryShaderCache(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash)
@@ -9,6 +9,7 @@
 #include "RendererLib/ResourceUploadingManager.h"
 #include "RendererLib/RendererResourceRegistry.h"
 #include "RendererLib/IResourceUploader.h"
+#include "RendererLib/ResourceUploader.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
 #include "RendererLib/DisplayConfig.h"
@@ -18,8 +19,12 @@
 #include "Utils/ThreadLocalLogForced.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Resource/EffectResource.h"
+#include "Resource/ArrayResource.h"
+#include "Resource/TextureResource.h"
+#include "Collections/Vector.h"
 #include "absl/algorithm/container.h"
 #include <chrono>
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -36,14 +41,20 @@ namespace ramses_internal
         , m_renderBackend(renderBackend)
         , m_asyncEffectUploader(asyncEffectUploader)
         , m_keepEffects(displayConfig.getKeepEffectsUploaded())
+        , m_keepGeometryResourceData(displayConfig.isDrawCallBatchingEnabled())
         , m_frameTimer(frameTimer)
-        , m_resourceCacheSize(displayConfig.getGPUMemoryCacheSize())
+        , m_textureStreamingEnabled(displayConfig.isTextureStreamingEnabled())
+        , m_gpuMemoryBudget(displayConfig.getGPUMemoryCacheSize())
         , m_resourceUploadBatchSize(displayConfig.getResourceUploadBatchSize())
         , m_stats(stats)
         , m_scenePriorities(displayConfig.getScenePriorities())
     {
         assert(m_uploader);
         assert(m_resourceUploadBatchSize > 0u);
+        if (displayConfig.getResourceDecompressionThreadCount() > 0u)
+            m_decompressionStage = std::make_unique<ResourceDecompressionStage>(displayConfig.getResourceDecompressionThreadCount());
+        if (!displayConfig.getResourceDiskCacheFilePath().empty())
+            m_diskCache = std::make_unique<ResourceDiskCache>(displayConfig.getResourceDiskCacheFilePath(), displayConfig.getResourceDiskCacheMaxSize());
     }
 
     ResourceUploadingManager::~ResourceUploadingManager()
@@ -64,24 +75,75 @@ namespace ramses_internal
 
     Bool ResourceUploadingManager::hasAnythingToUpload() const
     {
-        return !m_resources.getAllProvidedResources().empty() || m_resources.hasAnyResourcesScheduledForUpload();
+        return !m_resources.getAllProvidedResources().empty() || m_resources.hasAnyResourcesScheduledForUpload() || !m_streamedTextures.empty();
     }
 
     void ResourceUploadingManager::uploadAndUnloadPendingResources()
     {
+        if (m_decompressionStage)
+            m_decompressionStage->collectFinished();
+
         ResourceContentHashVector resourcesToUpload;
         UInt64 sizeToUpload = 0u;
         getAndPrepareResourcesToUploadNext(resourcesToUpload, sizeToUpload);
-        const UInt64 sizeToBeFreed = getAmountOfMemoryToBeFreedForNewResources(sizeToUpload);
+        const UInt64 sizeToBeFreed = m_gpuMemoryBudget.getAmountOfMemoryToBeFreed(sizeToUpload);
 
         ResourceContentHashVector resourcesToUnload;
         getResourcesToUnloadNext(resourcesToUnload, m_keepEffects, sizeToBeFreed);
 
         unloadResources(resourcesToUnload);
         uploadResources(resourcesToUpload);
+        // remaining mip levels of streamed textures have lower priority than resources not uploaded at all yet
+        uploadStreamedTextureMipLevels(!resourcesToUpload.empty());
         syncEffects();
 
-        m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
+        // eviction above was based on estimated size of resources to upload, evict more if actual size did not fit,
+        // so that budget is reported as exceeded only if resources in use do not fit in it
+        if (m_gpuMemoryBudget.isEnabled())
+        {
+            const UInt64 sizeStillToBeFreed = m_gpuMemoryBudget.getAmountOfMemoryToBeFreed(0u);
+            if (sizeStillToBeFreed > 0u)
+            {
+                resourcesToUnload.clear();
+                getResourcesToUnloadNext(resourcesToUnload, m_keepEffects, sizeStillToBeFreed);
+                unloadResources(resourcesToUnload);
+            }
+        }
+
+        m_gpuMemoryBudgetExceeded = m_gpuMemoryBudget.updatePressureState();
+        if (m_gpuMemoryBudgetExceeded)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "ResourceUploadingManager::uploadAndUnloadPendingResources: resources in use by scenes exceed GPU memory cache size ("
+                << m_gpuMemoryBudget.getUsage() << " B used, " << m_gpuMemoryBudget.getBudget() << " B cache size)");
+            m_stats.gpuMemoryBudgetExceeded();
+        }
+
+        m_stats.setVRAMUsage(m_gpuMemoryBudget.getUsage(), m_gpuMemoryBudget.getBudget());
+        m_stats.setVRAMUsagePerType(
+            m_gpuMemoryBudget.getUsage(EResourceType_Texture2D) + m_gpuMemoryBudget.getUsage(EResourceType_Texture3D) + m_gpuMemoryBudget.getUsage(EResourceType_TextureCube),
+            m_gpuMemoryBudget.getUsage(EResourceType_VertexArray) + m_gpuMemoryBudget.getUsage(EResourceType_IndexArray),
+            m_gpuMemoryBudget.getUsage(EResourceType_Effect));
+        for (const auto& sceneUsage : m_gpuMemoryBudget.getUsagePerScene())
+            m_stats.setSceneVRAMUsage(sceneUsage.first, sceneUsage.second);
+    }
+
+    void ResourceUploadingManager::onResourceUsedByScene(const ResourceContentHash& hash, SceneId sceneId)
+    {
+        m_gpuMemoryBudget.onResourceUsedByScene(hash, sceneId, getScenePriority(sceneId));
+    }
+
+    void ResourceUploadingManager::onResourceUnreferencedByScene(const ResourceContentHash& hash, SceneId sceneId)
+    {
+        // resources not registered anymore were not uploaded and are not tracked by budget
+        if (!m_resources.containsResource(hash) || !contains_c(m_resources.getResourceDescriptor(hash).sceneUsage, sceneId))
+            m_gpuMemoryBudget.onResourceUnusedByScene(hash, sceneId);
+    }
+
+    ManagedResource ResourceUploadingManager::loadFromDiskCache(const ResourceContentHash& hash)
+    {
+        if (!m_diskCache)
+            return {};
+        return m_diskCache->load(hash);
     }
 
     void ResourceUploadingManager::unloadResources(const ResourceContentHashVector& resourcesToUnload)
@@ -93,13 +155,31 @@ namespace ramses_internal
         }
     }
 
+    void ResourceUploadingManager::collectEffectsToCancel()
+    {
+        assert(m_effectsToCancel.empty());
+        // effects not used by any scene anymore (e.g. their scene got unmapped) do not need to be compiled
+        for (auto& effect : m_effectsScheduledForUpload)
+        {
+            if (!effect.value && m_resources.getResourceDescriptor(effect.key).sceneUsage.empty())
+            {
+                m_effectsToCancel.push_back(effect.key);
+                effect.value = true;
+            }
+        }
+    }
+
     void ResourceUploadingManager::syncEffects()
     {
-        m_asyncEffectUploader.sync(m_effectsToUpload, m_effectsUploadedTemp);
+        collectEffectsToCancel();
+        m_asyncEffectUploader.sync(m_effectsToUpload, m_effectsToCancel, m_effectsSyncResultTemp);
         m_effectsToUpload.clear();
+        m_effectsToCancel.clear();
 
-        for (auto& e : m_effectsUploadedTemp)
+        auto& uploadedEffects = m_effectsSyncResultTemp.uploaded;
+        for (size_t i = 0u; i < uploadedEffects.size(); ++i)
         {
+            auto& e = uploadedEffects[i];
             const auto& hash = e.first;
             if (!m_resources.containsResource(hash))
             {
@@ -115,17 +195,21 @@ namespace ramses_internal
                 assert(false);
                 continue;
             }
+            m_effectsScheduledForUpload.remove(hash);
+
+            const auto& rd = m_resources.getResourceDescriptor(hash);
+            const auto sceneId = (rd.sceneUsage.empty() ? SceneId{} : rd.sceneUsage.front());
+            const auto& uploadTimes = m_effectsSyncResultTemp.uploadTimes[i];
+            m_stats.shaderCompiled(uploadTimes.uploadTime, rd.resource->getName(), sceneId);
+            m_stats.shaderCompileLatency(uploadTimes.latency);
 
             if (e.second)
             {
-                const auto& rd = m_resources.getResourceDescriptor(hash);
                 const auto deviceHandle = m_renderBackend.getDevice().registerShader(std::move(e.second));
                 const auto resourceSize = rd.decompressedSize;
-                m_resourceSizes.put(hash, resourceSize);
-                m_resourceTotalUploadedSize += resourceSize;
+                uploadedToGpuMemory(rd, resourceSize);
                 m_resources.setResourceUploaded(hash, deviceHandle, resourceSize);
 
-                const auto sceneId = (rd.sceneUsage.empty() ? SceneId{} : rd.sceneUsage.front());
                 m_uploader->storeShaderInBinaryShaderCache(m_renderBackend, deviceHandle, hash, sceneId);
             }
             else
@@ -135,7 +219,18 @@ namespace ramses_internal
             }
         }
 
-        m_effectsUploadedTemp.clear();
+        for (const auto& hash : m_effectsSyncResultTemp.cancelled)
+        {
+            assert(m_resources.getResourceStatus(hash) == EResourceStatus::ScheduledForUpload);
+            LOG_INFO(CONTEXT_RENDERER, "ResourceUploadingManager::syncEffects upload of effect cancelled #" << hash);
+            m_effectsScheduledForUpload.remove(hash);
+            // effect gets uploaded again if it got used by a scene meanwhile
+            m_resources.setResourceUploadCancelled(hash);
+        }
+
+        m_effectsSyncResultTemp.uploaded.clear();
+        m_effectsSyncResultTemp.uploadTimes.clear();
+        m_effectsSyncResultTemp.cancelled.clear();
     }
 
     void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload)
@@ -189,15 +284,27 @@ namespace ramses_internal
         const UInt32 resourceSize = pResource->getDecompressedDataSize();
         UInt32 vramSize = 0;
         // upload to GPU
-        const auto deviceHandle = m_uploader->uploadResource(m_renderBackend, rd, vramSize);
+        const UInt32 firstMipLevel = getFirstMipLevelToUpload(*pResource);
+        const auto deviceHandle = (firstMipLevel > 0u) ?
+            absl::optional<DeviceResourceHandle>{ m_uploader->uploadTextureFromMipLevel(m_renderBackend, *pResource->convertTo<TextureResource>(), firstMipLevel, vramSize) } :
+            m_uploader->uploadResource(m_renderBackend, rd, vramSize);
         if (deviceHandle.has_value())
         {
             if (deviceHandle.value().isValid())
             {
-                m_resourceSizes.put(rd.hash, resourceSize);
-                m_resourceTotalUploadedSize += resourceSize;
+                if (firstMipLevel > 0u)
+                    m_streamedTextures.push_back({ rd.hash, deviceHandle.value(), rd.resource, firstMipLevel, 0u });
+                // uploader reports VRAM size only where it differs from data size (e.g. textures with generated mip levels)
+                uploadedToGpuMemory(rd, vramSize > 0u ? vramSize : resourceSize);
+                // only resources received compressed are worth caching, shaders are cached by binary shader cache
+                if (m_diskCache && rd.compressedSize != 0u && rd.type != EResourceType_Effect)
+                    m_diskCache->store(rd.resource);
+                // bounds for frustum culling must be computed while vertex data is still in system memory
+                if (rd.type == EResourceType_VertexArray)
+                    m_resources.setResourceBoundingVolume(rd.hash, BoundingVolume::FromVertexArray(*pResource->convertTo<ArrayResource>()));
                 // will also release reference to data (release from system memory if last holder)
-                m_resources.setResourceUploaded(rd.hash, deviceHandle.value(), vramSize);
+                const bool keepResourceData = m_keepGeometryResourceData && (rd.type == EResourceType_VertexArray || rd.type == EResourceType_IndexArray);
+                m_resources.setResourceUploaded(rd.hash, deviceHandle.value(), vramSize, keepResourceData);
             }
             else
             {
@@ -209,26 +316,94 @@ namespace ramses_internal
         {
             // effect not found in cache, schedule for upload in uploader thread
             assert(rd.type == EResourceType_Effect);
-            assert(absl::c_find_if(m_effectsToUpload, [&](const auto& e){ return e->getHash() == rd.hash;}) == m_effectsToUpload.cend());
-            m_effectsToUpload.push_back(pResource->convertTo<const EffectResource>());
+            assert(absl::c_find_if(m_effectsToUpload, [&](const auto& e){ return e.effect->getHash() == rd.hash;}) == m_effectsToUpload.cend());
+            m_effectsToUpload.push_back({ pResource->convertTo<const EffectResource>(), getScenePriority(rd) });
+            m_effectsScheduledForUpload.put(rd.hash, false);
             m_resources.setResourceScheduledForUpload(rd.hash);
         }
     }
 
+    void ResourceUploadingManager::uploadStreamedTextureMipLevels(bool checkTimeLimitBeforeFirst)
+    {
+        m_scenesWithStreamedTextureUpdates.clear();
+
+        // at least one piece of mip level is uploaded per update unless other resources were uploaded already,
+        // so that streaming makes progress even if time budget is always exceeded
+        Bool checkTimeLimit = checkTimeLimitBeforeFirst;
+        while (!m_streamedTextures.empty())
+        {
+            if (checkTimeLimit && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ResourcesUpload))
+                break;
+            checkTimeLimit = true;
+
+            auto& streamedTexture = m_streamedTextures.front();
+            assert(streamedTexture.baseMipLevel > 0u);
+            const auto& texture = *streamedTexture.resource->convertTo<TextureResource>();
+            const UInt32 mipLevel = streamedTexture.baseMipLevel - 1u;
+            const UInt32 rowCount = ResourceUploader::GetTextureMipLevelRowCount(texture, mipLevel);
+            const UInt32 numFaces = (texture.getTypeID() == EResourceType_TextureCube ? 6u : 1u);
+            const UInt32 rowDataSize = texture.getMipDataSizes()[mipLevel] * numFaces / rowCount;
+            const UInt32 rowsToUpload = std::min(std::max(1u, LargeResourceByteSizeThreshold / rowDataSize), rowCount - streamedTexture.uploadedRows);
+            m_uploader->uploadTextureMipLevel(m_renderBackend, streamedTexture.deviceHandle, texture, mipLevel, streamedTexture.uploadedRows, rowsToUpload);
+
+            streamedTexture.uploadedRows += rowsToUpload;
+            if (streamedTexture.uploadedRows < rowCount)
+                continue;
+            streamedTexture.uploadedRows = 0u;
+            streamedTexture.baseMipLevel = mipLevel;
+
+            for (const auto sceneId : m_resources.getResourceDescriptor(streamedTexture.hash).sceneUsage)
+            {
+                if (!contains_c(m_scenesWithStreamedTextureUpdates, sceneId))
+                    m_scenesWithStreamedTextureUpdates.push_back(sceneId);
+            }
+
+            if (streamedTexture.baseMipLevel == 0u)
+            {
+                LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::uploadStreamedTextureMipLevels all mip levels uploaded for texture #" << streamedTexture.hash);
+                m_streamedTextures.pop_front();
+            }
+        }
+    }
+
+    UInt32 ResourceUploadingManager::getFirstMipLevelToUpload(const IResource& resource) const
+    {
+        const auto type = resource.getTypeID();
+        if (!m_textureStreamingEnabled || (type != EResourceType_Texture2D && type != EResourceType_Texture3D && type != EResourceType_TextureCube))
+            return 0u;
+
+        const auto& texture = *resource.convertTo<TextureResource>();
+        if (texture.getGenerateMipChainFlag())
+            return 0u;
+
+        // smallest mip levels which together are not considered large resource are uploaded at once, at least the smallest one
+        const auto& mipDataSizes = texture.getMipDataSizes();
+        const UInt32 numFaces = (type == EResourceType_TextureCube ? 6u : 1u);
+        UInt32 firstMipLevel = static_cast<UInt32>(mipDataSizes.size()) - 1u;
+        UInt32 sizeToUpload = mipDataSizes[firstMipLevel] * numFaces;
+        while (firstMipLevel > 0u && sizeToUpload + mipDataSizes[firstMipLevel - 1u] * numFaces <= LargeResourceByteSizeThreshold)
+        {
+            --firstMipLevel;
+            sizeToUpload += mipDataSizes[firstMipLevel] * numFaces;
+        }
+
+        return firstMipLevel;
+    }
+
     void ResourceUploadingManager::unloadResource(const ResourceDescriptor& rd)
     {
         assert(rd.sceneUsage.empty());
         assert(rd.status == EResourceStatus::Uploaded);
-        assert(m_resourceSizes.contains(rd.hash));
 
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::unloadResource delete resource of type " << EnumToString(rd.type));
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Unloading resource #" << rd.hash);
         m_uploader->unloadResource(m_renderBackend, rd.type, rd.hash, rd.deviceHandle);
 
-        auto resSizeIt = m_resourceSizes.find(rd.hash);
-        assert(m_resourceTotalUploadedSize >= resSizeIt->value);
-        m_resourceTotalUploadedSize -= resSizeIt->value;
-        m_resourceSizes.remove(resSizeIt);
+        const auto streamedIt = absl::c_find_if(m_streamedTextures, [&](const auto& t) { return t.hash == rd.hash; });
+        if (streamedIt != m_streamedTextures.end())
+            m_streamedTextures.erase(streamedIt);
+
+        m_gpuMemoryBudget.onResourceUnloaded(rd.hash);
 
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Removing resource descriptor for resource #" << rd.hash);
         m_resources.unregisterResource(rd.hash);
@@ -237,13 +412,21 @@ namespace ramses_internal
     void ResourceUploadingManager::getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const
     {
         assert(resourcesToUnload.empty());
-        const ResourceContentHashVector& unusedResources = m_resources.getAllResourcesNotInUseByScenes();
+        const ResourceContentHashVector* unusedResources = &m_resources.getAllResourcesNotInUseByScenes();
         UInt64 sizeToUnload = 0u;
 
+        // unused resources are listed in order they became unused, without scene priorities that is also eviction order
+        if (!m_scenePriorities.empty() && sizeToBeFreed > 0u)
+        {
+            m_evictionOrder = *unusedResources;
+            m_gpuMemoryBudget.sortByEvictionOrder(m_evictionOrder);
+            unusedResources = &m_evictionOrder;
+        }
+
         // collect unused resources to be unloaded
         // if total size of resources to be unloaded is enough
         // we stop adding more unused resources, they can be kept uploaded as long as not more memory is needed
-        for (const auto& hash : unusedResources)
+        for (const auto& hash : *unusedResources)
         {
             if (sizeToUnload >= sizeToBeFreed)
             {
@@ -257,14 +440,13 @@ namespace ramses_internal
                 if (!keepEffectCached)
                 {
                     resourcesToUnload.push_back(hash);
-                    assert(m_resourceSizes.contains(hash));
-                    sizeToUnload += *m_resourceSizes.get(hash);
+                    sizeToUnload += m_gpuMemoryBudget.getResourceSize(hash);
                 }
             }
         }
     }
 
-    void ResourceUploadingManager::getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const
+    void ResourceUploadingManager::getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize)
     {
         assert(resourcesToUpload.empty());
 
@@ -286,6 +468,9 @@ namespace ramses_internal
             const ResourceDescriptor& rd = m_resources.getResourceDescriptor(resource);
             assert(rd.status == EResourceStatus::Provided);
             assert(rd.resource);
+            // resources still being decompressed by worker threads are uploaded in one of next frames
+            if (m_decompressionStage && m_decompressionStage->prepare(rd.hash, rd.resource))
+                continue;
             totalSize += rd.resource->getDecompressedDataSize();
             auto& bucket = m_buckets[getScenePriority(rd)];
             bucket.push_back(resource);
@@ -308,41 +493,28 @@ namespace ramses_internal
 
     Int32 ResourceUploadingManager::getScenePriority(const ResourceDescriptor& rd) const
     {
-        if (!m_scenePriorities.empty() && !rd.sceneUsage.empty())
-        {
-            auto it = m_scenePriorities.find(rd.sceneUsage.front());
-            if (it != m_scenePriorities.end())
-            {
-                return it->second;
-            }
-        }
-        return 0;
+        return rd.sceneUsage.empty() ? 0 : getScenePriority(rd.sceneUsage.front());
     }
 
-    UInt64 ResourceUploadingManager::getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const
+    Int32 ResourceUploadingManager::getScenePriority(SceneId sceneId) const
     {
-        if (m_resourceCacheSize == 0u)
-        {
-            // unload all if no caching is allowed
-            return std::numeric_limits<UInt64>::max();
-        }
+        const auto it = m_scenePriorities.find(sceneId);
+        return it != m_scenePriorities.end() ? it->second : 0;
+    }
 
-        if (m_resourceCacheSize > m_resourceTotalUploadedSize)
-        {
-            const UInt64 remainingCacheSize = m_resourceCacheSize - m_resourceTotalUploadedSize;
-            if (remainingCacheSize < sizeToUpload)
-            {
-                return sizeToUpload - remainingCacheSize;
-            }
-            else
-            {
-                return 0u;
-            }
-        }
-        else
-        {
-            // cache already exceeded, try unloading all that is above cache limit plus size for new resources to be uploaded
-            return sizeToUpload + m_resourceTotalUploadedSize - m_resourceCacheSize;
-        }
+    Int32 ResourceUploadingManager::getHighestScenePriority(const ResourceDescriptor& rd) const
+    {
+        // lower value is higher priority
+        if (rd.sceneUsage.empty())
+            return 0;
+        Int32 priority = std::numeric_limits<Int32>::max();
+        for (const auto sceneId : rd.sceneUsage)
+            priority = std::min(priority, getScenePriority(sceneId));
+        return priority;
+    }
+
+    void ResourceUploadingManager::uploadedToGpuMemory(const ResourceDescriptor& rd, UInt32 vramSize)
+    {
+        m_gpuMemoryBudget.onResourceUploaded(rd.hash, rd.type, vramSize, m_scenePriorities.empty() ? 0 : getHighestScenePriority(rd), rd.sceneUsage);
     }
 }
@@ -8,6 +8,7 @@
 
 #include "RendererLib/SceneResourceUploader.h"
 #include "RendererLib/IRendererResourceManager.h"
+#include "RendererLib/RenderableBatchGeometry.h"
 #include "SceneAPI/RenderBuffer.h"
 #include "SceneAPI/IScene.h"
 #include "SceneAPI/TextureBuffer.h"
@@ -99,4 +100,35 @@ namespace ramses_internal
 
         resourceManager.uploadVertexArray(renderableHandle, vertexArrayInfo, scene.getSceneId());
     }
+
+    void SceneResourceUploader::UploadRenderableBatch(const IScene& scene, RenderableBatchHandle batchHandle, const RenderableBatchCache::Batch& batch, IRendererResourceManager& resourceManager)
+    {
+        // all members share geometry layout
+        const auto firstGeometryInstance = scene.getRenderable(batch.members.front().renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        const auto& geometryLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(firstGeometryInstance));
+
+        RenderableBatchInfo batchInfo;
+        batchInfo.effect = geometryLayout.getEffectHash();
+        for (DataFieldHandle attributeField(1u); attributeField < geometryLayout.getFieldCount(); ++attributeField)
+            batchInfo.vertexAttributeTypes.push_back(geometryLayout.getField(attributeField).dataType);
+
+        batchInfo.members.reserve(batch.members.size());
+        for (const auto& member : batch.members)
+        {
+            const auto& renderable = scene.getRenderable(member.renderable);
+            const auto geometryInstance = renderable.dataInstances[ERenderableDataSlotType_Geometry];
+
+            RenderableBatchInfo::Member memberInfo;
+            //indices are always in the 1st field (field Zero)
+            memberInfo.indices = scene.getDataResource(geometryInstance, DataFieldHandle{ 0u }).hash;
+            for (DataFieldHandle attributeField(1u); attributeField < geometryLayout.getFieldCount(); ++attributeField)
+                memberInfo.vertexAttributes.push_back(scene.getDataResource(geometryInstance, attributeField).hash);
+            memberInfo.startVertex = renderable.startVertex;
+            memberInfo.startIndex = member.startIndex;
+            memberInfo.indexCount = member.indexCount;
+            batchInfo.members.push_back(std::move(memberInfo));
+        }
+
+        resourceManager.uploadRenderableBatch(batchHandle, batchInfo, scene.getSceneId());
+    }
 }
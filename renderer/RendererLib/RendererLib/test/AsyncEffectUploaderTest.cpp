@@ -16,6 +16,7 @@
 #include "Watchdog/ThreadAliveNotifierMock.h"
 #include <thread>
 #include <memory>
+#include <iterator>
 
 using namespace testing;
 using namespace std::chrono_literals;
@@ -109,10 +110,13 @@ namespace ramses_internal
             constexpr std::chrono::milliseconds sleepTime {5u};
 
             const auto startTime = std::chrono::steady_clock::now();
+            // uploaded shaders can be reported over several syncs
             EffectsGpuResources resultShaders;
-            while (resultShaders.empty() && timeoutTime > (std::chrono::steady_clock::now() - startTime))
+            while (resultShaders.size() < effectsToUpload.size() && timeoutTime > (std::chrono::steady_clock::now() - startTime))
             {
-                asyncEffectUploader.sync({}, resultShaders);
+                EffectsGpuResources syncedShaders;
+                asyncEffectUploader.sync({}, syncedShaders);
+                std::move(syncedShaders.begin(), syncedShaders.end(), std::back_inserter(resultShaders));
                 std::this_thread::sleep_for(sleepTime);
             }
 
@@ -261,6 +265,106 @@ namespace ramses_internal
         destroyResourceUploadingRenderBackend();
     }
 
+    TEST_F(AnAsyncEffectUploader, UploadsPendingShadersInOrderOfPriority)
+    {
+        createResourceUploadingRenderBackend();
+
+        const auto effectToUploadAndBlock = createUniqueEffects(1u);
+        const auto effects = createUniqueEffects(4u);
+
+        std::promise<void> barrierUploadStarted;
+        std::promise<void> barrierUploadCanBeFinished;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effectToUploadAndBlock[0]))).WillOnce(Invoke([&](const auto&) {
+            barrierUploadStarted.set_value();
+            barrierUploadCanBeFinished.get_future().get();
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        expectDeviceFlushOnWindows();
+        submitForUploadAndExpectNoShaderWereUploaded(effectToUploadAndBlock);
+        barrierUploadStarted.get_future().get();
+
+        {
+            InSequence seq;
+            EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[2])));
+            EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[0])));
+            EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[3])));
+            EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[1])));
+        }
+        expectDeviceFlushOnWindows();
+
+        EffectsSyncResult result;
+        asyncEffectUploader.sync({ { effects[0], 0 }, { effects[1], 5 }, { effects[2], -1 } }, {}, result);
+        EXPECT_TRUE(result.uploaded.empty());
+        asyncEffectUploader.sync({ { effects[3], 0 } }, {}, result);
+        EXPECT_TRUE(result.uploaded.empty());
+
+        barrierUploadCanBeFinished.set_value();
+        EffectsRawResources allEffects = effectToUploadAndBlock;
+        allEffects.insert(allEffects.end(), effects.cbegin(), effects.cend());
+        expectShaderUploadingResult(allEffects);
+
+        destroyResourceUploadingRenderBackend();
+    }
+
+    TEST_F(AnAsyncEffectUploader, CancelsPendingShaderUploadsWhichDidNotStartYet)
+    {
+        createResourceUploadingRenderBackend();
+
+        const auto effectToUploadAndBlock = createUniqueEffects(1u);
+        const auto effects = createUniqueEffects(3u);
+
+        std::promise<void> barrierUploadStarted;
+        std::promise<void> barrierUploadCanBeFinished;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effectToUploadAndBlock[0]))).WillOnce(Invoke([&](const auto&) {
+            barrierUploadStarted.set_value();
+            barrierUploadCanBeFinished.get_future().get();
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[0])));
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[2])));
+        expectDeviceFlushOnWindows();
+
+        submitForUploadAndExpectNoShaderWereUploaded({ effectToUploadAndBlock[0], effects[0], effects[1], effects[2] });
+        barrierUploadStarted.get_future().get();
+
+        // effect being uploaded cannot be cancelled anymore
+        EffectsSyncResult result;
+        asyncEffectUploader.sync({}, { effectToUploadAndBlock[0]->getHash(), effects[1]->getHash() }, result);
+        EXPECT_TRUE(result.uploaded.empty());
+        EXPECT_EQ(ResourceContentHashVector{ effects[1]->getHash() }, result.cancelled);
+
+        barrierUploadCanBeFinished.set_value();
+        expectShaderUploadingResult({ effectToUploadAndBlock[0], effects[0], effects[2] });
+
+        destroyResourceUploadingRenderBackend();
+    }
+
+    TEST_F(AnAsyncEffectUploader, ReportsUploadTimesOfUploadedShaders)
+    {
+        createResourceUploadingRenderBackend();
+
+        const auto effects = createUniqueEffectsAndExpectUploadToDevice(2u);
+        submitForUploadAndExpectNoShaderWereUploaded(effects);
+
+        EffectsSyncResult result;
+        const auto startTime = std::chrono::steady_clock::now();
+        while (result.uploaded.size() < effects.size() && std::chrono::steady_clock::now() - startTime < std::chrono::seconds{ 2u })
+        {
+            EffectsSyncResult partialResult;
+            asyncEffectUploader.sync({}, {}, partialResult);
+            std::move(partialResult.uploaded.begin(), partialResult.uploaded.end(), std::back_inserter(result.uploaded));
+            result.uploadTimes.insert(result.uploadTimes.end(), partialResult.uploadTimes.cbegin(), partialResult.uploadTimes.cend());
+            std::this_thread::sleep_for(5ms);
+        }
+
+        ASSERT_EQ(effects.size(), result.uploaded.size());
+        ASSERT_EQ(effects.size(), result.uploadTimes.size());
+        for (const auto& times : result.uploadTimes)
+            EXPECT_LE(times.uploadTime, times.latency);
+
+        destroyResourceUploadingRenderBackend();
+    }
+
     TEST_F(AnAsyncEffectUploader, notifiesWatchdogInbetweenEveryShaderUpload)
     {
         EXPECT_CALL(notifier, notifyAlive(ThreadAliveNotifierMock::dummyThreadId)).Times(AtLeast(5)).WillRepeatedly([this](auto) { notifyCounter++; });
@@ -0,0 +1,133 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/BoundingVolume.h"
+#include "Resource/ArrayResource.h"
+#include "Math3d/ProjectionParams.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    class ABoundingVolume : public ::testing::Test
+    {
+    protected:
+        static BoundingVolume UnitBox()
+        {
+            BoundingVolume volume;
+            volume.halfExtents = Vector3(1.f);
+            return volume;
+        }
+
+        // camera at origin looking along -z
+        const ViewFrustum frustum{ CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(90.f, 1.f, 1.f, 100.f)) };
+    };
+
+    TEST_F(ABoundingVolume, isInvalidByDefault)
+    {
+        EXPECT_FALSE(BoundingVolume().isValid());
+    }
+
+    TEST_F(ABoundingVolume, computesBoxFromVec3Positions)
+    {
+        const Float positions[] = { -1.f, 2.f, 3.f,   5.f, -2.f, 4.f,   0.f, 0.f, 0.f };
+        const BoundingVolume volume = BoundingVolume::FromPositions(positions, 3u, 3u);
+        ASSERT_TRUE(volume.isValid());
+        EXPECT_EQ(Vector3(2.f, 0.f, 2.f), volume.center);
+        EXPECT_EQ(Vector3(3.f, 2.f, 2.f), volume.halfExtents);
+    }
+
+    TEST_F(ABoundingVolume, computesBoxFromVec4PositionsIgnoringW)
+    {
+        const Float positions[] = { -1.f, -1.f, -1.f, 100.f,   1.f, 1.f, 1.f, -100.f };
+        const BoundingVolume volume = BoundingVolume::FromPositions(positions, 2u, 4u);
+        ASSERT_TRUE(volume.isValid());
+        EXPECT_EQ(Vector3(0.f), volume.center);
+        EXPECT_EQ(Vector3(1.f), volume.halfExtents);
+    }
+
+    TEST_F(ABoundingVolume, isValidForSingleVertex)
+    {
+        const Float positions[] = { 1.f, 2.f, 3.f };
+        const BoundingVolume volume = BoundingVolume::FromPositions(positions, 1u, 3u);
+        ASSERT_TRUE(volume.isValid());
+        EXPECT_EQ(Vector3(1.f, 2.f, 3.f), volume.center);
+        EXPECT_EQ(Vector3(0.f), volume.halfExtents);
+    }
+
+    TEST_F(ABoundingVolume, isInvalidForNoVerticesOrNonFinitePositions)
+    {
+        const Float positions[] = { 1.f, 2.f, 3.f,   std::numeric_limits<Float>::infinity(), 0.f, 0.f };
+        EXPECT_FALSE(BoundingVolume::FromPositions(positions, 0u, 3u).isValid());
+        EXPECT_FALSE(BoundingVolume::FromPositions(positions, 2u, 3u).isValid());
+    }
+
+    TEST_F(ABoundingVolume, computesBoxFromVertexArrayResource)
+    {
+        const Float positions[] = { -1.f, 0.f, 0.f,   1.f, 4.f, 2.f };
+        const ArrayResource vertexArray(EResourceType_VertexArray, 2u, EDataType::Vector3F, positions, ResourceCacheFlag_DoNotCache, "");
+        const BoundingVolume volume = BoundingVolume::FromVertexArray(vertexArray);
+        ASSERT_TRUE(volume.isValid());
+        EXPECT_EQ(Vector3(0.f, 2.f, 1.f), volume.center);
+        EXPECT_EQ(Vector3(1.f, 2.f, 1.f), volume.halfExtents);
+    }
+
+    TEST_F(ABoundingVolume, isInvalidForVertexArrayResourceWithoutVec3OrVec4Positions)
+    {
+        const Float data[] = { -1.f, 0.f, 1.f, 4.f };
+        const ArrayResource vec2Array(EResourceType_VertexArray, 2u, EDataType::Vector2F, data, ResourceCacheFlag_DoNotCache, "");
+        const ArrayResource blobArray(EResourceType_VertexArray, 16u, EDataType::ByteBlob, data, ResourceCacheFlag_DoNotCache, "");
+        EXPECT_FALSE(BoundingVolume::FromVertexArray(vec2Array).isValid());
+        EXPECT_FALSE(BoundingVolume::FromVertexArray(blobArray).isValid());
+    }
+
+    TEST_F(ABoundingVolume, isInsideFrustumIfInFrontOfCamera)
+    {
+        EXPECT_FALSE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, 0.f, -10.f))));
+    }
+
+    TEST_F(ABoundingVolume, isOutsideFrustumIfBehindCameraOrBeyondFarPlane)
+    {
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, 0.f, 10.f))));
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, 0.f, -200.f))));
+    }
+
+    TEST_F(ABoundingVolume, isOutsideFrustumIfBesideOfIt)
+    {
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(20.f, 0.f, -10.f))));
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(-20.f, 0.f, -10.f))));
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, 20.f, -10.f))));
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, -20.f, -10.f))));
+    }
+
+    TEST_F(ABoundingVolume, isNotOutsideFrustumIfIntersectingItsBorder)
+    {
+        // 90 degree fov, at distance 10 frustum border is at x=10
+        EXPECT_FALSE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(10.5f, 0.f, -10.f))));
+        EXPECT_FALSE(frustum.isOutside(UnitBox(), Matrix44f::Translation(Vector3(0.f, 0.f, -100.5f))));
+    }
+
+    TEST_F(ABoundingVolume, takesScalingAndRotationOfModelMatrixIntoAccount)
+    {
+        const Matrix44f translation = Matrix44f::Translation(Vector3(13.f, 0.f, -10.f));
+        EXPECT_TRUE(frustum.isOutside(UnitBox(), translation));
+        EXPECT_FALSE(frustum.isOutside(UnitBox(), translation * Matrix44f::Scaling(Vector3(4.f, 1.f, 1.f))));
+
+        // long thin box reaches into frustum only when rotated
+        BoundingVolume thinBox;
+        thinBox.halfExtents = Vector3(0.1f, 4.f, 0.1f);
+        EXPECT_TRUE(frustum.isOutside(thinBox, translation));
+        EXPECT_FALSE(frustum.isOutside(thinBox, translation * Matrix44f::RotationEuler(Vector3(0.f, 0.f, 90.f), ERotationConvention::XYZ)));
+    }
+
+    TEST_F(ABoundingVolume, isNeverOutsideFrustumIfInvalid)
+    {
+        EXPECT_FALSE(frustum.isOutside(BoundingVolume(), Matrix44f::Translation(Vector3(0.f, 0.f, 1000.f))));
+    }
+}
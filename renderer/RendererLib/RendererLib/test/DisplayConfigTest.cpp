@@ -47,6 +47,13 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId()));
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId(15562)));
     EXPECT_EQ(10u, m_config.getResourceUploadBatchSize());
+    EXPECT_EQ(0u, m_config.getTransformationUpdateThreadCount());
+    EXPECT_FALSE(m_config.isDrawCallSortingEnabled());
+    EXPECT_FALSE(m_config.isDrawCallBatchingEnabled());
+    EXPECT_EQ(0u, m_config.getResourceDecompressionThreadCount());
+    EXPECT_TRUE(m_config.getResourceDiskCacheFilePath().empty());
+    EXPECT_EQ(0u, m_config.getResourceDiskCacheMaxSize());
+    EXPECT_FALSE(m_config.isTextureStreamingEnabled());
 
     // this value is used in HL API, so test that value does not change unnoticed
     EXPECT_TRUE(ramses_internal::IntegrityRGLDeviceUnit::Invalid().getValue() == 0xFFFFFFFF);
@@ -130,6 +137,25 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setResourceUploadBatchSize(3);
     EXPECT_EQ(3u, m_config.getResourceUploadBatchSize());
 
+    m_config.setTransformationUpdateThreadCount(4u);
+    EXPECT_EQ(4u, m_config.getTransformationUpdateThreadCount());
+
+    m_config.setDrawCallSortingEnabled(true);
+    EXPECT_TRUE(m_config.isDrawCallSortingEnabled());
+
+    m_config.setDrawCallBatchingEnabled(true);
+    EXPECT_TRUE(m_config.isDrawCallBatchingEnabled());
+
+    m_config.setResourceDecompressionThreadCount(2u);
+    EXPECT_EQ(2u, m_config.getResourceDecompressionThreadCount());
+
+    m_config.setResourceDiskCache("resources.cache", 1024u);
+    EXPECT_EQ(ramses_internal::String("resources.cache"), m_config.getResourceDiskCacheFilePath());
+    EXPECT_EQ(1024u, m_config.getResourceDiskCacheMaxSize());
+
+    m_config.setTextureStreamingEnabled(true);
+    EXPECT_TRUE(m_config.isTextureStreamingEnabled());
+
     m_config.setScenePriority(ramses_internal::SceneId(15562), -1);
     EXPECT_EQ(-1, m_config.getScenePriority(ramses_internal::SceneId(15562)));
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId(15562 + 1)));
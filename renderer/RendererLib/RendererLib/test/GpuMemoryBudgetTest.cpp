@@ -0,0 +1,149 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/GpuMemoryBudget.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    class AGpuMemoryBudget : public ::testing::Test
+    {
+    protected:
+        GpuMemoryBudget budget{ 100u };
+
+        const ResourceContentHash res1{ 1u, 0u };
+        const ResourceContentHash res2{ 2u, 0u };
+        const ResourceContentHash res3{ 3u, 0u };
+        const ResourceContentHash res4{ 4u, 0u };
+
+        const SceneId scene1{ 1u };
+        const SceneId scene2{ 2u };
+    };
+
+    TEST_F(AGpuMemoryBudget, tracksUsageTotalAndPerResourceType)
+    {
+        budget.onResourceUploaded(res1, EResourceType_Texture2D, 40u, 0, {});
+        budget.onResourceUploaded(res2, EResourceType_VertexArray, 10u, 0, {});
+        budget.onResourceUploaded(res3, EResourceType_Texture2D, 20u, 0, {});
+        EXPECT_EQ(70u, budget.getUsage());
+        EXPECT_EQ(60u, budget.getUsage(EResourceType_Texture2D));
+        EXPECT_EQ(10u, budget.getUsage(EResourceType_VertexArray));
+        EXPECT_EQ(0u, budget.getUsage(EResourceType_Effect));
+        EXPECT_EQ(40u, budget.getResourceSize(res1));
+
+        budget.onResourceUnloaded(res1);
+        EXPECT_EQ(30u, budget.getUsage());
+        EXPECT_EQ(20u, budget.getUsage(EResourceType_Texture2D));
+        EXPECT_EQ(0u, budget.getResourceSize(res1));
+    }
+
+    TEST_F(AGpuMemoryBudget, tracksUsagePerSceneCountingSharedResourcesForEachScene)
+    {
+        budget.onResourceUploaded(res1, EResourceType_Texture2D, 40u, 0, { scene1 });
+        budget.onResourceUploaded(res2, EResourceType_VertexArray, 10u, 0, { scene1, scene2, scene1 });
+        budget.onResourceUploaded(res3, EResourceType_Texture2D, 20u, 0, {});
+        EXPECT_EQ(50u, budget.getUsage(scene1));
+        EXPECT_EQ(10u, budget.getUsage(scene2));
+
+        // not uploaded resources are ignored
+        budget.onResourceUsedByScene(res4, scene2, 0);
+        budget.onResourceUsedByScene(res3, scene2, 0);
+        // already used by scene
+        budget.onResourceUsedByScene(res1, scene1, 0);
+        EXPECT_EQ(50u, budget.getUsage(scene1));
+        EXPECT_EQ(30u, budget.getUsage(scene2));
+
+        budget.onResourceUnusedByScene(res2, scene1);
+        EXPECT_EQ(40u, budget.getUsage(scene1));
+        EXPECT_EQ(30u, budget.getUsage(scene2));
+
+        budget.onResourceUnloaded(res1);
+        budget.onResourceUnloaded(res3);
+        EXPECT_EQ(0u, budget.getUsage(scene1));
+        EXPECT_EQ(10u, budget.getUsage(scene2));
+        EXPECT_EQ(10u, budget.getUsage());
+
+        // scene without usage is still listed so that its usage can be reported as dropped to zero
+        ASSERT_EQ(2u, budget.getUsagePerScene().size());
+        EXPECT_EQ(0u, budget.getUsagePerScene().at(scene1));
+    }
+
+    TEST_F(AGpuMemoryBudget, computesAmountOfMemoryToBeFreed)
+    {
+        budget.onResourceUploaded(res1, EResourceType_IndexArray, 80u, 0, {});
+        EXPECT_EQ(0u, budget.getAmountOfMemoryToBeFreed(20u));
+        EXPECT_EQ(10u, budget.getAmountOfMemoryToBeFreed(30u));
+
+        budget.onResourceUploaded(res2, EResourceType_IndexArray, 40u, 0, {});
+        EXPECT_EQ(20u, budget.getAmountOfMemoryToBeFreed(0u));
+        EXPECT_EQ(30u, budget.getAmountOfMemoryToBeFreed(10u));
+    }
+
+    TEST_F(AGpuMemoryBudget, requiresAllToBeFreedIfDisabled)
+    {
+        GpuMemoryBudget disabledBudget{ 0u };
+        EXPECT_FALSE(disabledBudget.isEnabled());
+        EXPECT_EQ(std::numeric_limits<UInt64>::max(), disabledBudget.getAmountOfMemoryToBeFreed(0u));
+    }
+
+    TEST_F(AGpuMemoryBudget, sortsLessImportantScenesFirstKeepingLeastRecentlyUsedOrderWithinPriority)
+    {
+        budget.onResourceUploaded(res1, EResourceType_IndexArray, 10u, -1, {});
+        budget.onResourceUploaded(res2, EResourceType_IndexArray, 10u, 5, {});
+        budget.onResourceUploaded(res3, EResourceType_IndexArray, 10u, -1, {});
+        budget.onResourceUploaded(res4, EResourceType_IndexArray, 10u, 5, {});
+
+        ResourceContentHashVector unusedResources{ res1, res2, res3, res4 };
+        budget.sortByEvictionOrder(unusedResources);
+        EXPECT_EQ((ResourceContentHashVector{ res2, res4, res1, res3 }), unusedResources);
+    }
+
+    TEST_F(AGpuMemoryBudget, raisesEvictionPriorityWhenUsedByMoreImportantScene)
+    {
+        budget.onResourceUploaded(res1, EResourceType_IndexArray, 10u, 5, {});
+        budget.onResourceUploaded(res2, EResourceType_IndexArray, 10u, 5, {});
+        budget.onResourceUsedByScene(res1, scene1, -1);
+        // less important scene does not lower priority
+        budget.onResourceUsedByScene(res1, scene2, 10);
+        // not uploaded resources are ignored
+        budget.onResourceUsedByScene(res3, scene1, -1);
+
+        ResourceContentHashVector unusedResources{ res1, res2 };
+        budget.sortByEvictionOrder(unusedResources);
+        EXPECT_EQ((ResourceContentHashVector{ res2, res1 }), unusedResources);
+    }
+
+    TEST_F(AGpuMemoryBudget, reportsPressureOnlyWhenItStarts)
+    {
+        budget.onResourceUploaded(res1, EResourceType_IndexArray, 100u, 0, {});
+        EXPECT_FALSE(budget.updatePressureState());
+        EXPECT_FALSE(budget.isUnderPressure());
+
+        budget.onResourceUploaded(res2, EResourceType_IndexArray, 1u, 0, {});
+        EXPECT_TRUE(budget.updatePressureState());
+        EXPECT_TRUE(budget.isUnderPressure());
+        EXPECT_FALSE(budget.updatePressureState());
+        EXPECT_TRUE(budget.isUnderPressure());
+
+        budget.onResourceUnloaded(res2);
+        EXPECT_FALSE(budget.updatePressureState());
+        EXPECT_FALSE(budget.isUnderPressure());
+
+        budget.onResourceUploaded(res2, EResourceType_IndexArray, 1u, 0, {});
+        EXPECT_TRUE(budget.updatePressureState());
+    }
+
+    TEST_F(AGpuMemoryBudget, neverReportsPressureIfDisabled)
+    {
+        GpuMemoryBudget disabledBudget{ 0u };
+        disabledBudget.onResourceUploaded(res1, EResourceType_IndexArray, 100u, 0, {});
+        EXPECT_FALSE(disabledBudget.updatePressureState());
+        EXPECT_FALSE(disabledBudget.isUnderPressure());
+    }
+}
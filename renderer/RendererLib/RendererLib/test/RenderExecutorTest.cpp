@@ -12,6 +12,7 @@
 #include "EmbeddedCompositingManagerMock.h"
 #include "RenderExecutor.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RenderPassCostEstimator.h"
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererScenes.h"
 #include "SceneUtils/DataLayoutCreationHelper.h"
@@ -352,6 +353,44 @@ protected:
         return renderable;
     }
 
+    // geometry with two plain vec3 attributes, first using VertArrayHash, second VertArrayHash2
+    DataInstanceHandle createGeometryWithTwoVec3Attributes(EFixedSemantics secondAttributeSemantics)
+    {
+        const DataFieldInfoVector dataFields{
+            DataFieldInfo(EDataType::Indices, 1u, EFixedSemantics::Indices),
+            DataFieldInfo(EDataType::Vector3Buffer, 1u, EFixedSemantics::Invalid),
+            DataFieldInfo(EDataType::Vector3Buffer, 1u, secondAttributeSemantics) };
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(dataFields, MockResourceHash::EffectHash));
+        scene.setDataResource(geometry, DataFieldHandle(0u), MockResourceHash::IndexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometry, DataFieldHandle(1u), MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometry, DataFieldHandle(2u), MockResourceHash::VertArrayHash2, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        return geometry;
+    }
+
+    // renderable sharing uniforms and render state with others, with plain (non-interleaved, non-instanced) geometry
+    RenderableHandle createBatchableRenderable(DataInstanceHandle uniforms, RenderStateHandle renderState, RenderGroupHandle group)
+    {
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(geometryLayout);
+        scene.setDataResource(geometry, indicesField, MockResourceHash::IndexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometry, vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometry, vertTexcoordField, MockResourceHash::VertArrayHash2, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+
+        const RenderableHandle renderable = createTestRenderable({ uniforms, geometry }, group);
+        scene.setRenderableRenderState(renderable, renderState);
+        return renderable;
+    }
+
+    // lets batch cache see the run unchanged until its geometry is merged
+    void mergeBatches(DeviceResourceHandle batchVertexArray)
+    {
+        RenderableBatchHandleVector batchesToUnload;
+        RenderableBatchHandleVector batchesToUpload;
+        for (UInt32 i = 0u; i <= RenderableBatchCache::StableUpdatesBeforeMerging; ++i)
+            scene.getRenderableBatches().update(scene, batchesToUnload, batchesToUpload);
+        for (const auto batch : batchesToUpload)
+            scene.getRenderableBatches().setBatchVertexArray(batch, batchVertexArray);
+    }
+
     TransformHandle addTransformToNode(NodeHandle node)
     {
         return sceneAllocator.allocateTransform(node);
@@ -520,6 +559,7 @@ protected:
         scene.updateRenderableVertexArrays(resourceManager, renderablesWithUpdatedVAOs);
         scene.markVertexArraysClean();
         scene.updateRenderableWorldMatrices();
+        scene.updateDrawStateSorting();
     }
 
     void expectRenderingWithProjection(RenderableHandle renderable, const Matrix44f& projMatrix, const UInt32 instanceCount = 1u)
@@ -1003,6 +1043,404 @@ TEST_F(ARenderExecutor, RenderStatesAppliedForEachRenderableIfDifferent)
     Mock::VerifyAndClearExpectations(&device);
 }
 
+TEST_F(ARenderExecutor, SortsRenderablesWithSameOrderByStateAndSkipsRedundantTextureAndVertexArrayActivation_IfEnabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const ResourceContentHash otherTextureHash{ 0x77, 0 };
+    const DeviceResourceHandle otherTextureDeviceHandle{ 777u };
+    ON_CALL(resourceManager, getResourceDeviceHandle(otherTextureHash)).WillByDefault(Return(otherTextureDeviceHandle));
+    const TextureSamplerHandle otherSampler = sceneAllocator.allocateTextureSampler({ {}, otherTextureHash });
+
+    // renderables 1 and 3 share texture sampler but are separated by renderable 2 using different texture
+    const DataInstances dataInstances1 = createTestDataInstance();
+    const DataInstances dataInstances2 = createTestDataInstance();
+    const DataInstances dataInstances3 = createTestDataInstance();
+    scene.setDataTextureSamplerHandle(dataInstances1.first, textureField, otherSampler);
+    scene.setDataTextureSamplerHandle(dataInstances3.first, textureField, otherSampler);
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances1, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances2, group);
+    const RenderableHandle renderable3 = createTestRenderable(dataInstances3, group);
+    updateScenes({ renderable1, renderable2, renderable3 });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, activateTexture(_, _)).Times(AnyNumber());
+    {
+        InSequence seq;
+        EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+        EXPECT_CALL(niceDevice, activateTexture(otherTextureDeviceHandle, textureField));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+        EXPECT_CALL(niceDevice, activateTexture(DeviceMock::FakeTextureDeviceHandle, textureField));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    }
+
+    RenderExecutor executor(niceDevice, renderContext, nullptr, true);
+    executor.executeScene(scene);
+    EXPECT_LT(0u, executor.getStateChangesSavedBySorting());
+}
+
+TEST_F(ARenderExecutor, ReusesDrawStateSortingOfPassInNextFrameUntilRenderableStateChanges_IfEnabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const ResourceContentHash otherTextureHash{ 0x77, 0 };
+    const DeviceResourceHandle otherTextureDeviceHandle{ 777u };
+    ON_CALL(resourceManager, getResourceDeviceHandle(otherTextureHash)).WillByDefault(Return(otherTextureDeviceHandle));
+    const TextureSamplerHandle otherSampler = sceneAllocator.allocateTextureSampler({ {}, otherTextureHash });
+
+    const DataInstances dataInstances1 = createTestDataInstance();
+    const DataInstances dataInstances2 = createTestDataInstance();
+    const DataInstances dataInstances3 = createTestDataInstance();
+    scene.setDataTextureSamplerHandle(dataInstances1.first, textureField, otherSampler);
+    scene.setDataTextureSamplerHandle(dataInstances3.first, textureField, otherSampler);
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances1, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances2, group);
+    const RenderableHandle renderable3 = createTestRenderable(dataInstances3, group);
+    updateScenes({ renderable1, renderable2, renderable3 });
+
+    NiceMock<DeviceMock> niceDevice;
+    RenderExecutor executor(niceDevice, renderContext, nullptr, true);
+    executor.executeScene(scene);
+    const UInt32 stateChangesSaved = executor.getStateChangesSavedBySorting();
+    EXPECT_LT(0u, stateChangesSaved);
+    const auto& sorted = scene.getDrawStateSortedRenderablesForPass(pass);
+    ASSERT_TRUE(sorted.valid);
+    EXPECT_EQ((RenderableVector{ renderable1, renderable3, renderable2 }), sorted.renderables);
+
+    // sorting from previous frame is used and its saved state changes are reported again
+    RenderExecutor nextFrameExecutor(niceDevice, renderContext, nullptr, true);
+    nextFrameExecutor.executeScene(scene);
+    EXPECT_EQ(stateChangesSaved, nextFrameExecutor.getStateChangesSavedBySorting());
+    EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+
+    // renderable 2 gets same texture as others, nothing to be saved by sorting anymore
+    scene.setDataTextureSamplerHandle(dataInstances2.first, textureField, otherSampler);
+    scene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+    EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+    scene.updateDrawStateSorting();
+    RenderExecutor executorAfterChange(niceDevice, renderContext, nullptr, true);
+    executorAfterChange.executeScene(scene);
+    EXPECT_EQ(0u, executorAfterChange.getStateChangesSavedBySorting());
+    EXPECT_EQ((RenderableVector{ renderable1, renderable2, renderable3 }), scene.getDrawStateSortedRenderablesForPass(pass).renderables);
+}
+
+TEST_F(ARenderExecutor, KeepsOrderOfRenderablesWithSameOrderAndActivatesAllResources_IfSortingDisabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const ResourceContentHash otherTextureHash{ 0x77, 0 };
+    const DeviceResourceHandle otherTextureDeviceHandle{ 777u };
+    ON_CALL(resourceManager, getResourceDeviceHandle(otherTextureHash)).WillByDefault(Return(otherTextureDeviceHandle));
+    const TextureSamplerHandle otherSampler = sceneAllocator.allocateTextureSampler({ {}, otherTextureHash });
+
+    const DataInstances dataInstances1 = createTestDataInstance();
+    const DataInstances dataInstances2 = createTestDataInstance();
+    scene.setDataTextureSamplerHandle(dataInstances1.first, textureField, otherSampler);
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances1, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances2, group);
+    updateScenes({ renderable1, renderable2 });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, activateTexture(_, _)).Times(AnyNumber());
+    {
+        InSequence seq;
+        EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+        EXPECT_CALL(niceDevice, activateTexture(otherTextureDeviceHandle, textureField));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+        EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+        EXPECT_CALL(niceDevice, activateTexture(DeviceMock::FakeTextureDeviceHandle, textureField));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    }
+
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getStateChangesSavedBySorting());
+}
+
+TEST_F(ARenderExecutor, SkipsRenderablesOutsideOfCameraFrustum_IfFrustumCullingEnabledForPass)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
+    scene.setRenderPassFrustumCulling(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    BoundingVolume unitBox;
+    unitBox.halfExtents = Vector3(1.f);
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash)).WillByDefault(Return(unitBox));
+
+    const DataInstances dataInstances = createTestDataInstance();
+    scene.setDataResource(dataInstances.second, vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+    const RenderableHandle visibleRenderable = createTestRenderable(dataInstances, group);
+    const RenderableHandle culledRenderable = createTestRenderable(dataInstances, group);
+    scene.setTranslation(addTransformToRenderable(visibleRenderable), Vector3(0.f, 0.f, -10.f));
+    scene.setTranslation(addTransformToRenderable(culledRenderable), Vector3(100.f, 0.f, -10.f));
+    updateScenes({ visibleRenderable, culledRenderable });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(1u, executor.getCulledRenderables());
+}
+
+TEST_F(ARenderExecutor, RendersRenderablesOutsideOfCameraFrustum_IfFrustumCullingDisabledForPass)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    BoundingVolume unitBox;
+    unitBox.halfExtents = Vector3(1.f);
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash)).WillByDefault(Return(unitBox));
+
+    const DataInstances dataInstances = createTestDataInstance();
+    scene.setDataResource(dataInstances.second, vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+    const RenderableHandle renderable = createTestRenderable(dataInstances, group);
+    scene.setTranslation(addTransformToRenderable(renderable), Vector3(100.f, 0.f, -10.f));
+    updateScenes({ renderable });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getCulledRenderables());
+}
+
+TEST_F(ARenderExecutor, DoesNotCullRenderableWithInterleavedVertexPositions)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
+    scene.setRenderPassFrustumCulling(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    BoundingVolume unitBox;
+    unitBox.halfExtents = Vector3(1.f);
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash)).WillByDefault(Return(unitBox));
+
+    // test data instance uses offset and stride for vertex positions
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), group);
+    scene.setTranslation(addTransformToRenderable(renderable), Vector3(100.f, 0.f, -10.f));
+    updateScenes({ renderable });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getCulledRenderables());
+}
+
+TEST_F(ARenderExecutor, DoesNotCullRenderableWithSeveralCandidatesForVertexPositions)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
+    scene.setRenderPassFrustumCulling(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    BoundingVolume unitBox;
+    unitBox.halfExtents = Vector3(1.f);
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash)).WillByDefault(Return(unitBox));
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash2)).WillByDefault(Return(unitBox));
+
+    // e.g. positions and normals, it is not known which of them holds positions
+    const DataInstanceHandle geometry = createGeometryWithTwoVec3Attributes(EFixedSemantics::Invalid);
+    const RenderableHandle renderable = createTestRenderable({ createTestDataInstance().first, geometry }, group);
+    scene.setTranslation(addTransformToRenderable(renderable), Vector3(100.f, 0.f, -10.f));
+    updateScenes({ renderable });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getCulledRenderables());
+}
+
+TEST_F(ARenderExecutor, CullsRenderableUsingBoundsOfAttributeWithVertexPositionsSemantic)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
+    scene.setRenderPassFrustumCulling(pass, true);
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    // bounds of first attribute would reach into frustum
+    BoundingVolume hugeBox;
+    hugeBox.halfExtents = Vector3(1000.f);
+    BoundingVolume unitBox;
+    unitBox.halfExtents = Vector3(1.f);
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash)).WillByDefault(Return(hugeBox));
+    ON_CALL(resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash2)).WillByDefault(Return(unitBox));
+
+    const DataInstanceHandle geometry = createGeometryWithTwoVec3Attributes(EFixedSemantics::VertexPositionsAttribute);
+    const RenderableHandle renderable = createTestRenderable({ createTestDataInstance().first, geometry }, group);
+    scene.setTranslation(addTransformToRenderable(renderable), Vector3(100.f, 0.f, -10.f));
+    updateScenes({ renderable });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _)).Times(0);
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(1u, executor.getCulledRenderables());
+}
+
+TEST_F(ARenderExecutor, DrawsRunOfRenderablesWithSingleDrawCall_IfTheirGeometryWasMerged)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderStateHandle renderState = sceneAllocator.allocateRenderState();
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable3 = createBatchableRenderable(dataInstances.first, renderState, group);
+    updateScenes({ renderable1, renderable2, renderable3 });
+
+    const DeviceResourceHandle batchVertexArray{ 888u };
+    mergeBatches(batchVertexArray);
+
+    NiceMock<DeviceMock> niceDevice;
+    {
+        InSequence seq;
+        EXPECT_CALL(niceDevice, activateVertexArray(batchVertexArray));
+        EXPECT_CALL(niceDevice, drawIndexedTriangles(0, Int32(3u * indexCount), 1u));
+    }
+
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(2u, executor.getDrawCallsSavedByBatching());
+}
+
+TEST_F(ARenderExecutor, DrawsRenderablesOfBatchIndividually_IfGeometryOfMemberChangedAfterMerging)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderStateHandle renderState = sceneAllocator.allocateRenderState();
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, renderState, group);
+    updateScenes({ renderable1, renderable2 });
+
+    const DeviceResourceHandle batchVertexArray{ 888u };
+    mergeBatches(batchVertexArray);
+
+    // batch cache was not updated yet but merged geometry is stale
+    scene.setDataResource(scene.getRenderable(renderable2).dataInstances[ERenderableDataSlotType_Geometry], vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+    updateScenes({ renderable2 });
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle)).Times(AnyNumber());
+    EXPECT_CALL(niceDevice, activateVertexArray(batchVertexArray)).Times(0);
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2);
+
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getDrawCallsSavedByBatching());
+}
+
+TEST_F(ARenderExecutor, DoesNotBatchRenderablesWithDifferentRenderState)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, sceneAllocator.allocateRenderState(), group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, sceneAllocator.allocateRenderState(), group);
+    updateScenes({ renderable1, renderable2 });
+
+    const DeviceResourceHandle batchVertexArray{ 888u };
+    mergeBatches(batchVertexArray);
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle)).Times(AnyNumber());
+    EXPECT_CALL(niceDevice, activateVertexArray(batchVertexArray)).Times(0);
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2);
+
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getDrawCallsSavedByBatching());
+}
+
+TEST_F(ARenderExecutor, DoesNotBatchRenderablesDrawnAsStrip)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderStateHandle renderState = sceneAllocator.allocateRenderState();
+    scene.setRenderStateDrawMode(renderState, EDrawMode::TriangleStrip);
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, renderState, group);
+    updateScenes({ renderable1, renderable2 });
+
+    const DeviceResourceHandle batchVertexArray{ 888u };
+    mergeBatches(batchVertexArray);
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle)).Times(AnyNumber());
+    EXPECT_CALL(niceDevice, activateVertexArray(batchVertexArray)).Times(0);
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2);
+
+    RenderExecutor executor(niceDevice, renderContext);
+    executor.executeScene(scene);
+    EXPECT_EQ(0u, executor.getDrawCallsSavedByBatching());
+}
+
+TEST_F(ARenderExecutor, UploadsPostponedBatchInNextUpdate)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderStateHandle renderState = sceneAllocator.allocateRenderState();
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, renderState, group);
+    updateScenes({ renderable1, renderable2 });
+
+    RenderableBatchCache& batches = scene.getRenderableBatches();
+    RenderableBatchHandleVector batchesToUnload;
+    RenderableBatchHandleVector batchesToUpload;
+    for (UInt32 i = 0u; i <= RenderableBatchCache::StableUpdatesBeforeMerging; ++i)
+        batches.update(scene, batchesToUnload, batchesToUpload);
+    ASSERT_EQ(1u, batchesToUpload.size());
+    const RenderableBatchHandle batch = batchesToUpload.front();
+
+    batches.postponeUpload(batch);
+    EXPECT_TRUE(batches.hasPendingBatches());
+
+    batchesToUpload.clear();
+    batches.update(scene, batchesToUnload, batchesToUpload);
+    EXPECT_TRUE(batchesToUnload.empty());
+    ASSERT_EQ(1u, batchesToUpload.size());
+    EXPECT_EQ(batch, batchesToUpload.front());
+    EXPECT_FALSE(batches.hasPendingBatches());
+}
+
+TEST_F(ARenderExecutor, ProvidesGeometryOfBatchesOnlyUntilTheyAreMerged)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera(getDefaultProjectionParams());
+    const RenderGroupHandle group = createRenderGroup(pass);
+
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderStateHandle renderState = sceneAllocator.allocateRenderState();
+    const RenderableHandle renderable1 = createBatchableRenderable(dataInstances.first, renderState, group);
+    const RenderableHandle renderable2 = createBatchableRenderable(dataInstances.first, renderState, group);
+    updateScenes({ renderable1, renderable2 });
+
+    RenderableBatchHandleVector batchesToUnload;
+    RenderableBatchHandleVector batchesToUpload;
+    scene.getRenderableBatches().update(scene, batchesToUnload, batchesToUpload);
+
+    ResourceContentHashVector geometry;
+    scene.getRenderableBatches().collectGeometryOfPendingBatches(scene, geometry);
+    const ResourceContentHashVector expectedGeometry{
+        MockResourceHash::IndexArrayHash, MockResourceHash::VertArrayHash, MockResourceHash::VertArrayHash2,
+        MockResourceHash::IndexArrayHash, MockResourceHash::VertArrayHash, MockResourceHash::VertArrayHash2 };
+    EXPECT_EQ(expectedGeometry, geometry);
+
+    mergeBatches(DeviceResourceHandle{ 888u });
+    geometry.clear();
+    scene.getRenderableBatches().collectGeometryOfPendingBatches(scene, geometry);
+    EXPECT_TRUE(geometry.empty());
+}
+
 TEST_F(ARenderExecutor, UpdatesModelMatrixWhenChangingTranslationRotationOrScalingOfNode)
 {
     const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -1303,6 +1741,65 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
     EXPECT_EQ(SceneRenderExecutionIterator(), renderIterator); // finished
 }
 
+TEST_F(ARenderExecutor, interruptsRenderingBeforePassWhichIsEstimatedToExceedRemainingTimeBudget)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle pass1 = createRenderPassWithCamera(projParams);
+    const RenderPassHandle pass2 = createRenderPassWithCamera(projParams);
+    scene.setRenderPassRenderOrder(pass1, 0);
+    scene.setRenderPassRenderOrder(pass2, 1);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, createRenderGroup(pass1));
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances, createRenderGroup(pass2));
+    updateScenes({ renderable1, renderable2 });
+
+    RenderPassCostEstimator passCostEstimator;
+    passCostEstimator.recordPassCost(scene.getSceneId(), pass2, 1u, std::chrono::hours(1));
+
+    FrameTimer frameTimer;
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::minutes(10)).count());
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    SceneRenderExecutionIterator renderIterator = RenderExecutor(niceDevice, renderContext, &frameTimer, false, &passCostEstimator).executeScene(scene);
+    Mock::VerifyAndClearExpectations(&niceDevice);
+    EXPECT_EQ(1u, renderIterator.getRenderPassIdx());
+    EXPECT_EQ(0u, renderIterator.getRenderableIdx());
+    EXPECT_EQ(1u, renderIterator.getFlattenedRenderableIdx());
+
+    // deferred pass is rendered in next frame even if it does not fit into budget, so that rendering always makes progress
+    renderContext.renderFrom = renderIterator;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _));
+    renderIterator = RenderExecutor(niceDevice, renderContext, &frameTimer, false, &passCostEstimator).executeScene(scene);
+    EXPECT_EQ(SceneRenderExecutionIterator(), renderIterator); // finished
+}
+
+TEST_F(ARenderExecutor, rendersAllPassesIfTheirEstimatedCostFitsIntoRemainingTimeBudget)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle pass1 = createRenderPassWithCamera(projParams);
+    const RenderPassHandle pass2 = createRenderPassWithCamera(projParams);
+    scene.setRenderPassRenderOrder(pass1, 0);
+    scene.setRenderPassRenderOrder(pass2, 1);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, createRenderGroup(pass1));
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances, createRenderGroup(pass2));
+    updateScenes({ renderable1, renderable2 });
+
+    RenderPassCostEstimator passCostEstimator;
+    passCostEstimator.recordPassCost(scene.getSceneId(), pass2, 1u, std::chrono::microseconds(1));
+
+    FrameTimer frameTimer;
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::minutes(10)).count());
+
+    NiceMock<DeviceMock> niceDevice;
+    EXPECT_CALL(niceDevice, drawIndexedTriangles(_, _, _)).Times(2);
+    const SceneRenderExecutionIterator renderIterator = RenderExecutor(niceDevice, renderContext, &frameTimer, false, &passCostEstimator).executeScene(scene);
+    EXPECT_EQ(SceneRenderExecutionIterator(), renderIterator); // finished
+}
+
 TEST_F(ARenderExecutor, ClearsDispBufferBeforeRenderingIntoIt_MainOnly)
 {
     const RenderPassHandle passMain = createRenderPassWithCamera(getDefaultProjectionParams(ECameraProjectionType::Perspective));
@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/RenderPassCostEstimator.h"
+
+namespace ramses_internal
+{
+    using std::chrono::microseconds;
+
+    class ARenderPassCostEstimator : public ::testing::Test
+    {
+    protected:
+        RenderPassCostEstimator estimator;
+        const SceneId scene{ 12u };
+        const SceneId otherScene{ 13u };
+        const RenderPassHandle pass{ 3u };
+        const RenderPassHandle otherPass{ 5u };
+    };
+
+    TEST_F(ARenderPassCostEstimator, estimatesZeroCostIfNothingMeasured)
+    {
+        EXPECT_EQ(microseconds(0), estimator.estimatePassCost(scene, pass, 100u));
+    }
+
+    TEST_F(ARenderPassCostEstimator, estimatesCostOfPassFromFirstMeasurement)
+    {
+        estimator.recordPassCost(scene, pass, 10u, microseconds(1000));
+        EXPECT_EQ(microseconds(1000), estimator.estimatePassCost(scene, pass, 10u));
+    }
+
+    TEST_F(ARenderPassCostEstimator, averagesCostOfPassOverFrames)
+    {
+        estimator.recordPassCost(scene, pass, 10u, microseconds(1000));
+        estimator.recordPassCost(scene, pass, 10u, microseconds(2000));
+        EXPECT_EQ(microseconds(1250), estimator.estimatePassCost(scene, pass, 10u));
+    }
+
+    TEST_F(ARenderPassCostEstimator, estimatesCostOfUnknownPassFromAverageRenderableCost)
+    {
+        estimator.recordPassCost(scene, pass, 10u, microseconds(1000));
+        EXPECT_EQ(microseconds(500), estimator.estimatePassCost(scene, otherPass, 5u));
+        EXPECT_EQ(microseconds(2000), estimator.estimatePassCost(otherScene, pass, 20u));
+    }
+
+    TEST_F(ARenderPassCostEstimator, doesNotLearnRenderableCostFromPassWithoutRenderables)
+    {
+        estimator.recordPassCost(scene, pass, 0u, microseconds(1000));
+        EXPECT_EQ(microseconds(1000), estimator.estimatePassCost(scene, pass, 0u));
+        EXPECT_EQ(microseconds(0), estimator.estimatePassCost(scene, otherPass, 10u));
+    }
+
+    TEST_F(ARenderPassCostEstimator, forgetsPassCostsOfRemovedScene)
+    {
+        estimator.recordPassCost(scene, pass, 10u, microseconds(1000));
+        estimator.recordPassCost(scene, otherPass, 10u, microseconds(1000));
+        estimator.removeScene(scene);
+
+        // only average renderable cost is kept
+        EXPECT_EQ(microseconds(200), estimator.estimatePassCost(scene, pass, 2u));
+    }
+}
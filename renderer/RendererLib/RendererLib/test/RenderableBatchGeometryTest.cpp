@@ -0,0 +1,135 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/RenderableBatchGeometry.h"
+#include "Resource/ArrayResource.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    class ARenderableBatchGeometry : public ::testing::Test
+    {
+    protected:
+        static std::vector<Float> AsFloats(const std::vector<Byte>& data)
+        {
+            std::vector<Float> values(data.size() / sizeof(Float));
+            std::memcpy(values.data(), data.data(), data.size());
+            return values;
+        }
+
+        static std::vector<UInt16> AsUInt16(const std::vector<Byte>& data)
+        {
+            std::vector<UInt16> values(data.size() / sizeof(UInt16));
+            std::memcpy(values.data(), data.data(), data.size());
+            return values;
+        }
+
+        RenderableBatchGeometry::MemberData createMember(const ArrayResource* indices, const ArrayResource& positions, UInt32 startIndex, UInt32 indexCount, UInt32 startVertex = 0u) const
+        {
+            RenderableBatchGeometry::MemberData member;
+            member.indices = indices;
+            member.vertexAttributes = { &positions };
+            member.startIndex = startIndex;
+            member.indexCount = indexCount;
+            member.startVertex = startVertex;
+            return member;
+        }
+
+        const Float positions1Data[6] = { 0.f, 0.f,   1.f, 0.f,   1.f, 1.f };
+        const Float positions2Data[8] = { 5.f, 5.f,   6.f, 5.f,   6.f, 6.f,   5.f, 6.f };
+        const UInt16 indices1Data[3] = { 0u, 1u, 2u };
+        const UInt16 indices2Data[6] = { 0u, 1u, 2u,   2u, 3u, 0u };
+        const ArrayResource positions1{ EResourceType_VertexArray, 3u, EDataType::Vector2F, positions1Data, ResourceCacheFlag_DoNotCache, "" };
+        const ArrayResource positions2{ EResourceType_VertexArray, 4u, EDataType::Vector2F, positions2Data, ResourceCacheFlag_DoNotCache, "" };
+        const ArrayResource indices1{ EResourceType_IndexArray, 3u, EDataType::UInt16, indices1Data, ResourceCacheFlag_DoNotCache, "" };
+        const ArrayResource indices2{ EResourceType_IndexArray, 6u, EDataType::UInt16, indices2Data, ResourceCacheFlag_DoNotCache, "" };
+    };
+
+    TEST_F(ARenderableBatchGeometry, concatenatesVerticesAndRebasesIndicesOfMembers)
+    {
+        RenderableBatchGeometry geometry;
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices2, positions2, 0u, 6u) }, geometry));
+
+        EXPECT_EQ(9u, geometry.drawCount);
+        EXPECT_EQ(EDataType::UInt16, geometry.indexType);
+        EXPECT_EQ((std::vector<UInt16>{ 0u, 1u, 2u,   3u, 4u, 5u,   5u, 6u, 3u }), AsUInt16(geometry.indexData));
+        ASSERT_EQ(1u, geometry.vertexData.size());
+        EXPECT_EQ((std::vector<Float>{ 0.f, 0.f, 1.f, 0.f, 1.f, 1.f,   5.f, 5.f, 6.f, 5.f, 6.f, 6.f, 5.f, 6.f }), AsFloats(geometry.vertexData[0]));
+    }
+
+    TEST_F(ARenderableBatchGeometry, copiesOnlyVerticesReferencedByIndexRangeOfMember)
+    {
+        const UInt16 indices3Data[3] = { 3u, 2u, 1u };
+        const ArrayResource indices3{ EResourceType_IndexArray, 3u, EDataType::UInt16, indices3Data, ResourceCacheFlag_DoNotCache, "" };
+
+        RenderableBatchGeometry geometry;
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices3, positions2, 0u, 3u) }, geometry));
+
+        EXPECT_EQ(6u, geometry.drawCount);
+        EXPECT_EQ((std::vector<UInt16>{ 0u, 1u, 2u,   5u, 4u, 3u }), AsUInt16(geometry.indexData));
+        EXPECT_EQ((std::vector<Float>{ 0.f, 0.f, 1.f, 0.f, 1.f, 1.f,   6.f, 5.f, 6.f, 6.f, 5.f, 6.f }), AsFloats(geometry.vertexData[0]));
+    }
+
+    TEST_F(ARenderableBatchGeometry, takesStartVertexOfMemberIntoAccount)
+    {
+        RenderableBatchGeometry geometry;
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices1, positions2, 0u, 3u, 1u) }, geometry));
+        EXPECT_EQ((std::vector<UInt16>{ 0u, 1u, 2u,   3u, 4u, 5u }), AsUInt16(geometry.indexData));
+        EXPECT_EQ((std::vector<Float>{ 0.f, 0.f, 1.f, 0.f, 1.f, 1.f,   6.f, 5.f, 6.f, 6.f, 5.f, 6.f }), AsFloats(geometry.vertexData[0]));
+
+        // with start vertex 1 the index 3 refers to vertex out of range
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices2, positions2, 0u, 6u, 1u) }, geometry));
+    }
+
+    TEST_F(ARenderableBatchGeometry, concatenatesVertexRangesOfNonIndexedMembers)
+    {
+        RenderableBatchGeometry geometry;
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(nullptr, positions1, 0u, 3u), createMember(nullptr, positions2, 1u, 3u) }, geometry));
+
+        EXPECT_EQ(6u, geometry.drawCount);
+        EXPECT_EQ(EDataType::Invalid, geometry.indexType);
+        EXPECT_TRUE(geometry.indexData.empty());
+        EXPECT_EQ((std::vector<Float>{ 0.f, 0.f, 1.f, 0.f, 1.f, 1.f,   6.f, 5.f, 6.f, 6.f, 5.f, 6.f }), AsFloats(geometry.vertexData[0]));
+    }
+
+    TEST_F(ARenderableBatchGeometry, usesUInt32IndicesIfMergedVertexCountExceedsUInt16Range)
+    {
+        std::vector<Float> manyPositions(2u * 40000u, 0.f);
+        const ArrayResource bigPositions{ EResourceType_VertexArray, 40000u, EDataType::Vector2F, manyPositions.data(), ResourceCacheFlag_DoNotCache, "" };
+
+        RenderableBatchGeometry geometry;
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(nullptr, bigPositions, 0u, 40000u), createMember(nullptr, bigPositions, 0u, 40000u) }, geometry));
+        EXPECT_EQ(EDataType::Invalid, geometry.indexType);
+
+        std::vector<UInt16> manyIndices(40000u);
+        for (UInt16 i = 0u; i < manyIndices.size(); ++i)
+            manyIndices[i] = i;
+        const ArrayResource bigIndices{ EResourceType_IndexArray, 40000u, EDataType::UInt16, manyIndices.data(), ResourceCacheFlag_DoNotCache, "" };
+        ASSERT_TRUE(RenderableBatchGeometry::Merge({ createMember(&bigIndices, bigPositions, 0u, 40000u), createMember(&bigIndices, bigPositions, 0u, 40000u) }, geometry));
+        EXPECT_EQ(EDataType::UInt32, geometry.indexType);
+        EXPECT_EQ(80000u * sizeof(UInt32), geometry.indexData.size());
+    }
+
+    TEST_F(ARenderableBatchGeometry, failsIfMembersDoNotMatchOrDrawRangeIsOutOfBounds)
+    {
+        const Float positions3Data[9] = { 0.f, 0.f, 0.f,   1.f, 0.f, 0.f,   1.f, 1.f, 0.f };
+        const ArrayResource positions3{ EResourceType_VertexArray, 3u, EDataType::Vector3F, positions3Data, ResourceCacheFlag_DoNotCache, "" };
+
+        RenderableBatchGeometry geometry;
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({}, geometry));
+        // indexed mixed with non-indexed
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(nullptr, positions2, 0u, 3u) }, geometry));
+        // different vertex data types
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices1, positions3, 0u, 3u) }, geometry));
+        // index range exceeds index array
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({ createMember(&indices1, positions1, 0u, 3u), createMember(&indices2, positions2, 4u, 3u) }, geometry));
+        // vertex range exceeds vertex array
+        EXPECT_FALSE(RenderableBatchGeometry::Merge({ createMember(nullptr, positions1, 0u, 3u), createMember(nullptr, positions2, 2u, 3u) }, geometry));
+    }
+}
@@ -11,6 +11,8 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/RendererScenes.h"
 #include "RendererEventCollector.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses_internal
 {
@@ -1055,6 +1057,426 @@ namespace ramses_internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, reportsRenderablesWithSameOrderInSameGroupAsReorderableRange)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        sceneHelper.createRenderable(group);
+        sceneHelper.createRenderable(group);
+        sceneHelper.createRenderable(group);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        const RendererCachedScene::RenderableIndexRanges expectedRanges{ { 0u, 3u } };
+        EXPECT_EQ(expectedRanges, scene.getReorderableRenderableRangesForPass(pass));
+    }
+
+    TEST_F(ARendererCachedScene, doesNotReportReorderableRangesAcrossDifferentOrdersOrNestedGroups)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        const RenderableHandle rend4 = sceneHelper.createRenderable();
+        const RenderableHandle rend5 = sceneHelper.createRenderable();
+        const RenderableHandle rend6 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend2, 0);
+        scene.addRenderableToRenderGroup(group, rend3, 1);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 2);
+        scene.addRenderableToRenderGroup(nestedGroup, rend4, 0);
+        scene.addRenderableToRenderGroup(nestedGroup, rend5, 0);
+        scene.addRenderableToRenderGroup(group, rend6, 2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        // nested group goes before renderable with same order
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3, rend4, rend5, rend6 });
+        const RendererCachedScene::RenderableIndexRanges expectedRanges{ { 0u, 2u }, { 3u, 5u } };
+        EXPECT_EQ(expectedRanges, scene.getReorderableRenderableRangesForPass(pass));
+    }
+
+    TEST_F(ARendererCachedScene, invisibleRenderableDoesNotBreakReorderableRange)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+        const RendererCachedScene::RenderableIndexRanges expectedRanges{ { 0u, 2u } };
+        EXPECT_EQ(expectedRanges, scene.getReorderableRenderableRangesForPass(pass));
+    }
+
+    TEST_F(ARendererCachedScene, keepsDrawStateSortingUntilRenderablesOfPassOrTheirRenderStatesChange)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle otherPass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle otherGroup = sceneHelper.createRenderGroup(otherPass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        sceneHelper.createRenderable(group);
+        sceneHelper.createRenderable(otherGroup);
+        sceneHelper.createRenderable(otherGroup);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+
+        scene.updateDrawStateSorting();
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(otherPass).valid);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(otherPass).valid);
+
+        // only pass whose renderables changed is invalidated
+        sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(otherPass).valid);
+
+        // render state change invalidates all passes
+        scene.updateDrawStateSorting();
+        EXPECT_TRUE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+        scene.setRenderableRenderState(rend1, sceneAllocator.allocateRenderState());
+        EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+        EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(otherPass).valid);
+    }
+
+    TEST_F(ARendererCachedScene, doesNotSortDrawStatesOfPassWithoutReorderableRenderables)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        scene.updateDrawStateSorting();
+        EXPECT_FALSE(scene.getDrawStateSortedRenderablesForPass(pass).valid);
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableAddedToGroupAlreadyInPassAccordingToOrder)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        const RenderableHandle rend4 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 3);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        scene.addRenderableToRenderGroup(group, rend3, 2);
+        scene.addRenderableToRenderGroup(group, rend4, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        expectOrderedRenderablesInPass(pass, { rend4, rend1, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableAddedToGroupWithNestedGroupsAccordingToOrder)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        const RenderableHandle rend4 = sceneHelper.createRenderable();
+        const RenderableHandle rend5 = sceneHelper.createRenderable();
+        const RenderableHandle rend6 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend3, 10);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 5);
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+
+        // nested group goes before renderable with same order
+        scene.addRenderableToRenderGroup(group, rend4, 5);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend4, rend3 });
+
+        scene.addRenderableToRenderGroup(nestedGroup, rend5, -1);
+        scene.addRenderableToRenderGroup(group, rend6, 3);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend6, rend5, rend2, rend4, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableIntoEmptyNestedGroupAfterRenderablesOrderedBeforeIt)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 5);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend3, 6);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableMadeVisibleAtItsOriginalPosition)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+        const RendererCachedScene::RenderableIndexRanges expectedRanges{ { 0u, 3u } };
+        EXPECT_EQ(expectedRanges, scene.getReorderableRenderableRangesForPass(pass));
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableMadeVisibleAtItsOriginalPositionAfterGroupWasSortedAndShrunk)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass1);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend4 = sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        // appended to group with lower order, group gets sorted when second pass using it is built
+        const RenderableHandle rend0 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend0, -1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        scene.addRenderGroupToRenderPass(pass2, group, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        scene.removeRenderableFromRenderGroup(group, rend1);
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        expectOrderedRenderablesInPass(pass1, { rend0, rend2, rend3, rend4 });
+        expectOrderedRenderablesInPass(pass2, { rend0, rend2, rend3, rend4 });
+    }
+
+    TEST_F(ARendererCachedScene, reordersRenderableInPassWhenItsGeometryInstanceChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+
+        const DataLayoutHandle effect1layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        const DataLayoutHandle effect2layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 2, 0 });
+        const DataInstanceHandle effect1geometry = sceneAllocator.allocateDataInstance(effect1layout);
+        const DataInstanceHandle effect2geometry1 = sceneAllocator.allocateDataInstance(effect2layout);
+        const DataInstanceHandle effect2geometry2 = sceneAllocator.allocateDataInstance(effect2layout);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect1geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect2geometry1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        // different effect (and geometry instance) changes order within group
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect2geometry2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, insertsRenderableAddedInvisibleAndMadeVisibleBeforeUpdateOnlyOnce)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, doesNotInsertRenderableAddedAndRemovedBeforeUpdate)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        sceneHelper.removeRenderable(rend2, group);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        expectOrderedRenderablesInPass(pass, { rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, removesOnlyRenderableEntryOfGroupItWasRemovedFromWhenAlsoInNestedGroup)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 0);
+        scene.addRenderableToRenderGroup(nestedGroup, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend2, 1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend1, rend2 });
+
+        scene.removeRenderableFromRenderGroup(group, rend1);
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesRenderGroupUsedTwiceInPass)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle group2 = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle sharedGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderPass(pass, group1, 0);
+        scene.addRenderGroupToRenderPass(pass, group2, 1);
+        scene.addRenderGroupToRenderGroup(group1, sharedGroup, 0);
+        scene.addRenderGroupToRenderGroup(group2, sharedGroup, 0);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(sharedGroup);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend1, rend2 });
+
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(sharedGroup, rend3, 1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend1, rend3, rend2 });
+
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesRenderablesOfGroupSharedByTwoPassesIncrementallyInBothPasses)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass1, pass2);
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        scene.addRenderableToRenderGroup(group, rend2, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend2, rend1 });
+        expectOrderedRenderablesInPass(pass2, { rend2, rend1 });
+
+        scene.removeRenderableFromRenderGroup(group, rend1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass1, { rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, confidenceTest_incrementalUpdatesGiveSameResultAsFullRebuild)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle nestedGroup1 = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle nestedGroup2 = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle deepGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderPass(pass, group, 0);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup1, 10);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup2, 20);
+        scene.addRenderGroupToRenderGroup(nestedGroup2, deepGroup, 5);
+
+        const RenderGroupHandle groups[] = { group, nestedGroup1, nestedGroup2, deepGroup };
+        std::vector<std::pair<RenderableHandle, RenderGroupHandle>> renderables;
+        for (Int32 i = 0; i < 40; ++i)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable();
+            const RenderGroupHandle targetGroup = groups[i % 4];
+            scene.addRenderableToRenderGroup(targetGroup, renderable, (i * 7) % 30 - 5);
+            renderables.push_back({ renderable, targetGroup });
+        }
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        for (Int32 i = 0; i < 40; ++i)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable();
+            scene.addRenderableToRenderGroup(groups[(i * 3) % 4], renderable, (i * 11) % 30 - 5 + 100 * (i % 2));
+            if (i % 3 == 0)
+                scene.setRenderableVisibility(renderables[i].first, EVisibilityMode::Invisible);
+            if (i % 5 == 0)
+                scene.removeRenderableFromRenderGroup(renderables[i].second, renderables[i].first);
+            if (i % 10 == 0)
+                scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        }
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        const RenderableVector incrementalResult = scene.getOrderedRenderablesForPass(pass);
+        const RendererCachedScene::RenderableIndexRanges incrementalRanges = scene.getReorderableRenderableRangesForPass(pass);
+
+        // readding group to pass forces full rebuild
+        scene.removeRenderGroupFromRenderPass(pass, group);
+        scene.addRenderGroupToRenderPass(pass, group, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        EXPECT_EQ(scene.getOrderedRenderablesForPass(pass), incrementalResult);
+        EXPECT_EQ(scene.getReorderableRenderableRangesForPass(pass), incrementalRanges);
+    }
+
+    TEST_F(ARendererCachedScene, incrementallyAddedRenderablesInManyGroupsGiveSameOrderAsFullRebuild)
+    {
+        constexpr UInt32 GroupCount = 20u;
+        constexpr UInt32 RenderablesPerGroup = 10u;
+
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        std::vector<RenderGroupHandle> groups;
+        for (UInt32 g = 0u; g < GroupCount; ++g)
+        {
+            groups.push_back(sceneAllocator.allocateRenderGroup());
+            scene.addRenderGroupToRenderPass(pass, groups.back(), static_cast<Int32>(g));
+            for (UInt32 r = 0u; r < RenderablesPerGroup; ++r)
+                scene.addRenderableToRenderGroup(groups.back(), sceneHelper.createRenderable(), static_cast<Int32>(r * 2));
+        }
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+
+        // every flush adds one mesh to one group, in between existing orders
+        for (UInt32 i = 0u; i < 30u; ++i)
+        {
+            scene.addRenderableToRenderGroup(groups[(i * 7u) % GroupCount], sceneHelper.createRenderable(), static_cast<Int32>(i % 20u) + 1);
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        }
+        const RenderableVector incrementalResult = scene.getOrderedRenderablesForPass(pass);
+        EXPECT_EQ(GroupCount * RenderablesPerGroup + 30u, incrementalResult.size());
+
+        // readding group to pass forces full rebuild
+        scene.removeRenderGroupFromRenderPass(pass, groups.front());
+        scene.addRenderGroupToRenderPass(pass, groups.front(), 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_EQ(incrementalResult, scene.getOrderedRenderablesForPass(pass));
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1435,4 +1857,186 @@ namespace ramses_internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    class ARendererCachedSceneWithParallelWorldMatrixUpdate : public testing::Test
+    {
+    public:
+        ARendererCachedSceneWithParallelWorldMatrixUpdate()
+            : rendererScenes(rendererEventCollector)
+            , serialScene(rendererScenes.createScene(SceneInfo(SceneId(1u))))
+            , parallelScene(rendererScenes.createScene(SceneInfo(SceneId(2u))))
+            , serialSceneHelper(serialScene)
+            , parallelSceneHelper(parallelScene)
+            , executor(NumWorkers)
+        {
+        }
+
+    protected:
+        struct SceneContent
+        {
+            std::vector<TransformHandle> transforms;
+            RenderableVector renderables;
+        };
+
+        // root node with given number of branches, each branch is a chain of transformed nodes with a renderable attached to every node
+        static SceneContent CreateContent(RendererCachedScene& scene, TestSceneHelper& sceneHelper, UInt32 branchCount, UInt32 branchDepth)
+        {
+            SceneAllocateHelper sceneAllocator(scene);
+            SceneContent content;
+            const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+            const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+            const NodeHandle root = sceneAllocator.allocateNode();
+            content.transforms.push_back(sceneAllocator.allocateTransform(root));
+            content.renderables.push_back(sceneHelper.createRenderable(group));
+            scene.addChildToNode(root, scene.getRenderable(content.renderables.back()).node);
+
+            for (UInt32 branch = 0u; branch < branchCount; ++branch)
+            {
+                NodeHandle parent = root;
+                for (UInt32 level = 0u; level < branchDepth; ++level)
+                {
+                    const NodeHandle node = sceneAllocator.allocateNode();
+                    const TransformHandle transform = sceneAllocator.allocateTransform(node);
+                    scene.addChildToNode(parent, node);
+                    const Float f = static_cast<Float>(branch * branchDepth + level);
+                    scene.setTranslation(transform, Vector3(f * 0.1f, -f * 0.2f, 1.f));
+                    scene.setRotation(transform, Vector3(f, 2.f * f, 0.5f * f), ERotationConvention::XYZ);
+                    scene.setScaling(transform, Vector3(1.f + 0.001f * f, 1.f, 1.f - 0.001f * f));
+                    content.transforms.push_back(transform);
+
+                    const RenderableHandle renderable = sceneHelper.createRenderable(group);
+                    scene.addChildToNode(node, scene.getRenderable(renderable).node);
+                    content.renderables.push_back(renderable);
+                    parent = node;
+                }
+            }
+
+            return content;
+        }
+
+        void createContent(UInt32 branchCount, UInt32 branchDepth)
+        {
+            serialContent = CreateContent(serialScene, serialSceneHelper, branchCount, branchDepth);
+            parallelContent = CreateContent(parallelScene, parallelSceneHelper, branchCount, branchDepth);
+            ASSERT_EQ(serialContent.renderables, parallelContent.renderables);
+            ASSERT_EQ(serialContent.transforms, parallelContent.transforms);
+        }
+
+        void setTranslation(size_t transformIdx, const Vector3& translation)
+        {
+            serialScene.setTranslation(serialContent.transforms[transformIdx], translation);
+            parallelScene.setTranslation(parallelContent.transforms[transformIdx], translation);
+        }
+
+        void updateAndExpectSameWorldMatrices()
+        {
+            serialScene.updateRenderablesAndResourceCache(serialSceneHelper.resourceManager, serialSceneHelper.embeddedCompositingManager);
+            parallelScene.updateRenderablesAndResourceCache(parallelSceneHelper.resourceManager, parallelSceneHelper.embeddedCompositingManager);
+            serialScene.updateRenderableWorldMatrices();
+            parallelScene.updateRenderableWorldMatricesParallel(executor, NumWorkers);
+
+            for (const auto renderable : serialContent.renderables)
+            {
+                const Matrix44f& expected = serialScene.getRenderableWorldMatrix(renderable);
+                EXPECT_EQ(expected, parallelScene.getRenderableWorldMatrix(renderable));
+                EXPECT_EQ(expected, parallelScene.updateMatrixCache(ETransformationMatrixType_World, parallelScene.getRenderable(renderable).node));
+            }
+        }
+
+        static constexpr UInt32 NumWorkers = 4u;
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        RendererCachedScene& serialScene;
+        RendererCachedScene& parallelScene;
+        TestSceneHelper serialSceneHelper;
+        TestSceneHelper parallelSceneHelper;
+        ThreadedTaskExecutor executor;
+        SceneContent serialContent;
+        SceneContent parallelContent;
+    };
+
+    constexpr UInt32 ARendererCachedSceneWithParallelWorldMatrixUpdate::NumWorkers;
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateForCompletelyDirtyScene)
+    {
+        createContent(20u, 10u);
+        updateAndExpectSameWorldMatrices();
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateForSingleBranch)
+    {
+        createContent(1u, 30u);
+        updateAndExpectSameWorldMatrices();
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateAfterRootModified)
+    {
+        createContent(20u, 10u);
+        updateAndExpectSameWorldMatrices();
+
+        setTranslation(0u, Vector3(5.f, 6.f, 7.f));
+        updateAndExpectSameWorldMatrices();
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateAfterSomeSubtreesModified)
+    {
+        createContent(20u, 10u);
+        updateAndExpectSameWorldMatrices();
+
+        // modify nodes in middle of some branches and also two nodes within same branch
+        setTranslation(1u + 3u * 10u + 5u, Vector3(1.f, 2.f, 3.f));
+        setTranslation(1u + 7u * 10u + 2u, Vector3(1.f, 2.f, 3.f));
+        setTranslation(1u + 7u * 10u + 8u, Vector3(3.f, 2.f, 1.f));
+        setTranslation(1u + 19u * 10u + 9u, Vector3(-1.f, 0.f, 0.f));
+        updateAndExpectSameWorldMatrices();
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateWhenNothingModified)
+    {
+        createContent(20u, 10u);
+        updateAndExpectSameWorldMatrices();
+        updateAndExpectSameWorldMatrices();
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, computesSameMatricesAsSerialUpdateWithRootAnimatedOverSeveralFrames)
+    {
+        createContent(50u, 20u);
+        updateAndExpectSameWorldMatrices();
+
+        for (UInt32 frame = 0u; frame < 5u; ++frame)
+        {
+            setTranslation(0u, Vector3(static_cast<Float>(frame), 0.f, 0.f));
+            updateAndExpectSameWorldMatrices();
+        }
+    }
+
+    TEST_F(ARendererCachedSceneWithParallelWorldMatrixUpdate, DISABLED_BenchmarkSerialVsParallelUpdateWithAnimatedRoot)
+    {
+        constexpr UInt32 Iterations = 50u;
+        createContent(1000u, 20u);
+        updateAndExpectSameWorldMatrices();
+
+        const auto measure = [&](RendererCachedScene& scene, const SceneContent& content, bool parallel)
+        {
+            const UInt64 start = PlatformTime::GetMicrosecondsMonotonic();
+            for (UInt32 i = 0u; i < Iterations; ++i)
+            {
+                scene.setTranslation(content.transforms.front(), Vector3(static_cast<Float>(i), 0.f, 0.f));
+                if (parallel)
+                    scene.updateRenderableWorldMatricesParallel(executor, NumWorkers);
+                else
+                    scene.updateRenderableWorldMatrices();
+            }
+            return (PlatformTime::GetMicrosecondsMonotonic() - start) / Iterations;
+        };
+
+        const UInt64 serialTime = measure(serialScene, serialContent, false);
+        const UInt64 parallelTime = measure(parallelScene, parallelContent, true);
+        std::cout << "world matrix update of " << serialContent.renderables.size() << " renderables: serial " << serialTime
+            << "us, parallel (" << NumWorkers << " workers) " << parallelTime << "us" << std::endl;
+
+        updateAndExpectSameWorldMatrices();
+    }
 }
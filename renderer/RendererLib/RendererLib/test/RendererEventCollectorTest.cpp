@@ -331,6 +331,18 @@ namespace ramses_internal
         EXPECT_TRUE(resultEvents[0].isFirstDisplay);
     }
 
+    TEST_F(ARendererEventCollector, CanAddGpuMemoryBudgetExceededEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        m_rendererEventCollector.addGpuMemoryBudgetExceededEvent(displayHandle, 300u, 256u);
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::GpuMemoryBudgetExceeded, resultEvents[0].eventType);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+        EXPECT_EQ(300u, resultEvents[0].gpuMemoryUsage.usedBytes);
+        EXPECT_EQ(256u, resultEvents[0].gpuMemoryUsage.budgetBytes);
+    }
+
     TEST_F(ARendererEventCollector, CanAddStreamSurfaceUnavailableEvent)
     {
         const WaylandIviSurfaceId streamId(794u);
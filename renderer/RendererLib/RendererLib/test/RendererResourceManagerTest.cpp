@@ -1175,7 +1175,9 @@ TEST_F(ARendererResourceManager, DoesNotUnloadEffectThatGetsUnreferencedAndReRef
 
     //block call to upload shader to simulate scene getting unreferenced while AsyncEffectUploader is still uploading
     std::promise<void> barrier;
+    std::promise<void> uploadStarted;
     EXPECT_CALL(platform.resourceUploadRenderBackendMock.deviceMock, uploadShader(_)).WillOnce(Invoke([&](const auto&) {
+        uploadStarted.set_value();
         barrier.get_future().get();
         return std::make_unique<const GPUResource>(1u, 2u);
         }));
@@ -1185,6 +1187,8 @@ TEST_F(ARendererResourceManager, DoesNotUnloadEffectThatGetsUnreferencedAndReRef
 
     resourceManager.uploadAndUnloadPendingResources();
     ASSERT_EQ(EResourceStatus::ScheduledForUpload, resourceManager.getResourceStatus(resHash));
+    // effect not yet picked up by AsyncEffectUploader would be cancelled instead when unreferenced
+    uploadStarted.get_future().wait();
 
     resourceManager.unreferenceAllResourcesForScene(fakeSceneId);
     resourceManager.uploadAndUnloadPendingResources();
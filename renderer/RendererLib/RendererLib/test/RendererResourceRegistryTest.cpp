@@ -166,6 +166,23 @@ TEST_F(ARendererResourceRegistry, canSetResourceFromProvidedToUploaded_willRelea
     EXPECT_TRUE(registry.getAllResourcesNotInUseByScenes().empty());
 }
 
+TEST_F(ARendererResourceRegistry, keepsResourceDataOfUploadedResourceUntilReleased)
+{
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    registry.setResourceData(resource, testManagedResource);
+    const ResourceDescriptor& rd = registry.getResourceDescriptor(resource);
+
+    registry.setResourceUploaded(resource, DeviceResourceHandle(123456u), 666u, true);
+    EXPECT_EQ(EResourceStatus::Uploaded, rd.status);
+    EXPECT_TRUE(rd.resource);
+
+    registry.releaseResourceData(resource);
+    EXPECT_EQ(EResourceStatus::Uploaded, rd.status);
+    EXPECT_FALSE(rd.resource);
+    EXPECT_EQ(DeviceResourceHandle(123456u), rd.deviceHandle);
+}
+
 TEST_F(ARendererResourceRegistry, canSetResourceProvidedToBroken_willReleaseResourceData)
 {
     const ResourceContentHash resource(123u, 0u);
@@ -226,6 +243,40 @@ TEST_F(ARendererResourceRegistry, canSetResourceScheduledForUploadToBroken_willR
     EXPECT_TRUE(registry.getAllResourcesNotInUseByScenes().empty());
 }
 
+TEST_F(ARendererResourceRegistry, cancelledUploadOfResourceUsedByScene_returnsItToProvided)
+{
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    registry.addResourceRef(resource, SceneId(1u));
+    registry.setResourceData(resource, testManagedResource);
+    registry.setResourceScheduledForUpload(resource);
+
+    registry.setResourceUploadCancelled(resource);
+
+    EXPECT_EQ(EResourceStatus::Provided, registry.getResourceStatus(resource));
+    EXPECT_TRUE(registry.getResourceDescriptor(resource).resource);
+    EXPECT_TRUE(contains_c(registry.getAllProvidedResources(), resource));
+    EXPECT_FALSE(registry.hasAnyResourcesScheduledForUpload());
+}
+
+TEST_F(ARendererResourceRegistry, cancelledUploadOfResourceNotUsedBySceneAnymore_unregistersIt)
+{
+    const ResourceContentHash resource(123u, 0u);
+    registry.registerResource(resource);
+    registry.addResourceRef(resource, SceneId(1u));
+    registry.setResourceData(resource, testManagedResource);
+    registry.setResourceScheduledForUpload(resource);
+    registry.removeResourceRef(resource, SceneId(1u));
+    EXPECT_TRUE(registry.containsResource(resource));
+
+    registry.setResourceUploadCancelled(resource);
+
+    EXPECT_FALSE(registry.containsResource(resource));
+    EXPECT_TRUE(registry.getAllProvidedResources().empty());
+    EXPECT_TRUE(registry.getAllResourcesNotInUseByScenes().empty());
+    EXPECT_FALSE(registry.hasAnyResourcesScheduledForUpload());
+}
+
 TEST_F(ARendererResourceRegistry, providedResourceIsInProvidedList)
 {
     const ResourceContentHash resource(123u, 0u);
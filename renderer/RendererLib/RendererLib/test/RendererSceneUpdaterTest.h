@@ -1007,16 +1007,16 @@ protected:
         EXPECT_CALL(*renderer.m_displayController, executePostProcessing());
         EXPECT_CALL(*renderer.m_displayController, swapBuffers());
 
-        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(sceneIdx))), _, nullptr)).WillOnce(
-            [](const auto&, const RenderingContext& renderContext, const auto*) {
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(sceneIdx))), _, nullptr, nullptr)).WillOnce(
+            [](const auto&, const RenderingContext& renderContext, const auto*, auto*) {
             EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, renderContext.displayBufferDeviceHandle);
             return SceneRenderExecutionIterator{};
         });
 
         SceneRenderExecutionIterator interruptedState;
         interruptedState.incrementRenderableIdx();
-        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(interruptedSceneIdx))), _, _)).WillOnce(
-            [interruptedState](const auto&, const RenderingContext& renderContext, const auto*) {
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(getSceneId(interruptedSceneIdx))), _, _, _)).WillOnce(
+            [interruptedState](const auto&, const RenderingContext& renderContext, const auto*, auto*) {
             EXPECT_EQ(DeviceMock::FakeRenderTargetDeviceHandle, renderContext.displayBufferDeviceHandle);
             return interruptedState;
         });
@@ -1039,7 +1039,7 @@ protected:
         EXPECT_CALL(*renderer.m_displayController, canRenderNewFrame()).WillOnce(Return(true));
         EXPECT_CALL(*renderer.m_displayController, executePostProcessing()).Times(AnyNumber());
         EXPECT_CALL(*renderer.m_displayController, swapBuffers()).Times(AnyNumber());
-        EXPECT_CALL(*renderer.m_displayController, renderScene(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(*renderer.m_displayController, renderScene(_, _, _, _)).Times(AnyNumber());
 
         renderer.doOneRenderLoop();
     }
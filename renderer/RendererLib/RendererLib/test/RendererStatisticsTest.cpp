@@ -49,6 +49,68 @@ TEST_F(ARendererStatistics, tracksDrawCallsPerFrame)
     EXPECT_EQ(3u, stats.getDrawCallsPerFrame());
 }
 
+TEST_F(ARendererStatistics, tracksUploadedAndSkippedUniformsPerFrame)
+{
+    EXPECT_THAT(logOutput(), Not(HasSubstr("uniformsUploadedPerFrame")));
+
+    stats.uniformsUploaded(10u, 30u);
+    stats.frameFinished(0u);
+    stats.uniformsUploaded(20u, 50u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(15u, stats.getUploadedUniformsPerFrame());
+    EXPECT_EQ(40u, stats.getSkippedUniformsPerFrame());
+    EXPECT_THAT(logOutput(), HasSubstr("uniformsUploadedPerFrame 15, uniformsSkippedPerFrame 40"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getUploadedUniformsPerFrame());
+    EXPECT_EQ(0u, stats.getSkippedUniformsPerFrame());
+}
+
+TEST_F(ARendererStatistics, tracksStateChangesSavedByDrawCallSortingPerFrame)
+{
+    EXPECT_THAT(logOutput(), Not(HasSubstr("stateChangesSavedBySortingPerFrame")));
+
+    stats.drawCallsSorted(6u);
+    stats.frameFinished(0u);
+    stats.drawCallsSorted(2u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(4u, stats.getStateChangesSavedByDrawCallSortingPerFrame());
+    EXPECT_THAT(logOutput(), HasSubstr("stateChangesSavedBySortingPerFrame 4"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getStateChangesSavedByDrawCallSortingPerFrame());
+}
+
+TEST_F(ARendererStatistics, tracksCulledRenderablesPerFrame)
+{
+    EXPECT_THAT(logOutput(), Not(HasSubstr("culledDrawCallsPerFrame")));
+
+    stats.renderablesCulled(10u);
+    stats.frameFinished(0u);
+    stats.renderablesCulled(4u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(7u, stats.getCulledRenderablesPerFrame());
+    EXPECT_THAT(logOutput(), HasSubstr("culledDrawCallsPerFrame 7"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getCulledRenderablesPerFrame());
+}
+
+TEST_F(ARendererStatistics, tracksDrawCallsSavedByBatchingPerFrame)
+{
+    EXPECT_THAT(logOutput(), Not(HasSubstr("drawCallsSavedByBatchingPerFrame")));
+
+    stats.renderablesBatched(6u);
+    stats.frameFinished(0u);
+    stats.renderablesBatched(2u);
+    stats.frameFinished(0u);
+    EXPECT_EQ(4u, stats.getDrawCallsSavedByBatchingPerFrame());
+    EXPECT_THAT(logOutput(), HasSubstr("drawCallsSavedByBatchingPerFrame 4"));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getDrawCallsSavedByBatchingPerFrame());
+}
+
 TEST_F(ARendererStatistics, tracksFrameCount)
 {
     stats.frameFinished(0u);
@@ -307,6 +369,29 @@ TEST_F(ARendererStatistics, tracksSceneResourceUploads)
     EXPECT_THAT(logOutput(), Not(HasSubstr("RSUploaded")));
 }
 
+TEST_F(ARendererStatistics, tracksSceneVRAMUsage)
+{
+    stats.setSceneVRAMUsage(sceneId1, 3u << 10);
+    stats.frameFinished(0u);
+    EXPECT_THAT(logOutput(), HasSubstr("RCVRAM 3 KB"));
+
+    // usage is current state, not reset with periodic statistics
+    stats.reset();
+    stats.frameFinished(0u);
+    EXPECT_THAT(logOutput(), HasSubstr("RCVRAM 3 KB"));
+
+    stats.setSceneVRAMUsage(sceneId1, 0u);
+    stats.frameFinished(0u);
+    EXPECT_THAT(logOutput(), Not(HasSubstr("RCVRAM")));
+}
+
+TEST_F(ARendererStatistics, doesNotTrackSceneOnlyBecauseItHasNoVRAMUsage)
+{
+    stats.setSceneVRAMUsage(sceneId1, 0u);
+    stats.frameFinished(0u);
+    EXPECT_THAT(logOutput(), Not(HasSubstr("Scene 11")));
+}
+
 TEST_F(ARendererStatistics, tracksShaderCompilationAndTimes)
 {
     stats.shaderCompiled(std::chrono::microseconds(2u), "some effect", SceneId(123));
@@ -331,6 +416,17 @@ TEST_F(ARendererStatistics, tracksShaderCompilationAndTimes)
     EXPECT_THAT(logOutput(), Not(HasSubstr("shadersCompiled")));
 }
 
+TEST_F(ARendererStatistics, tracksShaderCompileLatency)
+{
+    stats.shaderCompileLatency(std::chrono::microseconds(2000u));
+    stats.shaderCompileLatency(std::chrono::microseconds(10000u));
+    stats.frameFinished(0u);
+    EXPECT_THAT(logOutput(), HasSubstr("shaderLatency avg ms:6 max ms:10"));
+
+    stats.reset();
+    EXPECT_THAT(logOutput(), Not(HasSubstr("shaderLatency")));
+}
+
 
 TEST_F(ARendererStatistics, tracksExpirationOffsets)
 {
@@ -136,8 +136,8 @@ public:
         EDiscardDepth discardAllowed,
         const FrameTimer* frameTimer = nullptr)
     {
-        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), _, frameTimer))
-            .WillOnce([=](const auto&, RenderingContext& renderContext, const auto*) {
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), _, frameTimer, _))
+            .WillOnce([=](const auto&, RenderingContext& renderContext, const auto*, auto*) {
             EXPECT_EQ(buffer, renderContext.displayBufferDeviceHandle);
             EXPECT_EQ(expectedRenderBegin, renderContext.renderFrom);
             EXPECT_EQ(dispBufferClearFlags, renderContext.displayBufferClearPending);
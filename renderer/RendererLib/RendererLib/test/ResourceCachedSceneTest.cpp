@@ -1168,6 +1168,7 @@ namespace ramses_internal
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::IndexArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::VertArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getVertexArrayDeviceHandle(renderable2, scene.getSceneId()));
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash));
         updateRenderableResourcesAndVertexArray({ renderable2 });
         expectRenderableResourcesClean(renderable2);
     }
@@ -1219,6 +1220,7 @@ namespace ramses_internal
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::IndexArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::VertArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getVertexArrayDeviceHandle(renderable, scene.getSceneId()));
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash));
         updateRenderableResourcesAndVertexArray({ renderable });
         expectRenderableResourcesClean(renderable);
     }
@@ -1251,6 +1253,7 @@ namespace ramses_internal
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::IndexArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::VertArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getVertexArrayDeviceHandle(renderable, scene.getSceneId()));
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash));
         updateRenderableResourcesAndVertexArray({ renderable });
         expectRenderableResourcesClean(renderable);
 
@@ -1266,6 +1269,7 @@ namespace ramses_internal
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::IndexArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getResourceDeviceHandle(MockResourceHash::VertArrayHash));
         EXPECT_CALL(sceneHelper.resourceManager, getVertexArrayDeviceHandle(renderable, scene.getSceneId()));
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingVolume(MockResourceHash::VertArrayHash));
         updateRenderableResourcesAndVertexArray({ renderable });
         expectRenderableResourcesClean(renderable);
     }
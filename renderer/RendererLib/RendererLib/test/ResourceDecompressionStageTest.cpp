@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/ResourceDecompressionStage.h"
+#include "Resource/ArrayResource.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class AResourceDecompressionStage : public ::testing::Test
+    {
+    protected:
+        static ManagedResource CreateCompressedResource()
+        {
+            std::vector<UInt16> data(2000u);
+            for (size_t i = 0u; i < data.size(); ++i)
+                data[i] = static_cast<UInt16>(i);
+            ArrayResource uncompressedRes(EResourceType_IndexArray, static_cast<UInt32>(data.size()), EDataType::UInt16, data.data(), ResourceCacheFlag_DoNotCache, String());
+            uncompressedRes.compress(IResource::CompressionLevel::Realtime);
+
+            auto compressedRes = std::make_shared<ArrayResource>(EResourceType_IndexArray, static_cast<UInt32>(data.size()), EDataType::UInt16, nullptr, ResourceCacheFlag_DoNotCache, String());
+            const auto& compressedData = uncompressedRes.getCompressedResourceData();
+            compressedRes->setCompressedResourceData(CompressedResourceBlob(compressedData.size(), compressedData.data()),
+                IResource::CompressionLevel::Realtime, uncompressedRes.getDecompressedDataSize(), uncompressedRes.getHash());
+            return compressedRes;
+        }
+
+        void waitForAllPendingFinished()
+        {
+            for (int i = 0; i < 1000 && stage.getPendingCount() > 0u; ++i)
+            {
+                PlatformThread::Sleep(5u);
+                stage.collectFinished();
+            }
+            ASSERT_EQ(0u, stage.getPendingCount());
+        }
+
+        ResourceDecompressionStage stage{ 2u };
+        const ResourceContentHash hash{ 123u, 0u };
+        const ResourceContentHash otherHash{ 124u, 0u };
+    };
+
+    TEST_F(AResourceDecompressionStage, doesNotHoldBackResourceWhichIsNotCompressed)
+    {
+        const UInt16 data[] = { 1u, 2u, 3u };
+        const ManagedResource res = std::make_shared<ArrayResource>(EResourceType_IndexArray, 3u, EDataType::UInt16, data, ResourceCacheFlag_DoNotCache, String());
+        EXPECT_FALSE(stage.prepare(hash, res));
+        EXPECT_EQ(0u, stage.getPendingCount());
+    }
+
+    TEST_F(AResourceDecompressionStage, decompressesCompressedResourceInWorkerThread)
+    {
+        const ManagedResource res = CreateCompressedResource();
+        ASSERT_FALSE(res->isDeCompressedAvailable());
+
+        EXPECT_TRUE(stage.prepare(hash, res));
+        waitForAllPendingFinished();
+
+        EXPECT_TRUE(res->isDeCompressedAvailable());
+        EXPECT_FALSE(stage.prepare(hash, res));
+    }
+
+    TEST_F(AResourceDecompressionStage, holdsBackResourceUntilFinishedDecompressionWasCollected)
+    {
+        const ManagedResource res = CreateCompressedResource();
+        EXPECT_TRUE(stage.prepare(hash, res));
+
+        for (int i = 0; i < 1000 && !res->isDeCompressedAvailable(); ++i)
+            PlatformThread::Sleep(5u);
+        ASSERT_TRUE(res->isDeCompressedAvailable());
+
+        // still pending until collected
+        EXPECT_TRUE(stage.prepare(hash, res));
+        waitForAllPendingFinished();
+        EXPECT_FALSE(stage.prepare(hash, res));
+    }
+
+    TEST_F(AResourceDecompressionStage, decompressesMultipleResourcesInParallel)
+    {
+        const ManagedResource res1 = CreateCompressedResource();
+        const ManagedResource res2 = CreateCompressedResource();
+        EXPECT_TRUE(stage.prepare(hash, res1));
+        EXPECT_TRUE(stage.prepare(otherHash, res2));
+        EXPECT_EQ(2u, stage.getPendingCount());
+
+        waitForAllPendingFinished();
+        EXPECT_TRUE(res1->isDeCompressedAvailable());
+        EXPECT_TRUE(res2->isDeCompressedAvailable());
+    }
+
+    TEST_F(AResourceDecompressionStage, keepsResourceAliveWhileBeingDecompressed)
+    {
+        {
+            const ManagedResource res = CreateCompressedResource();
+            EXPECT_TRUE(stage.prepare(hash, res));
+        }
+        // resource released by owner before decompression is finished
+        waitForAllPendingFinished();
+    }
+}
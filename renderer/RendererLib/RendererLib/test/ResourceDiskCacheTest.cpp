@@ -0,0 +1,255 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/ResourceDiskCache.h"
+#include "Resource/ArrayResource.h"
+#include "Utils/File.h"
+#include <cstring>
+#include <vector>
+
+namespace ramses_internal
+{
+    class AResourceDiskCache : public ::testing::Test
+    {
+    protected:
+        ~AResourceDiskCache() override
+        {
+            File file(m_filePath);
+            if (file.exists())
+                file.remove();
+        }
+
+        static ManagedResource CreateResource(UInt16 seed)
+        {
+            std::vector<UInt16> data(1000u);
+            for (size_t i = 0u; i < data.size(); ++i)
+                data[i] = static_cast<UInt16>(i + seed);
+            auto res = std::make_shared<ArrayResource>(EResourceType_IndexArray, static_cast<UInt32>(data.size()), EDataType::UInt16, data.data(), ResourceCacheFlag_DoNotCache, String());
+            // compressed data is available too like for resources received from client
+            res->compress(IResource::CompressionLevel::Realtime);
+            return res;
+        }
+
+        static void ExpectSameData(const IResource& expected, const IResource& actual)
+        {
+            EXPECT_EQ(expected.getTypeID(), actual.getTypeID());
+            ASSERT_EQ(expected.getDecompressedDataSize(), actual.getDecompressedDataSize());
+            EXPECT_EQ(0, std::memcmp(expected.getResourceData().data(), actual.getResourceData().data(), expected.getDecompressedDataSize()));
+        }
+
+        void storeAll(const ManagedResourceVector& resources, UInt64 maxSize = 1000000u)
+        {
+            ResourceDiskCache cache(m_filePath, maxSize);
+            for (const auto& res : resources)
+                cache.store(res);
+            cache.flush();
+        }
+
+        std::vector<Byte> readFile()
+        {
+            File file(m_filePath);
+            size_t size = 0u;
+            EXPECT_TRUE(file.getSizeInBytes(size));
+            std::vector<Byte> content(size);
+            size_t numBytes = 0u;
+            EXPECT_TRUE(file.open(File::Mode::ReadOnlyBinary));
+            EXPECT_EQ(EStatus::Ok, file.read(content.data(), size, numBytes));
+            return content;
+        }
+
+        void writeFile(const std::vector<Byte>& content)
+        {
+            File file(m_filePath);
+            ASSERT_TRUE(file.open(File::Mode::WriteOverWriteOldBinary));
+            ASSERT_TRUE(file.write(content.data(), content.size()));
+        }
+
+        const String m_filePath{ "resourceDiskCacheTest.dat" };
+        const ManagedResource res1 = CreateResource(1u);
+        const ManagedResource res2 = CreateResource(2u);
+        const ManagedResource res3 = CreateResource(3u);
+    };
+
+    TEST_F(AResourceDiskCache, returnsNullForResourceNotCached)
+    {
+        ResourceDiskCache cache(m_filePath, 1000000u);
+        EXPECT_FALSE(cache.contains(res1->getHash()));
+        EXPECT_FALSE(cache.load(res1->getHash()));
+    }
+
+    TEST_F(AResourceDiskCache, loadsStoredResourceDecompressedAfterReopening)
+    {
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            cache.store(res1);
+            cache.flush();
+            EXPECT_TRUE(cache.contains(res1->getHash()));
+            // file written in this run is not mapped yet
+            EXPECT_FALSE(cache.load(res1->getHash()));
+        }
+
+        ManagedResource loaded;
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            loaded = cache.load(res1->getHash());
+        }
+
+        // loaded resource keeps cache file mapped
+        ASSERT_TRUE(loaded);
+        EXPECT_EQ(res1->getHash(), loaded->getHash());
+        EXPECT_TRUE(loaded->isDeCompressedAvailable());
+        EXPECT_FALSE(loaded->isCompressedAvailable());
+        ExpectSameData(*res1, *loaded);
+    }
+
+    TEST_F(AResourceDiskCache, storesSameResourceOnlyOnce)
+    {
+        ResourceDiskCache cache(m_filePath, 1000000u);
+        cache.store(res1);
+        cache.flush();
+        const UInt64 sizeAfterFirstStore = cache.getCachedSize();
+        cache.store(res1);
+        cache.flush();
+        EXPECT_EQ(sizeAfterFirstStore, cache.getCachedSize());
+    }
+
+    TEST_F(AResourceDiskCache, dropsResourceWithCorruptedData)
+    {
+        storeAll({ res1 });
+
+        std::vector<Byte> content = readFile();
+        content.back() ^= 0xFFu;
+        writeFile(content);
+
+        ResourceDiskCache cache(m_filePath, 1000000u);
+        EXPECT_TRUE(cache.contains(res1->getHash()));
+        EXPECT_FALSE(cache.load(res1->getHash()));
+        EXPECT_FALSE(cache.contains(res1->getHash()));
+    }
+
+    TEST_F(AResourceDiskCache, dropsTruncatedRecordAtEndOfFile)
+    {
+        storeAll({ res1, res2 });
+
+        std::vector<Byte> content = readFile();
+        content.resize(content.size() - 10u);
+        writeFile(content);
+
+        ResourceDiskCache cache(m_filePath, 1000000u);
+        EXPECT_FALSE(cache.contains(res2->getHash()));
+        const ManagedResource loaded = cache.load(res1->getHash());
+        ASSERT_TRUE(loaded);
+        ExpectSameData(*res1, *loaded);
+    }
+
+    TEST_F(AResourceDiskCache, evictsLeastRecentlyUsedResourceWhenExceedingMaxSize)
+    {
+        UInt64 recordSize = 0u;
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            cache.store(res1);
+            cache.flush();
+            recordSize = cache.getCachedSize();
+            cache.store(res2);
+            cache.flush();
+        }
+        {
+            // res1 is used in this run, res2 is not
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            EXPECT_TRUE(cache.load(res1->getHash()));
+        }
+
+        ResourceDiskCache cache(m_filePath, 2u * recordSize);
+        cache.store(res3);
+        cache.flush();
+        EXPECT_TRUE(cache.contains(res1->getHash()));
+        EXPECT_FALSE(cache.contains(res2->getHash()));
+        EXPECT_TRUE(cache.contains(res3->getHash()));
+        EXPECT_EQ(2u * recordSize, cache.getCachedSize());
+    }
+
+    TEST_F(AResourceDiskCache, doesNotRestoreResourceEvictedInPreviousRun)
+    {
+        UInt64 recordSize = 0u;
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            cache.store(res1);
+            cache.flush();
+            recordSize = cache.getCachedSize();
+        }
+        storeAll({ res2 });
+        // res1 was stored in older run than res2
+        storeAll({ res3 }, 2u * recordSize);
+
+        ResourceDiskCache cache(m_filePath, 1000000u);
+        EXPECT_FALSE(cache.contains(res1->getHash()));
+        EXPECT_TRUE(cache.contains(res2->getHash()));
+        EXPECT_TRUE(cache.contains(res3->getHash()));
+    }
+
+    TEST_F(AResourceDiskCache, reclaimsSpaceOfEvictedResourcesWhenReopened)
+    {
+        storeAll({ res1 });
+        const size_t fileSizeWithOneResource = readFile().size();
+        storeAll({ res2 });
+        UInt64 recordSize = 0u;
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            recordSize = cache.getCachedSize() / 2u;
+        }
+
+        {
+            // res1 is evicted, file is compacted as it would be mostly unused otherwise
+            ResourceDiskCache cache(m_filePath, recordSize);
+            EXPECT_FALSE(cache.contains(res1->getHash()));
+            EXPECT_EQ(fileSizeWithOneResource, readFile().size());
+            const ManagedResource loaded = cache.load(res2->getHash());
+            ASSERT_TRUE(loaded);
+            ExpectSameData(*res2, *loaded);
+        }
+
+        ResourceDiskCache cache(m_filePath, recordSize);
+        EXPECT_TRUE(cache.load(res2->getHash()));
+    }
+
+    TEST_F(AResourceDiskCache, keepsFileBelowTwiceMaxSizeUntilReopened)
+    {
+        UInt64 recordSize = 0u;
+        {
+            ResourceDiskCache cache(m_filePath, 1000000u);
+            cache.store(res1);
+            cache.flush();
+            recordSize = cache.getCachedSize();
+        }
+        File(m_filePath).remove();
+
+        ResourceDiskCache cache(m_filePath, recordSize);
+        cache.store(res1);
+        cache.flush();
+        cache.store(res2);
+        cache.flush();
+        EXPECT_FALSE(cache.contains(res1->getHash()));
+        EXPECT_TRUE(cache.contains(res2->getHash()));
+
+        // evicted res1 still occupies file
+        cache.store(res3);
+        cache.flush();
+        EXPECT_FALSE(cache.contains(res3->getHash()));
+        EXPECT_TRUE(cache.contains(res2->getHash()));
+    }
+
+    TEST_F(AResourceDiskCache, doesNotStoreResourceBiggerThanMaxSize)
+    {
+        ResourceDiskCache cache(m_filePath, 100u);
+        cache.store(res1);
+        cache.flush();
+        EXPECT_FALSE(cache.contains(res1->getHash()));
+        EXPECT_EQ(0u, cache.getCachedSize());
+    }
+}
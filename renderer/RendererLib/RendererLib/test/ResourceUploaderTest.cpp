@@ -228,10 +228,9 @@ TEST_F(AResourceUploader, uploadsTextureCubeResource)
     InSequence seq;
     EXPECT_CALL(renderer.deviceMock, allocateTextureCube(2u, ETextureFormat::R8, DefaultTextureSwizzleArray, mipCount, 6 * 5)).WillOnce(Return(DeviceResourceHandle(123)));
     for (UInt32 i = 0u; i < 6u; ++i)
-    {
         EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, i, 2u, 2u, 1u, _, _));
+    for (UInt32 i = 0u; i < 6u; ++i)
         EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, i, 1u, 1u, 1u, _, _));
-    }
     EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
     EXPECT_EQ(6u * (2 * 2 + 1), vramSize);
 }
@@ -256,6 +255,79 @@ TEST_F(AResourceUploader, uploadsTextureCubeResourceWithMipGen)
     EXPECT_EQ(6u * (4 * 4 + 2 * 2 + 1), vramSize);
 }
 
+TEST_F(AResourceUploader, uploadsTexture2DResourceFromMipLevel)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 16, 4, 1 });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData().data();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, allocateTexture2D(4u, 4u, ETextureFormat::R8, DefaultTextureSwizzleArray, 3u, 21u)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, 0u, 2u, 2u, 1u, data + 16, 4u));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 2u, 0u, 0u, 0u, 1u, 1u, 1u, data + 20, 1u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    EXPECT_EQ(DeviceResourceHandle(123), uploader.uploadTextureFromMipLevel(renderer, res, 1u, vramSize));
+    EXPECT_EQ(16u + 4 + 1, vramSize);
+}
+
+TEST_F(AResourceUploader, uploadsSingleMipLevelOfTexture2DResource)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 16, 4, 1 });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData().data();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 0u, 4u, 4u, 1u, data, 16u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 0u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 0u, 0u, 4u);
+}
+
+TEST_F(AResourceUploader, uploadsRowsOfMipLevelOfTexture2DResourceAndMakesItBaseLevelWithLastRow)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 16, 4, 1 });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData().data();
+    EXPECT_EQ(4u, ResourceUploader::GetTextureMipLevelRowCount(res, 0u));
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 0u, 4u, 3u, 1u, data, 12u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 0u, 0u, 3u);
+
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 3u, 0u, 4u, 1u, 1u, data + 12, 4u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 0u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 0u, 3u, 1u);
+}
+
+TEST_F(AResourceUploader, uploadsDepthSlicesOfMipLevelOfTexture3DResource)
+{
+    const TextureMetaInfo texDesc(2u, 2u, 4u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 16, 2 });
+    TextureResource res(EResourceType_Texture3D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData().data();
+    EXPECT_EQ(4u, ResourceUploader::GetTextureMipLevelRowCount(res, 0u));
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 1u, 2u, 2u, 2u, data + 4, 8u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 0u, 1u, 2u);
+}
+
+TEST_F(AResourceUploader, uploadsSingleMipLevelOfTextureCubeResourceForAllFaces)
+{
+    const TextureMetaInfo texDesc(2u, 1u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 4, 1 });
+    TextureResource res(EResourceType_TextureCube, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData().data();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    for (UInt32 i = 0u; i < 6u; ++i)
+        EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, i, 1u, 1u, 1u, data + i * 5u + 4u, 1u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 1u, 0u, 1u);
+}
+
 TEST_F(AResourceUploader, canStoreBinaryShader)
 {
     EffectResource res("", "", "", absl::nullopt, EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
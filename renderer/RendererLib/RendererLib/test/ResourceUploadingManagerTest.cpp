@@ -14,6 +14,7 @@
 #include "RendererLib/DisplayConfig.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
+#include "Resource/TextureResource.h"
 #include "ResourceUploaderMock.h"
 #include "ResourceMock.h"
 #include "PlatformMock.h"
@@ -87,9 +88,15 @@ public:
         ASSERT_TRUE(contains_c(resourceRegistry.getAllProvidedResources(), hash));
     }
 
-    void makeResourceUnused(ResourceContentHash hash, SceneId id = {})
+    void removeResourceRef(ResourceContentHash hash, SceneId id = {})
     {
         resourceRegistry.removeResourceRef(hash, id.isValid() ? id : sceneId);
+        rendererResourceUploader.onResourceUnreferencedByScene(hash, id.isValid() ? id : sceneId);
+    }
+
+    void makeResourceUnused(ResourceContentHash hash, SceneId id = {})
+    {
+        removeResourceRef(hash, id);
         if (resourceRegistry.containsResource(hash))
         {
             ASSERT_TRUE(contains_c(resourceRegistry.getAllResourcesNotInUseByScenes(), hash));
@@ -226,6 +233,36 @@ public:
     }
 };
 
+class AResourceUploadingManager_ScenePriorityWithVRAMCache : public AResourceUploadingManager
+{
+public:
+    AResourceUploadingManager_ScenePriorityWithVRAMCache()
+        : AResourceUploadingManager(makeConfig(false, 30u, AResourceUploadingManager_ScenePriority::getPreferredScene(), AResourceUploadingManager_ScenePriority::getDeprivedScene()))
+    {
+    }
+};
+
+class AResourceUploadingManager_TextureStreaming : public AResourceUploadingManager
+{
+public:
+    AResourceUploadingManager_TextureStreaming()
+        : AResourceUploadingManager(makeTextureStreamingConfig())
+    {
+    }
+
+    static DisplayConfig makeTextureStreamingConfig()
+    {
+        DisplayConfig cfg;
+        cfg.setTextureStreamingEnabled(true);
+        return cfg;
+    }
+
+protected:
+    // smallest mip level alone is below large resource threshold, together with the next one it is above
+    const TextureResource largeTexture{ EResourceType_Texture2D,
+        TextureMetaInfo(1024u, 1024u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 1024u * 1024u, 512u * 512u, 256u * 256u }), ResourceCacheFlag_DoNotCache, String() };
+};
+
 TEST_F(AResourceUploadingManager, hasNothingToUploadUnloadInitially)
 {
     EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
@@ -329,6 +366,52 @@ TEST_F(AResourceUploadingManager, setsBrokenStatusForEffectIfUploadFailed)
     makeResourceUnused(resHash);
 }
 
+TEST_F(AResourceUploadingManager, cancelsUploadOfEffectNotUsedAnymoreIfItsUploadDidNotStartYet)
+{
+    const EffectResource otherEffectResource("other", "", "", absl::nullopt, EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    const auto effect1 = dummyEffectResource.getHash();
+    const auto effect2 = otherEffectResource.getHash();
+    registerAndProvideResource(effect1, true);
+    registerAndProvideResource(effect2, true, &otherEffectResource);
+
+    const absl::optional<DeviceResourceHandle> unsetDeviceHandle;
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2u).WillRepeatedly(Return(unsetDeviceHandle));
+
+    // block upload thread with first effect until upload of second effect is cancelled
+    std::promise<void> barrierUploadStarted;
+    std::promise<void> barrierUploadCanFinish;
+    EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(dummyEffectResource))).WillOnce(Invoke([&](const auto&) {
+        barrierUploadStarted.set_value();
+        barrierUploadCanFinish.get_future().get();
+        return std::make_unique<const GPUResource>(1u, 2u);
+        }));
+    EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(otherEffectResource))).Times(0u);
+
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    barrierUploadStarted.get_future().get();
+    expectResourceStatus(effect2, EResourceStatus::ScheduledForUpload);
+
+    makeResourceUnused(effect2);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(effect2);
+
+    EXPECT_CALL(platformMock.renderBackendMock.deviceMock, registerShader(_));
+    EXPECT_CALL(*uploader, storeShaderInBinaryShaderCache(Ref(platformMock.renderBackendMock), DeviceMock::FakeShaderDeviceHandle, effect1, sceneId));
+    barrierUploadCanFinish.set_value();
+    constexpr std::chrono::seconds timeoutTime{ 2u };
+    const auto startTime = std::chrono::steady_clock::now();
+    while (resourceRegistry.getResourceStatus(effect1) == EResourceStatus::ScheduledForUpload
+        && std::chrono::steady_clock::now() - startTime < timeoutTime)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 5u });
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+    }
+    expectResourceUploaded(effect1, DeviceMock::FakeShaderDeviceHandle);
+
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    makeResourceUnused(effect1);
+}
+
 TEST_F(AResourceUploadingManager, uploadsAllProvidedResourcesInOneUpdate_defaultUploadStrategy)
 {
     const ResourceContentHash res1(1234u, 0u);
@@ -830,6 +913,223 @@ TEST_F(AResourceUploadingManager_WithVRAMCache, willUnloadResourcesOfSameOrGreat
     EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
 }
 
+TEST_F(AResourceUploadingManager_WithVRAMCache, accountsResourcesWithVRAMSizeReportedByUploader)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+
+    EXPECT_CALL(*uploader, uploadResource(_, _, _))
+        .WillOnce(DoAll(SetArgReferee<2>(25u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)))
+        .WillOnce(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    EXPECT_EQ(35u, rendererResourceUploader.getGpuMemoryBudget().getUsage());
+    EXPECT_EQ(35u, rendererResourceUploader.getGpuMemoryBudget().getUsage(EResourceType_IndexArray));
+    EXPECT_EQ(0u, rendererResourceUploader.getGpuMemoryBudget().getUsage(EResourceType_Texture2D));
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+
+    // 5 bytes above cache size, resource with larger VRAM size became unused first and is enough to free
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res1);
+    expectResourceUploaded(res2);
+    EXPECT_EQ(10u, rendererResourceUploader.getGpuMemoryBudget().getUsage());
+
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+}
+
+TEST_F(AResourceUploadingManager_WithVRAMCache, reportsBudgetExceededOnceWhenResourcesInUseDoNotFitInCache)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+    registerAndProvideResource(res3);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(rendererResourceUploader.hasGpuMemoryBudgetBeenExceeded());
+
+    registerAndProvideResource(res4);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_TRUE(rendererResourceUploader.hasGpuMemoryBudgetBeenExceeded());
+    EXPECT_TRUE(rendererResourceUploader.getGpuMemoryBudget().isUnderPressure());
+
+    // not reported again while pressure lasts
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(rendererResourceUploader.hasGpuMemoryBudgetBeenExceeded());
+    EXPECT_TRUE(rendererResourceUploader.getGpuMemoryBudget().isUnderPressure());
+
+    // unused resource is unloaded right away and pressure is gone
+    makeResourceUnused(res4);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(rendererResourceUploader.hasGpuMemoryBudgetBeenExceeded());
+    EXPECT_FALSE(rendererResourceUploader.getGpuMemoryBudget().isUnderPressure());
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    makeResourceUnused(res3);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AResourceUploadingManager_WithVRAMCache, evictsMoreUnusedResourcesIfUploadNeededMoreVRAMThanEstimated)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    makeResourceUnused(res1);
+
+    // estimated size of new resource fits in cache, VRAM size reported by upload does not
+    registerAndProvideResource(res3);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(DoAll(SetArgReferee<2>(15u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)));
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res1);
+    expectResourceUploaded(res3);
+    EXPECT_EQ(25u, rendererResourceUploader.getGpuMemoryBudget().getUsage());
+
+    // unused resource could be evicted so budget was not exceeded
+    EXPECT_FALSE(rendererResourceUploader.hasGpuMemoryBudgetBeenExceeded());
+    EXPECT_FALSE(rendererResourceUploader.getGpuMemoryBudget().isUnderPressure());
+
+    makeResourceUnused(res2);
+    makeResourceUnused(res3);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2u);
+}
+
+TEST_F(AResourceUploadingManager_WithVRAMCache, tracksVRAMUsagePerScene)
+{
+    const SceneId otherScene(67u);
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2, false, nullptr, otherScene);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_EQ(10u, rendererResourceUploader.getGpuMemoryBudget().getUsage(sceneId));
+    EXPECT_EQ(10u, rendererResourceUploader.getGpuMemoryBudget().getUsage(otherScene));
+
+    // shared resource counts for both scenes
+    resourceRegistry.addResourceRef(res1, otherScene);
+    rendererResourceUploader.onResourceUsedByScene(res1, otherScene);
+    EXPECT_EQ(10u, rendererResourceUploader.getGpuMemoryBudget().getUsage(sceneId));
+    EXPECT_EQ(20u, rendererResourceUploader.getGpuMemoryBudget().getUsage(otherScene));
+
+    // scene referencing resource multiple times keeps using it until last reference is removed
+    resourceRegistry.addResourceRef(res1, sceneId);
+    rendererResourceUploader.onResourceUsedByScene(res1, sceneId);
+    removeResourceRef(res1);
+    EXPECT_EQ(10u, rendererResourceUploader.getGpuMemoryBudget().getUsage(sceneId));
+    removeResourceRef(res1);
+    EXPECT_EQ(0u, rendererResourceUploader.getGpuMemoryBudget().getUsage(sceneId));
+    EXPECT_EQ(20u, rendererResourceUploader.getGpuMemoryBudget().getUsage(otherScene));
+
+    makeResourceUnused(res1, otherScene);
+    makeResourceUnused(res2, otherScene);
+    EXPECT_EQ(0u, rendererResourceUploader.getGpuMemoryBudget().getUsage(otherScene));
+    EXPECT_EQ(20u, rendererResourceUploader.getGpuMemoryBudget().getUsage());
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2u);
+}
+
+TEST_F(AResourceUploadingManager_ScenePriorityWithVRAMCache, evictsUnusedResourcesOfLessImportantScenesFirst)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+    const SceneId preferredScene = AResourceUploadingManager_ScenePriority::getPreferredScene();
+    const SceneId deprivedScene = AResourceUploadingManager_ScenePriority::getDeprivedScene();
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1, false, nullptr, preferredScene);
+    registerAndProvideResource(res2, false, nullptr, deprivedScene);
+    registerAndProvideResource(res3);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    // least recently used is resource of preferred scene
+    makeResourceUnused(res1, preferredScene);
+    makeResourceUnused(res2, deprivedScene);
+
+    // resource of deprived scene is evicted first although it became unused later
+    registerAndProvideResource(res4);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(*uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res2);
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res4);
+
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AResourceUploadingManager_ScenePriorityWithVRAMCache, keepsEvictionPriorityOfMostImportantSceneWhichUsedResource)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+    const SceneId preferredScene = AResourceUploadingManager_ScenePriority::getPreferredScene();
+    const SceneId deprivedScene = AResourceUploadingManager_ScenePriority::getDeprivedScene();
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1, false, nullptr, deprivedScene);
+    registerAndProvideResource(res2, false, nullptr, deprivedScene);
+    registerAndProvideResource(res3);
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    // uploaded resource gets used by preferred scene too
+    resourceRegistry.addResourceRef(res2, preferredScene);
+    rendererResourceUploader.onResourceUsedByScene(res2, preferredScene);
+
+    // still in use by preferred scene
+    removeResourceRef(res2, deprivedScene);
+    makeResourceUnused(res2, preferredScene);
+    makeResourceUnused(res1, deprivedScene);
+
+    registerAndProvideResource(res4);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(*uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res1);
+    expectResourceUploaded(res2);
+
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
 TEST_F(AResourceUploadingManager_ScenePriority, uploadsPreferredResourcesFirst)
 {
     const std::vector<UInt32> dummyData(ResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
@@ -887,4 +1187,109 @@ TEST_F(AResourceUploadingManager_ScenePriority, uploadsPreferredResourcesFirst)
     EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(4);
 }
 
+TEST_F(AResourceUploadingManager_TextureStreaming, uploadsSmallestMipLevelsOfLargeTextureFirstAndStreamsRemainingLevels)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeTexture);
+
+    InSequence seq;
+    EXPECT_CALL(*uploader, uploadTextureFromMipLevel(_, Ref(largeTexture), 2u, _));
+    EXPECT_CALL(*uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(largeTexture), 1u, _, _)).Times(2);
+    EXPECT_CALL(*uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(largeTexture), 0u, _, _)).Times(5);
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+    EXPECT_EQ(SceneIdVector{ sceneId }, rendererResourceUploader.getScenesWithStreamedTextureUpdates());
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+}
+
+TEST_F(AResourceUploadingManager_TextureStreaming, streamsOnePieceOfMipLevelPerUpdateIfOutOfTimeBudget)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeTexture);
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u);
+
+    // texture itself is uploaded in this update so no more mip levels fit
+    EXPECT_CALL(*uploader, uploadTextureFromMipLevel(_, Ref(largeTexture), 2u, _));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+    EXPECT_TRUE(rendererResourceUploader.getScenesWithStreamedTextureUpdates().empty());
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    // level 1 has 512 rows of 512 bytes, rows below large resource threshold are uploaded at once
+    const UInt32 rowsOfLevel1PerUpdate = ResourceUploadingManager::LargeResourceByteSizeThreshold / 512u;
+    EXPECT_CALL(*uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(largeTexture), 1u, 0u, rowsOfLevel1PerUpdate));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    // level is not used before it is complete
+    EXPECT_TRUE(rendererResourceUploader.getScenesWithStreamedTextureUpdates().empty());
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    EXPECT_CALL(*uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(largeTexture), 1u, rowsOfLevel1PerUpdate, 512u - rowsOfLevel1PerUpdate));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_EQ(SceneIdVector{ sceneId }, rendererResourceUploader.getScenesWithStreamedTextureUpdates());
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    const UInt32 rowsOfLevel0PerUpdate = ResourceUploadingManager::LargeResourceByteSizeThreshold / 1024u;
+    for (UInt32 firstRow = 0u; firstRow < 1024u; firstRow += rowsOfLevel0PerUpdate)
+    {
+        const UInt32 rowCount = std::min(rowsOfLevel0PerUpdate, 1024u - firstRow);
+        EXPECT_CALL(*uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(largeTexture), 0u, firstRow, rowCount));
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        Mock::VerifyAndClearExpectations(uploader);
+    }
+    EXPECT_EQ(SceneIdVector{ sceneId }, rendererResourceUploader.getScenesWithStreamedTextureUpdates());
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+}
+
+TEST_F(AResourceUploadingManager_TextureStreaming, stopsStreamingTextureWhenItGetsUnloaded)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeTexture);
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u);
+
+    EXPECT_CALL(*uploader, uploadTextureFromMipLevel(_, Ref(largeTexture), 2u, _));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    makeResourceUnused(res);
+    EXPECT_CALL(*uploader, unloadResource(_, _, res, _));
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res);
+    EXPECT_TRUE(rendererResourceUploader.getScenesWithStreamedTextureUpdates().empty());
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+}
+
+TEST_F(AResourceUploadingManager_TextureStreaming, uploadsSmallTextureAndTextureWithGeneratedMipChainAtOnce)
+{
+    const TextureResource smallTexture(EResourceType_Texture2D, TextureMetaInfo(2u, 2u, 1u, ETextureFormat::R8, false, DefaultTextureSwizzleArray, { 4u, 1u }), ResourceCacheFlag_DoNotCache, String());
+    const TextureResource mipGenTexture(EResourceType_Texture2D, TextureMetaInfo(1024u, 1024u, 1u, ETextureFormat::R8, true, DefaultTextureSwizzleArray, { 1024u * 1024u }), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    registerAndProvideResource(res1, false, &smallTexture);
+    registerAndProvideResource(res2, false, &mipGenTexture);
+
+    EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2);
+    frameTimer.startFrame();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res2);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2);
+}
+
 }
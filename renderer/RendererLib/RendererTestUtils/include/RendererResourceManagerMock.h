@@ -16,6 +16,8 @@
 #include "RendererLib/IRendererResourceManager.h"
 #include "RendererLib/RendererLogContext.h"
 #include "RendererLib/EResourceStatus.h"
+#include "RendererLib/RenderableBatchGeometry.h"
+#include "RendererLib/GpuMemoryBudget.h"
 #include "Components/ManagedResource.h"
 #include <unordered_map>
 
@@ -52,6 +54,9 @@ public:
     MOCK_METHOD(void, provideResourceData, (const ManagedResource& mr), (override));
     MOCK_METHOD(bool, hasResourcesToBeUploaded, (), (const, override));
     MOCK_METHOD(void, uploadAndUnloadPendingResources, (), (override));
+    MOCK_METHOD(const SceneIdVector&, getScenesWithStreamedTextureUpdates, (), (const, override));
+    MOCK_METHOD(bool, hasGpuMemoryBudgetBeenExceeded, (), (const, override));
+    MOCK_METHOD(const GpuMemoryBudget&, getGpuMemoryBudget, (), (const, override));
     MOCK_METHOD(void, uploadRenderTargetBuffer, (RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer), (override));
     MOCK_METHOD(void, unloadRenderTargetBuffer, (RenderBufferHandle renderBufferHandle, SceneId sceneId), (override));
     MOCK_METHOD(void, uploadRenderTarget, (RenderTargetHandle renderTarget, const RenderBufferHandleVector& rtBufferHandles, SceneId sceneId), (override));
@@ -76,11 +81,20 @@ public:
     MOCK_METHOD(void, uploadVertexArray, (RenderableHandle renderableHandle, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId), (override));
     MOCK_METHOD(void, unloadVertexArray, (RenderableHandle renderableHandle, SceneId sceneId), (override));
     MOCK_METHOD(DeviceResourceHandle, getVertexArrayDeviceHandle, (RenderableHandle renderableHandle, SceneId sceneId), (const, override));
+    MOCK_METHOD(void, uploadRenderableBatch, (RenderableBatchHandle batchHandle, const RenderableBatchInfo& batchInfo, SceneId sceneId), (override));
+    MOCK_METHOD(void, unloadRenderableBatch, (RenderableBatchHandle batchHandle, SceneId sceneId), (override));
+    MOCK_METHOD(void, releaseGeometryDataNotNeededForBatching, (SceneId sceneId, const ResourceContentHashVector& sortedGeometryOfPendingBatches), (override));
+    MOCK_METHOD(DeviceResourceHandle, getRenderableBatchDeviceHandle, (RenderableBatchHandle batchHandle, SceneId sceneId), (const, override));
+    MOCK_METHOD(BoundingVolume, getResourceBoundingVolume, (const ResourceContentHash& resourceHash), (const, override));
 
     MOCK_METHOD(void, uploadExternalBuffer, (ExternalBufferHandle), (override));
     MOCK_METHOD(void, unloadExternalBuffer, (ExternalBufferHandle), (override));
 
     MOCK_METHOD(const StreamUsage&, getStreamUsage, (WaylandIviSurfaceId source), (const, override));
+
+private:
+    SceneIdVector m_noScenes;
+    GpuMemoryBudget m_gpuMemoryBudget{ 0u };
 };
 
 class RendererResourceManagerRefCountMock : public RendererResourceManagerMock
@@ -32,6 +32,8 @@ public:
     MOCK_METHOD(DeviceResourceHandle, getDataBufferDeviceHandle, (DataBufferHandle dataBufferHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getTextureBufferDeviceHandle, (TextureBufferHandle textureBufferHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getVertexArrayDeviceHandle, (RenderableHandle renderableHandle, SceneId sceneId), (const, override));
+    MOCK_METHOD(DeviceResourceHandle, getRenderableBatchDeviceHandle, (RenderableBatchHandle batchHandle, SceneId sceneId), (const, override));
+    MOCK_METHOD(BoundingVolume, getResourceBoundingVolume, (const ResourceContentHash& resourceHash), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getExternalBufferDeviceHandle, (ExternalBufferHandle), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getEmptyExternalBufferDeviceHandle, (), (const, override));
     MOCK_METHOD(uint32_t, getExternalBufferGlId, (ExternalBufferHandle), (const, override));
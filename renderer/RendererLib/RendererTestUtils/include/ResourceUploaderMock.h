@@ -25,6 +25,8 @@ namespace ramses_internal
         MOCK_METHOD(absl::optional<DeviceResourceHandle> , uploadResource, (IRenderBackend&, const ResourceDescriptor&, UInt32&), (override));
         MOCK_METHOD(void, unloadResource, (IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle), (override));
         MOCK_METHOD(void, storeShaderInBinaryShaderCache, (IRenderBackend&, DeviceResourceHandle, const ResourceContentHash&, SceneId), (override));
+        MOCK_METHOD(DeviceResourceHandle, uploadTextureFromMipLevel, (IRenderBackend&, const TextureResource&, UInt32, UInt32&), (override));
+        MOCK_METHOD(void, uploadTextureMipLevel, (IRenderBackend&, DeviceResourceHandle, const TextureResource&, UInt32, UInt32, UInt32), (override));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
@@ -19,7 +19,7 @@ DisplayControllerMock::DisplayControllerMock()
     ON_CALL(*this, getDisplayBuffer()).WillByDefault(Return(FakeFrameBufferHandle));
     ON_CALL(*this, getDisplayWidth()).WillByDefault(Return(WindowMock::FakeWidth));
     ON_CALL(*this, getDisplayHeight()).WillByDefault(Return(WindowMock::FakeHeight));
-    ON_CALL(*this, renderScene(_, _, _)).WillByDefault(Return(SceneRenderExecutionIterator()));
+    ON_CALL(*this, renderScene(_, _, _, _)).WillByDefault(Return(SceneRenderExecutionIterator()));
 }
 
 DisplayControllerMock::~DisplayControllerMock()
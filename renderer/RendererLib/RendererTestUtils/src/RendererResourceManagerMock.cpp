@@ -53,15 +53,21 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     ON_CALL(*this, getOffscreenBufferHandle(DeviceResourceHandle::Invalid())).WillByDefault(Return(OffscreenBufferHandle::Invalid()));
     ON_CALL(*this, getStreamBufferDeviceHandle(_)).WillByDefault(Return(DeviceMock::FakeRenderTargetDeviceHandle));
     ON_CALL(*this, getVertexArrayDeviceHandle(_, _)).WillByDefault(Return(DeviceMock::FakeVertexArrayDeviceHandle));
+    ON_CALL(*this, getRenderableBatchDeviceHandle(_, _)).WillByDefault(Return(DeviceMock::FakeVertexArrayDeviceHandle));
     ON_CALL(*this, getExternalBufferDeviceHandle(Ne(ExternalBufferHandle::Invalid()))).WillByDefault(Return(DeviceMock::FakeExternalTextureDeviceHandle));
     ON_CALL(*this, getEmptyExternalBufferDeviceHandle()).WillByDefault(Return(DeviceMock::FakeEmptyExternalTextureDeviceHandle));
 
+    ON_CALL(*this, getScenesWithStreamedTextureUpdates()).WillByDefault(ReturnRef(m_noScenes));
+    ON_CALL(*this, getGpuMemoryBudget()).WillByDefault(ReturnRef(m_gpuMemoryBudget));
+
     ON_CALL(*this, getBlitPassRenderTargetsDeviceHandle(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<2>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle), SetArgReferee<3>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle)));
 
     // no need to strictly test getters
     EXPECT_CALL(*this, getResourceDeviceHandle(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getDataBufferDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getVertexArrayDeviceHandle(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*this, getRenderableBatchDeviceHandle(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*this, getResourceBoundingVolume(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getTextureBufferDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getRenderTargetDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getRenderTargetBufferDeviceHandle(_, _)).Times(AnyNumber());
@@ -71,6 +77,9 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     EXPECT_CALL(*this, getResourcesInUseByScene(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getExternalBufferDeviceHandle(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getEmptyExternalBufferDeviceHandle()).Times(AnyNumber());
+    EXPECT_CALL(*this, getScenesWithStreamedTextureUpdates()).Times(AnyNumber());
+    EXPECT_CALL(*this, hasGpuMemoryBudgetBeenExceeded()).Times(AnyNumber());
+    EXPECT_CALL(*this, getGpuMemoryBudget()).Times(AnyNumber());
 }
 
 RendererResourceManagerRefCountMock::~RendererResourceManagerRefCountMock()
@@ -236,13 +236,19 @@ namespace ramses
         *        Uploaded resources are kept in GPU memory even if not in use by any scene anymore.
         *        They are only freed from memory in order to make space for new resources to be uploaded
         *        which would not fit in the cache otherwise.
-        *        First in first out method is used when deciding which unused resource to remove from cache.
+        *        Least recently used unused resource is removed from cache first, unless scene priorities are set
+        *        (see ramses::DisplayConfig::setScenePriority): then unused resources used only by less important scenes
+        *        are removed before those used by more important scenes.
+        *        Resources are accounted with their estimated GPU memory size, e.g. including mip levels generated on GPU.
         *
         *        Note that the cache size does not act as hard limit, the renderer can still upload
         *        resources taking up more space. As long as cache limit is exceeded, newly unused resources are unloaded
-        *        immediately.
+        *        immediately. If resources in use by scenes alone exceed cache size,
+        *        ramses::IRendererEventHandler::gpuMemoryBudgetExceeded is reported.
         *
-        *        Only client resources are considered for this cache, not scene resources (eg. render targets/render buffers).
+        *        Only client resources are considered for this cache, not scene resources (render targets, render buffers,
+        *        offscreen buffers, texture buffers, data buffers): these are neither counted against the cache size
+        *        nor included in the GPU memory usage reported per scene and per resource type in renderer statistics.
         *        Cache is disabled by default (size is 0).
         *
         * @param[in] size GPU resource cache size in bytes. Disabled if 0 (default)
@@ -548,6 +554,106 @@ namespace ramses
         */
         status_t setResourceUploadBatchSize(uint32_t batchSize);
 
+        /**
+        * @brief Sets the number of worker threads used to compute world matrices of renderables
+        *
+        * By default (0) world matrices of all renderables are updated by the render thread itself. For scenes with many
+        * animated nodes it can be beneficial to distribute this work: independent dirty subtrees of the node hierarchy
+        * are then computed in parallel by the given number of worker threads, results are identical to the serial update.
+        * Scenes which consume transformation data links are always updated by the render thread.
+        *
+        * @param[in] threadCount number of worker threads (default: 0, maximum: 64)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setTransformationUpdateThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables sorting of draw calls by their GPU states
+        *
+        * Meshes which are added to the same #ramses::RenderGroup with the same order have no defined render order
+        * relative to each other. When enabled, renderer sorts such meshes by shader, textures, vertex arrays
+        * and render states before rendering them and skips redundant texture and vertex array activations.
+        * This reduces the number of GPU state changes for scenes with many meshes sharing order within a group.
+        * Meshes whose render order matters must use different orders or render groups regardless of this option.
+        *
+        * @param[in] enabled true to enable draw call sorting (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setDrawCallSortingEnabled(bool enabled);
+
+        /**
+        * @brief Enables batching of draw calls of static meshes
+        *
+        * Meshes which are added to the same #ramses::RenderGroup with the same order, follow each other in it and share
+        * appearance, effect and transformation can be drawn together. When enabled, renderer merges geometry of such meshes
+        * into combined vertex and index buffers once they stay unchanged for several frames and draws them with single draw call.
+        * Whenever any of them changes it falls back to drawing them individually until they are stable again.
+        * Only meshes with non-instanced, non-interleaved geometry coming from array resources (not array buffers)
+        * drawn as lists of points, lines or triangles (not strips, fans or loops) are batched, render passes with
+        * frustum culling enabled are not batched. Merging counts into the scene resources upload time budget
+        * (#ramses::RamsesRenderer::setFrameTimerLimits), meshes are drawn individually until it fits into the budget.
+        * Note that vertex and index data of uploaded resources are kept in system memory when this is enabled until it is
+        * known whether the meshes using them can be batched. Meshes which become batchable only later (e.g. after their
+        * transformation changed) are not batched if their data was released meanwhile.
+        *
+        * @param[in] enabled true to enable draw call batching (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setDrawCallBatchingEnabled(bool enabled);
+
+        /**
+        * @brief Sets the number of worker threads used to decompress resources before their upload
+        *
+        * By default (0) compressed resources are decompressed by the render thread right before they are uploaded
+        * to GPU, which counts into the resource upload time budget (#ramses::RamsesRenderer::setFrameTimerLimits).
+        * When set, resources are decompressed by the given number of worker threads as soon as renderer receives them
+        * and render thread only uploads already decompressed data. A resource still being decompressed is uploaded
+        * in one of the next frames.
+        *
+        * @param[in] threadCount number of worker threads (default: 0, maximum: 64)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setResourceDecompressionThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables persistent cache of resources in the form they are uploaded to GPU in
+        *
+        * Resources which renderer receives compressed are stored decompressed in given file after their upload.
+        * The file is memory mapped when the display is created, resources found in it are used directly from there
+        * instead of decompressing the received data, e.g. on every following start of the application.
+        * Every cached resource is verified by checksum before it is used. When cache exceeds given size,
+        * least recently used resources are dropped from it.
+        * Note that renderer still receives the resources from client, cache only saves the work of preparing them for upload.
+        * Cache file must not be shared by several displays.
+        *
+        * @param[in] filePath path of the cache file, it is created if it does not exist (default: empty, cache disabled)
+        * @param[in] maxSizeInBytes maximum size of cached resources
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setResourceDiskCache(const char* filePath, uint64_t maxSizeInBytes);
+
+        /**
+        * @brief Enables streaming of mip levels of large textures
+        *
+        * By default all mip levels of a texture are uploaded at once and meshes using it are rendered only after that.
+        * When enabled, only the smallest mip levels of a large texture with provided mip chain are uploaded at first,
+        * so that the texture can be sampled at reduced resolution right away. The remaining levels are uploaded one by one
+        * from the smallest to the largest in the following frames, as long as the resource upload time budget
+        * (#ramses::RamsesRenderer::setFrameTimerLimits) is not exceeded, and scenes using the texture are re-rendered
+        * after each of them. Textures with automatically generated mip chain or single mip level are always uploaded at once.
+        * Note that texture data is kept in system memory until its last mip level is uploaded.
+        *
+        * @param[in] enabled true to enable texture streaming (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setTextureStreamingEnabled(bool enabled);
+
         /**
         * Stores internal data for implementation specifics of DisplayConfig.
         */
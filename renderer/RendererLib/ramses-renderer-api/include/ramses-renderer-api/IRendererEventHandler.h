@@ -139,6 +139,24 @@ namespace ramses
         */
         virtual void renderThreadLoopTimings(std::chrono::microseconds maximumLoopTime, std::chrono::microseconds averageLooptime) = 0;
 
+        /**
+        * @brief This method will be called when resources in use by scenes mapped to a display do not fit
+        *        in its GPU memory cache size (#ramses::DisplayConfig::setGPUMemoryCacheSize) anymore, even after all unused
+        *        resources were unloaded. It is called once when that happens, not again until usage got back within cache size.
+        *        Application can react for example by unmapping or hiding scenes which are not needed.
+        *
+        * @param[in] displayId The display on which the event occurred
+        * @param[in] usedBytes Estimated GPU memory used by client resources uploaded to the display,
+        *                      memory of scene resources (e.g. render buffers, offscreen buffers) is not included
+        * @param[in] budgetBytes GPU memory cache size of the display
+        */
+        virtual void gpuMemoryBudgetExceeded(displayId_t displayId, uint64_t usedBytes, uint64_t budgetBytes)
+        {
+            (void)displayId;
+            (void)usedBytes;
+            (void)budgetBytes;
+        }
+
 #ifdef RAMSES_ENABLE_RENDER_LOOP_TIMINGS_PER_DISPLAY
         /**
         * @brief This method will be called in period given to renderer config (#ramses::RendererConfig::setRenderThreadLoopTimingReportingPeriod)
@@ -76,6 +76,25 @@ namespace ramses
         status_t setResourceUploadBatchSize(uint32_t batchSize);
         uint32_t getResourceUploadBatchSize() const;
 
+        status_t setTransformationUpdateThreadCount(uint32_t threadCount);
+        uint32_t getTransformationUpdateThreadCount() const;
+
+        status_t setDrawCallSortingEnabled(bool enabled);
+        bool isDrawCallSortingEnabled() const;
+
+        status_t setDrawCallBatchingEnabled(bool enabled);
+        bool isDrawCallBatchingEnabled() const;
+
+        status_t setResourceDecompressionThreadCount(uint32_t threadCount);
+        uint32_t getResourceDecompressionThreadCount() const;
+
+        status_t setResourceDiskCache(const char* filePath, uint64_t maxSizeInBytes);
+        const char* getResourceDiskCacheFilePath() const;
+        uint64_t getResourceDiskCacheMaxSize() const;
+
+        status_t setTextureStreamingEnabled(bool enabled);
+        bool isTextureStreamingEnabled() const;
+
         virtual status_t validate() const override;
 
         //impl methods
@@ -95,6 +95,12 @@ namespace ramses
             m_handler2.renderThreadLoopTimings(maximumLoopTime, averageLooptime);
         }
 
+        virtual void gpuMemoryBudgetExceeded(displayId_t displayId, uint64_t usedBytes, uint64_t budgetBytes) override
+        {
+            m_handler1.gpuMemoryBudgetExceeded(displayId, usedBytes, budgetBytes);
+            m_handler2.gpuMemoryBudgetExceeded(displayId, usedBytes, budgetBytes);
+        }
+
 #ifdef RAMSES_ENABLE_EXTERNAL_BUFFER_EVENTS
         virtual void externalBufferCreated(displayId_t displayId, externalBufferId_t externalBufferId, uint32_t textureGlId, ERendererEventResult result) override
         {
@@ -259,4 +259,46 @@ namespace ramses
     {
         return impl.setResourceUploadBatchSize(batchSize);
     }
+
+    status_t DisplayConfig::setTransformationUpdateThreadCount(uint32_t threadCount)
+    {
+        const status_t status = impl.setTransformationUpdateThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    status_t DisplayConfig::setDrawCallSortingEnabled(bool enabled)
+    {
+        const status_t status = impl.setDrawCallSortingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    status_t DisplayConfig::setDrawCallBatchingEnabled(bool enabled)
+    {
+        const status_t status = impl.setDrawCallBatchingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    status_t DisplayConfig::setResourceDecompressionThreadCount(uint32_t threadCount)
+    {
+        const status_t status = impl.setResourceDecompressionThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    status_t DisplayConfig::setResourceDiskCache(const char* filePath, uint64_t maxSizeInBytes)
+    {
+        const status_t status = impl.setResourceDiskCache(filePath, maxSizeInBytes);
+        LOG_HL_RENDERER_API2(status, filePath, maxSizeInBytes);
+        return status;
+    }
+
+    status_t DisplayConfig::setTextureStreamingEnabled(bool enabled)
+    {
+        const status_t status = impl.setTextureStreamingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
 }
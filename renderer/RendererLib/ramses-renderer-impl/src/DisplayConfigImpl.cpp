@@ -312,6 +312,93 @@ namespace ramses
         return m_internalConfig.getResourceUploadBatchSize();
     }
 
+    status_t DisplayConfigImpl::setTransformationUpdateThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > 64u)
+        {
+            return addErrorEntry("DisplayConfig::setTransformationUpdateThreadCount failed - threadCount too high!");
+        }
+        m_internalConfig.setTransformationUpdateThreadCount(threadCount);
+        return StatusOK;
+    }
+
+    uint32_t DisplayConfigImpl::getTransformationUpdateThreadCount() const
+    {
+        return m_internalConfig.getTransformationUpdateThreadCount();
+    }
+
+    status_t DisplayConfigImpl::setDrawCallSortingEnabled(bool enabled)
+    {
+        m_internalConfig.setDrawCallSortingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isDrawCallSortingEnabled() const
+    {
+        return m_internalConfig.isDrawCallSortingEnabled();
+    }
+
+    status_t DisplayConfigImpl::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_internalConfig.setDrawCallBatchingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isDrawCallBatchingEnabled() const
+    {
+        return m_internalConfig.isDrawCallBatchingEnabled();
+    }
+
+    status_t DisplayConfigImpl::setResourceDecompressionThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > 64u)
+        {
+            return addErrorEntry("DisplayConfig::setResourceDecompressionThreadCount failed - threadCount too high!");
+        }
+        m_internalConfig.setResourceDecompressionThreadCount(threadCount);
+        return StatusOK;
+    }
+
+    uint32_t DisplayConfigImpl::getResourceDecompressionThreadCount() const
+    {
+        return m_internalConfig.getResourceDecompressionThreadCount();
+    }
+
+    status_t DisplayConfigImpl::setResourceDiskCache(const char* filePath, uint64_t maxSizeInBytes)
+    {
+        if (filePath == nullptr || filePath[0] == '\0')
+        {
+            return addErrorEntry("DisplayConfig::setResourceDiskCache failed - file path must not be empty!");
+        }
+        if (maxSizeInBytes == 0u)
+        {
+            return addErrorEntry("DisplayConfig::setResourceDiskCache failed - maximum size must not be 0!");
+        }
+        m_internalConfig.setResourceDiskCache(filePath, maxSizeInBytes);
+        return StatusOK;
+    }
+
+    const char* DisplayConfigImpl::getResourceDiskCacheFilePath() const
+    {
+        return m_internalConfig.getResourceDiskCacheFilePath().c_str();
+    }
+
+    uint64_t DisplayConfigImpl::getResourceDiskCacheMaxSize() const
+    {
+        return m_internalConfig.getResourceDiskCacheMaxSize();
+    }
+
+    status_t DisplayConfigImpl::setTextureStreamingEnabled(bool enabled)
+    {
+        m_internalConfig.setTextureStreamingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isTextureStreamingEnabled() const
+    {
+        return m_internalConfig.isTextureStreamingEnabled();
+    }
+
     status_t DisplayConfigImpl::validate() const
     {
         status_t status = StatusObjectImpl::validate();
@@ -642,6 +642,9 @@ namespace ramses
                 rendererEventHandler.renderThreadLoopTimingsPerDisplay(displayId_t{ event.displayHandle.asMemoryHandle() }, event.frameTimings.maximumLoopTimeWithinPeriod, event.frameTimings.averageLoopTimeWithinPeriod);
 #endif
                 break;
+            case ramses_internal::ERendererEventType::GpuMemoryBudgetExceeded:
+                rendererEventHandler.gpuMemoryBudgetExceeded(displayId_t{ event.displayHandle.asMemoryHandle() }, event.gpuMemoryUsage.usedBytes, event.gpuMemoryUsage.budgetBytes);
+                break;
             default:
                 assert(false);
                 return addErrorEntry("RamsesRenderer::dispatchEvents failed - unknown renderer event type!");
@@ -270,3 +270,66 @@ TEST_F(ADisplayConfig, canSetResourceUploadBatchSize)
     EXPECT_NE(ramses::StatusOK, config.setResourceUploadBatchSize(0));
     EXPECT_EQ(1u, config.impl.getResourceUploadBatchSize());
 }
+
+TEST_F(ADisplayConfig, canSetTransformationUpdateThreadCount)
+{
+    EXPECT_EQ(0u, config.impl.getTransformationUpdateThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setTransformationUpdateThreadCount(4u));
+    EXPECT_EQ(4u, config.impl.getTransformationUpdateThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setTransformationUpdateThreadCount(0u));
+    EXPECT_EQ(0u, config.impl.getTransformationUpdateThreadCount());
+    EXPECT_NE(ramses::StatusOK, config.setTransformationUpdateThreadCount(65u));
+    EXPECT_EQ(0u, config.impl.getTransformationUpdateThreadCount());
+}
+
+TEST_F(ADisplayConfig, canEnableDrawCallSorting)
+{
+    EXPECT_FALSE(config.impl.isDrawCallSortingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallSortingEnabled(true));
+    EXPECT_TRUE(config.impl.isDrawCallSortingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallSortingEnabled(false));
+    EXPECT_FALSE(config.impl.isDrawCallSortingEnabled());
+}
+
+TEST_F(ADisplayConfig, canEnableDrawCallBatching)
+{
+    EXPECT_FALSE(config.impl.isDrawCallBatchingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(true));
+    EXPECT_TRUE(config.impl.isDrawCallBatchingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(false));
+    EXPECT_FALSE(config.impl.isDrawCallBatchingEnabled());
+}
+
+TEST_F(ADisplayConfig, canSetResourceDecompressionThreadCount)
+{
+    EXPECT_EQ(0u, config.impl.getResourceDecompressionThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setResourceDecompressionThreadCount(2u));
+    EXPECT_EQ(2u, config.impl.getResourceDecompressionThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setResourceDecompressionThreadCount(0u));
+    EXPECT_EQ(0u, config.impl.getResourceDecompressionThreadCount());
+    EXPECT_NE(ramses::StatusOK, config.setResourceDecompressionThreadCount(65u));
+    EXPECT_EQ(0u, config.impl.getResourceDecompressionThreadCount());
+}
+
+TEST_F(ADisplayConfig, canSetResourceDiskCache)
+{
+    EXPECT_STREQ("", config.impl.getResourceDiskCacheFilePath());
+    EXPECT_EQ(ramses::StatusOK, config.setResourceDiskCache("resources.cache", 1024u));
+    EXPECT_STREQ("resources.cache", config.impl.getResourceDiskCacheFilePath());
+    EXPECT_EQ(1024u, config.impl.getResourceDiskCacheMaxSize());
+
+    EXPECT_NE(ramses::StatusOK, config.setResourceDiskCache("", 1024u));
+    EXPECT_NE(ramses::StatusOK, config.setResourceDiskCache(nullptr, 1024u));
+    EXPECT_NE(ramses::StatusOK, config.setResourceDiskCache("other.cache", 0u));
+    EXPECT_STREQ("resources.cache", config.impl.getResourceDiskCacheFilePath());
+    EXPECT_EQ(1024u, config.impl.getResourceDiskCacheMaxSize());
+}
+
+TEST_F(ADisplayConfig, canEnableTextureStreaming)
+{
+    EXPECT_FALSE(config.impl.isTextureStreamingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setTextureStreamingEnabled(true));
+    EXPECT_TRUE(config.impl.isTextureStreamingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setTextureStreamingEnabled(false));
+    EXPECT_FALSE(config.impl.isTextureStreamingEnabled());
+}
@@ -948,6 +948,9 @@ namespace ramses_internal
             if (ImGui::Button("Refresh"))
                 obj.retriggerRenderOnce();
         }
+        bool frustumCulling = obj.isFrustumCullingEnabled();
+        if (ImGui::Checkbox("FrustumCulling", &frustumCulling))
+            obj.setFrustumCullingEnabled(frustumCulling);
 
         draw(obj.getCamera()->impl);
 
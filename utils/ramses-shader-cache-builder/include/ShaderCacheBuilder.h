@@ -0,0 +1,54 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHADER_CACHE_BUILDER_SHADERCACHEBUILDER_H
+#define RAMSES_SHADER_CACHE_BUILDER_SHADERCACHEBUILDER_H
+
+#include "Utils/CommandLineParser.h"
+#include "Utils/Argument.h"
+#include "Collections/String.h"
+#include "ramses-framework-api/RamsesFrameworkConfig.h"
+#include "ramses-renderer-api/RendererConfig.h"
+#include "ramses-renderer-api/DisplayConfig.h"
+
+namespace ramses
+{
+    class Scene;
+}
+
+namespace ramses_internal
+{
+    // Compiles all effects of a scene file on the renderer and writes the resulting binary shaders to a
+    // binary shader cache file, which can be loaded by ramses::BinaryShaderCache::loadFromFile at renderer startup.
+    // Binary shaders are specific to GPU and driver, so the tool has to run on the target platform.
+    class ShaderCacheBuilder
+    {
+    public:
+        ShaderCacheBuilder(int argc, char* argv[]);
+
+        int run();
+
+    private:
+        void printUsage() const;
+        int buildCache(const String& sceneFile, const String& cacheFile);
+        static uint32_t AddRenderablesForAllEffects(ramses::Scene& scene);
+
+        CommandLineParser m_parser;
+        ArgumentBool   m_helpArgument;
+        ArgumentString m_scenePathAndFileArgument;
+        ArgumentString m_resourceFilesArgument;
+        ArgumentString m_cacheFileArgument;
+        ArgumentUInt32 m_timeoutArgument;
+
+        ramses::RamsesFrameworkConfig m_frameworkConfig;
+        ramses::RendererConfig        m_rendererConfig;
+        ramses::DisplayConfig         m_displayConfig;
+    };
+}
+
+#endif
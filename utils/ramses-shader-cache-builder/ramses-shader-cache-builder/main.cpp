@@ -0,0 +1,15 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ShaderCacheBuilder.h"
+
+int main(int argc, char* argv[])
+{
+    ramses_internal::ShaderCacheBuilder shaderCacheBuilder(argc, argv);
+    return shaderCacheBuilder.run();
+}
@@ -0,0 +1,297 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ShaderCacheBuilder.h"
+
+#include "ramses-client.h"
+#include "ramses-client-api/ResourceDataPool.h"
+#include "ramses-hmi-utils.h"
+
+#include "ramses-renderer-api/RamsesRenderer.h"
+#include "ramses-renderer-api/RendererSceneControl.h"
+#include "ramses-renderer-api/BinaryShaderCache.h"
+#include "ramses-renderer-api/IRendererEventHandler.h"
+#include "ramses-renderer-api/IRendererSceneControlEventHandler.h"
+#include "ramses-framework-api/RamsesFramework.h"
+
+#include "RendererLib/RendererConfigUtils.h"
+#include "Utils/LogMacros.h"
+#include "Utils/RamsesLogger.h"
+#include "Utils/StringUtils.h"
+#include "Utils/File.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        const int ErrorUsage        = 1;
+        const int ErrorClient       = 2;
+        const int ErrorRenderer     = 3;
+        const int ErrorScene        = 4;
+        const int ErrorDisplay      = 5;
+        const int ErrorNotSupported = 6;
+        const int ErrorUpload       = 7;
+
+        // counts what the renderer reports to the cache, so the tool can tell if anything was compiled at all
+        class CountingBinaryShaderCache : public ramses::BinaryShaderCache
+        {
+        public:
+            virtual void deviceSupportsBinaryShaderFormats(const ramses::binaryShaderFormatId_t* supportedFormats, uint32_t numSupportedFormats) override
+            {
+                BinaryShaderCache::deviceSupportsBinaryShaderFormats(supportedFormats, numSupportedFormats);
+                m_numSupportedFormats = numSupportedFormats;
+            }
+
+            virtual void storeBinaryShader(ramses::effectId_t effectId, ramses::sceneId_t sceneId, const uint8_t* binaryShaderData, uint32_t binaryShaderDataSize, ramses::binaryShaderFormatId_t binaryShaderFormat) override
+            {
+                BinaryShaderCache::storeBinaryShader(effectId, sceneId, binaryShaderData, binaryShaderDataSize, binaryShaderFormat);
+                ++m_numStoredShaders;
+            }
+
+            uint32_t getNumSupportedFormats() const
+            {
+                return m_numSupportedFormats;
+            }
+
+            uint32_t getNumStoredShaders() const
+            {
+                return m_numStoredShaders;
+            }
+
+        private:
+            std::atomic<uint32_t> m_numSupportedFormats{ 0u };
+            std::atomic<uint32_t> m_numStoredShaders{ 0u };
+        };
+
+        class RendererEventWaiter : public ramses::RendererEventHandlerEmpty, public ramses::RendererSceneControlEventHandlerEmpty
+        {
+        public:
+            RendererEventWaiter(ramses::RamsesRenderer& renderer, std::chrono::seconds timeout)
+                : m_renderer(renderer)
+                , m_timeout(timeout)
+            {
+            }
+
+            virtual void displayCreated(ramses::displayId_t displayId, ramses::ERendererEventResult result) override
+            {
+                if (result == ramses::ERendererEventResult_OK)
+                    m_displays.insert(displayId);
+            }
+
+            virtual void sceneStateChanged(ramses::sceneId_t sceneId, ramses::RendererSceneState state) override
+            {
+                m_sceneStates[sceneId] = state;
+            }
+
+            bool waitForDisplay(ramses::displayId_t displayId)
+            {
+                return waitUntil([&] { return m_displays.count(displayId) > 0; });
+            }
+
+            bool waitForSceneState(ramses::sceneId_t sceneId, ramses::RendererSceneState state)
+            {
+                return waitUntil([&] { return m_sceneStates[sceneId] == state; });
+            }
+
+        private:
+            bool waitUntil(const std::function<bool()>& conditionFunction)
+            {
+                const auto timeoutTS = std::chrono::steady_clock::now() + m_timeout;
+                while (!conditionFunction() && std::chrono::steady_clock::now() < timeoutTS)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+                    m_renderer.dispatchEvents(*this);
+                    m_renderer.getSceneControlAPI()->dispatchEvents(*this);
+                }
+
+                return conditionFunction();
+            }
+
+            ramses::RamsesRenderer& m_renderer;
+            const std::chrono::seconds m_timeout;
+            std::unordered_set<ramses::displayId_t> m_displays;
+            std::unordered_map<ramses::sceneId_t, ramses::RendererSceneState> m_sceneStates;
+        };
+    }
+
+    ShaderCacheBuilder::ShaderCacheBuilder(int argc, char* argv[])
+        : m_parser(argc, argv)
+        , m_helpArgument(m_parser, "help", "help", "Print this help")
+        , m_scenePathAndFileArgument(m_parser, "s", "scene", String(), "Scene path+file")
+        , m_resourceFilesArgument(m_parser, "r", "resource-files", String(), "Comma separated list of resource files used by the scene")
+        , m_cacheFileArgument(m_parser, "c", "cache-file", String(), "Binary shader cache file to write, extended if it exists already")
+        , m_timeoutArgument(m_parser, "t", "timeout", 60u, "Seconds to wait for the renderer to upload all effects")
+        , m_frameworkConfig(argc, argv)
+        , m_rendererConfig(argc, argv)
+        , m_displayConfig(argc, argv)
+    {
+        GetRamsesLogger().initialize(m_parser, String(), String(), false, true);
+        m_frameworkConfig.setPeriodicLogsEnabled(false);
+    }
+
+    int ShaderCacheBuilder::run()
+    {
+        if (m_helpArgument)
+        {
+            printUsage();
+            return 0;
+        }
+
+        String scenePathAndFile = m_scenePathAndFileArgument;
+        const String cacheFile = m_cacheFileArgument;
+        if (scenePathAndFile.empty() || cacheFile.empty())
+        {
+            LOG_ERROR(CONTEXT_CLIENT,
+                      "A scene file and a cache file including path have to be specified by options "
+                      << m_scenePathAndFileArgument.getHelpString() << m_cacheFileArgument.getHelpString());
+            return ErrorUsage;
+        }
+
+        if (!File(scenePathAndFile).exists())
+        {
+            // try with extension
+            scenePathAndFile += ".ramses";
+        }
+
+        return buildCache(scenePathAndFile, cacheFile);
+    }
+
+    void ShaderCacheBuilder::printUsage() const
+    {
+        const std::string argumentHelpString = m_helpArgument.getHelpString() + m_scenePathAndFileArgument.getHelpString() + m_resourceFilesArgument.getHelpString() +
+            m_cacheFileArgument.getHelpString() + m_timeoutArgument.getHelpString();
+        const String& programName = m_parser.getProgramName();
+        LOG_INFO(CONTEXT_CLIENT,
+                "\nUsage: " << programName << " [options] -s <sceneFileName> -c <cacheFileName>\n"
+                "Compiles all effects of the RAMSES scene <sceneFileName> on this device and stores the binary shaders in <cacheFileName>\n"
+                "Arguments:\n" << argumentHelpString);
+
+        ramses_internal::RendererConfigUtils::PrintCommandLineOptions();
+    }
+
+    int ShaderCacheBuilder::buildCache(const String& sceneFile, const String& cacheFile)
+    {
+        CountingBinaryShaderCache binaryShaderCache;
+        if (File(cacheFile).exists() && !binaryShaderCache.loadFromFile(cacheFile.c_str()))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "Existing cache file could not be loaded and will be overwritten: " << cacheFile);
+        }
+        m_rendererConfig.setBinaryShaderCache(binaryShaderCache);
+
+        ramses::RamsesFramework framework(m_frameworkConfig);
+        auto client = framework.createClient("ramses-shader-cache-builder");
+        if (!client)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Creation of client failed");
+            return ErrorClient;
+        }
+
+        auto renderer = framework.createRenderer(m_rendererConfig);
+        if (!renderer)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Creation of renderer failed");
+            return ErrorRenderer;
+        }
+        renderer->startThread();
+        framework.connect();
+
+        const String resourceFiles = m_resourceFilesArgument;
+        for (const auto& resourceFile : StringUtils::Tokenize(resourceFiles, ','))
+        {
+            if (!ramses::RamsesHMIUtils::GetResourceDataPoolForClient(*client).addResourceDataFile(resourceFile.stdRef()))
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "Adding resource file failed: " << resourceFile);
+                return ErrorScene;
+            }
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "Load scene:" << sceneFile);
+        auto scene = client->loadSceneFromFile(sceneFile.c_str());
+        if (scene == nullptr)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Loading scene failed!");
+            return ErrorScene;
+        }
+
+        const uint32_t numEffects = AddRenderablesForAllEffects(*scene);
+        scene->publish();
+        scene->flush();
+
+        RendererEventWaiter eventWaiter(*renderer, std::chrono::seconds{ static_cast<UInt32>(m_timeoutArgument) });
+        const ramses::displayId_t displayId = renderer->createDisplay(m_displayConfig);
+        renderer->flush();
+        if (!eventWaiter.waitForDisplay(displayId))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Display creation failed");
+            return ErrorDisplay;
+        }
+
+        if (binaryShaderCache.getNumSupportedFormats() == 0u)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Device does not support binary shaders, no cache can be built");
+            return ErrorNotSupported;
+        }
+
+        // ready state requires all resources used by the scene to be uploaded, compiled effects are stored to cache right after upload
+        auto sceneControl = renderer->getSceneControlAPI();
+        sceneControl->setSceneMapping(scene->getSceneId(), displayId);
+        sceneControl->setSceneState(scene->getSceneId(), ramses::RendererSceneState::Ready);
+        sceneControl->flush();
+        if (!eventWaiter.waitForSceneState(scene->getSceneId(), ramses::RendererSceneState::Ready))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Scene did not get ready within timeout, not all effects could be uploaded");
+            return ErrorUpload;
+        }
+
+        sceneControl->setSceneState(scene->getSceneId(), ramses::RendererSceneState::Available);
+        sceneControl->flush();
+        eventWaiter.waitForSceneState(scene->getSceneId(), ramses::RendererSceneState::Available);
+
+        binaryShaderCache.saveToFile(cacheFile.c_str());
+        LOG_INFO(CONTEXT_CLIENT, "Stored " << binaryShaderCache.getNumStoredShaders() << " binary shaders for " << numEffects << " effects to " << cacheFile);
+
+        return 0;
+    }
+
+    uint32_t ShaderCacheBuilder::AddRenderablesForAllEffects(ramses::Scene& scene)
+    {
+        // renderer only uploads effects used by renderables which are not switched off,
+        // invisible mesh nodes make it upload every effect of the scene without drawing anything,
+        // their geometry bindings stay empty so the renderables never get their vertex data resolved on renderer,
+        // this does not delay ready state which only waits for the resources used by scene to be uploaded
+        std::vector<const ramses::Effect*> effects;
+        ramses::SceneObjectIterator it(scene, ramses::ERamsesObjectType_Effect);
+        while (const auto* effect = static_cast<const ramses::Effect*>(it.getNext()))
+            effects.push_back(effect);
+
+        for (const auto* effect : effects)
+        {
+            auto appearance = scene.createAppearance(*effect);
+            auto geometryBinding = scene.createGeometryBinding(*effect);
+            auto meshNode = scene.createMeshNode();
+            if (!appearance || !geometryBinding || !meshNode)
+            {
+                LOG_WARN(CONTEXT_CLIENT, "Failed to create renderable for effect " << effect->getName());
+                continue;
+            }
+            meshNode->setAppearance(*appearance);
+            meshNode->setGeometryBinding(*geometryBinding);
+            meshNode->setVisibility(ramses::EVisibilityMode::Invisible);
+        }
+
+        return static_cast<uint32_t>(effects.size());
+    }
+}
@@ -0,0 +1,149 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "ShaderCacheBuilder.h"
+#include "ramses-framework-api/RamsesFramework.h"
+#include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/Scene.h"
+#include "ramses-client-api/Effect.h"
+#include "ramses-client-api/EffectDescription.h"
+#include "ramses-renderer-api/BinaryShaderCache.h"
+#include "Utils/File.h"
+
+// This is needed to abstract from a specific rendering platform
+#include "PlatformMock.h"
+#include "Platform_Base/Platform_Base.h"
+
+#include <string>
+#include <vector>
+
+namespace ramses_internal
+{
+    using namespace testing;
+
+    namespace
+    {
+        bool gDeviceSupportsBinaryShaders = true;
+    }
+
+    // replace platform with mock via overriding static factory helper, device delivers fake binary shaders
+    IPlatform* Platform_Base::CreatePlatform(const RendererConfig&)
+    {
+        auto platform = new NiceMock<PlatformNiceMock>();
+        auto& device = platform->renderBackendMock.deviceMock;
+        if (gDeviceSupportsBinaryShaders)
+        {
+            ON_CALL(device, getBinaryShader(_, _, _)).WillByDefault(DoAll(
+                SetArgReferee<1>(UInt8Vector{ 1u, 2u, 3u }),
+                SetArgReferee<2>(DeviceMock::FakeSupportedBinaryShaderFormat),
+                Return(true)));
+        }
+        else
+        {
+            ON_CALL(device, getSupportedBinaryProgramFormats(_)).WillByDefault(Invoke([](auto& formats) { formats.clear(); }));
+        }
+
+        return platform;
+    }
+
+    class AShaderCacheBuilder : public Test
+    {
+    public:
+        AShaderCacheBuilder()
+        {
+            gDeviceSupportsBinaryShaders = true;
+            File(CacheFile).remove();
+        }
+
+        virtual ~AShaderCacheBuilder() override
+        {
+            File(SceneFile).remove();
+            File(CacheFile).remove();
+        }
+
+    protected:
+        // effects are not used by any mesh in scene, builder has to make renderer upload them nevertheless
+        void saveSceneWithEffects()
+        {
+            ramses::RamsesFramework framework;
+            ramses::RamsesClient& client = *framework.createClient("client");
+            ramses::Scene& scene = *client.createScene(ramses::sceneId_t{ 123u });
+
+            ramses::EffectDescription effectWithAttribute;
+            effectWithAttribute.setVertexShader("#version 100\nattribute vec3 a_position;\nvoid main(void) { gl_Position = vec4(a_position, 1.0); }");
+            effectWithAttribute.setFragmentShader("#version 100\nvoid main(void) { gl_FragColor = vec4(1.0); }");
+            const ramses::Effect* effect1 = scene.createEffect(effectWithAttribute);
+            ASSERT_NE(nullptr, effect1);
+
+            ramses::EffectDescription effectWithoutAttribute;
+            effectWithoutAttribute.setVertexShader("#version 100\nvoid main(void) { gl_Position = vec4(0.0); }");
+            effectWithoutAttribute.setFragmentShader("#version 100\nvoid main(void) { gl_FragColor = vec4(0.5); }");
+            const ramses::Effect* effect2 = scene.createEffect(effectWithoutAttribute);
+            ASSERT_NE(nullptr, effect2);
+
+            m_effectIds = { effect1->getResourceId(), effect2->getResourceId() };
+            ASSERT_EQ(ramses::StatusOK, scene.saveToFile(SceneFile, false));
+        }
+
+        int runBuilder(std::vector<std::string> args)
+        {
+            args.insert(args.begin(), "ramses-shader-cache-builder");
+            std::vector<char*> argv;
+            for (auto& arg : args)
+                argv.push_back(&arg[0]);
+
+            ShaderCacheBuilder builder(static_cast<int>(argv.size()), argv.data());
+            return builder.run();
+        }
+
+        static constexpr const char* SceneFile = "shaderCacheBuilderTest.ramses";
+        static constexpr const char* CacheFile = "shaderCacheBuilderTest.cache";
+        std::vector<ramses::resourceId_t> m_effectIds;
+    };
+
+    constexpr const char* AShaderCacheBuilder::SceneFile;
+    constexpr const char* AShaderCacheBuilder::CacheFile;
+
+    TEST_F(AShaderCacheBuilder, storesBinaryShadersOfAllEffectsInScene)
+    {
+        saveSceneWithEffects();
+        EXPECT_EQ(0, runBuilder({ "-s", SceneFile, "-c", CacheFile, "-t", "10" }));
+
+        ramses::BinaryShaderCache cache;
+        ASSERT_TRUE(cache.loadFromFile(CacheFile));
+        for (const auto& effectId : m_effectIds)
+        {
+            const ramses::effectId_t id{ effectId.lowPart, effectId.highPart };
+            EXPECT_TRUE(cache.hasBinaryShader(id));
+            EXPECT_EQ(3u, cache.getBinaryShaderSize(id));
+            EXPECT_EQ(DeviceMock::FakeSupportedBinaryShaderFormat.getValue(), cache.getBinaryShaderFormat(id).getValue());
+        }
+    }
+
+    TEST_F(AShaderCacheBuilder, failsWithoutSceneOrCacheFile)
+    {
+        EXPECT_NE(0, runBuilder({ "-s", SceneFile }));
+        EXPECT_NE(0, runBuilder({ "-c", CacheFile }));
+        EXPECT_FALSE(File(CacheFile).exists());
+    }
+
+    TEST_F(AShaderCacheBuilder, failsIfSceneFileCannotBeLoaded)
+    {
+        EXPECT_NE(0, runBuilder({ "-s", "this_file_should_really_not_exist.ramses", "-c", CacheFile, "-t", "10" }));
+        EXPECT_FALSE(File(CacheFile).exists());
+    }
+
+    TEST_F(AShaderCacheBuilder, failsIfDeviceDoesNotSupportBinaryShaders)
+    {
+        saveSceneWithEffects();
+        gDeviceSupportsBinaryShaders = false;
+        EXPECT_NE(0, runBuilder({ "-s", SceneFile, "-c", CacheFile, "-t", "10" }));
+        EXPECT_FALSE(File(CacheFile).exists());
+    }
+}
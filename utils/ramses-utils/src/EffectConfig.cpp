@@ -297,6 +297,7 @@ void EffectConfig::initAttributeSemanticNameTable()
 {
     m_attributeSemanticNameTable.put("EEffectAttributeSemantic_TextPositions", ramses::EEffectAttributeSemantic::TextPositions);
     m_attributeSemanticNameTable.put("EEffectAttributeSemantic_TextTextureCoordinates", ramses::EEffectAttributeSemantic::TextTextureCoordinates);
+    m_attributeSemanticNameTable.put("EEffectAttributeSemantic_VertexPositions", ramses::EEffectAttributeSemantic::VertexPositions);
 }
 
 void EffectConfig::clear()